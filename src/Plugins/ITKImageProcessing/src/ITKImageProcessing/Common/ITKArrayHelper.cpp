@@ -1,11 +1,18 @@
 #include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 
 #include "simplnx/Common/TypesUtility.hpp"
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Core/Preferences.hpp"
 
 #include <fmt/ranges.h>
 
 using namespace nx::core;
 
+namespace
+{
+constexpr StringLiteral k_PluginName = "ITKImageProcessing";
+} // namespace
+
 DataType ITK::detail::ConvertChoiceToDataType(types::usize choice)
 {
   switch(choice)
@@ -72,3 +79,14 @@ Result<> ITK::CheckImageType(const std::vector<DataType>& types, const DataStruc
 
   return {};
 }
+
+uint64 ITK::GetStreamingMemoryBudget()
+{
+  Preferences* preferences = Application::GetOrCreateInstance()->getPreferences();
+  const nlohmann::json budget = preferences->pluginValue(k_PluginName.str(), Constants::k_StreamingMemoryBudget_Key.str());
+  if(budget.is_number_unsigned() && budget.get<uint64>() > 0)
+  {
+    return budget.get<uint64>();
+  }
+  return preferences->largeDataStructureSize();
+}
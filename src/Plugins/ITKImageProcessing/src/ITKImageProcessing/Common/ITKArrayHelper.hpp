@@ -1,21 +1,26 @@
 #pragma once
 
+#include "ITKImageProcessing/Common/ITKDataStoreImageSource.hpp"
 #include "ITKImageProcessing/Common/ITKDream3DFilterInterruption.hpp"
 #include "ITKImageProcessing/Common/ITKProgressObserver.hpp"
 
 #include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/StringLiteral.hpp"
 #include "simplnx/Common/Types.hpp"
 #include "simplnx/Common/TypesUtility.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/IDataStore.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Output.hpp"
+#include "simplnx/Utilities/DataArrayUtilities.hpp"
 
 #include <itkCastImageFilter.h>
 #include <itkImage.h>
 #include <itkImageIOBase.h>
+#include <itkImageRegionConstIterator.h>
 #include <itkImportImageFilter.h>
 #include <itkNumericTraits.h>
 #include <itkVector.h>
@@ -23,6 +28,10 @@
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <atomic>
 #include <stdexcept>
 #include <type_traits>
 #include <vector>
@@ -151,9 +160,21 @@ namespace Constants
 {
 inline constexpr int32 k_ImageGeometryDimensionMismatch = -2000;
 inline constexpr int32 k_ImageComponentDimensionMismatch = -2001;
+inline constexpr int32 k_StreamingMemoryBudgetTooSmall = -2002;
+inline constexpr int32 k_StreamingRegionMismatch = -2003;
+inline constexpr int32 k_StreamingNotSupported = -9999;
 
+// Plugin preference holding the number of bytes a streamed ITK filter may use. 0 uses the large DataStructure size.
+inline constexpr StringLiteral k_StreamingMemoryBudget_Key = "streaming_memory_budget";
 } // namespace Constants
 
+/**
+ * @brief Returns the number of bytes a filter that is executed slab by slab (see StreamImageSlabs()) may hold in memory.
+ * This is the "streaming_memory_budget" preference of the plugin or, while that is 0, the large DataStructure size.
+ * @return uint64
+ */
+uint64 GetStreamingMemoryBudget();
+
 /**
  * @brief Compares the total number of cells of the image geometry and the total number of tuples from the data store
  * @param dataStore
@@ -383,6 +404,149 @@ DataStore<UnderlyingType_t<PixelT>> ConvertImageToDataStore(itk::Image<PixelT, D
   return dataStore;
 }
 
+/**
+ * @brief Creates an image source that reads the requested slabs of the image from the data store instead of wrapping
+ * the whole store in an image.
+ * @tparam PixelT
+ * @tparam Dimensions
+ * @param dataStore
+ * @param imageGeom
+ * @return typename itk::DataStoreImageSource<itk::Image<PixelT, Dimensions>>::Pointer
+ */
+template <class PixelT, uint32 Dimensions>
+typename itk::DataStoreImageSource<itk::Image<PixelT, Dimensions>>::Pointer CreateDataStoreImageSource(const AbstractDataStore<UnderlyingType_t<PixelT>>& dataStore, const ImageGeomData& imageGeom)
+{
+  using SourceType = itk::DataStoreImageSource<itk::Image<PixelT, Dimensions>>;
+
+  typename SourceType::RegionType imageRegion{};
+  typename SourceType::SpacingType imageSpacing{};
+  typename SourceType::PointType imageOrigin{};
+  for(uint32 i = 0; i < Dimensions; i++)
+  {
+    imageRegion.SetSize(i, imageGeom.dims[i]);
+    imageSpacing[i] = imageGeom.spacing[i];
+    imageOrigin[i] = imageGeom.origin[i];
+  }
+
+  auto source = SourceType::New();
+  source->SetDataStore(&dataStore);
+  source->SetRegion(imageRegion);
+  source->SetSpacing(imageSpacing);
+  source->SetOrigin(imageOrigin);
+  return source;
+}
+
+/**
+ * @brief Updates the pipeline that produces outputImage one slab of slices along the slowest dimension at a time and
+ * writes every slab to the output store before the next one is computed.
+ *
+ * The pipeline has to start at an image source that only reads what is requested (see CreateDataStoreImageSource()),
+ * so for every slab only the slab plus the kernel radius the filters need around it is read. The number of slices per
+ * slab is chosen so that the input slab with its halo, one intermediate image of the same extent and the output slab
+ * fit into the memory budget. When a single output slice already needs the whole input (e.g. a filter that measures
+ * the whole image), the image is processed as one slab, so every filter is executed once. This only works if the whole
+ * image fits into the budget.
+ * @param sourceImage The output of the image source at the start of the pipeline
+ * @param outputImage The output of the last filter of the pipeline
+ * @param outputStore
+ * @param memoryBudget Number of bytes the pipeline may hold in memory
+ * @param shouldCancel
+ * @return Result<>
+ */
+template <class InputImageT, class OutputPixelT, uint32 Dimension>
+Result<> StreamImageSlabs(InputImageT& sourceImage, itk::Image<OutputPixelT, Dimension>& outputImage, AbstractDataStore<UnderlyingType_t<OutputPixelT>>& outputStore, uint64 memoryBudget,
+                          const std::atomic_bool& shouldCancel)
+{
+  using OutputImageType = itk::Image<OutputPixelT, Dimension>;
+  using RegionType = typename OutputImageType::RegionType;
+  using InputValueType = UnderlyingType_t<typename InputImageT::PixelType>;
+  using OutputValueType = UnderlyingType_t<OutputPixelT>;
+
+  constexpr uint32 k_SlabDimension = Dimension - 1;
+
+  outputImage.UpdateOutputInformation();
+  const RegionType largestRegion = outputImage.GetLargestPossibleRegion();
+  if(largestRegion != sourceImage.GetLargestPossibleRegion())
+  {
+    return MakeErrorResult(Constants::k_StreamingRegionMismatch, "The ITK filter changes the size of the image, so it can not be executed one slab at a time.");
+  }
+
+  const usize numSlices = largestRegion.GetSize(k_SlabDimension);
+  if(numSlices == 0)
+  {
+    return {};
+  }
+  const usize sliceTuples = largestRegion.GetNumberOfPixels() / numSlices;
+  const usize numOutputComponents = itk::NumericTraits<OutputPixelT>::GetLength();
+  const uint64 inputSliceBytes = sliceTuples * itk::NumericTraits<typename InputImageT::PixelType>::GetLength() * sizeof(InputValueType);
+  const uint64 outputSliceBytes = sliceTuples * numOutputComponents * sizeof(OutputValueType);
+
+  auto slabRegion = [&largestRegion](usize firstSlice, usize numSlabSlices) {
+    RegionType region = largestRegion;
+    region.SetIndex(k_SlabDimension, largestRegion.GetIndex(k_SlabDimension) + static_cast<itk::IndexValueType>(firstSlice));
+    region.SetSize(k_SlabDimension, numSlabSlices);
+    return region;
+  };
+
+  // The number of input slices the pipeline requests for a single output slice gives the kernel radius of the filters
+  outputImage.SetRequestedRegion(slabRegion(numSlices / 2, 1));
+  outputImage.PropagateRequestedRegion();
+  const usize haloSlices = sourceImage.GetRequestedRegion().GetSize(k_SlabDimension) - 1;
+
+  const uint64 minimumBytes = (1 + haloSlices) * (inputSliceBytes + outputSliceBytes) + outputSliceBytes;
+  if(memoryBudget < minimumBytes)
+  {
+    return MakeErrorResult(Constants::k_StreamingMemoryBudgetTooSmall,
+                           fmt::format("The ITK streaming memory budget of {} bytes is too small for this filter. One slice of the image and the {} slices the filter needs around it take about {} bytes.",
+                                       memoryBudget, haloSlices, minimumBytes));
+  }
+  // The filters upstream of the output do not keep their results, so a pipeline that needs the whole input for one
+  // slice would recompute the whole image for every slab
+  const bool needsWholeInput = haloSlices + 1 >= numSlices;
+  const usize slabSlices = needsWholeInput ? numSlices : std::min<usize>(numSlices, 1 + (memoryBudget - minimumBytes) / (inputSliceBytes + 2 * outputSliceBytes));
+
+  std::vector<OutputValueType> slabBuffer;
+  for(usize firstSlice = 0; firstSlice < numSlices; firstSlice += slabSlices)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    const usize numSlabSlices = std::min(slabSlices, numSlices - firstSlice);
+    const RegionType region = slabRegion(firstSlice, numSlabSlices);
+    outputImage.SetRequestedRegion(region);
+    outputImage.Update();
+
+    const usize valueStart = firstSlice * sliceTuples * numOutputComponents;
+    const usize numValues = region.GetNumberOfPixels() * numOutputComponents;
+    Result<> writeResult;
+    if(outputImage.GetBufferedRegion() == region)
+    {
+      writeResult = outputStore.copyFromBuffer(valueStart, nonstd::span<const OutputValueType>(reinterpret_cast<const OutputValueType*>(outputImage.GetBufferPointer()), numValues));
+    }
+    else
+    {
+      // The filter computed more than the slab (e.g. the whole image), so the slab is copied out of its output
+      slabBuffer.resize(numValues);
+      auto* slabPixels = reinterpret_cast<OutputPixelT*>(slabBuffer.data());
+      itk::ImageRegionConstIterator<OutputImageType> iter(&outputImage, region);
+      for(iter.GoToBegin(); !iter.IsAtEnd(); ++iter)
+      {
+        *slabPixels = iter.Get();
+        ++slabPixels;
+      }
+      writeResult = outputStore.copyFromBuffer(valueStart, nonstd::span<const OutputValueType>(slabBuffer.data(), numValues));
+    }
+    if(writeResult.invalid())
+    {
+      return writeResult;
+    }
+  }
+
+  return {};
+}
+
 // clang-format off
 template <typename T>
 concept NotBoolT = !std::is_same_v<T, bool>;
@@ -625,7 +789,13 @@ Result<OutputActions> DataCheckImpl(const DataStructure& dataStructure, const Da
   std::vector<usize> tDims(std::make_reverse_iterator(imageDims.end()), std::make_reverse_iterator(imageDims.begin()));
   std::vector<usize> outputPixelDims = ITK::GetComponentDimensions<OutputPixelT>();
 
-  outputActions.appendAction(std::make_unique<CreateArrayAction>(outputType, tDims, outputPixelDims, outputArrayPath, dataStore.getDataFormat()));
+  // Stores that compute their values (e.g. a virtual mosaic) can not be created, so the output uses the default format
+  std::string dataFormat = dataStore.getDataFormat();
+  if(!dataFormat.empty() && !GetIOCollection()->hasDataStoreCreationFunction(dataFormat))
+  {
+    dataFormat.clear();
+  }
+  outputActions.appendAction(std::make_unique<CreateArrayAction>(outputType, tDims, outputPixelDims, outputArrayPath, dataFormat));
 
   return {std::move(outputActions)};
 }
@@ -684,6 +854,24 @@ using HasInterMediateTypeHelper_t = typename HasIntermediateTypeHelper<T>::type;
 template <class T>
 inline constexpr bool HasIntermediateType_v = !std::is_same_v<HasInterMediateTypeHelper_t<T>, void>;
 
+/**
+ * @brief Filter creation functors opt into slab by slab execution of out-of-core arrays with
+ * "static constexpr bool k_Streamable = true;". Only filters that need a fixed neighborhood around each output pixel
+ * should do so; all other filters are rejected for out-of-core arrays.
+ */
+template <class T, class = void>
+struct IsStreamableHelper : std::false_type
+{
+};
+
+template <class T>
+struct IsStreamableHelper<T, std::void_t<decltype(T::k_Streamable)>> : std::bool_constant<T::k_Streamable>
+{
+};
+
+template <class T>
+inline constexpr bool IsStreamable_v = IsStreamableHelper<T>::value;
+
 template <class InputT, class OutputT, uint32 Dimension>
 struct ITKFilterFunctor
 {
@@ -786,6 +974,65 @@ struct ITKFilterFunctor
   }
 };
 
+/**
+ * @brief Executes the filter slab by slab for stores that are not held in memory. The input is read from the store by
+ * a DataStoreImageSource and the output slabs are written straight to the output store.
+ */
+template <class InputT, class OutputT, uint32 Dimension>
+struct ITKStreamedFilterFunctor
+{
+  template <class FilterCreationFunctorT>
+  Result<> operator()(const IDataStore& inputDataStore, const ImageGeom& imageGeom, IDataStore& outputDataStore, uint64 memoryBudget, const std::atomic_bool& shouldCancel,
+                      const itk::ProgressObserver::Pointer progressObserver, const FilterCreationFunctorT& filterCreationFunctor) const
+  {
+    using InputImageType = itk::Image<InputT, Dimension>;
+    using OutputImageType = itk::Image<OutputT, Dimension>;
+
+    const auto& typedInputDataStore = dynamic_cast<const AbstractDataStore<ITK::UnderlyingType_t<InputT>>&>(inputDataStore);
+    auto& typedOutputDataStore = dynamic_cast<AbstractDataStore<ITK::UnderlyingType_t<OutputT>>&>(outputDataStore);
+
+    auto source = ITK::CreateDataStoreImageSource<InputT, Dimension>(typedInputDataStore, imageGeom);
+    source->ReleaseDataFlagOn();
+
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New(shouldCancel);
+
+    if constexpr(HasIntermediateType_v<FilterCreationFunctorT>)
+    {
+      using IntermediateImageType = itk::Image<IntermediateType_t<FilterCreationFunctorT>, Dimension>;
+
+      auto castImageToIntermediateFilter = itk::CastImageFilter<InputImageType, IntermediateImageType>::New();
+      castImageToIntermediateFilter->SetInput(source->GetOutput());
+      castImageToIntermediateFilter->ReleaseDataFlagOn();
+
+      auto filter = filterCreationFunctor.template createFilter<IntermediateImageType, IntermediateImageType, Dimension>();
+      if(progressObserver != nullptr)
+      {
+        filter->AddObserver(itk::ProgressEvent(), progressObserver);
+      }
+      filter->AddObserver(itk::ProgressEvent(), interruption);
+      filter->SetInput(castImageToIntermediateFilter->GetOutput());
+      filter->ReleaseDataFlagOn();
+
+      auto castImageFromIntermediateFilter = itk::CastImageFilter<IntermediateImageType, OutputImageType>::New();
+      castImageFromIntermediateFilter->SetInput(filter->GetOutput());
+
+      return ITK::StreamImageSlabs(*source->GetOutput(), *castImageFromIntermediateFilter->GetOutput(), typedOutputDataStore, memoryBudget, shouldCancel);
+    }
+    else
+    {
+      auto filter = filterCreationFunctor.template createFilter<InputImageType, OutputImageType, Dimension>();
+      if(progressObserver != nullptr)
+      {
+        filter->AddObserver(itk::ProgressEvent(), progressObserver);
+      }
+      filter->AddObserver(itk::ProgressEvent(), interruption);
+      filter->SetInput(source->GetOutput());
+
+      return ITK::StreamImageSlabs(*source->GetOutput(), *filter->GetOutput(), typedOutputDataStore, memoryBudget, shouldCancel);
+    }
+  }
+};
+
 template <class OutputT, class DefaultOutputT>
 using TrueOutputT = std::conditional_t<std::is_same_v<OutputT, void>, DefaultOutputT, OutputT>;
 
@@ -904,9 +1151,26 @@ Result<detail::ITKFilterFunctorResult_t<FilterCreationFunctorT>> Execute(DataStr
 
   using ResultT = detail::ITKFilterFunctorResult_t<FilterCreationFunctorT>;
 
-  if(inputArray.getDataFormat() != "")
+  // Arrays that are not held in memory are run through the filter one slab at a time
+  if(inputArray.getDataFormat() != "" || outputArray.getDataFormat() != "")
   {
-    return MakeErrorResult(-9999, fmt::format("Input Array '{}' utilizes out-of-core data. This is not supported within ITK filters.", inputArrayPath.toString()));
+    if constexpr(!detail::IsStreamable_v<std::decay_t<FilterCreationFunctorT>>)
+    {
+      return MakeErrorResult<ResultT>(Constants::k_StreamingNotSupported,
+                                      fmt::format("Input Array '{}' utilizes out-of-core data. This is not supported by this ITK filter because it can not be executed one slab at a time.",
+                                                  inputArrayPath.toString()));
+    }
+    else
+    {
+      try
+      {
+        return ArraySwitchFunc<detail::ITKStreamedFilterFunctor, ArrayOptionsT, ResultT, OutputT>(inputDataStore, imageGeom, -1, inputDataStore, imageGeom, outputDataStore, GetStreamingMemoryBudget(),
+                                                                                                  shouldCancel, progressObserver, filterCreationFunctor);
+      } catch(const itk::ExceptionObject& exception)
+      {
+        return MakeErrorResult<ResultT>(-222, exception.GetDescription());
+      }
+    }
   }
 
   try
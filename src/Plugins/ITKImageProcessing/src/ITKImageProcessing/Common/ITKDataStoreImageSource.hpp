@@ -0,0 +1,144 @@
+#pragma once
+
+#include "itkConfigure.h"
+
+#include <itkImageSource.h>
+#include <itkNumericTraits.h>
+
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+
+#include <nonstd/span.hpp>
+
+namespace itk
+{
+/**
+ * @class DataStoreImageSource
+ * @brief Image source that reads the requested region of its output from a simplnx data store.
+ *
+ * The requested region is always enlarged to whole slices, i.e. to the full extent of every dimension but the slowest,
+ * so that it is one contiguous block of tuples in the store and can be read with one bulk copy. Only the slices the
+ * downstream filters request (the slab they compute plus their kernel radius) are ever held in memory, which is what
+ * allows out-of-core stores to be run through ITK filters.
+ */
+template <class TOutputImage>
+class DataStoreImageSource : public ImageSource<TOutputImage>
+{
+public:
+  ITK_DISALLOW_COPY_AND_MOVE(DataStoreImageSource);
+
+  /** Standard class type aliases. */
+  using Self = DataStoreImageSource;
+  using Superclass = ImageSource<TOutputImage>;
+  using Pointer = SmartPointer<Self>;
+  using ConstPointer = SmartPointer<const Self>;
+
+  using OutputImageType = TOutputImage;
+  using PixelType = typename OutputImageType::PixelType;
+  using ValueType = typename NumericTraits<PixelType>::ValueType;
+  using RegionType = typename OutputImageType::RegionType;
+  using SpacingType = typename OutputImageType::SpacingType;
+  using PointType = typename OutputImageType::PointType;
+  using StoreType = nx::core::AbstractDataStore<ValueType>;
+
+  static constexpr unsigned int ImageDimension = OutputImageType::ImageDimension;
+
+  /** Method for creation through the object factory. */
+  itkNewMacro(Self);
+
+  /** Run-time type information (and related methods). */
+#if defined(ITK_VERSION_MAJOR) && ITK_VERSION_MAJOR == 5 && defined(ITK_VERSION_MINOR) && ITK_VERSION_MINOR == 2
+  itkTypeMacro(DataStoreImageSource, ImageSource);
+#else
+  itkOverrideGetNameOfClassMacro(DataStoreImageSource);
+#endif
+
+  /**
+   * @brief Sets the store the pixels are read from. The store must outlive the pipeline and its tuples must be ordered
+   * with the fastest dimension first, as for every image in simplnx.
+   * @param dataStore
+   */
+  void SetDataStore(const StoreType* dataStore)
+  {
+    m_DataStore = dataStore;
+    this->Modified();
+  }
+
+  /** The largest possible region of the image, i.e. the dimensions of the whole store. */
+  itkSetMacro(Region, RegionType);
+  itkGetConstReferenceMacro(Region, RegionType);
+
+  itkSetMacro(Spacing, SpacingType);
+  itkGetConstReferenceMacro(Spacing, SpacingType);
+
+  itkSetMacro(Origin, PointType);
+  itkGetConstReferenceMacro(Origin, PointType);
+
+protected:
+  DataStoreImageSource()
+  {
+    m_Spacing.Fill(1.0);
+    m_Origin.Fill(0.0);
+  }
+  ~DataStoreImageSource() override = default;
+
+  void GenerateOutputInformation() override
+  {
+    OutputImageType* output = this->GetOutput();
+    output->SetLargestPossibleRegion(m_Region);
+    output->SetSpacing(m_Spacing);
+    output->SetOrigin(m_Origin);
+  }
+
+  void EnlargeOutputRequestedRegion(DataObject* data) override
+  {
+    auto* output = dynamic_cast<OutputImageType*>(data);
+    if(output == nullptr)
+    {
+      return;
+    }
+    RegionType region = output->GetRequestedRegion();
+    for(unsigned int i = 0; i + 1 < ImageDimension; i++)
+    {
+      region.SetIndex(i, m_Region.GetIndex(i));
+      region.SetSize(i, m_Region.GetSize(i));
+    }
+    output->SetRequestedRegion(region);
+  }
+
+  void GenerateData() override
+  {
+    if(m_DataStore == nullptr)
+    {
+      itkExceptionMacro(<< "No DataStore was set to read the image from");
+    }
+
+    OutputImageType* output = this->GetOutput();
+    const RegionType region = output->GetRequestedRegion();
+    output->SetBufferedRegion(region);
+    output->Allocate();
+
+    constexpr unsigned int slabDimension = ImageDimension - 1;
+    nx::core::usize sliceTuples = 1;
+    for(unsigned int i = 0; i < slabDimension; i++)
+    {
+      sliceTuples *= m_Region.GetSize(i);
+    }
+    const nx::core::usize numComponents = NumericTraits<PixelType>::GetLength();
+    const auto firstSlice = static_cast<nx::core::usize>(region.GetIndex(slabDimension) - m_Region.GetIndex(slabDimension));
+    const nx::core::usize numValues = region.GetNumberOfPixels() * numComponents;
+
+    auto* buffer = reinterpret_cast<ValueType*>(output->GetBufferPointer());
+    nx::core::Result<> result = m_DataStore->copyIntoBuffer(firstSlice * sliceTuples * numComponents, nonstd::span<ValueType>(buffer, numValues));
+    if(result.invalid())
+    {
+      itkExceptionMacro(<< "Failed to read the image from the DataStore: " << result.errors().front().message);
+    }
+  }
+
+private:
+  const StoreType* m_DataStore = nullptr;
+  RegionType m_Region;
+  SpacingType m_Spacing;
+  PointType m_Origin;
+};
+} // namespace itk
@@ -0,0 +1,134 @@
+#include "MontageMosaic.hpp"
+
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
+
+#include <itkImageIOFactory.h>
+
+#include <limits>
+#include <numeric>
+
+using namespace nx::core;
+
+namespace nx::core::MontageMosaic
+{
+// -----------------------------------------------------------------------------
+Result<TileInformation> ReadTileInformation(const std::string& filePath)
+{
+  try
+  {
+    itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(filePath.c_str(), itk::CommonEnums::IOFileMode::ReadMode);
+    if(imageIO == nullptr)
+    {
+      return MakeErrorResult<TileInformation>(-5, fmt::format("ITK could not read the given file \"{}\". Format is likely unsupported.", filePath));
+    }
+
+    imageIO->SetFileName(filePath);
+    imageIO->ReadImageInformation();
+
+    itk::ImageIOBase::IOComponentEnum component = imageIO->GetComponentType();
+    std::optional<DataType> dataType = ITK::ConvertIOComponentToDataType(component);
+    if(!dataType.has_value())
+    {
+      return MakeErrorResult<TileInformation>(-4, fmt::format("Unsupported pixel component: {}", imageIO->GetComponentTypeAsString(component)));
+    }
+
+    const uint32 numDims = imageIO->GetNumberOfDimensions();
+    if(numDims > 3 || (numDims == 3 && imageIO->GetDimensions(2) > 1))
+    {
+      return MakeErrorResult<TileInformation>(k_UnsupportedTileDimensions, fmt::format("The image '{}' is not a 2D image and can not be stitched into a mosaic.", filePath));
+    }
+
+    TileInformation information;
+    information.Width = static_cast<usize>(imageIO->GetDimensions(0));
+    information.Height = numDims > 1 ? static_cast<usize>(imageIO->GetDimensions(1)) : 1;
+    information.NumComponents = imageIO->GetNumberOfComponents();
+    information.Type = *dataType;
+    return {information};
+  } catch(const itk::ExceptionObject& err)
+  {
+    return MakeErrorResult<TileInformation>(-55557, fmt::format("ITK exception was thrown while processing input file: {}", err.what()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+MosaicLayout::MosaicLayout(std::vector<TilePlacement> tiles, usize numComponents, BlendMode blendMode, TileReadOptions readOptions)
+: m_Tiles(std::move(tiles))
+, m_NumComponents(numComponents)
+, m_BlendMode(blendMode)
+, m_ReadOptions(std::move(readOptions))
+{
+  for(const auto& tile : m_Tiles)
+  {
+    m_Width = std::max(m_Width, tile.X + tile.Width);
+    m_Height = std::max(m_Height, tile.Y + tile.Height);
+    m_MaxTileHeight = std::max(m_MaxTileHeight, tile.Height);
+  }
+
+  m_TilesByRow.resize(m_Tiles.size());
+  std::iota(m_TilesByRow.begin(), m_TilesByRow.end(), 0);
+  std::stable_sort(m_TilesByRow.begin(), m_TilesByRow.end(), [this](usize lhs, usize rhs) { return m_Tiles[lhs].Y < m_Tiles[rhs].Y; });
+}
+
+// -----------------------------------------------------------------------------
+usize MosaicLayout::getWidth() const
+{
+  return m_Width;
+}
+
+// -----------------------------------------------------------------------------
+usize MosaicLayout::getHeight() const
+{
+  return m_Height;
+}
+
+// -----------------------------------------------------------------------------
+usize MosaicLayout::getNumberOfComponents() const
+{
+  return m_NumComponents;
+}
+
+// -----------------------------------------------------------------------------
+BlendMode MosaicLayout::getBlendMode() const
+{
+  return m_BlendMode;
+}
+
+// -----------------------------------------------------------------------------
+const TileReadOptions& MosaicLayout::getReadOptions() const
+{
+  return m_ReadOptions;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<TilePlacement>& MosaicLayout::getTiles() const
+{
+  return m_Tiles;
+}
+
+// -----------------------------------------------------------------------------
+usize MosaicLayout::getBandHeight() const
+{
+  return std::max(m_MaxTileHeight, static_cast<usize>(1));
+}
+
+// -----------------------------------------------------------------------------
+std::vector<usize> MosaicLayout::findTiles(usize firstRow, usize endRow) const
+{
+  // No tile that starts more than the tallest tile above the band can reach into it
+  const usize searchStart = firstRow > m_MaxTileHeight ? firstRow - m_MaxTileHeight : 0;
+  auto iter = std::lower_bound(m_TilesByRow.cbegin(), m_TilesByRow.cend(), searchStart, [this](usize tileIndex, usize row) { return m_Tiles[tileIndex].Y < row; });
+
+  std::vector<usize> tileIndices;
+  for(; iter != m_TilesByRow.cend() && m_Tiles[*iter].Y < endRow; ++iter)
+  {
+    const TilePlacement& tile = m_Tiles[*iter];
+    if(tile.Y + tile.Height > firstRow && tile.Width > 0)
+    {
+      tileIndices.push_back(*iter);
+    }
+  }
+  // Overlaps are resolved in the order of the configuration
+  std::sort(tileIndices.begin(), tileIndices.end());
+  return tileIndices;
+}
+} // namespace nx::core::MontageMosaic
@@ -0,0 +1,466 @@
+#pragma once
+
+#include "ITKImageProcessing/Common/ReadImageUtils.hpp"
+#include "ITKImageProcessing/ITKImageProcessing_export.hpp"
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace nx::core::MontageMosaic
+{
+inline constexpr int32 k_TileDimensionsMismatch = -18560;
+inline constexpr int32 k_TileComponentsMismatch = -18561;
+inline constexpr int32 k_UnsupportedTileDimensions = -18562;
+
+/**
+ * @brief How the pixels in the overlap of two or more tiles are computed.
+ */
+enum class BlendMode : uint64
+{
+  None = 0,  // The tile that comes last in the configuration is on top
+  Linear = 1 // Average of the tiles, each weighted by the distance of the pixel to the edges of the tile
+};
+
+/**
+ * @brief Position and size of one tile in the mosaic, in pixels.
+ */
+struct TilePlacement
+{
+  std::string FilePath;
+  usize X = 0;
+  usize Y = 0;
+  usize Width = 0;
+  usize Height = 0;
+};
+
+/**
+ * @brief What the header of a tile image says about its pixels.
+ */
+struct TileInformation
+{
+  usize Width = 0;
+  usize Height = 0;
+  usize NumComponents = 1;
+  DataType Type = DataType::uint8;
+};
+
+/**
+ * @brief How the tile images are converted while they are read.
+ */
+struct TileReadOptions
+{
+  bool ChangeDataType = false;
+  bool ConvertToGrayScale = false;
+  std::vector<float32> ColorWeights;
+};
+
+/**
+ * @brief Reads the dimensions, number of components and pixel type from the header of a 2D image without reading its
+ * pixels.
+ * @param filePath
+ * @return Result<TileInformation>
+ */
+ITKIMAGEPROCESSING_EXPORT Result<TileInformation> ReadTileInformation(const std::string& filePath);
+
+/**
+ * @class MosaicLayout
+ * @brief Describes where the tiles of a montage lie in one stitched mosaic image and how they are blended. The mosaic
+ * is always composed in bands of whole rows, and the layout finds the tiles a band needs without looking at every tile.
+ */
+class ITKIMAGEPROCESSING_EXPORT MosaicLayout
+{
+public:
+  /**
+   * @param tiles The tiles in the order of the configuration. The mosaic is the bounding box of the tiles.
+   * @param numComponents The number of components of the mosaic pixels after the read options have been applied
+   * @param blendMode
+   * @param readOptions
+   */
+  MosaicLayout(std::vector<TilePlacement> tiles, usize numComponents, BlendMode blendMode, TileReadOptions readOptions);
+
+  usize getWidth() const;
+  usize getHeight() const;
+  usize getNumberOfComponents() const;
+  BlendMode getBlendMode() const;
+  const TileReadOptions& getReadOptions() const;
+  const std::vector<TilePlacement>& getTiles() const;
+
+  /**
+   * @brief Returns the number of rows that are composed together: the height of the tallest tile.
+   * @return usize
+   */
+  usize getBandHeight() const;
+
+  /**
+   * @brief Returns the indices of the tiles that cover any of the rows [firstRow, endRow) in configuration order.
+   * @param firstRow
+   * @param endRow
+   * @return std::vector<usize>
+   */
+  std::vector<usize> findTiles(usize firstRow, usize endRow) const;
+
+private:
+  std::vector<TilePlacement> m_Tiles;
+  std::vector<usize> m_TilesByRow;
+  usize m_Width = 0;
+  usize m_Height = 0;
+  usize m_NumComponents = 1;
+  usize m_MaxTileHeight = 0;
+  BlendMode m_BlendMode = BlendMode::None;
+  TileReadOptions m_ReadOptions;
+};
+
+template <class T>
+using TileBuffer = cxItkImageReaderFilter::ImageBuffer<T>;
+
+/**
+ * @brief Decodes one tile and applies the read options of the layout.
+ */
+template <class T>
+Result<> ReadTile(const MosaicLayout& layout, usize tileIndex, TileBuffer<T>& tile)
+{
+  const TilePlacement& placement = layout.getTiles()[tileIndex];
+  const TileReadOptions& options = layout.getReadOptions();
+  Result<> readResult = cxItkImageReaderFilter::ReadImageExecute<cxItkImageReaderFilter::ReadImageIntoBufferFunctor>(placement.FilePath, placement.FilePath, options.ChangeDataType, tile);
+  if(readResult.invalid())
+  {
+    return readResult;
+  }
+  if constexpr(std::is_same_v<T, uint8>)
+  {
+    if(options.ConvertToGrayScale)
+    {
+      cxItkImageReaderFilter::ConvertBufferToGrayScale(tile, options.ColorWeights);
+    }
+  }
+
+  if(tile.Dims[0] != placement.Width || tile.Dims[1] != placement.Height || tile.Dims[2] != 1)
+  {
+    return MakeErrorResult(k_TileDimensionsMismatch, fmt::format("The image '{}' is {} x {} x {} pixels, but its header said {} x {}.", placement.FilePath, tile.Dims[0], tile.Dims[1], tile.Dims[2],
+                                                                 placement.Width, placement.Height));
+  }
+  if(tile.NumComponents != layout.getNumberOfComponents())
+  {
+    return MakeErrorResult(k_TileComponentsMismatch,
+                           fmt::format("The image '{}' has {} components per pixel but the mosaic has {}.", placement.FilePath, tile.NumComponents, layout.getNumberOfComponents()));
+  }
+  return {};
+}
+
+/**
+ * @class TileCache
+ * @brief Holds decoded tiles up to a memory limit and drops the least recently used ones beyond it. Tiles that are
+ * missing are decoded in parallel. The cache can be shared by several threads.
+ */
+template <class T>
+class TileCache
+{
+public:
+  using TilePointer = std::shared_ptr<const TileBuffer<T>>;
+
+  TileCache(std::shared_ptr<const MosaicLayout> layout, uint64 capacity)
+  : m_Layout(std::move(layout))
+  , m_Capacity(capacity)
+  {
+  }
+
+  /**
+   * @brief Returns the number of bytes of decoded tiles that the cache keeps. A single request that needs more tiles
+   * can exceed it until the next request.
+   * @return uint64
+   */
+  uint64 getCapacity() const
+  {
+    return m_Capacity;
+  }
+
+  /**
+   * @brief Returns the decoded tiles in the order of the given indices. The returned tiles stay valid even if they are
+   * dropped from the cache later.
+   * @param tileIndices
+   * @return Result<std::vector<TilePointer>>
+   */
+  Result<std::vector<TilePointer>> getTiles(const std::vector<usize>& tileIndices)
+  {
+    // The missing tiles are decoded without holding the lock: decoding runs parallel work, and a thread that waits for
+    // that work may pick up a task that reads from this cache again
+    std::vector<TilePointer> tiles(tileIndices.size());
+    std::vector<usize> missing;
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      for(usize i = 0; i < tileIndices.size(); i++)
+      {
+        auto iter = m_Tiles.find(tileIndices[i]);
+        if(iter == m_Tiles.end())
+        {
+          missing.push_back(i);
+        }
+        else
+        {
+          tiles[i] = iter->second.Tile;
+        }
+      }
+    }
+
+    std::vector<std::shared_ptr<TileBuffer<T>>> decoded(missing.size());
+    if(!missing.empty())
+    {
+      std::vector<Result<>> results(missing.size());
+      ParallelTaskAlgorithm taskRunner;
+      for(usize i = 0; i < missing.size(); i++)
+      {
+        decoded[i] = std::make_shared<TileBuffer<T>>();
+        taskRunner.execute(ReadTileTask(*m_Layout, tileIndices[missing[i]], *decoded[i], results[i]));
+      }
+      taskRunner.wait();
+
+      for(usize i = 0; i < missing.size(); i++)
+      {
+        if(results[i].invalid())
+        {
+          return ConvertInvalidResult<std::vector<TilePointer>>(std::move(results[i]));
+        }
+      }
+    }
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_Clock++;
+    for(usize i = 0; i < missing.size(); i++)
+    {
+      const usize tileIndex = tileIndices[missing[i]];
+      // Another thread may have decoded the same tile in the meantime
+      auto iter = m_Tiles.find(tileIndex);
+      if(iter == m_Tiles.end())
+      {
+        m_Size += decoded[i]->Values.size() * sizeof(T);
+        iter = m_Tiles.emplace(tileIndex, CacheEntry{std::move(decoded[i]), m_Clock}).first;
+      }
+      tiles[missing[i]] = iter->second.Tile;
+    }
+    // Tiles that were found in the first pass may have been dropped since, they stay valid through the returned pointers
+    for(usize tileIndex : tileIndices)
+    {
+      auto iter = m_Tiles.find(tileIndex);
+      if(iter != m_Tiles.end())
+      {
+        iter->second.LastUse = m_Clock;
+      }
+    }
+
+    evict();
+    return {std::move(tiles)};
+  }
+
+private:
+  struct CacheEntry
+  {
+    TilePointer Tile;
+    uint64 LastUse = 0;
+  };
+
+  class ReadTileTask
+  {
+  public:
+    ReadTileTask(const MosaicLayout& layout, usize tileIndex, TileBuffer<T>& tile, Result<>& result)
+    : m_Layout(layout)
+    , m_TileIndex(tileIndex)
+    , m_Tile(tile)
+    , m_Result(result)
+    {
+    }
+
+    void operator()() const
+    {
+      m_Result = ReadTile<T>(m_Layout, m_TileIndex, m_Tile);
+    }
+
+  private:
+    const MosaicLayout& m_Layout;
+    usize m_TileIndex;
+    TileBuffer<T>& m_Tile;
+    Result<>& m_Result;
+  };
+
+  // Drops the least recently used tiles until the cache fits its capacity again. The tiles of the current request are
+  // never dropped, so a request that is larger than the capacity still works.
+  void evict()
+  {
+    while(m_Size > m_Capacity)
+    {
+      auto oldest = std::min_element(m_Tiles.begin(), m_Tiles.end(), [](const auto& lhs, const auto& rhs) { return lhs.second.LastUse < rhs.second.LastUse; });
+      if(oldest == m_Tiles.end() || oldest->second.LastUse == m_Clock)
+      {
+        return;
+      }
+      m_Size -= oldest->second.Tile->Values.size() * sizeof(T);
+      m_Tiles.erase(oldest);
+    }
+  }
+
+  std::shared_ptr<const MosaicLayout> m_Layout;
+  uint64 m_Capacity = 0;
+  uint64 m_Size = 0;
+  uint64 m_Clock = 0;
+  std::map<usize, CacheEntry> m_Tiles;
+  std::mutex m_Mutex;
+};
+
+/**
+ * @brief Composes the rows [firstRow, firstRow + numRows) of the mosaic into the output buffer. The rows are composed
+ * in parallel. Pixels that no tile covers are 0.
+ * @param layout
+ * @param firstRow
+ * @param numRows
+ * @param tileIndices The tiles that cover the rows (see MosaicLayout::findTiles()) in configuration order
+ * @param tiles The decoded tiles in the same order as tileIndices
+ * @param output Receives numRows * width * numComponents values
+ */
+template <class T>
+void ComposeRows(const MosaicLayout& layout, usize firstRow, usize numRows, const std::vector<usize>& tileIndices, const std::vector<std::shared_ptr<const TileBuffer<T>>>& tiles,
+                 nonstd::span<T> output)
+{
+  const usize width = layout.getWidth();
+  const usize numComp = layout.getNumberOfComponents();
+  const usize rowSize = width * numComp;
+  const std::vector<TilePlacement>& placements = layout.getTiles();
+  const bool linear = layout.getBlendMode() == BlendMode::Linear;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRows);
+  dataAlg.execute([&](const Range& range) {
+    std::vector<float64> sums;
+    std::vector<float64> weights;
+    if(linear)
+    {
+      sums.resize(rowSize);
+      weights.resize(width);
+    }
+
+    for(usize row = range.min(); row < range.max(); row++)
+    {
+      const usize mosaicRow = firstRow + row;
+      T* outputRow = output.data() + row * rowSize;
+      if(linear)
+      {
+        std::fill(sums.begin(), sums.end(), 0.0);
+        std::fill(weights.begin(), weights.end(), 0.0);
+      }
+      else
+      {
+        std::fill_n(outputRow, rowSize, static_cast<T>(0));
+      }
+
+      for(usize i = 0; i < tileIndices.size(); i++)
+      {
+        const TilePlacement& placement = placements[tileIndices[i]];
+        if(mosaicRow < placement.Y || mosaicRow >= placement.Y + placement.Height)
+        {
+          continue;
+        }
+        const usize tileRow = mosaicRow - placement.Y;
+        const T* tileValues = tiles[i]->Values.data() + tileRow * placement.Width * numComp;
+        if(!linear)
+        {
+          // Later tiles are copied over earlier ones
+          std::copy_n(tileValues, placement.Width * numComp, outputRow + placement.X * numComp);
+          continue;
+        }
+
+        // The weight falls off linearly towards every edge of the tile
+        const auto rowWeight = static_cast<float64>(std::min(tileRow + 1, placement.Height - tileRow));
+        for(usize x = 0; x < placement.Width; x++)
+        {
+          const float64 weight = rowWeight * static_cast<float64>(std::min(x + 1, placement.Width - x));
+          const usize mosaicX = placement.X + x;
+          weights[mosaicX] += weight;
+          for(usize comp = 0; comp < numComp; comp++)
+          {
+            sums[mosaicX * numComp + comp] += weight * static_cast<float64>(tileValues[x * numComp + comp]);
+          }
+        }
+      }
+
+      if(!linear)
+      {
+        continue;
+      }
+      for(usize x = 0; x < width; x++)
+      {
+        for(usize comp = 0; comp < numComp; comp++)
+        {
+          float64 value = weights[x] > 0.0 ? sums[x * numComp + comp] / weights[x] : 0.0;
+          if constexpr(std::is_integral_v<T>)
+          {
+            value = std::round(value);
+          }
+          outputRow[x * numComp + comp] = static_cast<T>(value);
+        }
+      }
+    }
+  });
+}
+
+/**
+ * @brief Stitches the whole mosaic into the given store one band of rows at a time. The tiles of a band are decoded in
+ * parallel and kept in a cache of the given capacity so that the next band can reuse them.
+ * @param layout
+ * @param outputStore Must hold height * width tuples of numComponents values
+ * @param cacheCapacity The number of bytes of decoded tiles that are kept between bands
+ * @param messageHandler
+ * @param shouldCancel
+ * @return Result<>
+ */
+template <class T>
+Result<> AssembleMosaic(const std::shared_ptr<const MosaicLayout>& layout, AbstractDataStore<T>& outputStore, uint64 cacheCapacity, const IFilter::MessageHandler& messageHandler,
+                        const std::atomic_bool& shouldCancel)
+{
+  const usize height = layout->getHeight();
+  const usize rowSize = layout->getWidth() * layout->getNumberOfComponents();
+  const usize bandHeight = layout->getBandHeight();
+
+  TileCache<T> tileCache(layout, cacheCapacity);
+  std::vector<T> band;
+  for(usize firstRow = 0; firstRow < height; firstRow += bandHeight)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+    const usize numRows = std::min(bandHeight, height - firstRow);
+    messageHandler(IFilter::Message::Type::Info, fmt::format("Stitching rows {} to {} of {}", firstRow, firstRow + numRows, height));
+
+    const std::vector<usize> tileIndices = layout->findTiles(firstRow, firstRow + numRows);
+    auto tilesResult = tileCache.getTiles(tileIndices);
+    if(tilesResult.invalid())
+    {
+      return ConvertResult(std::move(tilesResult));
+    }
+
+    band.resize(numRows * rowSize);
+    ComposeRows<T>(*layout, firstRow, numRows, tileIndices, tilesResult.value(), band);
+    Result<> writeResult = outputStore.copyFromBuffer(firstRow * rowSize, band);
+    if(writeResult.invalid())
+    {
+      return writeResult;
+    }
+  }
+  return {};
+}
+} // namespace nx::core::MontageMosaic
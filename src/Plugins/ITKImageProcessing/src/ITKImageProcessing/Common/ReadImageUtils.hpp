@@ -9,6 +9,11 @@
 
 #include <itkImageFileReader.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 using namespace nx::core;
 
 namespace cxItkImageReaderFilter
@@ -75,6 +80,107 @@ struct ReadImageIntoArrayFunctor
   }
 };
 
+/**
+ * @brief Holds an image that was read without creating a DataStructure for it. The values are stored with X as the
+ * fastest dimension and the components of each pixel next to each other.
+ */
+template <class T>
+struct ImageBuffer
+{
+  std::vector<T> Values;
+  SizeVec3 Dims = {1, 1, 1};
+  FloatVec3 Spacing = {1.0f, 1.0f, 1.0f};
+  usize NumComponents = 1;
+
+  usize getNumberOfPixels() const
+  {
+    return Dims[0] * Dims[1] * Dims[2];
+  }
+};
+
+struct ReadImageIntoBufferFunctor
+{
+  //------------------------------------------------------------------------------
+  template <class PixelT, uint32 Dimension, class T>
+  Result<> operator()(const std::string& filePath, bool changeDataType, ImageBuffer<T>& imageBuffer) const
+  {
+    using ImageType = itk::Image<PixelT, Dimension>;
+    using ReaderType = itk::ImageFileReader<ImageType>;
+
+    using FileT = ITK::UnderlyingType_t<PixelT>;
+
+    if constexpr(!std::is_same_v<FileT, T>)
+    {
+      if(!changeDataType || !ITK::detail::TypeConversionValidateFunctor<FileT>{}.template operator()<T>())
+      {
+        return MakeErrorResult(-64511, fmt::format("The pixel type of '{}' does not match the pixel type of the first image.", filePath));
+      }
+    }
+
+    typename ReaderType::Pointer reader = ReaderType::New();
+    reader->SetFileName(filePath);
+
+    reader->Update();
+    typename ImageType::Pointer outputImage = reader->GetOutput();
+
+    typename ImageType::SizeType imageSize = outputImage->GetLargestPossibleRegion().GetSize();
+    imageBuffer.Dims = {1, 1, 1};
+    imageBuffer.Spacing = {1.0f, 1.0f, 1.0f};
+    for(uint32 i = 0; i < Dimension; i++)
+    {
+      imageBuffer.Dims[i] = static_cast<usize>(imageSize[i]);
+      imageBuffer.Spacing[i] = static_cast<float32>(outputImage->GetSpacing()[i]);
+    }
+    imageBuffer.NumComponents = itk::NumericTraits<PixelT>::GetLength();
+
+    const usize numValues = imageBuffer.getNumberOfPixels() * imageBuffer.NumComponents;
+    const auto* rawBufferPtr = reinterpret_cast<const FileT*>(outputImage->GetBufferPointer());
+    imageBuffer.Values.resize(numValues);
+    if constexpr(std::is_same_v<FileT, T>)
+    {
+      std::copy(rawBufferPtr, rawBufferPtr + numValues, imageBuffer.Values.begin());
+    }
+    else if constexpr(!std::is_signed_v<T> && !std::is_signed_v<FileT>)
+    {
+      // Same scaling as ITK::ConvertImageToDataStore()
+      constexpr auto destMaxV = static_cast<float64>(std::numeric_limits<T>::max());
+      constexpr auto originMaxV = std::numeric_limits<FileT>::max();
+      std::transform(rawBufferPtr, rawBufferPtr + numValues, imageBuffer.Values.begin(), [](auto value) {
+        float64 ratio = static_cast<float64>(value) / static_cast<float64>(originMaxV);
+        return static_cast<T>(ratio * destMaxV);
+      });
+    }
+
+    return {};
+  }
+};
+
+//------------------------------------------------------------------------------
+/**
+ * @brief Converts a color image to a single component image with the luminosity algorithm of the ConvertColorToGrayScale
+ * filter. Images with less than 3 components are left alone.
+ * @param imageBuffer
+ * @param colorWeights The red, green and blue weights
+ */
+inline void ConvertBufferToGrayScale(ImageBuffer<uint8>& imageBuffer, const std::vector<float32>& colorWeights)
+{
+  const usize numComp = imageBuffer.NumComponents;
+  if(numComp < 3 || colorWeights.size() < 3)
+  {
+    return;
+  }
+  const usize numPixels = imageBuffer.getNumberOfPixels();
+  uint8* values = imageBuffer.Values.data();
+  // Every gray value is written at or before the color it is computed from, so the conversion can be done in place
+  for(usize i = 0; i < numPixels; i++)
+  {
+    auto temp = static_cast<int32>(roundf((values[numComp * i] * colorWeights[0]) + (values[numComp * i + 1] * colorWeights[1]) + (values[numComp * i + 2] * colorWeights[2])));
+    values[i] = static_cast<uint8>(temp);
+  }
+  imageBuffer.Values.resize(numPixels);
+  imageBuffer.NumComponents = 1;
+}
+
 //------------------------------------------------------------------------------
 template <class T, usize Dimension, class FunctorT, class... ArgsT>
 Result<> ReadImageByPixelType(const itk::ImageIOBase& imageIO, ArgsT&&... args)
@@ -0,0 +1,386 @@
+#pragma once
+
+#include "ITKImageProcessing/Common/MontageMosaic.hpp"
+
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace nx::core
+{
+/**
+ * @class VirtualMosaicDataStore
+ * @brief Read-only data store that holds no pixels of its own: every value is composed from the montage tiles the
+ * first time a band of rows that contains it is read. The composed bands and the decoded tiles are cached up to a
+ * memory limit, so a mosaic that is larger than memory can be viewed, written to file or streamed through other
+ * filters. The tuples are ordered as for a {1, height, width} image.
+ * @tparam T
+ */
+template <typename T>
+class VirtualMosaicDataStore : public AbstractDataStore<T>
+{
+public:
+  using value_type = typename AbstractDataStore<T>::value_type;
+  using reference = typename AbstractDataStore<T>::reference;
+  using const_reference = typename AbstractDataStore<T>::const_reference;
+  using ShapeType = typename IDataStore::ShapeType;
+
+  static inline constexpr StringLiteral k_DataFormat = "VirtualMosaic";
+
+  /**
+   * @param layout
+   * @param cacheCapacity The number of bytes of decoded tiles that are kept in memory
+   */
+  VirtualMosaicDataStore(std::shared_ptr<const MontageMosaic::MosaicLayout> layout, uint64 cacheCapacity)
+  : m_Layout(layout)
+  , m_TupleShape({1, layout->getHeight(), layout->getWidth()})
+  , m_ComponentShape({layout->getNumberOfComponents()})
+  , m_TileCache(std::make_shared<MontageMosaic::TileCache<T>>(layout, cacheCapacity))
+  , m_BandCache(std::make_shared<BandCache>())
+  {
+  }
+
+  VirtualMosaicDataStore(const VirtualMosaicDataStore& other) = default;
+  VirtualMosaicDataStore(VirtualMosaicDataStore&& other) noexcept = default;
+  ~VirtualMosaicDataStore() override = default;
+
+  usize getNumberOfTuples() const override
+  {
+    return m_Layout->getHeight() * m_Layout->getWidth();
+  }
+
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  usize getNumberOfComponents() const override
+  {
+    return m_Layout->getNumberOfComponents();
+  }
+
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  /**
+   * @brief One chunk is one band of rows across the whole mosaic.
+   * @return std::optional<ShapeType>
+   */
+  std::optional<ShapeType> getChunkShape() const override
+  {
+    return ShapeType{1, m_Layout->getBandHeight(), m_Layout->getWidth(), m_Layout->getNumberOfComponents()};
+  }
+
+  std::vector<T> getChunkValues(const ShapeType& chunkPosition) const override
+  {
+    const usize bandIndex = chunkPosition.size() > 1 ? chunkPosition[1] : 0;
+    // Chunks are always returned at full size, the rows below the mosaic are 0
+    std::vector<T> values(m_Layout->getBandHeight() * getRowSize(), static_cast<T>(0));
+    if(bandIndex * m_Layout->getBandHeight() < m_Layout->getHeight())
+    {
+      std::shared_ptr<const std::vector<T>> band = getBand(bandIndex);
+      std::copy(band->cbegin(), band->cend(), values.begin());
+    }
+    return values;
+  }
+
+  /**
+   * @brief Resizing would lose the layout of the mosaic, so it always throws.
+   * @param tupleShape
+   */
+  void resizeTuples(const ShapeType& /*tupleShape*/) override
+  {
+    throw std::runtime_error("A virtual mosaic can not be resized.");
+  }
+
+  DataType getDataType() const override
+  {
+    return GetDataType<T>();
+  }
+
+  IDataStore::StoreType getStoreType() const override
+  {
+    return IDataStore::StoreType::OutOfCore;
+  }
+
+  std::string getDataFormat() const override
+  {
+    return k_DataFormat.str();
+  }
+
+  usize getTypeSize() const override
+  {
+    return sizeof(T);
+  }
+
+  value_type getValue(usize index) const override
+  {
+    const usize bandValues = m_Layout->getBandHeight() * getRowSize();
+    return (*getBand(index / bandValues))[index % bandValues];
+  }
+
+  void setValue(usize /*index*/, value_type /*value*/) override
+  {
+    throw std::runtime_error("A virtual mosaic is read-only.");
+  }
+
+  /**
+   * @brief Returns a reference into the band that contains the value. The last k_MaxPinnedBands bands that the calling
+   * thread read through this operator are pinned for it, so the reference stays valid until the same thread has read
+   * values of k_MaxPinnedBands other bands, no matter how many bands other threads read in the meantime. Use
+   * getValue() or copyIntoBuffer() where possible.
+   * @param index
+   * @return const_reference
+   */
+  const_reference operator[](usize index) const override
+  {
+    const usize bandValues = m_Layout->getBandHeight() * getRowSize();
+    const usize bandIndex = index / bandValues;
+    std::shared_ptr<const std::vector<T>> band = getBand(bandIndex);
+    const T& value = (*band)[index % bandValues];
+    std::lock_guard<std::mutex> lock(m_BandCache->Mutex);
+    auto& pinnedBands = m_BandCache->PinnedBands[std::this_thread::get_id()];
+    auto iter = std::find_if(pinnedBands.begin(), pinnedBands.end(), [bandIndex](const auto& entry) { return entry.first == bandIndex; });
+    if(iter != pinnedBands.end())
+    {
+      pinnedBands.splice(pinnedBands.begin(), pinnedBands, iter);
+      return value;
+    }
+    pinnedBands.emplace_front(bandIndex, std::move(band));
+    if(pinnedBands.size() > k_MaxPinnedBands)
+    {
+      pinnedBands.pop_back();
+    }
+    return value;
+  }
+
+  const_reference at(usize index) const override
+  {
+    if(index >= this->getSize())
+    {
+      throw std::runtime_error(fmt::format("VirtualMosaicDataStore: Index {} is out of range for a store of size {}.", index, this->getSize()));
+    }
+    return (*this)[index];
+  }
+
+  reference operator[](usize /*index*/) override
+  {
+    throw std::runtime_error("A virtual mosaic is read-only.");
+  }
+
+  /**
+   * @brief Composes the requested values band by band. Bands that are read completely are composed straight into the
+   * buffer without passing through the band cache.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} from a data store of size {}.", buffer.size(), startIndex, this->getSize()));
+    }
+
+    const usize rowSize = getRowSize();
+    const usize bandHeight = m_Layout->getBandHeight();
+    const usize bandValues = bandHeight * rowSize;
+    usize bufferIndex = 0;
+    while(bufferIndex < buffer.size())
+    {
+      const usize index = startIndex + bufferIndex;
+      const usize bandIndex = index / bandValues;
+      const usize bandStart = bandIndex * bandValues;
+      const usize numRows = std::min(bandHeight, m_Layout->getHeight() - bandIndex * bandHeight);
+      const usize bandEnd = bandStart + numRows * rowSize;
+      const usize count = std::min(bandEnd, startIndex + buffer.size()) - index;
+
+      if(index == bandStart && count == numRows * rowSize)
+      {
+        Result<> composeResult = composeBand(bandIndex, buffer.subspan(bufferIndex, count));
+        if(composeResult.invalid())
+        {
+          return composeResult;
+        }
+      }
+      else
+      {
+        std::shared_ptr<const std::vector<T>> band;
+        try
+        {
+          band = getBand(bandIndex);
+        } catch(const std::runtime_error& error)
+        {
+          return MakeErrorResult(-18571, error.what());
+        }
+        std::copy_n(band->cbegin() + (index - bandStart), count, buffer.begin() + bufferIndex);
+      }
+      bufferIndex += count;
+    }
+    return {};
+  }
+
+  Result<> copyFromBuffer(usize /*startIndex*/, nonstd::span<const T> /*buffer*/) override
+  {
+    return MakeErrorResult(-18570, "A virtual mosaic is read-only.");
+  }
+
+  /**
+   * @brief The cached bands and the capacity of the tile cache count towards the memory of the store. Bands that are
+   * only pinned by operator[] are not counted.
+   * @return uint64
+   */
+  uint64 memoryUsage() const override
+  {
+    return k_MaxCachedBands * m_Layout->getBandHeight() * getRowSize() * sizeof(T) + m_TileCache->getCapacity();
+  }
+
+  /**
+   * @brief The copy shares the layout and the caches of this store.
+   * @return std::unique_ptr<IDataStore>
+   */
+  std::unique_ptr<IDataStore> deepCopy() const override
+  {
+    return std::make_unique<VirtualMosaicDataStore<T>>(*this);
+  }
+
+  std::unique_ptr<IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<DataStore<T>>(m_TupleShape, m_ComponentShape, static_cast<T>(0));
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(const std::string& absoluteFilePath) const override
+  {
+    std::ofstream outStrm(absoluteFilePath, std::ios_base::out | std::ios_base::binary);
+    if(!outStrm.is_open())
+    {
+      return {-10170, fmt::format("File could not be opened for writing:\n  '{}'", absoluteFilePath)};
+    }
+
+    return writeBinaryFile(outStrm);
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(std::ostream& outputStream) const override
+  {
+    const usize rowSize = getRowSize();
+    const usize bandHeight = m_Layout->getBandHeight();
+    std::vector<T> band;
+    for(usize firstRow = 0; firstRow < m_Layout->getHeight(); firstRow += bandHeight)
+    {
+      band.resize(std::min(bandHeight, m_Layout->getHeight() - firstRow) * rowSize);
+      Result<> composeResult = composeBand(firstRow / bandHeight, band);
+      if(composeResult.invalid())
+      {
+        return {composeResult.errors().front().code, composeResult.errors().front().message};
+      }
+      outputStream.write(reinterpret_cast<const char*>(band.data()), sizeof(T) * band.size());
+      if(outputStream.bad())
+      {
+        return {-10175, fmt::format("Error writing binary file:\n  Total Elements:'{}'\n", this->getSize())};
+      }
+    }
+
+    return {0, ""};
+  }
+
+private:
+  static inline constexpr usize k_MaxCachedBands = 2;
+  static inline constexpr usize k_MaxPinnedBands = 4;
+
+  // Bands by band index, the most recently used first
+  using BandList = std::list<std::pair<usize, std::shared_ptr<const std::vector<T>>>>;
+
+  struct BandCache
+  {
+    BandList Bands;
+    // The last bands every thread took a reference into with operator[]
+    std::unordered_map<std::thread::id, BandList> PinnedBands;
+    std::mutex Mutex;
+  };
+
+  usize getRowSize() const
+  {
+    return m_Layout->getWidth() * m_Layout->getNumberOfComponents();
+  }
+
+  Result<> composeBand(usize bandIndex, nonstd::span<T> output) const
+  {
+    const usize bandHeight = m_Layout->getBandHeight();
+    const usize firstRow = bandIndex * bandHeight;
+    const usize numRows = std::min(bandHeight, m_Layout->getHeight() - firstRow);
+    const std::vector<usize> tileIndices = m_Layout->findTiles(firstRow, firstRow + numRows);
+    auto tilesResult = m_TileCache->getTiles(tileIndices);
+    if(tilesResult.invalid())
+    {
+      return ConvertResult(std::move(tilesResult));
+    }
+    MontageMosaic::ComposeRows<T>(*m_Layout, firstRow, numRows, tileIndices, tilesResult.value(), output);
+    return {};
+  }
+
+  // Returns the band from the cache or composes it. Errors can only be thrown from here since the accessors that use
+  // it can not return a Result. The band is composed without holding the lock: composing runs parallel work, and a
+  // thread that waits for that work may pick up a task that reads this store again.
+  std::shared_ptr<const std::vector<T>> getBand(usize bandIndex) const
+  {
+    auto findBand = [this, bandIndex]() -> std::shared_ptr<const std::vector<T>> {
+      auto& bands = m_BandCache->Bands;
+      auto iter = std::find_if(bands.begin(), bands.end(), [bandIndex](const auto& entry) { return entry.first == bandIndex; });
+      if(iter == bands.end())
+      {
+        return nullptr;
+      }
+      bands.splice(bands.begin(), bands, iter);
+      return bands.front().second;
+    };
+
+    {
+      std::lock_guard<std::mutex> lock(m_BandCache->Mutex);
+      if(auto band = findBand(); band != nullptr)
+      {
+        return band;
+      }
+    }
+
+    const usize bandHeight = m_Layout->getBandHeight();
+    auto band = std::make_shared<std::vector<T>>(std::min(bandHeight, m_Layout->getHeight() - bandIndex * bandHeight) * getRowSize());
+    Result<> composeResult = composeBand(bandIndex, *band);
+    if(composeResult.invalid())
+    {
+      throw std::runtime_error(composeResult.errors().front().message);
+    }
+
+    std::lock_guard<std::mutex> lock(m_BandCache->Mutex);
+    // Another thread may have composed the same band in the meantime
+    if(auto cachedBand = findBand(); cachedBand != nullptr)
+    {
+      return cachedBand;
+    }
+    auto& bands = m_BandCache->Bands;
+    bands.emplace_front(bandIndex, std::move(band));
+    if(bands.size() > k_MaxCachedBands)
+    {
+      bands.pop_back();
+    }
+    return bands.front().second;
+  }
+
+  std::shared_ptr<const MontageMosaic::MosaicLayout> m_Layout;
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  std::shared_ptr<MontageMosaic::TileCache<T>> m_TileCache;
+  std::shared_ptr<BandCache> m_BandCache;
+};
+} // namespace nx::core
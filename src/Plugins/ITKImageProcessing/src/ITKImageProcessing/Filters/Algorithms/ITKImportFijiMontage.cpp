@@ -1,18 +1,25 @@
 #include "ITKImportFijiMontage.hpp"
 
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 #include "ITKImageProcessing/Common/ReadImageUtils.hpp"
+#include "ITKImageProcessing/Common/VirtualMosaicDataStore.hpp"
 #include "ITKImageProcessing/Filters/ITKImageReaderFilter.hpp"
 
 #include "simplnx/Common/Array.hpp"
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/IDataArray.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <cmath>
 #include <filesystem>
+#include <mutex>
 #include <sstream>
 
 namespace fs = std::filesystem;
@@ -25,6 +32,71 @@ const Uuid k_SimplnxCorePluginId = *Uuid::FromString("05cc618b-781f-4ac0-b9ac-43
 const Uuid k_ColorToGrayScaleFilterId = *Uuid::FromString("d938a2aa-fee2-4db9-aa2f-2c34a9736580");
 const FilterHandle k_ColorToGrayScaleFilterHandle(k_ColorToGrayScaleFilterId, k_SimplnxCorePluginId);
 
+struct ReadTileIntoArrayFunctor
+{
+  template <class T>
+  Result<> operator()(IDataArray& imageArray, const fs::path& filePath, bool changeDataType, std::mutex& storeMutex)
+  {
+    cxItkImageReaderFilter::ImageBuffer<T> imageBuffer;
+    Result<> readResult =
+        cxItkImageReaderFilter::ReadImageExecute<cxItkImageReaderFilter::ReadImageIntoBufferFunctor>(filePath.string(), filePath.string(), changeDataType, imageBuffer);
+    if(readResult.invalid())
+    {
+      return readResult;
+    }
+
+    auto& dataStore = dynamic_cast<DataArray<T>&>(imageArray).getDataStoreRef();
+    if(dataStore.getSize() != imageBuffer.Values.size())
+    {
+      return MakeErrorResult(-18544, fmt::format("The image '{}' has {} values but {} were expected from preflight.", filePath.string(), imageBuffer.Values.size(), dataStore.getSize()));
+    }
+    // Out-of-core stores may share one file, so only the decoding runs in parallel
+    std::lock_guard<std::mutex> lock(storeMutex);
+    return dataStore.copyFromBuffer(0, imageBuffer.Values);
+  }
+};
+
+class ReadTileTask
+{
+public:
+  ReadTileTask(IDataArray& imageArray, const fs::path& filePath, bool changeDataType, std::mutex& storeMutex, Result<>& result)
+  : m_ImageArray(imageArray)
+  , m_FilePath(filePath)
+  , m_ChangeDataType(changeDataType)
+  , m_StoreMutex(storeMutex)
+  , m_Result(result)
+  {
+  }
+
+  void operator()() const
+  {
+    m_Result = ExecuteNeighborFunction(ReadTileIntoArrayFunctor{}, m_ImageArray.getDataType(), m_ImageArray, m_FilePath, m_ChangeDataType, m_StoreMutex);
+  }
+
+private:
+  IDataArray& m_ImageArray;
+  const fs::path& m_FilePath;
+  bool m_ChangeDataType;
+  std::mutex& m_StoreMutex;
+  Result<>& m_Result;
+};
+
+struct CreateMosaicFunctor
+{
+  template <class T>
+  Result<> operator()(IDataArray& mosaicArray, const std::shared_ptr<const MontageMosaic::MosaicLayout>& layout, bool virtualMosaic, uint64 cacheCapacity,
+                      const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+  {
+    auto& dataArray = dynamic_cast<DataArray<T>&>(mosaicArray);
+    if(virtualMosaic)
+    {
+      dataArray.setDataStore(std::make_shared<VirtualMosaicDataStore<T>>(layout, cacheCapacity));
+      return {};
+    }
+    return MontageMosaic::AssembleMosaic<T>(layout, dataArray.getDataStoreRef(), cacheCapacity, messageHandler, shouldCancel);
+  }
+};
+
 template <bool GenerateCache = true>
 class IOHandler
 {
@@ -54,14 +126,13 @@ public:
 
     if(!m_Allocate)
     {
-      fillCache();
+      return fillCache();
     }
-    else
+    if(m_InputValues->montageOutput != FijiMontageOutput::TileGeometries)
     {
-      return readImages();
+      return createMosaic();
     }
-
-    return {};
+    return readImages();
   }
 
 private:
@@ -138,7 +209,7 @@ private:
   }
 
   // -----------------------------------------------------------------------------
-  void fillCache()
+  Result<> fillCache()
   {
     parseConfigFile();
 
@@ -173,7 +244,30 @@ private:
     std::stringstream ss;
     ss << "\n"
        << "Imported Image Count: " << m_Cache.bounds.size();
+
+    // The mosaic is laid out from the image headers, the pixels are not read until execute
+    if(m_InputValues->montageOutput != FijiMontageOutput::TileGeometries)
+    {
+      for(const auto& bound : m_Cache.bounds)
+      {
+        auto informationResult = MontageMosaic::ReadTileInformation(bound.Filepath.string());
+        if(informationResult.invalid())
+        {
+          return ConvertResult(std::move(informationResult));
+        }
+        m_Cache.tileInformation.push_back(informationResult.value());
+      }
+      auto mosaicResult = GetMosaicInformation(m_Cache, *m_InputValues);
+      if(mosaicResult.invalid())
+      {
+        return ConvertResult(std::move(mosaicResult));
+      }
+      ss << "\n"
+         << "Mosaic Dimensions: " << mosaicResult.value().Width << " x " << mosaicResult.value().Height;
+    }
     m_Cache.montageInformation = ss.str();
+
+    return {};
   }
 
   // -----------------------------------------------------------------------------
@@ -184,48 +278,48 @@ private:
     auto* filterListPtr = Application::Instance()->getFilterList();
     // auto imageImportFilter = ITKImageReaderFilter();
 
-    for(const auto& bound : m_Cache.bounds)
+    const usize numTiles = m_Cache.bounds.size();
+    std::vector<DataPath> imageDataPaths(numTiles);
+    for(usize i = 0; i < numTiles; i++)
     {
-      m_Filter->sendUpdate(("Importing " + bound.Filepath.filename().string()));
-
-      DataPath imageDataPath = {};
+      const auto& bound = m_Cache.bounds[i];
       if(m_InputValues->parentDataGroup)
       {
-        imageDataPath = DataPath({m_InputValues->DataGroupName, bound.ImageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
+        imageDataPaths[i] = DataPath({m_InputValues->DataGroupName, bound.ImageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
       }
       else
       {
-        imageDataPath = DataPath({bound.ImageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
-      }
-
-      // Ensure that we are dealing with in-core memory ONLY
-      const IDataArray* inputArrayPtr = m_DataStructure.getDataAs<IDataArray>(imageDataPath);
-      if(!inputArrayPtr->getDataFormat().empty())
-      {
-        return MakeErrorResult(-9999, fmt::format("Input Array '{}' utilizes out-of-core data. This is not supported within ITK filters.", imageDataPath.toString()));
+        imageDataPaths[i] = DataPath({bound.ImageName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
       }
 
       // Set the Correct Origin, Spacing and Units for the Image Geometry
-      auto* image = m_DataStructure.getDataAs<ImageGeom>(imageDataPath.getParent().getParent());
+      auto* image = m_DataStructure.getDataAs<ImageGeom>(imageDataPaths[i].getParent().getParent());
       image->setUnits(m_InputValues->lengthUnit);
       image->setOrigin(bound.Origin);
       image->setSpacing(FloatVec3(1.0f, 1.0f, 1.0f));
+    }
 
-      // Use ITKUtils to read the image into the DataStructure
-      Result<> imageReaderResult;
-      if(m_InputValues->changeDataType)
-      {
-        imageReaderResult = cxItkImageReaderFilter::ReadImageExecute<cxItkImageReaderFilter::ReadImageIntoArrayFunctor>(bound.Filepath.string(), m_DataStructure, bound.Filepath.string(),
-                                                                                                                        imageDataPath, m_InputValues->destType);
-      }
-      else
+    // The tiles are independent of each other, so they are all decoded in parallel
+    m_Filter->sendUpdate(fmt::format("Importing {} images", numTiles));
+    std::vector<Result<>> readResults(numTiles);
+    {
+      std::mutex storeMutex;
+      ParallelTaskAlgorithm taskRunner;
+      for(usize i = 0; i < numTiles; i++)
       {
-        imageReaderResult =
-            cxItkImageReaderFilter::ReadImageExecute<cxItkImageReaderFilter::ReadImageIntoArrayFunctor>(bound.Filepath.string(), m_DataStructure, imageDataPath, bound.Filepath.string());
+        auto& imageArray = m_DataStructure.getDataRefAs<IDataArray>(imageDataPaths[i]);
+        taskRunner.execute(ReadTileTask(imageArray, m_Cache.bounds[i].Filepath, m_InputValues->changeDataType, storeMutex, readResults[i]));
       }
-      if(imageReaderResult.invalid())
+      taskRunner.wait();
+    }
+
+    for(usize i = 0; i < numTiles; i++)
+    {
+      const DataPath& imageDataPath = imageDataPaths[i];
+      if(readResults[i].invalid())
       {
-        for(const auto& error : imageReaderResult.errors())
+        m_Filter->sendUpdate(("Importing " + m_Cache.bounds[i].Filepath.filename().string()));
+        for(const auto& error : readResults[i].errors())
         {
           m_Filter->sendUpdate(fmt::format("|-- Error Reading Image: Code ({}) - {}", error.code, error.message));
         }
@@ -288,9 +382,103 @@ private:
 
     return outputResult;
   }
+
+  // -----------------------------------------------------------------------------
+  Result<> createMosaic()
+  {
+    DataPath mosaicDataPath({m_InputValues->mosaicGeometryName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
+    if(m_InputValues->parentDataGroup)
+    {
+      mosaicDataPath = DataPath({m_InputValues->DataGroupName, m_InputValues->mosaicGeometryName, m_InputValues->cellAMName, m_InputValues->imageDataArrayName});
+    }
+
+    auto& mosaicArray = m_DataStructure.getDataRefAs<IDataArray>(mosaicDataPath);
+    std::shared_ptr<const MontageMosaic::MosaicLayout> layout = CreateMosaicLayout(m_Cache, *m_InputValues, mosaicArray.getNumberOfComponents());
+    if(layout->getWidth() * layout->getHeight() != mosaicArray.getNumberOfTuples())
+    {
+      return MakeErrorResult(-18546, fmt::format("The mosaic is {} x {} pixels but {} were expected from preflight. The images have changed on disk.", layout->getWidth(), layout->getHeight(),
+                                                 mosaicArray.getNumberOfTuples()));
+    }
+
+    const bool virtualMosaic = m_InputValues->montageOutput == FijiMontageOutput::VirtualMosaic;
+    return ExecuteNeighborFunction(CreateMosaicFunctor{}, mosaicArray.getDataType(), mosaicArray, layout, virtualMosaic, ITK::GetStreamingMemoryBudget(), m_Filter->getMessageHandler(),
+                                   m_Filter->getCancel());
+  }
 };
 } // namespace
 
+// -----------------------------------------------------------------------------
+Result<MontageMosaic::TileInformation> nx::core::GetMosaicInformation(const FijiCache& cache, const ITKImportFijiMontageInputValues& inputValues)
+{
+  if(cache.tileInformation.empty() || cache.tileInformation.size() != cache.bounds.size())
+  {
+    return MakeErrorResult<MontageMosaic::TileInformation>(-18547, "The configuration file does not list any images to stitch into a mosaic.");
+  }
+
+  const MontageMosaic::TileInformation& firstTile = cache.tileInformation.front();
+  for(usize i = 1; i < cache.tileInformation.size(); i++)
+  {
+    if(cache.tileInformation[i].NumComponents != firstTile.NumComponents)
+    {
+      return MakeErrorResult<MontageMosaic::TileInformation>(-18545, fmt::format("The image '{}' has {} components per pixel but '{}' has {}. All images of a mosaic need the same components.",
+                                                                                 cache.bounds[i].Filepath.string(), cache.tileInformation[i].NumComponents,
+                                                                                 cache.bounds.front().Filepath.string(), firstTile.NumComponents));
+    }
+  }
+
+  MontageMosaic::TileInformation mosaicInformation = firstTile;
+  if(inputValues.changeDataType && ExecuteNeighborFunction(ITK::detail::PreflightTypeConversionValidateFunctor{}, firstTile.Type, inputValues.destType))
+  {
+    mosaicInformation.Type = inputValues.destType;
+  }
+  if(inputValues.convertToGrayScale && mosaicInformation.Type == DataType::uint8 && mosaicInformation.NumComponents >= 3)
+  {
+    mosaicInformation.NumComponents = 1;
+  }
+
+  std::shared_ptr<const MontageMosaic::MosaicLayout> layout = CreateMosaicLayout(cache, inputValues, mosaicInformation.NumComponents);
+  mosaicInformation.Width = layout->getWidth();
+  mosaicInformation.Height = layout->getHeight();
+  return {mosaicInformation};
+}
+
+// -----------------------------------------------------------------------------
+FloatVec3 nx::core::GetMosaicOrigin(const FijiCache& cache)
+{
+  if(cache.bounds.empty())
+  {
+    return {0.0f, 0.0f, 0.0f};
+  }
+  FloatVec3 origin = {std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(), 0.0f};
+  for(const auto& bound : cache.bounds)
+  {
+    origin[0] = std::min(bound.Origin[0], origin[0]);
+    origin[1] = std::min(bound.Origin[1], origin[1]);
+  }
+  return origin;
+}
+
+// -----------------------------------------------------------------------------
+std::shared_ptr<const MontageMosaic::MosaicLayout> nx::core::CreateMosaicLayout(const FijiCache& cache, const ITKImportFijiMontageInputValues& inputValues, usize numComponents)
+{
+  const FloatVec3 origin = GetMosaicOrigin(cache);
+  std::vector<MontageMosaic::TilePlacement> tiles(cache.bounds.size());
+  for(usize i = 0; i < cache.bounds.size() && i < cache.tileInformation.size(); i++)
+  {
+    tiles[i].FilePath = cache.bounds[i].Filepath.string();
+    tiles[i].X = static_cast<usize>(std::max(std::round(cache.bounds[i].Origin[0] - origin[0]), 0.0f));
+    tiles[i].Y = static_cast<usize>(std::max(std::round(cache.bounds[i].Origin[1] - origin[1]), 0.0f));
+    tiles[i].Width = cache.tileInformation[i].Width;
+    tiles[i].Height = cache.tileInformation[i].Height;
+  }
+
+  MontageMosaic::TileReadOptions readOptions;
+  readOptions.ChangeDataType = inputValues.changeDataType;
+  readOptions.ConvertToGrayScale = inputValues.convertToGrayScale;
+  readOptions.ColorWeights = inputValues.colorWeights;
+  return std::make_shared<const MontageMosaic::MosaicLayout>(std::move(tiles), numComponents, inputValues.blendMode, std::move(readOptions));
+}
+
 // -----------------------------------------------------------------------------
 ITKImportFijiMontage::ITKImportFijiMontage(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ITKImportFijiMontageInputValues* inputValues,
                                            FijiCache& cache)
@@ -314,6 +502,12 @@ FijiCache& ITKImportFijiMontage::getCache()
   return m_Cache;
 }
 
+// -----------------------------------------------------------------------------
+const IFilter::MessageHandler& ITKImportFijiMontage::getMessageHandler()
+{
+  return m_MessageHandler;
+}
+
 // -----------------------------------------------------------------------------
 void ITKImportFijiMontage::sendUpdate(const std::string& message)
 {
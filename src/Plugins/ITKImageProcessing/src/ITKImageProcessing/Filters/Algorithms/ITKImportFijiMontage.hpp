@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ITKImageProcessing/Common/MontageMosaic.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_export.hpp"
 
 #include "simplnx/Common/Array.hpp"
@@ -12,6 +13,16 @@ namespace fs = std::filesystem;
 
 namespace nx::core
 {
+/**
+ * @brief What the filter creates from the tiles of the montage.
+ */
+enum class FijiMontageOutput : uint64
+{
+  TileGeometries = 0, // One image geometry per tile
+  StitchedMosaic = 1, // One image geometry that holds all tiles stitched together
+  VirtualMosaic = 2   // Like StitchedMosaic, but the tiles are only read when the mosaic is accessed
+};
+
 struct ITKIMAGEPROCESSING_EXPORT ITKImportFijiMontageInputValues
 {
   bool allocate = false;
@@ -28,6 +39,9 @@ struct ITKIMAGEPROCESSING_EXPORT ITKImportFijiMontageInputValues
   std::string imagePrefix = "";
   std::string cellAMName = "";
   std::string imageDataArrayName = "";
+  FijiMontageOutput montageOutput = FijiMontageOutput::TileGeometries;
+  MontageMosaic::BlendMode blendMode = MontageMosaic::BlendMode::None;
+  std::string mosaicGeometryName = "";
 };
 
 struct ITKIMAGEPROCESSING_EXPORT BoundsType
@@ -41,6 +55,7 @@ struct ITKIMAGEPROCESSING_EXPORT FijiCache
 {
   fs::path inputFile;
   std::vector<BoundsType> bounds;
+  std::vector<MontageMosaic::TileInformation> tileInformation; // Only read when a mosaic is created
   std::string montageInformation;
   fs::file_time_type timeStamp;
   ITKImportFijiMontageInputValues inputValues = {};
@@ -49,6 +64,7 @@ struct ITKIMAGEPROCESSING_EXPORT FijiCache
   {
     inputFile.clear();
     bounds.clear();
+    tileInformation.clear();
     montageInformation = "";
     timeStamp = fs::file_time_type();
     inputValues = {};
@@ -70,6 +86,11 @@ struct ITKIMAGEPROCESSING_EXPORT FijiCache
       return true;
     }
 
+    if(inputValues.montageOutput != newVals.montageOutput)
+    {
+      return true;
+    }
+
     // check loops last to avoid running them unless absolutely necessary
     if(newVals.changeOrigin)
     {
@@ -86,6 +107,32 @@ struct ITKIMAGEPROCESSING_EXPORT FijiCache
   }
 };
 
+/**
+ * @brief Returns the dimensions, number of components and pixel type of the mosaic that the tiles in the cache are
+ * stitched into. The tile information must have been read into the cache.
+ * @param cache
+ * @param inputValues
+ * @return Result<MontageMosaic::TileInformation>
+ */
+ITKIMAGEPROCESSING_EXPORT Result<MontageMosaic::TileInformation> GetMosaicInformation(const FijiCache& cache, const ITKImportFijiMontageInputValues& inputValues);
+
+/**
+ * @brief Returns the origin of the mosaic, which is the smallest origin of all tiles.
+ * @param cache
+ * @return FloatVec3
+ */
+ITKIMAGEPROCESSING_EXPORT FloatVec3 GetMosaicOrigin(const FijiCache& cache);
+
+/**
+ * @brief Places the tiles in the cache into the mosaic. The tiles are 1 pixel per unit, so the offset of a tile is its
+ * origin relative to the mosaic origin, rounded to whole pixels.
+ * @param cache
+ * @param inputValues
+ * @param numComponents
+ * @return std::shared_ptr<const MontageMosaic::MosaicLayout>
+ */
+ITKIMAGEPROCESSING_EXPORT std::shared_ptr<const MontageMosaic::MosaicLayout> CreateMosaicLayout(const FijiCache& cache, const ITKImportFijiMontageInputValues& inputValues, usize numComponents);
+
 /**
  * @class ITKImportImageStack
  * @brief This filter will ....
@@ -107,6 +154,8 @@ public:
 
   FijiCache& getCache();
 
+  const IFilter::MessageHandler& getMessageHandler();
+
   void sendUpdate(const std::string& message);
 
 private:
@@ -22,6 +22,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKAcosImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
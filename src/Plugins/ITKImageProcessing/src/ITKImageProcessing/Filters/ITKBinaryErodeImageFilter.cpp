@@ -25,6 +25,8 @@ using ArrayOptionsType = ITK::IntegerScalarPixelIdTypeList;
 
 struct ITKBinaryErodeImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   std::vector<uint32> kernelRadius = {1, 1, 1};
   itk::simple::KernelEnum kernelType = itk::simple::sitkBall;
   float64 backgroundValue = 0.0;
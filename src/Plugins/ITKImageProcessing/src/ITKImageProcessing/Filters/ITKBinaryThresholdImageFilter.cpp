@@ -24,6 +24,8 @@ using FilterOutputType = uint8;
 
 struct ITKBinaryThresholdImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   float64 lowerThreshold = 0.0;
   float64 upperThreshold = 255.0;
   uint8 insideValue = 1u;
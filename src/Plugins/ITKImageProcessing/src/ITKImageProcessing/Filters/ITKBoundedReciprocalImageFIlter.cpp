@@ -20,6 +20,8 @@ using FilterOutputType = double;
 
 struct ITKBoundedReciprocalImageFilterFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
@@ -24,6 +24,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKDiscreteGaussianImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   using VarianceInputArrayType = std::vector<float64>;
   VarianceInputArrayType variance = std::vector<double>(3, 1.0);
   uint32 maximumKernelWidth = 32u;
@@ -24,6 +24,8 @@ using FilterOutputType = float32;
 
 struct ITKGradientMagnitudeImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   bool useImageSpacing = true;
 
   template <class InputImageT, class OutputImageT, uint32 Dimension>
@@ -23,6 +23,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKGrayscaleErodeImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   std::vector<uint32> kernelRadius = {1, 1, 1};
   itk::simple::KernelEnum kernelType = itk::simple::sitkBall;
 
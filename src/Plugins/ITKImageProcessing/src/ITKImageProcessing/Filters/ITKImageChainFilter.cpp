@@ -0,0 +1,450 @@
+#include "ITKImageChainFilter.hpp"
+
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
+#include "ITKImageProcessing/Common/sitkCommon.hpp"
+
+#include "simplnx/Parameters/ArraySelectionParameter.hpp"
+#include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Parameters/DynamicTableParameter.hpp"
+#include "simplnx/Parameters/GeometrySelectionParameter.hpp"
+#include "simplnx/Parameters/NumberParameter.hpp"
+
+#include <itkBinaryThresholdImageFilter.h>
+#include <itkCastImageFilter.h>
+#include <itkCurvatureAnisotropicDiffusionImageFilter.h>
+#include <itkDiscreteGaussianImageFilter.h>
+#include <itkGradientMagnitudeImageFilter.h>
+#include <itkGrayscaleDilateImageFilter.h>
+#include <itkGrayscaleErodeImageFilter.h>
+#include <itkMedianImageFilter.h>
+#include <itkStreamingImageFilter.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace nx::core;
+
+namespace cxITKImageChainFilter
+{
+using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
+template <class PixelT>
+using FilterOutputType = float32;
+
+// Every stage of the chain reads and writes images of this pixel type
+using IntermediatePixelType = float32;
+
+constexpr int32 k_NoStagesError = -21500;
+constexpr int32 k_InvalidOperationError = -21501;
+constexpr int32 k_InvalidStageParameterError = -21502;
+constexpr int32 k_InvalidStreamDivisionsError = -21503;
+
+constexpr usize k_NumStageParameters = 4;
+
+enum class Operation : uint8
+{
+  Median = 0,
+  DiscreteGaussian = 1,
+  CurvatureAnisotropicDiffusion = 2,
+  GradientMagnitude = 3,
+  BinaryThreshold = 4,
+  GrayscaleDilate = 5,
+  GrayscaleErode = 6
+};
+
+constexpr std::array<const char*, 7> k_OperationNames = {"Median", "Discrete Gaussian", "Curvature Anisotropic Diffusion", "Gradient Magnitude", "Binary Threshold", "Grayscale Dilate",
+                                                         "Grayscale Erode"};
+
+struct ChainStage
+{
+  Operation operation = Operation::Median;
+  std::array<float64, k_NumStageParameters> values = {};
+};
+
+bool IsWholeNumber(float64 value)
+{
+  return value >= 0.0 && std::floor(value) == value;
+}
+
+/**
+ * @brief Returns true for the operations whose filter needs its whole input image to compute any part of its output.
+ * @param operation
+ * @return bool
+ */
+bool NeedsWholeInput(Operation operation)
+{
+  return operation == Operation::CurvatureAnisotropicDiffusion;
+}
+
+/**
+ * @brief Converts the rows of the operations table into the stages of the chain and validates their parameters.
+ * @param table
+ * @return Result<std::vector<ChainStage>>
+ */
+Result<std::vector<ChainStage>> ParseStages(const DynamicTableInfo::TableDataType& table)
+{
+  if(table.empty())
+  {
+    return MakeErrorResult<std::vector<ChainStage>>(k_NoStagesError, "The operations table must contain at least one stage.");
+  }
+
+  std::vector<ChainStage> stages;
+  stages.reserve(table.size());
+  for(usize row = 0; row < table.size(); row++)
+  {
+    const DynamicTableInfo::RowType& rowValues = table[row];
+    if(rowValues.size() < k_NumStageParameters + 1)
+    {
+      return MakeErrorResult<std::vector<ChainStage>>(k_InvalidStageParameterError,
+                                                      fmt::format("Stage {} must have an operation and {} parameter values.", row + 1, k_NumStageParameters));
+    }
+    if(!IsWholeNumber(rowValues[0]) || rowValues[0] >= static_cast<float64>(k_OperationNames.size()))
+    {
+      return MakeErrorResult<std::vector<ChainStage>>(k_InvalidOperationError, fmt::format("Stage {} has the operation '{}'. The operation must be a whole number between 0 and {}.", row + 1,
+                                                                                           rowValues[0], k_OperationNames.size() - 1));
+    }
+
+    ChainStage stage;
+    stage.operation = static_cast<Operation>(static_cast<uint8>(rowValues[0]));
+    std::copy_n(rowValues.cbegin() + 1, k_NumStageParameters, stage.values.begin());
+
+    const auto& values = stage.values;
+    std::string problem;
+    switch(stage.operation)
+    {
+    case Operation::Median:
+    case Operation::GrayscaleDilate:
+    case Operation::GrayscaleErode:
+      if(!IsWholeNumber(values[0]))
+      {
+        problem = "the radius must be a whole number";
+      }
+      break;
+    case Operation::DiscreteGaussian:
+      if(values[0] < 0.0)
+      {
+        problem = "the variance must not be negative";
+      }
+      else if(values[1] <= 0.0 || values[1] >= 1.0)
+      {
+        problem = "the maximum error must be between 0 and 1";
+      }
+      else if(!IsWholeNumber(values[2]) || values[2] < 1.0)
+      {
+        problem = "the maximum kernel width must be a whole number of at least 1";
+      }
+      break;
+    case Operation::CurvatureAnisotropicDiffusion:
+      if(values[0] <= 0.0)
+      {
+        problem = "the time step must be greater than 0";
+      }
+      else if(!IsWholeNumber(values[2]) || values[2] < 1.0)
+      {
+        problem = "the number of iterations must be a whole number of at least 1";
+      }
+      break;
+    case Operation::GradientMagnitude:
+      break;
+    case Operation::BinaryThreshold:
+      if(values[0] > values[1])
+      {
+        problem = "the lower threshold must not be greater than the upper threshold";
+      }
+      break;
+    }
+    if(!problem.empty())
+    {
+      return MakeErrorResult<std::vector<ChainStage>>(k_InvalidStageParameterError,
+                                                      fmt::format("Stage {} ({}): {}.", row + 1, k_OperationNames[static_cast<usize>(stage.operation)], problem));
+    }
+
+    stages.push_back(stage);
+  }
+
+  return {std::move(stages)};
+}
+
+template <uint32 Dimension>
+using IntermediateImageType = itk::Image<IntermediatePixelType, Dimension>;
+
+template <uint32 Dimension>
+using StageFilterType = itk::ImageToImageFilter<IntermediateImageType<Dimension>, IntermediateImageType<Dimension>>;
+
+/**
+ * @brief Creates the ITK filter of one stage. The filters are configured the same way the single operation filters
+ * of this plugin configure them.
+ * @param stage
+ * @return typename StageFilterType<Dimension>::Pointer
+ */
+template <uint32 Dimension>
+typename StageFilterType<Dimension>::Pointer CreateStageFilter(const ChainStage& stage)
+{
+  using ImageType = IntermediateImageType<Dimension>;
+  const auto& values = stage.values;
+
+  switch(stage.operation)
+  {
+  case Operation::Median: {
+    auto filter = itk::MedianImageFilter<ImageType, ImageType>::New();
+    filter->SetRadius(static_cast<itk::SizeValueType>(values[0]));
+    return filter.GetPointer();
+  }
+  case Operation::DiscreteGaussian: {
+    auto filter = itk::DiscreteGaussianImageFilter<ImageType, ImageType>::New();
+    filter->SetVariance(values[0]);
+    filter->SetMaximumError(values[1]);
+    filter->SetMaximumKernelWidth(static_cast<uint32>(values[2]));
+    filter->SetUseImageSpacing(true);
+    return filter.GetPointer();
+  }
+  case Operation::CurvatureAnisotropicDiffusion: {
+    auto filter = itk::CurvatureAnisotropicDiffusionImageFilter<ImageType, ImageType>::New();
+    filter->SetTimeStep(values[0]);
+    filter->SetConductanceParameter(values[1]);
+    filter->SetNumberOfIterations(static_cast<uint32>(values[2]));
+    return filter.GetPointer();
+  }
+  case Operation::GradientMagnitude: {
+    auto filter = itk::GradientMagnitudeImageFilter<ImageType, ImageType>::New();
+    filter->SetUseImageSpacing(true);
+    return filter.GetPointer();
+  }
+  case Operation::BinaryThreshold: {
+    auto filter = itk::BinaryThresholdImageFilter<ImageType, ImageType>::New();
+    filter->SetLowerThreshold(static_cast<IntermediatePixelType>(values[0]));
+    filter->SetUpperThreshold(static_cast<IntermediatePixelType>(values[1]));
+    filter->SetInsideValue(static_cast<IntermediatePixelType>(values[2]));
+    filter->SetOutsideValue(static_cast<IntermediatePixelType>(values[3]));
+    return filter.GetPointer();
+  }
+  case Operation::GrayscaleDilate: {
+    auto filter = itk::GrayscaleDilateImageFilter<ImageType, ImageType, itk::FlatStructuringElement<Dimension>>::New();
+    filter->SetKernel(itk::simple::CreateKernel<Dimension>(itk::simple::sitkBall, std::vector<uint32>(3, static_cast<uint32>(values[0]))));
+    return filter.GetPointer();
+  }
+  case Operation::GrayscaleErode: {
+    auto filter = itk::GrayscaleErodeImageFilter<ImageType, ImageType, itk::FlatStructuringElement<Dimension>>::New();
+    filter->SetKernel(itk::simple::CreateKernel<Dimension>(itk::simple::sitkBall, std::vector<uint32>(3, static_cast<uint32>(values[0]))));
+    return filter.GetPointer();
+  }
+  }
+  return nullptr;
+}
+
+template <class InputPixelT, class OutputPixelT, uint32 Dimension>
+struct ITKImageChainFunctor
+{
+  Result<> operator()(IDataStore& inputDataStore, const ImageGeom& imageGeom, IDataStore& outputDataStore, const std::vector<ChainStage>& stages, uint32 numberOfStreamDivisions, uint64 memoryBudget,
+                      const std::atomic_bool& shouldCancel) const
+  {
+    using InputImageType = itk::Image<InputPixelT, Dimension>;
+    using ImageType = IntermediateImageType<Dimension>;
+    using InputValueType = ITK::UnderlyingType_t<InputPixelT>;
+    using OutputValueType = ITK::UnderlyingType_t<OutputPixelT>;
+
+    // Stores that are not held in memory are read and written one slab at a time instead of being wrapped
+    auto* inMemoryInputStore = dynamic_cast<DataStore<InputValueType>*>(&inputDataStore);
+    auto* inMemoryOutputStore = dynamic_cast<DataStore<OutputValueType>*>(&outputDataStore);
+    const bool streamFromStore = inMemoryInputStore == nullptr || inMemoryOutputStore == nullptr;
+
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New(shouldCancel);
+
+    auto castFilter = itk::CastImageFilter<InputImageType, ImageType>::New();
+    castFilter->ReleaseDataFlagOn();
+
+    typename InputImageType::Pointer inputImage;
+    typename itk::DataStoreImageSource<InputImageType>::Pointer source;
+    if(streamFromStore)
+    {
+      source = ITK::CreateDataStoreImageSource<InputPixelT, Dimension>(dynamic_cast<const AbstractDataStore<InputValueType>&>(inputDataStore), imageGeom);
+      source->ReleaseDataFlagOn();
+      castFilter->SetInput(source->GetOutput());
+    }
+    else
+    {
+      inputImage = ITK::WrapDataStoreInImage<InputPixelT, Dimension>(*inMemoryInputStore, imageGeom);
+      castFilter->SetInput(inputImage);
+    }
+
+    // Every stage frees its output as soon as the next stage has read it, so only the slab that is currently being
+    // streamed exists for the intermediate images. Stages that need their whole input compute their whole output
+    // anyway; they keep it so the stages before them are not executed again for every slab. The filters have to stay
+    // alive until the pipeline has run.
+    std::vector<typename StageFilterType<Dimension>::Pointer> stageFilters;
+    stageFilters.reserve(stages.size());
+    ImageType* stageInput = castFilter->GetOutput();
+    for(const ChainStage& stage : stages)
+    {
+      typename StageFilterType<Dimension>::Pointer filter = CreateStageFilter<Dimension>(stage);
+      filter->SetInput(stageInput);
+      if(!NeedsWholeInput(stage.operation))
+      {
+        filter->ReleaseDataFlagOn();
+      }
+      filter->AddObserver(itk::ProgressEvent(), interruption);
+      stageInput = filter->GetOutput();
+      stageFilters.push_back(filter);
+    }
+
+    if(streamFromStore)
+    {
+      return ITK::StreamImageSlabs(*source->GetOutput(), *stageInput, dynamic_cast<AbstractDataStore<OutputValueType>&>(outputDataStore), memoryBudget, shouldCancel);
+    }
+
+    auto streamingFilter = itk::StreamingImageFilter<ImageType, ImageType>::New();
+    streamingFilter->SetInput(stageInput);
+    streamingFilter->SetNumberOfStreamDivisions(numberOfStreamDivisions);
+    streamingFilter->AddObserver(itk::ProgressEvent(), interruption);
+    streamingFilter->Update();
+
+    typename ImageType::Pointer outputImage = streamingFilter->GetOutput();
+    outputImage->DisconnectPipeline();
+
+    *inMemoryOutputStore = ITK::ConvertImageToDataStore(*outputImage);
+
+    return {};
+  }
+};
+} // namespace cxITKImageChainFilter
+
+namespace nx::core
+{
+//------------------------------------------------------------------------------
+std::string ITKImageChainFilter::name() const
+{
+  return FilterTraits<ITKImageChainFilter>::name;
+}
+
+//------------------------------------------------------------------------------
+std::string ITKImageChainFilter::className() const
+{
+  return FilterTraits<ITKImageChainFilter>::className;
+}
+
+//------------------------------------------------------------------------------
+Uuid ITKImageChainFilter::uuid() const
+{
+  return FilterTraits<ITKImageChainFilter>::uuid;
+}
+
+//------------------------------------------------------------------------------
+std::string ITKImageChainFilter::humanName() const
+{
+  return "ITK Image Chain Filter";
+}
+
+//------------------------------------------------------------------------------
+std::vector<std::string> ITKImageChainFilter::defaultTags() const
+{
+  return {className(), "ITKImageProcessing", "ITKImageChain", "Pipeline", "Streaming", "Smoothing", "MathematicalMorphology"};
+}
+
+//------------------------------------------------------------------------------
+Parameters ITKImageChainFilter::parameters() const
+{
+  Parameters params;
+  params.insertSeparator(Parameters::Separator{"Input Parameter(s)"});
+  {
+    DynamicTableInfo tableInfo;
+    tableInfo.setColsInfo(DynamicTableInfo::StaticVectorInfo({"Operation", "Parameter 1", "Parameter 2", "Parameter 3", "Parameter 4"}));
+    tableInfo.setRowsInfo(DynamicTableInfo::DynamicVectorInfo(1, "Stage {}"));
+    const DynamicTableInfo::TableDataType defaultTable{{{1.0, 1.0, 0.01, 32.0, 0.0}, {0.0, 1.0, 0.0, 0.0, 0.0}}};
+    params.insert(std::make_unique<DynamicTableParameter>(
+        k_Operations_Key, "Operations",
+        "The stages of the chain in the order they are applied. Operation: 0 = Median (radius), 1 = Discrete Gaussian (variance, maximum error, maximum kernel width), 2 = Curvature Anisotropic "
+        "Diffusion (time step, conductance, iterations), 3 = Gradient Magnitude, 4 = Binary Threshold (lower, upper, inside value, outside value), 5 = Grayscale Dilate (radius), 6 = Grayscale Erode "
+        "(radius)",
+        defaultTable, tableInfo));
+  }
+  params.insert(std::make_unique<UInt32Parameter>(k_NumberOfStreamDivisions_Key, "Number of Stream Divisions",
+                                                  "The number of slabs the output is computed in. More slabs need less memory for the intermediate images.", 8u));
+
+  params.insertSeparator(Parameters::Separator{"Input Cell Data"});
+  params.insert(std::make_unique<GeometrySelectionParameter>(k_InputImageGeomPath_Key, "Image Geometry", "Select the Image Geometry Group from the DataStructure.", DataPath({"Image Geometry"}),
+                                                             GeometrySelectionParameter::AllowedTypes{IGeometry::Type::Image}));
+  params.insert(std::make_unique<ArraySelectionParameter>(k_InputImageDataPath_Key, "Input Cell Data", "The image data that will be processed by this filter.", DataPath{},
+                                                          nx::core::ITK::GetScalarPixelAllowedTypes()));
+
+  params.insertSeparator(Parameters::Separator{"Output Cell Data"});
+  params.insert(std::make_unique<DataObjectNameParameter>(k_OutputImageArrayName_Key, "Output Cell Data",
+                                                          "The float32 result of the last stage will be stored in this Data Array inside the same group as the input data.", "Output Image Data"));
+
+  return params;
+}
+
+//------------------------------------------------------------------------------
+IFilter::VersionType ITKImageChainFilter::parametersVersion() const
+{
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+IFilter::UniquePointer ITKImageChainFilter::clone() const
+{
+  return std::make_unique<ITKImageChainFilter>();
+}
+
+//------------------------------------------------------------------------------
+IFilter::PreflightResult ITKImageChainFilter::preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler,
+                                                            const std::atomic_bool& shouldCancel) const
+{
+  auto imageGeomPath = filterArgs.value<DataPath>(k_InputImageGeomPath_Key);
+  auto selectedInputArray = filterArgs.value<DataPath>(k_InputImageDataPath_Key);
+  auto outputArrayName = filterArgs.value<DataObjectNameParameter::ValueType>(k_OutputImageArrayName_Key);
+  auto operations = filterArgs.value<DynamicTableParameter::ValueType>(k_Operations_Key);
+  auto numberOfStreamDivisions = filterArgs.value<uint32>(k_NumberOfStreamDivisions_Key);
+
+  const DataPath outputArrayPath = selectedInputArray.replaceName(outputArrayName);
+
+  auto stagesResult = cxITKImageChainFilter::ParseStages(operations);
+  if(stagesResult.invalid())
+  {
+    return {ConvertResultTo<OutputActions>(ConvertResult(std::move(stagesResult)), {})};
+  }
+  if(numberOfStreamDivisions == 0)
+  {
+    return {MakeErrorResult<OutputActions>(cxITKImageChainFilter::k_InvalidStreamDivisionsError, "The number of stream divisions must be at least 1.")};
+  }
+
+  Result<OutputActions> resultOutputActions =
+      ITK::DataCheck<cxITKImageChainFilter::ArrayOptionsType, cxITKImageChainFilter::FilterOutputType>(dataStructure, selectedInputArray, imageGeomPath, outputArrayPath);
+
+  return {std::move(resultOutputActions)};
+}
+
+//------------------------------------------------------------------------------
+Result<> ITKImageChainFilter::executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                                          const std::atomic_bool& shouldCancel) const
+{
+  auto imageGeomPath = filterArgs.value<DataPath>(k_InputImageGeomPath_Key);
+  auto selectedInputArray = filterArgs.value<DataPath>(k_InputImageDataPath_Key);
+  auto outputArrayName = filterArgs.value<DataObjectNameParameter::ValueType>(k_OutputImageArrayName_Key);
+  const DataPath outputArrayPath = selectedInputArray.replaceName(outputArrayName);
+
+  auto operations = filterArgs.value<DynamicTableParameter::ValueType>(k_Operations_Key);
+  auto numberOfStreamDivisions = filterArgs.value<uint32>(k_NumberOfStreamDivisions_Key);
+
+  auto stagesResult = cxITKImageChainFilter::ParseStages(operations);
+  if(stagesResult.invalid())
+  {
+    return ConvertResult(std::move(stagesResult));
+  }
+
+  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
+  auto& inputArray = dataStructure.getDataRefAs<IDataArray>(selectedInputArray);
+  auto& outputArray = dataStructure.getDataRefAs<IDataArray>(outputArrayPath);
+
+  try
+  {
+    return ITK::ArraySwitchFunc<cxITKImageChainFilter::ITKImageChainFunctor, cxITKImageChainFilter::ArrayOptionsType, void, cxITKImageChainFilter::FilterOutputType>(
+        inputArray.getIDataStoreRef(), imageGeom, -1, inputArray.getIDataStoreRef(), imageGeom, outputArray.getIDataStoreRef(), stagesResult.value(), numberOfStreamDivisions,
+        ITK::GetStreamingMemoryBudget(), shouldCancel);
+  } catch(const itk::ExceptionObject& exception)
+  {
+    return MakeErrorResult(-222, exception.GetDescription());
+  }
+}
+} // namespace nx::core
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "ITKImageProcessing/ITKImageProcessing_export.hpp"
+
+#include "simplnx/Filter/FilterTraits.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+
+namespace nx::core
+{
+/**
+ * @class ITKImageChainFilter
+ * @brief Runs an ordered list of ITK image operations as one connected ITK pipeline.
+ *
+ * Every row of the operations table is one stage of the pipeline. The input image is cast to float32 once, each stage
+ * reads the output of the stage before it and only the output of the last stage is written to the DataStructure, so no
+ * intermediate result is ever copied back into a DataStore.
+ *
+ * The pipeline is driven by an itk::StreamingImageFilter that requests the output in slabs along the slowest
+ * dimension. Every stage only computes the part of its output the next stage needs for the current slab (plus the
+ * kernel radius) and releases it once it has been read, so the peak memory stays near the input plus the output image
+ * for stages that can stream. Stages that need their whole input (e.g. anisotropic diffusion) still work, ITK enlarges
+ * their requested region to the whole image.
+ *
+ * Operations (column "Operation" of each row, the parameter columns are used as listed):
+ * - 0 Median: Parameter 1 = radius
+ * - 1 Discrete Gaussian: Parameter 1 = variance, Parameter 2 = maximum error, Parameter 3 = maximum kernel width
+ * - 2 Curvature Anisotropic Diffusion: Parameter 1 = time step, Parameter 2 = conductance, Parameter 3 = number of iterations
+ * - 3 Gradient Magnitude: no parameters
+ * - 4 Binary Threshold: Parameter 1 = lower threshold, Parameter 2 = upper threshold, Parameter 3 = inside value, Parameter 4 = outside value
+ * - 5 Grayscale Dilate: Parameter 1 = ball kernel radius
+ * - 6 Grayscale Erode: Parameter 1 = ball kernel radius
+ */
+class ITKIMAGEPROCESSING_EXPORT ITKImageChainFilter : public IFilter
+{
+public:
+  ITKImageChainFilter() = default;
+  ~ITKImageChainFilter() noexcept override = default;
+
+  ITKImageChainFilter(const ITKImageChainFilter&) = delete;
+  ITKImageChainFilter(ITKImageChainFilter&&) noexcept = delete;
+
+  ITKImageChainFilter& operator=(const ITKImageChainFilter&) = delete;
+  ITKImageChainFilter& operator=(ITKImageChainFilter&&) noexcept = delete;
+
+  // Parameter Keys
+  static inline constexpr StringLiteral k_InputImageGeomPath_Key = "input_image_geometry_path";
+  static inline constexpr StringLiteral k_InputImageDataPath_Key = "input_image_data_path";
+  static inline constexpr StringLiteral k_OutputImageArrayName_Key = "output_array_name";
+  static inline constexpr StringLiteral k_Operations_Key = "operations";
+  static inline constexpr StringLiteral k_NumberOfStreamDivisions_Key = "number_of_stream_divisions";
+
+  /**
+   * @brief Returns the name of the filter.
+   * @return
+   */
+  std::string name() const override;
+
+  /**
+   * @brief Returns the C++ classname of this filter.
+   * @return
+   */
+  std::string className() const override;
+
+  /**
+   * @brief Returns the uuid of the filter.
+   * @return
+   */
+  Uuid uuid() const override;
+
+  /**
+   * @brief Returns the human readable name of the filter.
+   * @return
+   */
+  std::string humanName() const override;
+
+  /**
+   * @brief Returns the default tags for this filter.
+   * @return
+   */
+  std::vector<std::string> defaultTags() const override;
+
+  /**
+   * @brief Returns the parameters of the filter (i.e. its inputs)
+   * @return
+   */
+  Parameters parameters() const override;
+
+  /**
+   * @brief Returns parameters version integer.
+   * Initial version should always be 1.
+   * Should be incremented everytime the parameters change.
+   * @return VersionType
+   */
+  VersionType parametersVersion() const override;
+
+  /**
+   * @brief Returns a copy of the filter.
+   * @return
+   */
+  UniquePointer clone() const override;
+
+protected:
+  /**
+   * @brief Takes in a DataStructure and checks that the filter can be run on it with the given arguments.
+   * Returns any warnings/errors. Also returns the changes that would be applied to the DataStructure.
+   * Some parts of the actions may not be completely filled out if all the required information is not available at preflight time.
+   * @param dataStructure The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @param shouldCancel Boolean that gets set if the filter should stop executing and return
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  PreflightResult preflightImpl(const DataStructure& dataStructure, const Arguments& filterArgs, const MessageHandler& messageHandler, const std::atomic_bool& shouldCancel) const override;
+
+  /**
+   * @brief Applies the filter's algorithm to the DataStructure with the given arguments. Returns any warnings/errors.
+   * On failure, there is no guarantee that the DataStructure is in a correct state.
+   * @param dataStructure The input DataStructure instance
+   * @param filterArgs These are the input values for each parameter that is required for the filter
+   * @param messageHandler The MessageHandler object
+   * @param shouldCancel Boolean that gets set if the filter should stop executing and return
+   * @return Returns a Result object with error or warning values if any of those occurred during execution of this function
+   */
+  Result<> executeImpl(DataStructure& dataStructure, const Arguments& filterArgs, const PipelineFilter* pipelineNode, const MessageHandler& messageHandler,
+                       const std::atomic_bool& shouldCancel) const override;
+};
+} // namespace nx::core
+
+SIMPLNX_DEF_FILTER_TRAITS(nx::core, ITKImageChainFilter, "59b141cd-c999-40e8-a386-a6555ef249f3");
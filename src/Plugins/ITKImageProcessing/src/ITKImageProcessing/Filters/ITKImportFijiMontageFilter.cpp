@@ -7,7 +7,10 @@
 
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
+#include "simplnx/DataStructure/IO/Generic/IOConstants.hpp"
+#include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Actions/CreateDataGroupAction.hpp"
+#include "simplnx/Filter/Actions/CreateImageGeometryAction.hpp"
 #include "simplnx/Filter/Actions/UpdateImageGeomAction.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
@@ -89,10 +92,17 @@ Parameters ITKImportFijiMontageFilter::parameters() const
   params.insert(std::make_unique<ChoicesParameter>(k_ImageDataType_Key, "Output Data Type", "Numeric Type of data to create", 0ULL,
                                                    ChoicesParameter::Choices{"uint8", "uint16", "uint32"})); // Sequence Dependent DO NOT REORDER
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_ParentDataGroup_Key, "Parent Imported Images Under a DataGroup", "Create a new DataGroup to hold the  imported images", true));
+  params.insertLinkableParameter(std::make_unique<ChoicesParameter>(
+      k_MontageOutput_Key, "Montage Output",
+      "Import every tile as its own image geometry, stitch the tiles into one mosaic image geometry, or create a virtual mosaic whose tiles are only read when it is accessed",
+      to_underlying(FijiMontageOutput::TileGeometries), ChoicesParameter::Choices{"Tile Geometries", "Stitched Mosaic", "Virtual Mosaic"})); // Sequence Dependent DO NOT REORDER
+  params.insert(std::make_unique<ChoicesParameter>(k_BlendingMode_Key, "Overlap Blending", "How the pixels where tiles overlap are computed: the last tile on top or a linear feathering of the tiles",
+                                                   to_underlying(MontageMosaic::BlendMode::None), ChoicesParameter::Choices{"None", "Linear"})); // Sequence Dependent DO NOT REORDER
 
   params.insertSeparator(Parameters::Separator{"Output Data Object(s)"});
   params.insert(std::make_unique<StringParameter>(k_DataGroupName_Key, "Name of Created DataGroup", "Name of the overarching parent DataGroup", "Zen DataGroup"));
   params.insert(std::make_unique<StringParameter>(k_DataContainerPath_Key, "Image Geometry Prefix", "A prefix that can be used for each Image Geometry", "Mosaic-"));
+  params.insert(std::make_unique<StringParameter>(k_MosaicGeometryName_Key, "Mosaic Image Geometry Name", "The name of the Image Geometry that holds the stitched mosaic", "Stitched Mosaic"));
   params.insert(std::make_unique<StringParameter>(k_CellAttributeMatrixName_Key, "Cell Attribute Matrix Name", "The name of the Cell Attribute Matrix", "Tile Data"));
   params.insert(std::make_unique<StringParameter>(k_ImageDataArrayName_Key, "Image DataArray Name", "The name of the import image data", "Image"));
 
@@ -101,6 +111,12 @@ Parameters ITKImportFijiMontageFilter::parameters() const
   params.linkParameters(k_ChangeOrigin_Key, k_Origin_Key, true);
   params.linkParameters(k_ConvertToGrayScale_Key, k_ColorWeights_Key, true);
   params.linkParameters(k_ParentDataGroup_Key, k_DataGroupName_Key, true);
+  params.linkParameters(k_MontageOutput_Key, k_DataContainerPath_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(FijiMontageOutput::TileGeometries)));
+  for(const auto mosaicOutput : {FijiMontageOutput::StitchedMosaic, FijiMontageOutput::VirtualMosaic})
+  {
+    params.linkParameters(k_MontageOutput_Key, k_BlendingMode_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(mosaicOutput)));
+    params.linkParameters(k_MontageOutput_Key, k_MosaicGeometryName_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(mosaicOutput)));
+  }
 
   return params;
 }
@@ -133,6 +149,9 @@ IFilter::PreflightResult ITKImportFijiMontageFilter::preflightImpl(const DataStr
   auto pImageDataArrayNameValue = filterArgs.value<StringParameter::ValueType>(k_ImageDataArrayName_Key);
   auto pChangeDataType = filterArgs.value<bool>(k_ChangeDataType_Key);
   auto pChoiceType = filterArgs.value<ChoicesParameter::ValueType>(k_ImageDataType_Key);
+  auto pMontageOutputValue = static_cast<FijiMontageOutput>(filterArgs.value<ChoicesParameter::ValueType>(k_MontageOutput_Key));
+  auto pMosaicGeometryNameValue = filterArgs.value<StringParameter::ValueType>(k_MosaicGeometryName_Key);
+  auto pLengthUnitValue = static_cast<IGeometry::LengthUnit>(filterArgs.value<ChoicesParameter::ValueType>(k_LengthUnit_Key));
 
   PreflightResult preflightResult;
   nx::core::Result<OutputActions> resultOutputActions = {};
@@ -147,6 +166,9 @@ IFilter::PreflightResult ITKImportFijiMontageFilter::preflightImpl(const DataStr
   inputValues.imagePrefix = pDataContainerPathValue;
   inputValues.changeDataType = pChangeDataType;
   inputValues.destType = ITK::detail::ConvertChoiceToDataType(pChoiceType);
+  inputValues.convertToGrayScale = pConvertToGrayScaleValue;
+  inputValues.colorWeights = pColorWeightsValue;
+  inputValues.montageOutput = pMontageOutputValue;
 
   // Read from the file if the input file has changed or the input file's time stamp is out of date.
   if(pInputFileValue != s_HeaderCache[m_InstanceId].inputFile || s_HeaderCache[m_InstanceId].timeStamp < fs::last_write_time(pInputFileValue) || s_HeaderCache[m_InstanceId].valuesChanged(inputValues))
@@ -156,7 +178,12 @@ IFilter::PreflightResult ITKImportFijiMontageFilter::preflightImpl(const DataStr
     // Read from the file
     DataStructure throwaway = DataStructure();
     ITKImportFijiMontage algorithm(throwaway, messageHandler, shouldCancel, &inputValues, s_HeaderCache.find(m_InstanceId)->second);
-    algorithm.operator()();
+    Result<> cacheResult = algorithm.operator()();
+    if(cacheResult.invalid())
+    {
+      s_HeaderCache[m_InstanceId].flush();
+      return {ConvertResultTo<OutputActions>(std::move(cacheResult), {})};
+    }
 
     // Update the cached variables
     s_HeaderCache[m_InstanceId].inputFile = pInputFileValue;
@@ -170,6 +197,35 @@ IFilter::PreflightResult ITKImportFijiMontageFilter::preflightImpl(const DataStr
     resultOutputActions.value().appendAction(std::move(createAction));
   }
 
+  if(pMontageOutputValue != FijiMontageOutput::TileGeometries)
+  {
+    // All tiles go into one image geometry that is laid out from the image headers
+    auto mosaicResult = GetMosaicInformation(s_HeaderCache[m_InstanceId], inputValues);
+    if(mosaicResult.invalid())
+    {
+      return {ConvertResultTo<OutputActions>(ConvertResult(std::move(mosaicResult)), {})};
+    }
+    const MontageMosaic::TileInformation& mosaic = mosaicResult.value();
+    const FloatVec3 mosaicOrigin = GetMosaicOrigin(s_HeaderCache[m_InstanceId]);
+
+    DataPath mosaicGeometryPath({pMosaicGeometryNameValue});
+    if(pParentDataGroupValue)
+    {
+      mosaicGeometryPath = DataPath({pDataGroupNameValue, pMosaicGeometryNameValue});
+    }
+    resultOutputActions.value().appendAction(std::make_unique<CreateImageGeometryAction>(mosaicGeometryPath, CreateImageGeometryAction::DimensionType{mosaic.Width, mosaic.Height, 1},
+                                                                                          CreateImageGeometryAction::OriginType{mosaicOrigin[0], mosaicOrigin[1], 0.0f},
+                                                                                          CreateImageGeometryAction::SpacingType{1.0f, 1.0f, 1.0f}, pCellAttributeMatrixNameValue, pLengthUnitValue));
+    // A virtual mosaic gets its store in execute, so no memory is allocated for it here
+    const std::string dataFormat = pMontageOutputValue == FijiMontageOutput::VirtualMosaic ? IOConstants::k_DeferredDataFormat.str() : std::string("");
+    resultOutputActions.value().appendAction(std::make_unique<CreateArrayAction>(mosaic.Type, std::vector<usize>{1, mosaic.Height, mosaic.Width}, std::vector<usize>{mosaic.NumComponents},
+                                                                                 mosaicGeometryPath.createChildPath(pCellAttributeMatrixNameValue).createChildPath(pImageDataArrayNameValue),
+                                                                                 dataFormat));
+
+    preflightUpdatedValues.push_back({"Import Information", s_HeaderCache[m_InstanceId].montageInformation});
+    return {std::move(resultOutputActions), std::move(preflightUpdatedValues)};
+  }
+
   auto* filterListPtr = Application::Instance()->getFilterList();
   for(const auto& bound : s_HeaderCache[m_InstanceId].bounds)
   {
@@ -249,9 +305,10 @@ Result<> ITKImportFijiMontageFilter::executeImpl(DataStructure& dataStructure, c
   inputValues.imageDataArrayName = filterArgs.value<StringParameter::ValueType>(k_ImageDataArrayName_Key);
   inputValues.changeDataType = filterArgs.value<bool>(k_ChangeDataType_Key);
   inputValues.destType = ITK::detail::ConvertChoiceToDataType(filterArgs.value<ChoicesParameter::ValueType>(k_ImageDataType_Key));
+  inputValues.montageOutput = static_cast<FijiMontageOutput>(filterArgs.value<ChoicesParameter::ValueType>(k_MontageOutput_Key));
+  inputValues.blendMode = static_cast<MontageMosaic::BlendMode>(filterArgs.value<ChoicesParameter::ValueType>(k_BlendingMode_Key));
+  inputValues.mosaicGeometryName = filterArgs.value<StringParameter::ValueType>(k_MosaicGeometryName_Key);
 
-  ITKImportFijiMontage(dataStructure, messageHandler, shouldCancel, &inputValues, s_HeaderCache.find(m_InstanceId)->second)();
-
-  return {};
+  return ITKImportFijiMontage(dataStructure, messageHandler, shouldCancel, &inputValues, s_HeaderCache.find(m_InstanceId)->second)();
 }
 } // namespace nx::core
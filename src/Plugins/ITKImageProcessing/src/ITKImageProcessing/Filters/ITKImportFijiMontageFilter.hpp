@@ -42,6 +42,9 @@ public:
   static inline constexpr StringLiteral k_DataContainerPath_Key = "data_container_path";
   static inline constexpr StringLiteral k_CellAttributeMatrixName_Key = "cell_attribute_matrix_name";
   static inline constexpr StringLiteral k_ImageDataArrayName_Key = "image_data_array_name";
+  static inline constexpr StringLiteral k_MontageOutput_Key = "montage_output_index";
+  static inline constexpr StringLiteral k_BlendingMode_Key = "blending_mode_index";
+  static inline constexpr StringLiteral k_MosaicGeometryName_Key = "mosaic_geometry_name";
 
   /**
    * @brief Returns the name of the filter.
@@ -1,6 +1,7 @@
 #include "ITKImportImageStackFilter.hpp"
 
 #include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
+#include "ITKImageProcessing/Common/ReadImageUtils.hpp"
 #include "ITKImageProcessing/Filters/ITKImageReaderFilter.hpp"
 
 #include "simplnx/Common/TypesUtility.hpp"
@@ -17,13 +18,18 @@
 #include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 #include <itkImageFileReader.h>
 #include <itkImageIOBase.h>
 
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
+#include <mutex>
+#include <optional>
 
 namespace fs = std::filesystem;
 
@@ -49,8 +55,6 @@ const Uuid k_RotateSampleRefFrameFilterId = *Uuid::FromString("d2451dc1-a5a1-4ac
 const FilterHandle k_RotateSampleRefFrameFilterHandle(k_RotateSampleRefFrameFilterId, k_SimplnxCorePluginId);
 const Uuid k_ColorToGrayScaleFilterId = *Uuid::FromString("d938a2aa-fee2-4db9-aa2f-2c34a9736580");
 const FilterHandle k_ColorToGrayScaleFilterHandle(k_ColorToGrayScaleFilterId, k_SimplnxCorePluginId);
-const Uuid k_ResampleImageGeomFilterId = *Uuid::FromString("9783ea2c-4cf7-46de-ab21-b40d91a48c5b");
-const FilterHandle k_ResampleImageGeomFilterHandle(k_ResampleImageGeomFilterId, k_SimplnxCorePluginId);
 
 // Parameter Keys
 constexpr StringLiteral k_RotationRepresentation_Key = "rotation_representation";
@@ -77,253 +81,274 @@ std::unique_ptr<IFilter> CreateRotateSampleRefFrameFilter()
 }
 
 template <class T>
-void FlipAboutYAxis(DataArray<T>& dataArray, Vec3<usize>& dims)
+void FlipAboutYAxis(cxItkImageReaderFilter::ImageBuffer<T>& slice, const SizeVec3& dims)
 {
-  auto& tempDataStore = dataArray.getDataStoreRef();
-
-  usize numComp = tempDataStore.getNumberOfComponents();
-  std::vector<T> currentRowBuffer(dims[0] * dataArray.getNumberOfComponents());
-
-  // We could _in theory_ parallelize over the rows, not sure how the out-of-core
-  // would handle that though.
+  const usize numComp = slice.NumComponents;
   for(usize row = 0; row < dims[1]; row++)
   {
-    // Copy the current row into a temp buffer
-    auto startIter = tempDataStore.begin() + (dims[0] * numComp * row);
-    auto endIter = startIter + dims[0] * numComp;
-    std::copy(startIter, endIter, currentRowBuffer.begin());
-
-    // Starting at the last tuple in the buffer
-    usize bufferIndex = (dims[0] - 1) * numComp;
-    usize dataStoreIndex = row * dims[0] * numComp;
-
-    for(usize tupleIdx = 0; tupleIdx < dims[0]; tupleIdx++)
+    // Swap the tuples of the row from both ends towards the middle
+    T* rowPtr = slice.Values.data() + row * dims[0] * numComp;
+    for(usize left = 0, right = dims[0] - 1; left < right; left++, right--)
     {
-      for(usize cIdx = 0; cIdx < numComp; cIdx++)
-      {
-        tempDataStore.setValue(dataStoreIndex, currentRowBuffer[bufferIndex + cIdx]);
-        dataStoreIndex++;
-      }
-      bufferIndex = bufferIndex - numComp;
+      std::swap_ranges(rowPtr + left * numComp, rowPtr + (left + 1) * numComp, rowPtr + right * numComp);
     }
   }
 }
 
 template <class T>
-void FlipAboutXAxis(DataArray<T>& dataArray, Vec3<usize>& dims)
+void FlipAboutXAxis(cxItkImageReaderFilter::ImageBuffer<T>& slice, const SizeVec3& dims)
 {
-  auto& tempDataStore = dataArray.getDataStoreRef();
-  usize numComp = tempDataStore.getNumberOfComponents();
-  size_t rowLCV = (dims[1] % 2 == 1) ? ((dims[1] - 1) / 2) : dims[1] / 2;
-  usize bottomRow = dims[1] - 1;
-
-  for(usize row = 0; row < rowLCV; row++)
+  const usize rowSize = dims[0] * slice.NumComponents;
+  for(usize top = 0, bottom = dims[1] - 1; top < bottom; top++, bottom--)
   {
-    // Copy the "top" row into a temp buffer
-    auto topStartIter = 0 + (dims[0] * numComp * row);
-    auto topEndIter = topStartIter + dims[0] * numComp;
-    auto bottomStartIter = 0 + (dims[0] * numComp * bottomRow);
-
-    // Copy from bottom to top and then temp to bottom
-    for(usize eleIndex = topStartIter; eleIndex < topEndIter; eleIndex++)
-    {
-      T value = tempDataStore.getValue(eleIndex);
-      tempDataStore[eleIndex] = tempDataStore[bottomStartIter];
-      tempDataStore[bottomStartIter] = value;
-      bottomStartIter++;
-    }
-    bottomRow--;
+    std::swap_ranges(slice.Values.begin() + top * rowSize, slice.Values.begin() + (top + 1) * rowSize, slice.Values.begin() + bottom * rowSize);
   }
 }
 
-} // namespace
-
-namespace cxITKImportImageStackFilter
-{
+/**
+ * @brief Resamples one slice with the nearest neighbor mapping and the dimensions that ResampleImageGeomFilter computes
+ * for the same settings.
+ */
 template <class T>
-Result<> ReadImageStack(DataStructure& dataStructure, const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::vector<std::string>& files,
-                        ChoicesParameter::ValueType transformType, bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, ChoicesParameter::ValueType resample,
-                        float32 scalingFactor, const VectorUInt64Parameter::ValueType& exactDims, bool changeDataType, ChoicesParameter::ValueType destType,
-                        const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+void ResampleSlice(cxItkImageReaderFilter::ImageBuffer<T>& slice, ChoicesParameter::ValueType resample, float32 scalingFactor, const VectorUInt64Parameter::ValueType& exactDims)
 {
-  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-  DataPath imageDataPath = imageGeomPath.createChildPath(cellDataName).createChildPath(imageArrayName);
-  SizeVec3 dims = imageGeom.getDimensions();
-  const usize tuplesPerSlice = dims[0] * dims[1];
-
-  auto& outputData = dataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
-  auto& outputDataStore = outputData.getDataStoreRef();
-
-  // Variables for the progress Reporting
-  usize slice = 0;
-
-  auto* filterListPtr = Application::Instance()->getFilterList();
-
-  if((convertToGrayscale || resample != k_NoResampleModeIndex) && !filterListPtr->containsPlugin(k_SimplnxCorePluginId))
+  const FloatVec3 srcSpacing = slice.Spacing;
+  const SizeVec3 srcDims = slice.Dims;
+  FloatVec3 spacing = srcSpacing;
+  switch(resample)
   {
-    return MakeErrorResult(-18542, "SimplnxCore was not instantiated in this instance, so color to grayscale is not a valid option.");
+  case k_ScalingModeIndex: {
+    if(scalingFactor == 100.0f)
+    {
+      return;
+    }
+    const std::array<float32, 3> scaling = {scalingFactor, scalingFactor, 100.0f};
+    for(usize i = 0; i < 3; i++)
+    {
+      spacing[i] = srcSpacing[i] / (scaling[i] / 100);
+    }
+    break;
+  }
+  case k_ExactDimensionsModeIndex: {
+    const std::array<uint64, 3> exactDimensions = {exactDims[0], exactDims[1], 1};
+    for(usize i = 0; i < 3; i++)
+    {
+      spacing[i] = srcSpacing[i] * static_cast<float32>(srcDims[i]) / static_cast<float32>(exactDimensions[i]);
+    }
+    break;
+  }
+  default: {
+    return;
+  }
   }
-  auto grayScaleFilter = filterListPtr->createFilter(k_ColorToGrayScaleFilterHandle);
-  auto resampleImageGeomFilter = filterListPtr->createFilter(k_ResampleImageGeomFilterHandle);
-  Result<> outputResult = {};
 
-  // Loop over all the files importing them one by one and copying the data into the data array
-  for(const auto& filePath : files)
+  // Same as ResampleImageGeomFilter: the spacing may not shrink a dimension below 1
+  SizeVec3 dims;
+  for(usize i = 0; i < 3; i++)
   {
-    messageHandler(IFilter::Message::Type::Info, fmt::format("Importing: {}", filePath));
+    dims[i] = std::max<usize>(static_cast<usize>(((srcSpacing[i] * static_cast<float>(srcDims[i])) / spacing[i])), 1);
+  }
 
-    DataStructure importedDataStructure;
+  const usize numComp = slice.NumComponents;
+  std::vector<T> values(dims[0] * dims[1] * dims[2] * numComp);
+  usize index = 0;
+  for(usize i = 0; i < dims[2]; i++)
+  {
+    for(usize j = 0; j < dims[1]; j++)
     {
-      // Create a sub-filter to read each image, although for preflight we are going to read the first image in the
-      // list and hope the rest are correct.
-      const ITKImageReaderFilter imageReader;
-
-      Arguments args;
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageGeometryPath_Key, std::make_any<DataPath>(imageGeomPath));
-      args.insertOrAssign(ITKImageReaderFilter::k_CellDataName_Key, std::make_any<std::string>(cellDataName));
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageDataArrayPath_Key, std::make_any<std::string>(imageArrayName));
-      args.insertOrAssign(ITKImageReaderFilter::k_FileName_Key, std::make_any<fs::path>(filePath));
-      args.insertOrAssign(ITKImageReaderFilter::k_ChangeDataType_Key, std::make_any<bool>(changeDataType));
-      args.insertOrAssign(ITKImageReaderFilter::k_ImageDataType_Key, std::make_any<ChoicesParameter::ValueType>(destType));
-
-      auto executeResult = imageReader.execute(importedDataStructure, args);
-      if(executeResult.result.invalid())
+      for(usize k = 0; k < dims[0]; k++)
       {
-        return executeResult.result;
+        auto col = static_cast<int64>((static_cast<float32>(k) * spacing[0]) / srcSpacing[0]);
+        auto row = static_cast<int64>((static_cast<float32>(j) * spacing[1]) / srcSpacing[1]);
+        auto plane = static_cast<int64>((static_cast<float32>(i) * spacing[2]) / srcSpacing[2]);
+        auto indexOld = static_cast<usize>(plane * srcDims[1] * srcDims[0] + row * srcDims[0] + col);
+        std::copy_n(slice.Values.cbegin() + indexOld * numComp, numComp, values.begin() + index * numComp);
+        index++;
       }
     }
+  }
 
-    // ======================= Resample Image Geometry Section ===================
-    switch(resample)
-    {
-    case k_NoResampleModeIndex: {
-      break;
-    }
-    case k_ScalingModeIndex: {
-      if(scalingFactor == 100.0f)
-      {
-        break;
-      }
-
-      Arguments resampleImageGeomArgs;
-      resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
-      resampleImageGeomArgs.insertOrAssign("remove_original_geometry", std::make_any<bool>(true));
+  slice.Values = std::move(values);
+  slice.Dims = dims;
+  slice.Spacing = spacing;
+}
 
-      resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(1));
-      resampleImageGeomArgs.insertOrAssign("scaling", std::make_any<VectorFloat32Parameter::ValueType>(std::vector<float32>{scalingFactor, scalingFactor, 100.0f}));
+/**
+ * @brief Holds what the slice tasks share: the lock for the output store and the error of the first slice that failed.
+ */
+struct SliceImportState
+{
+  std::mutex Mutex;
+  std::optional<usize> FailedSlice;
+  Result<> FailedResult;
+  std::atomic_bool Failed = false;
 
-      // Run resample image geometry filter and process results and messages
-      auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
-      if(result.invalid())
-      {
-        return result;
-      }
-      break;
+  void recordFailure(usize slice, Result<>&& result)
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    // Report the error of the lowest slice like the serial import did
+    if(!FailedSlice.has_value() || slice < *FailedSlice)
+    {
+      FailedSlice = slice;
+      FailedResult = std::move(result);
     }
-    case k_ExactDimensionsModeIndex: {
-      Arguments resampleImageGeomArgs;
-      resampleImageGeomArgs.insertOrAssign("input_image_geometry_path", std::make_any<DataPath>(imageGeomPath));
-      resampleImageGeomArgs.insertOrAssign("remove_original_geometry", std::make_any<bool>(true));
+    Failed = true;
+  }
+};
+
+struct SliceImportOptions
+{
+  SizeVec3 Dims;
+  ChoicesParameter::ValueType TransformType = k_NoImageTransform;
+  bool ConvertToGrayscale = false;
+  std::vector<float32> LuminosityValues;
+  ChoicesParameter::ValueType Resample = k_NoResampleModeIndex;
+  float32 ScalingFactor = 100.0f;
+  std::vector<uint64> ExactDims;
+  bool ChangeDataType = false;
+};
 
-      resampleImageGeomArgs.insertOrAssign("resampling_mode_index", std::make_any<ChoicesParameter::ValueType>(2));
-      resampleImageGeomArgs.insertOrAssign("exact_dimensions", std::make_any<VectorUInt64Parameter::ValueType>(std::vector<uint64>{exactDims[0], exactDims[1], 1}));
+/**
+ * @brief Reads, resamples, converts and flips one slice in its own buffer and writes it straight into its z position
+ * of the output array.
+ */
+template <class T>
+class ImportSliceTask
+{
+public:
+  ImportSliceTask(const SliceImportOptions& options, const std::string& filePath, usize slice, AbstractDataStore<T>& outputStore, SliceImportState& state, const std::atomic_bool& shouldCancel)
+  : m_Options(options)
+  , m_FilePath(filePath)
+  , m_Slice(slice)
+  , m_OutputStore(outputStore)
+  , m_State(state)
+  , m_ShouldCancel(shouldCancel)
+  {
+  }
 
-      // Run resample image geometry filter and process results and messages
-      auto result = resampleImageGeomFilter->execute(importedDataStructure, resampleImageGeomArgs).result;
-      if(result.invalid())
-      {
-        return result;
-      }
-      break;
-    }
-    default: {
-      break;
+  void operator()() const
+  {
+    if(m_State.Failed || m_ShouldCancel)
+    {
+      return;
     }
+    Result<> result = importSlice();
+    if(result.invalid())
+    {
+      m_State.recordFailure(m_Slice, std::move(result));
     }
+  }
 
-    // ======================= Convert to GrayScale Section ===================
-    bool validInputForGrayScaleConversion = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath).getDataType() == DataType::uint8;
-    if(convertToGrayscale && validInputForGrayScaleConversion && nullptr != grayScaleFilter.get())
+private:
+  Result<> importSlice() const
+  {
+    cxItkImageReaderFilter::ImageBuffer<T> slice;
+    Result<> readResult = cxItkImageReaderFilter::ReadImageExecute<cxItkImageReaderFilter::ReadImageIntoBufferFunctor>(m_FilePath, m_FilePath, m_Options.ChangeDataType, slice);
+    if(readResult.invalid())
     {
-      // This same filter was used to preflight so as long as nothing changes on disk this really should work....
-      Arguments colorToGrayscaleArgs;
-      colorToGrayscaleArgs.insertOrAssign("conversion_algorithm", std::make_any<ChoicesParameter::ValueType>(0));
-      colorToGrayscaleArgs.insertOrAssign("color_weights", std::make_any<VectorFloat32Parameter::ValueType>(luminosityValues));
-      colorToGrayscaleArgs.insertOrAssign("input_data_array_paths", std::make_any<std::vector<DataPath>>(std::vector<DataPath>{imageDataPath}));
-      colorToGrayscaleArgs.insertOrAssign("output_array_prefix", std::make_any<std::string>("gray"));
-
-      // Run grayscale filter and process results and messages
-      auto result = grayScaleFilter->execute(importedDataStructure, colorToGrayscaleArgs).result;
-      if(result.invalid())
-      {
-        return result;
-      }
+      return readResult;
+    }
 
-      // deletion of non-grayscale array
-      DataObject::IdType id;
-      { // scoped for safety since this reference will be nonexistent in a moment
-        auto& oldArray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath);
-        id = oldArray.getId();
-      }
-      importedDataStructure.removeData(id);
+    ResampleSlice(slice, m_Options.Resample, m_Options.ScalingFactor, m_Options.ExactDims);
 
-      // rename grayscale array to reflect original
+    if constexpr(std::is_same_v<T, uint8>)
+    {
+      if(m_Options.ConvertToGrayscale)
       {
-        auto& gray = importedDataStructure.getDataRefAs<IDataArray>(imageDataPath.replaceName("gray" + imageDataPath.getTargetName()));
-        if(!gray.canRename(imageDataPath.getTargetName()))
-        {
-          return MakeErrorResult(-64543, fmt::format("Unable to rename the internal grayscale array to {}", imageDataPath.getTargetName()));
-        }
-        gray.rename(imageDataPath.getTargetName());
+        cxItkImageReaderFilter::ConvertBufferToGrayScale(slice, m_Options.LuminosityValues);
       }
     }
-    else if(convertToGrayscale && !validInputForGrayScaleConversion)
+
+    // Check the dimensions of the imported image match the destination
+    const SizeVec3& dims = m_Options.Dims;
+    if(dims[0] != slice.Dims[0] || dims[1] != slice.Dims[1])
     {
-      outputResult.warnings().emplace_back(Warning{
-          -74320, fmt::format("The array ({}) resulting from reading the input image file is not a UInt8Array. The input image will not be converted to grayscale.", imageDataPath.getTargetName())});
+      return MakeErrorResult(-64510, fmt::format("Slice {} image dimensions are different than expected dimensions.\n  Expected Slice Dims are:  {} x {}\n  Received Slice Dims are: {} x {}\n", m_Slice,
+                                                 dims[0], dims[1], slice.Dims[0], slice.Dims[1]));
     }
-
-    // Check the ImageGeometry of the imported Image matches the destination
-    const auto& importedImageGeom = importedDataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-    SizeVec3 importedDims = importedImageGeom.getDimensions();
-    if(dims[0] != importedDims[0] || dims[1] != importedDims[1])
+    const usize numComp = m_OutputStore.getNumberOfComponents();
+    if(slice.NumComponents != numComp)
     {
-      return MakeErrorResult(-64510, fmt::format("Slice {} image dimensions are different than expected dimensions.\n  Expected Slice Dims are:  {} x {}\n  Received Slice Dims are: {} x {}\n", slice,
-                                                 dims[0], dims[1], importedDims[0], importedDims[1]));
+      return MakeErrorResult(-64512, fmt::format("Slice {} has {} components per pixel but the image data has {} components.", m_Slice, slice.NumComponents, numComp));
     }
 
-    // Compute the Tuple Index we are at:
-    const usize tupleIndex = (slice * dims[0] * dims[1]);
-
-    // get the current Slice data...
-    auto& tempData = importedDataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
-    auto& tempDataStore = tempData.getDataStoreRef();
-
-    if(transformType == k_FlipAboutYAxis)
+    if(m_Options.TransformType == k_FlipAboutYAxis)
     {
-      FlipAboutYAxis<T>(tempData, dims);
+      FlipAboutYAxis<T>(slice, dims);
     }
-    else if(transformType == k_FlipAboutXAxis)
+    else if(m_Options.TransformType == k_FlipAboutXAxis)
     {
-      FlipAboutXAxis<T>(tempData, dims);
+      FlipAboutXAxis<T>(slice, dims);
     }
 
     // Copy that into the output array...
-    auto result = outputDataStore.copyFrom(tupleIndex, tempDataStore, 0, tuplesPerSlice);
-    if(result.invalid())
+    const usize tuplesPerSlice = dims[0] * dims[1];
+    std::lock_guard<std::mutex> lock(m_State.Mutex);
+    return m_OutputStore.copyFromBuffer(m_Slice * tuplesPerSlice * numComp, nonstd::span<const T>(slice.Values.data(), tuplesPerSlice * numComp));
+  }
+
+  const SliceImportOptions& m_Options;
+  const std::string& m_FilePath;
+  usize m_Slice;
+  AbstractDataStore<T>& m_OutputStore;
+  SliceImportState& m_State;
+  const std::atomic_bool& m_ShouldCancel;
+};
+} // namespace
+
+namespace cxITKImportImageStackFilter
+{
+template <class T>
+Result<> ReadImageStack(DataStructure& dataStructure, const DataPath& imageGeomPath, const std::string& cellDataName, const std::string& imageArrayName, const std::vector<std::string>& files,
+                        ChoicesParameter::ValueType transformType, bool convertToGrayscale, const VectorFloat32Parameter::ValueType& luminosityValues, ChoicesParameter::ValueType resample,
+                        float32 scalingFactor, const VectorUInt64Parameter::ValueType& exactDims, bool changeDataType, ChoicesParameter::ValueType destType,
+                        const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+{
+  auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
+  DataPath imageDataPath = imageGeomPath.createChildPath(cellDataName).createChildPath(imageArrayName);
+
+  auto& outputData = dataStructure.getDataRefAs<DataArray<T>>(imageDataPath);
+  auto& outputDataStore = outputData.getDataStoreRef();
+
+  SliceImportOptions options;
+  options.Dims = imageGeom.getDimensions();
+  options.TransformType = transformType;
+  options.ConvertToGrayscale = convertToGrayscale;
+  options.LuminosityValues = luminosityValues;
+  options.Resample = resample;
+  options.ScalingFactor = scalingFactor;
+  options.ExactDims = exactDims;
+  options.ChangeDataType = changeDataType;
+
+  Result<> outputResult = {};
+  if constexpr(!std::is_same_v<T, uint8>)
+  {
+    if(convertToGrayscale)
     {
-      return result;
+      outputResult.warnings().emplace_back(Warning{
+          -74320, fmt::format("The array ({}) resulting from reading the input image file is not a UInt8Array. The input image will not be converted to grayscale.", imageDataPath.getTargetName())});
     }
+  }
 
-    slice++;
-
-    // Check to see if the filter got canceled.
-    if(shouldCancel)
+  // Every slice is decoded and processed on its own task and written straight into its place in the output array.
+  // The task algorithm waits for each batch of tasks, so only one batch of decoded slices is held in memory at a time.
+  SliceImportState state;
+  ParallelTaskAlgorithm taskRunner;
+  for(usize slice = 0; slice < files.size(); slice++)
+  {
+    if(shouldCancel || state.Failed)
     {
-      return outputResult;
+      break;
     }
+    messageHandler(IFilter::Message::Type::Info, fmt::format("Importing: {}", files[slice]));
+    taskRunner.execute(ImportSliceTask<T>(options, files[slice], slice, outputDataStore, state, shouldCancel));
   }
+  taskRunner.wait();
 
+  if(state.Failed)
+  {
+    return std::move(state.FailedResult);
+  }
   return outputResult;
 }
 } // namespace cxITKImportImageStackFilter
@@ -520,7 +545,7 @@ IFilter::PreflightResult ITKImportImageStackFilter::preflightImpl(const DataStru
     }
 
     // Update the dimensions according to the scaling value
-    std::transform(dims.begin(), dims.end() - 1, dims.begin(), [pScalingValue](usize& elem) { return static_cast<usize>(static_cast<float32>(elem) * (pScalingValue / 100.0f)); });
+    std::transform(dims.begin(), dims.end() - 1, dims.begin(), [pScalingValue](usize& elem) { return std::max<usize>(static_cast<usize>(static_cast<float32>(elem) * (pScalingValue / 100.0f)), 1); });
 
     // Update the spacing according to the scaling value
     std::transform(spacing.begin(), spacing.end() - 1, spacing.begin(), [pScalingValue](auto& elem) { return elem / (pScalingValue / 100.0f); });
@@ -22,6 +22,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKIntensityWindowingImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   float64 windowMinimum = 0.0;
   float64 windowMaximum = 255.0;
   float64 outputMinimum = 0.0;
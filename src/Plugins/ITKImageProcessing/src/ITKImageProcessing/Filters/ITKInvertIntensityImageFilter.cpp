@@ -23,6 +23,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKInvertIntensityImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   float64 maximum = 255;
 
   template <class InputImageT, class OutputImageT, uint32 Dimension>
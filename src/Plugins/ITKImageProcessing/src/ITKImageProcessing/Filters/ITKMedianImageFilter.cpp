@@ -23,6 +23,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKMedianImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   using RadiusInputRadiusType = std::vector<uint32>;
   RadiusInputRadiusType radius = std::vector<unsigned int>(3, 1);
 
@@ -22,6 +22,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKSigmoidImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   float64 alpha = 1;
   float64 beta = 0;
   float64 outputMaximum = 255;
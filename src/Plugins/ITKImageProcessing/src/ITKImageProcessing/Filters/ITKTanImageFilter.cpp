@@ -21,6 +21,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKTanImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   template <class InputImageT, class OutputImageT, uint32 Dimension>
   auto createFilter() const
   {
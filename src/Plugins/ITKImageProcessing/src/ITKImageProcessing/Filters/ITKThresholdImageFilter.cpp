@@ -22,6 +22,8 @@ using ArrayOptionsType = ITK::ScalarPixelIdTypeList;
 
 struct ITKThresholdImageFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   float64 lower = 0.0;
   float64 upper = 1.0;
   float64 outsideValue = 0.0;
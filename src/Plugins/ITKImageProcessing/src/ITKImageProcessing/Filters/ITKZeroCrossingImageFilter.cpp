@@ -20,6 +20,8 @@ using FilterOutputType = uint8;
 
 struct ITKZeroCrossingImageFilterFunctor
 {
+  static constexpr bool k_Streamable = true;
+
   uint8 foregroundValue = 1u;
   uint8 backgroundValue = 0u;
 
@@ -1,5 +1,6 @@
 #include "ITKImageProcessingPlugin.hpp"
 
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_filter_registration.hpp"
 #include "ITKImageProcessingLegacyUUIDMapping.hpp"
 
@@ -34,6 +35,8 @@ ITKImageProcessingPlugin::ITKImageProcessingPlugin()
   {
     addFilter(filterFunc);
   }
+  // 0 uses the large DataStructure size as the memory budget of ITK filters that are executed on out-of-core data
+  addDefaultValue(ITK::Constants::k_StreamingMemoryBudget_Key.str(), 0);
   RegisterITKImageIO();
 }
 
@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+
+#include "ITKImageProcessing/Common/sitkCommon.hpp"
+#include "ITKImageProcessing/Filters/ITKGrayscaleDilateImageFilter.hpp"
+#include "ITKImageProcessing/Filters/ITKImageChainFilter.hpp"
+#include "ITKImageProcessing/Filters/ITKMedianImageFilter.hpp"
+#include "ITKImageProcessing/ITKImageProcessing_test_dirs.hpp"
+#include "ITKTestBase.hpp"
+
+#include "simplnx/Parameters/ChoicesParameter.hpp"
+#include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Parameters/DynamicTableParameter.hpp"
+#include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+
+#include <filesystem>
+namespace fs = std::filesystem;
+
+using namespace nx::core;
+using namespace nx::core::Constants;
+using namespace nx::core::UnitTest;
+
+TEST_CASE("ITKImageProcessing::ITKImageChainFilter(MedianDilate)", "[ITKImageProcessing][ITKImageChain][MedianDilate]")
+{
+  DataStructure dataStructure;
+
+  const DataPath inputGeometryPath({ITKTestBase::k_ImageGeometryPath});
+  const DataPath cellDataPath = inputGeometryPath.createChildPath(ITKTestBase::k_ImageCellDataName);
+  const DataPath inputDataPath = cellDataPath.createChildPath(ITKTestBase::k_InputDataName);
+  const DataObjectNameParameter::ValueType outputArrayName = ITKTestBase::k_OutputDataPath;
+  const DataObjectNameParameter::ValueType medianArrayName = "Median";
+  const DataObjectNameParameter::ValueType dilateArrayName = "Dilate";
+
+  { // Start Image Comparison Scope
+    const fs::path inputFilePath = fs::path(unit_test::k_SourceDir.view()) / unit_test::k_DataDir.view() / "JSONFilters" / "Input/STAPLE1.png";
+    Result<> imageReadResult = ITKTestBase::ReadImage(dataStructure, inputFilePath, inputGeometryPath, ITKTestBase::k_ImageCellDataName, ITKTestBase::k_InputDataName);
+    SIMPLNX_RESULT_REQUIRE_VALID(imageReadResult)
+  } // End Image Comparison Scope
+
+  // Reference: the same operations run one filter at a time
+  {
+    const ITKMedianImageFilter filter;
+    Arguments args;
+    args.insertOrAssign(ITKMedianImageFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(inputGeometryPath));
+    args.insertOrAssign(ITKMedianImageFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(inputDataPath));
+    args.insertOrAssign(ITKMedianImageFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(medianArrayName));
+    args.insertOrAssign(ITKMedianImageFilter::k_Radius_Key, std::make_any<VectorUInt32Parameter::ValueType>(VectorUInt32Parameter::ValueType{1, 1, 1}));
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+  {
+    const ITKGrayscaleDilateImageFilter filter;
+    Arguments args;
+    args.insertOrAssign(ITKGrayscaleDilateImageFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(inputGeometryPath));
+    args.insertOrAssign(ITKGrayscaleDilateImageFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath(medianArrayName)));
+    args.insertOrAssign(ITKGrayscaleDilateImageFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(dilateArrayName));
+    args.insertOrAssign(ITKGrayscaleDilateImageFilter::k_KernelRadius_Key, std::make_any<VectorParameter<uint32>::ValueType>(std::vector<uint32>{1, 1, 1}));
+    args.insertOrAssign(ITKGrayscaleDilateImageFilter::k_KernelType_Key, std::make_any<ChoicesParameter::ValueType>(itk::simple::sitkBall));
+    auto executeResult = filter.execute(dataStructure, args);
+    SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+  }
+
+  const ITKImageChainFilter filter;
+  Arguments args;
+  args.insertOrAssign(ITKImageChainFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(inputGeometryPath));
+  args.insertOrAssign(ITKImageChainFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(inputDataPath));
+  args.insertOrAssign(ITKImageChainFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(outputArrayName));
+  args.insertOrAssign(ITKImageChainFilter::k_Operations_Key, std::make_any<DynamicTableParameter::ValueType>(DynamicTableParameter::ValueType{{0, 1, 0, 0, 0}, {5, 1, 0, 0, 0}}));
+  args.insertOrAssign(ITKImageChainFilter::k_NumberOfStreamDivisions_Key, std::make_any<uint32>(4));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const auto& expectedArray = dataStructure.getDataRefAs<UInt8Array>(cellDataPath.createChildPath(dilateArrayName));
+  const auto& outputArray = dataStructure.getDataRefAs<Float32Array>(cellDataPath.createChildPath(outputArrayName));
+  REQUIRE(outputArray.getSize() == expectedArray.getSize());
+  for(usize i = 0; i < outputArray.getSize(); i++)
+  {
+    REQUIRE(outputArray[i] == static_cast<float32>(expectedArray[i]));
+  }
+}
+
+TEST_CASE("ITKImageProcessing::ITKImageChainFilter(InvalidStage)", "[ITKImageProcessing][ITKImageChain][InvalidStage]")
+{
+  DataStructure dataStructure;
+  const ITKImageChainFilter filter;
+
+  const DataPath inputGeometryPath({ITKTestBase::k_ImageGeometryPath});
+  const DataPath cellDataPath = inputGeometryPath.createChildPath(ITKTestBase::k_ImageCellDataName);
+  const DataPath inputDataPath = cellDataPath.createChildPath(ITKTestBase::k_InputDataName);
+
+  { // Start Image Comparison Scope
+    const fs::path inputFilePath = fs::path(unit_test::k_SourceDir.view()) / unit_test::k_DataDir.view() / "JSONFilters" / "Input/STAPLE1.png";
+    Result<> imageReadResult = ITKTestBase::ReadImage(dataStructure, inputFilePath, inputGeometryPath, ITKTestBase::k_ImageCellDataName, ITKTestBase::k_InputDataName);
+    SIMPLNX_RESULT_REQUIRE_VALID(imageReadResult)
+  } // End Image Comparison Scope
+
+  Arguments args;
+  args.insertOrAssign(ITKImageChainFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(inputGeometryPath));
+  args.insertOrAssign(ITKImageChainFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(inputDataPath));
+  args.insertOrAssign(ITKImageChainFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(ITKTestBase::k_OutputDataPath));
+
+  // Unknown operation
+  args.insertOrAssign(ITKImageChainFilter::k_Operations_Key, std::make_any<DynamicTableParameter::ValueType>(DynamicTableParameter::ValueType{{42, 1, 0, 0, 0}}));
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions)
+
+  // Lower threshold above the upper threshold
+  args.insertOrAssign(ITKImageChainFilter::k_Operations_Key, std::make_any<DynamicTableParameter::ValueType>(DynamicTableParameter::ValueType{{4, 200, 100, 1, 0}}));
+  preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_INVALID(preflightResult.outputActions)
+}
@@ -1,16 +1,23 @@
 #include <catch2/catch.hpp>
 
+#include "ITKImageProcessing/Common/VirtualMosaicDataStore.hpp"
 #include "ITKImageProcessing/Filters/ITKImportFijiMontageFilter.hpp"
 #include "ITKImageProcessing/ITKImageProcessing_test_dirs.hpp"
 
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Parameters/ChoicesParameter.hpp"
 #include "simplnx/Parameters/FileSystemPathParameter.hpp"
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
 
+#include <array>
+#include <cmath>
 #include <filesystem>
+#include <limits>
+#include <map>
 #include <sstream>
 
 using namespace nx::core;
@@ -23,6 +30,85 @@ const std::string k_SmallZeissZenDir = fmt::format("{}/fiji_montage/small_zeiss_
 
 const std::string k_DataGroupName = "Zen DataGroup";
 const DataPath k_DataGroupPath = {{k_DataGroupName}};
+
+Arguments CreateArguments(const fs::path& inputFile, FijiMontageOutput montageOutput, MontageMosaic::BlendMode blendMode)
+{
+  Arguments args;
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_InputFile_Key, std::make_any<FileSystemPathParameter::ValueType>(inputFile));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_DataGroupName_Key, std::make_any<std::string>(k_DataGroupName));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_ParentDataGroup_Key, std::make_any<bool>(true));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_DataContainerPath_Key, std::make_any<std::string>("Mosaic-"));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_CellAttributeMatrixName_Key, std::make_any<std::string>("Tile Data"));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_ImageDataArrayName_Key, std::make_any<std::string>("Image"));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_MontageOutput_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(montageOutput)));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_BlendingMode_Key, std::make_any<ChoicesParameter::ValueType>(to_underlying(blendMode)));
+  args.insertOrAssign(ITKImportFijiMontageFilter::k_MosaicGeometryName_Key, std::make_any<std::string>("Stitched Mosaic"));
+  return args;
+}
+
+struct CompareMosaicsFunctor
+{
+  template <class T>
+  void operator()(const IDataArray& expected, const IDataArray& computed)
+  {
+    UnitTest::CompareDataArrays<T>(expected, computed);
+  }
+};
+
+// Pixels that only one tile covers must not be changed by blending
+struct CompareSingleCoverageFunctor
+{
+  template <class T>
+  void operator()(const IDataArray& noBlend, const IDataArray& linearBlend, const std::vector<int32>& coverage)
+  {
+    const auto& noBlendStore = noBlend.getIDataStoreRefAs<AbstractDataStore<T>>();
+    const auto& linearBlendStore = linearBlend.getIDataStoreRefAs<AbstractDataStore<T>>();
+    const usize numComp = noBlend.getNumberOfComponents();
+    for(usize pixel = 0; pixel < coverage.size(); pixel++)
+    {
+      if(coverage[pixel] != 1)
+      {
+        continue;
+      }
+      for(usize comp = 0; comp < numComp; comp++)
+      {
+        REQUIRE(noBlendStore[pixel * numComp + comp] == linearBlendStore[pixel * numComp + comp]);
+      }
+    }
+  }
+};
+
+// Pixels that only one tile covers must hold the pixel of that tile at the offset of the tile in the mosaic
+struct CompareTilePixelsFunctor
+{
+  template <class T>
+  void operator()(const IDataArray& mosaic, const IDataArray& tile, const std::array<usize, 2>& tileOffset, const ImageGeom& tileGeometry, usize mosaicWidth, const std::vector<int32>& coverage)
+  {
+    const auto& mosaicStore = mosaic.getIDataStoreRefAs<AbstractDataStore<T>>();
+    const auto& tileStore = tile.getIDataStoreRefAs<AbstractDataStore<T>>();
+    const usize numComp = mosaic.getNumberOfComponents();
+    REQUIRE(tile.getNumberOfComponents() == numComp);
+    usize numCompared = 0;
+    for(usize y = 0; y < tileGeometry.getNumYCells(); y++)
+    {
+      for(usize x = 0; x < tileGeometry.getNumXCells(); x++)
+      {
+        const usize mosaicPixel = (tileOffset[1] + y) * mosaicWidth + tileOffset[0] + x;
+        if(coverage[mosaicPixel] != 1)
+        {
+          continue;
+        }
+        const usize tilePixel = y * tileGeometry.getNumXCells() + x;
+        for(usize comp = 0; comp < numComp; comp++)
+        {
+          REQUIRE(mosaicStore.getValue(mosaicPixel * numComp + comp) == tileStore.getValue(tilePixel * numComp + comp));
+        }
+        numCompared++;
+      }
+    }
+    REQUIRE(numCompared > 0);
+  }
+};
 } // namespace
 
 TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Basic 2x2 Grid Montage", "[ITKImageProcessing][ITKImportFijiMontage]")
@@ -70,3 +156,100 @@ TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Basic 2x2 Grid Montage", "[
     UnitTest::CompareImageGeometry(exemplarDataStructure.getDataAs<ImageGeom>(exemplarGroup[i]), dataStructure.getDataAs<ImageGeom>(generatedGroup[i]));
   }
 }
+
+TEST_CASE("ITKImageProcessing::ITKImportFijiMontage: Stitched And Virtual Mosaic", "[ITKImageProcessing][ITKImportFijiMontage]")
+{
+  const nx::core::UnitTest::TestFileSentinel testDataSentinel(nx::core::unit_test::k_CMakeExecutable, nx::core::unit_test::k_TestFilesDir, "fiji_montage.tar.gz", "fiji_montage");
+
+  auto app = Application::GetOrCreateInstance();
+  app->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  const fs::path inputFile = fs::path(fmt::format("{}/TileConfiguration.registered.txt", k_SmallZeissZenDir));
+  const DataPath mosaicGeometryPath = k_DataGroupPath.createChildPath("Stitched Mosaic");
+  const DataPath mosaicArrayPath = mosaicGeometryPath.createChildPath("Tile Data").createChildPath("Image");
+
+  // The tiles imported one by one give the expected placement of every tile in the mosaic
+  DataStructure tileDataStructure;
+  {
+    ITKImportFijiMontageFilter filter;
+    Arguments args = CreateArguments(inputFile, FijiMontageOutput::TileGeometries, MontageMosaic::BlendMode::None);
+    SIMPLNX_RESULT_REQUIRE_VALID(filter.preflight(tileDataStructure, args).outputActions);
+    SIMPLNX_RESULT_REQUIRE_VALID(filter.execute(tileDataStructure, args).result);
+  }
+  std::vector<DataPath> tilePaths = GetAllChildDataPaths(tileDataStructure, k_DataGroupPath, DataObject::Type::ImageGeom).value();
+  REQUIRE(tilePaths.size() == 4);
+  FloatVec3 minOrigin = {std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(), 0.0f};
+  for(const auto& tilePath : tilePaths)
+  {
+    const auto& tile = tileDataStructure.getDataRefAs<ImageGeom>(tilePath);
+    minOrigin[0] = std::min(minOrigin[0], tile.getOrigin()[0]);
+    minOrigin[1] = std::min(minOrigin[1], tile.getOrigin()[1]);
+  }
+  usize mosaicWidth = 0;
+  usize mosaicHeight = 0;
+  for(const auto& tilePath : tilePaths)
+  {
+    const auto& tile = tileDataStructure.getDataRefAs<ImageGeom>(tilePath);
+    mosaicWidth = std::max(mosaicWidth, static_cast<usize>(std::round(tile.getOrigin()[0] - minOrigin[0])) + tile.getNumXCells());
+    mosaicHeight = std::max(mosaicHeight, static_cast<usize>(std::round(tile.getOrigin()[1] - minOrigin[1])) + tile.getNumYCells());
+  }
+  std::vector<int32> coverage(mosaicWidth * mosaicHeight, 0);
+  for(const auto& tilePath : tilePaths)
+  {
+    const auto& tile = tileDataStructure.getDataRefAs<ImageGeom>(tilePath);
+    const auto x0 = static_cast<usize>(std::round(tile.getOrigin()[0] - minOrigin[0]));
+    const auto y0 = static_cast<usize>(std::round(tile.getOrigin()[1] - minOrigin[1]));
+    for(usize y = y0; y < y0 + tile.getNumYCells(); y++)
+    {
+      for(usize x = x0; x < x0 + tile.getNumXCells(); x++)
+      {
+        coverage[y * mosaicWidth + x]++;
+      }
+    }
+  }
+
+  std::map<std::pair<FijiMontageOutput, MontageMosaic::BlendMode>, DataStructure> mosaics;
+  for(const auto blendMode : {MontageMosaic::BlendMode::None, MontageMosaic::BlendMode::Linear})
+  {
+    for(const auto montageOutput : {FijiMontageOutput::StitchedMosaic, FijiMontageOutput::VirtualMosaic})
+    {
+      ITKImportFijiMontageFilter filter;
+      DataStructure& dataStructure = mosaics[{montageOutput, blendMode}];
+      Arguments args = CreateArguments(inputFile, montageOutput, blendMode);
+      SIMPLNX_RESULT_REQUIRE_VALID(filter.preflight(dataStructure, args).outputActions);
+      SIMPLNX_RESULT_REQUIRE_VALID(filter.execute(dataStructure, args).result);
+
+      const auto& mosaicGeometry = dataStructure.getDataRefAs<ImageGeom>(mosaicGeometryPath);
+      REQUIRE(mosaicGeometry.getNumXCells() == mosaicWidth);
+      REQUIRE(mosaicGeometry.getNumYCells() == mosaicHeight);
+      REQUIRE(mosaicGeometry.getNumZCells() == 1);
+
+      const auto& mosaicArray = dataStructure.getDataRefAs<IDataArray>(mosaicArrayPath);
+      REQUIRE(mosaicArray.getNumberOfTuples() == mosaicWidth * mosaicHeight);
+      REQUIRE((mosaicArray.getDataFormat() == VirtualMosaicDataStore<uint8>::k_DataFormat) == (montageOutput == FijiMontageOutput::VirtualMosaic));
+    }
+
+    // The virtual mosaic composes the same pixels as the stitched one
+    const auto& stitched = mosaics[{FijiMontageOutput::StitchedMosaic, blendMode}].getDataRefAs<IDataArray>(mosaicArrayPath);
+    const auto& virtualMosaic = mosaics[{FijiMontageOutput::VirtualMosaic, blendMode}].getDataRefAs<IDataArray>(mosaicArrayPath);
+    ExecuteNeighborFunction(CompareMosaicsFunctor{}, stitched.getDataType(), stitched, virtualMosaic);
+  }
+
+  const auto& noBlend = mosaics[{FijiMontageOutput::StitchedMosaic, MontageMosaic::BlendMode::None}].getDataRefAs<IDataArray>(mosaicArrayPath);
+  const auto& linearBlend = mosaics[{FijiMontageOutput::StitchedMosaic, MontageMosaic::BlendMode::Linear}].getDataRefAs<IDataArray>(mosaicArrayPath);
+  ExecuteNeighborFunction(CompareSingleCoverageFunctor{}, noBlend.getDataType(), noBlend, linearBlend, coverage);
+
+  // Every tile shows up unchanged at its offset in the mosaic, both stitched and virtual
+  for(const auto montageOutput : {FijiMontageOutput::StitchedMosaic, FijiMontageOutput::VirtualMosaic})
+  {
+    const auto& mosaic = mosaics[{montageOutput, MontageMosaic::BlendMode::None}].getDataRefAs<IDataArray>(mosaicArrayPath);
+    for(const auto& tilePath : tilePaths)
+    {
+      const auto& tileGeometry = tileDataStructure.getDataRefAs<ImageGeom>(tilePath);
+      const auto& tileArray = tileDataStructure.getDataRefAs<IDataArray>(tilePath.createChildPath("Tile Data").createChildPath("Image"));
+      const std::array<usize, 2> tileOffset = {static_cast<usize>(std::round(tileGeometry.getOrigin()[0] - minOrigin[0])),
+                                               static_cast<usize>(std::round(tileGeometry.getOrigin()[1] - minOrigin[1]))};
+      ExecuteNeighborFunction(CompareTilePixelsFunctor{}, mosaic.getDataType(), mosaic, tileArray, tileOffset, tileGeometry, mosaicWidth, coverage);
+    }
+  }
+}
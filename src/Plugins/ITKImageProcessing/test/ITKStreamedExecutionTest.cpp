@@ -0,0 +1,249 @@
+#include <catch2/catch.hpp>
+
+#include "ITKImageProcessing/Common/ITKArrayHelper.hpp"
+#include "ITKImageProcessing/Filters/ITKMedianImageFilter.hpp"
+#include "ITKImageProcessing/Filters/ITKNormalizeImageFilter.hpp"
+
+#include "simplnx/Core/Application.hpp"
+#include "simplnx/Core/Preferences.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Parameters/DataObjectNameParameter.hpp"
+#include "simplnx/Parameters/VectorParameter.hpp"
+#include "simplnx/UnitTest/UnitTestCommon.hpp"
+
+#include <cmath>
+#include <numeric>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr StringLiteral k_PluginName = "ITKImageProcessing";
+
+/**
+ * @brief Stands in for an out-of-core store: it holds its values in a vector but can only be accessed through the
+ * value and block interface, and counts how often it was read.
+ */
+class OutOfCoreTestStore : public AbstractDataStore<float32>
+{
+public:
+  OutOfCoreTestStore(const ShapeType& tupleShape, const ShapeType& componentShape)
+  : m_TupleShape(tupleShape)
+  , m_ComponentShape(componentShape)
+  , m_NumTuples(std::accumulate(tupleShape.cbegin(), tupleShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_NumComponents(std::accumulate(componentShape.cbegin(), componentShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_Values(m_NumTuples * m_NumComponents, 0.0f)
+  {
+  }
+
+  value_type getValue(usize index) const override
+  {
+    return m_Values[index];
+  }
+  void setValue(usize index, value_type value) override
+  {
+    m_Values[index] = value;
+  }
+  const_reference operator[](usize index) const override
+  {
+    return m_Values[index];
+  }
+  const_reference at(usize index) const override
+  {
+    return m_Values.at(index);
+  }
+  reference operator[](usize index) override
+  {
+    return m_Values[index];
+  }
+
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<float32> buffer) const override
+  {
+    if(startIndex + buffer.size() > m_Values.size())
+    {
+      return MakeErrorResult(-1, "Read past the end of the store");
+    }
+    std::copy_n(m_Values.cbegin() + startIndex, buffer.size(), buffer.begin());
+    m_NumReads++;
+    return {};
+  }
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const float32> buffer) override
+  {
+    if(startIndex + buffer.size() > m_Values.size())
+    {
+      return MakeErrorResult(-1, "Write past the end of the store");
+    }
+    std::copy(buffer.begin(), buffer.end(), m_Values.begin() + startIndex);
+    return {};
+  }
+
+  usize getNumberOfTuples() const override
+  {
+    return m_NumTuples;
+  }
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+  usize getNumberOfComponents() const override
+  {
+    return m_NumComponents;
+  }
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+  std::optional<ShapeType> getChunkShape() const override
+  {
+    return {};
+  }
+  void resizeTuples(const ShapeType& tupleShape) override
+  {
+  }
+  DataType getDataType() const override
+  {
+    return DataType::float32;
+  }
+  StoreType getStoreType() const override
+  {
+    return StoreType::OutOfCore;
+  }
+  std::string getDataFormat() const override
+  {
+    return "Test";
+  }
+  usize getTypeSize() const override
+  {
+    return sizeof(float32);
+  }
+  std::unique_ptr<IDataStore> deepCopy() const override
+  {
+    return nullptr;
+  }
+  std::unique_ptr<IDataStore> createNewInstance() const override
+  {
+    return nullptr;
+  }
+  std::pair<int32, std::string> writeBinaryFile(const std::string& absoluteFilePath) const override
+  {
+    return {-1, "Not supported"};
+  }
+  std::pair<int32, std::string> writeBinaryFile(std::ostream& outputStream) const override
+  {
+    return {-1, "Not supported"};
+  }
+
+  usize getNumberOfReads() const
+  {
+    return m_NumReads;
+  }
+
+private:
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  usize m_NumTuples = 0;
+  usize m_NumComponents = 0;
+  std::vector<float32> m_Values;
+  mutable usize m_NumReads = 0;
+};
+
+Result<> ExecuteMedian(DataStructure& dataStructure, const DataPath& geometryPath, const DataPath& inputArrayPath, const std::string& outputArrayName)
+{
+  ITKMedianImageFilter filter;
+  Arguments args;
+  args.insertOrAssign(ITKMedianImageFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(geometryPath));
+  args.insertOrAssign(ITKMedianImageFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(inputArrayPath));
+  args.insertOrAssign(ITKMedianImageFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>(outputArrayName));
+  args.insertOrAssign(ITKMedianImageFilter::k_Radius_Key, std::make_any<VectorUInt32Parameter::ValueType>(VectorUInt32Parameter::ValueType{1, 1, 1}));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  if(preflightResult.outputActions.invalid())
+  {
+    return ConvertResult(std::move(preflightResult.outputActions));
+  }
+  return filter.execute(dataStructure, args).result;
+}
+} // namespace
+
+TEST_CASE("ITKImageProcessing::ITKStreamedExecution(OutOfCoreMedian)", "[ITKImageProcessing][ITKStreamedExecution]")
+{
+  auto* preferences = Application::GetOrCreateInstance()->getPreferences();
+
+  const SizeVec3 dims = {16, 12, 10};
+  const ShapeType tupleShape = {dims[2], dims[1], dims[0]};
+
+  DataStructure dataStructure;
+  ImageGeom* imageGeom = ImageGeom::Create(dataStructure, "Image");
+  imageGeom->setDimensions(dims);
+  imageGeom->setSpacing({1.0f, 1.0f, 1.0f});
+  imageGeom->setOrigin({0.0f, 0.0f, 0.0f});
+  AttributeMatrix* cellData = AttributeMatrix::Create(dataStructure, "Cell Data", tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+
+  auto* inMemoryArray = UnitTest::CreateTestDataArray<float32>(dataStructure, "In Memory", tupleShape, {1}, cellData->getId());
+  auto outOfCoreStore = std::make_shared<OutOfCoreTestStore>(tupleShape, ShapeType{1});
+  for(usize i = 0; i < inMemoryArray->getNumberOfTuples(); i++)
+  {
+    const float32 value = std::sin(static_cast<float32>(i) * 0.37f) * 100.0f + static_cast<float32>(i % 7);
+    (*inMemoryArray)[i] = value;
+    outOfCoreStore->setValue(i, value);
+  }
+  REQUIRE(Float32Array::Create(dataStructure, "Out Of Core", outOfCoreStore, cellData->getId()) != nullptr);
+
+  const DataPath geometryPath({"Image"});
+  const DataPath cellDataPath = geometryPath.createChildPath("Cell Data");
+
+  // A budget that holds a few slices forces the out-of-core array through several slabs
+  const usize sliceBytes = dims[0] * dims[1] * sizeof(float32);
+  preferences->setPluginValue(k_PluginName, ITK::Constants::k_StreamingMemoryBudget_Key.str(), sliceBytes * 10);
+
+  SIMPLNX_RESULT_REQUIRE_VALID(ExecuteMedian(dataStructure, geometryPath, cellDataPath.createChildPath("In Memory"), "In Memory Median"));
+  SIMPLNX_RESULT_REQUIRE_VALID(ExecuteMedian(dataStructure, geometryPath, cellDataPath.createChildPath("Out Of Core"), "Out Of Core Median"));
+  REQUIRE(outOfCoreStore->getNumberOfReads() > 1);
+
+  const auto& expected = dataStructure.getDataRefAs<Float32Array>(cellDataPath.createChildPath("In Memory Median"));
+  const auto& streamed = dataStructure.getDataRefAs<Float32Array>(cellDataPath.createChildPath("Out Of Core Median"));
+  REQUIRE(streamed.getSize() == expected.getSize());
+  for(usize i = 0; i < expected.getSize(); i++)
+  {
+    REQUIRE(streamed[i] == expected[i]);
+  }
+
+  // A budget that can not hold one slice and its neighbors is reported instead of exceeded
+  preferences->setPluginValue(k_PluginName, ITK::Constants::k_StreamingMemoryBudget_Key.str(), sliceBytes);
+  Result<> tooSmallResult = ExecuteMedian(dataStructure, geometryPath, cellDataPath.createChildPath("Out Of Core"), "Too Small Median");
+  REQUIRE(tooSmallResult.invalid());
+  REQUIRE(tooSmallResult.errors().front().code == ITK::Constants::k_StreamingMemoryBudgetTooSmall);
+
+  preferences->setPluginValue(k_PluginName, ITK::Constants::k_StreamingMemoryBudget_Key.str(), 0);
+}
+
+TEST_CASE("ITKImageProcessing::ITKStreamedExecution(NotStreamable)", "[ITKImageProcessing][ITKStreamedExecution]")
+{
+  const SizeVec3 dims = {8, 6, 4};
+  const ShapeType tupleShape = {dims[2], dims[1], dims[0]};
+
+  DataStructure dataStructure;
+  ImageGeom* imageGeom = ImageGeom::Create(dataStructure, "Image");
+  imageGeom->setDimensions(dims);
+  AttributeMatrix* cellData = AttributeMatrix::Create(dataStructure, "Cell Data", tupleShape, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  REQUIRE(Float32Array::Create(dataStructure, "Out Of Core", std::make_shared<OutOfCoreTestStore>(tupleShape, ShapeType{1}), cellData->getId()) != nullptr);
+
+  const DataPath geometryPath({"Image"});
+
+  // Normalizing needs the mean and deviation of the whole image, so it does not opt into slab by slab execution
+  ITKNormalizeImageFilter filter;
+  Arguments args;
+  args.insertOrAssign(ITKNormalizeImageFilter::k_InputImageGeomPath_Key, std::make_any<DataPath>(geometryPath));
+  args.insertOrAssign(ITKNormalizeImageFilter::k_InputImageDataPath_Key, std::make_any<DataPath>(geometryPath.createChildPath("Cell Data").createChildPath("Out Of Core")));
+  args.insertOrAssign(ITKNormalizeImageFilter::k_OutputImageArrayName_Key, std::make_any<DataObjectNameParameter::ValueType>("Normalized"));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+  auto executeResult = filter.execute(dataStructure, args);
+  REQUIRE(executeResult.result.invalid());
+  REQUIRE(executeResult.result.errors().front().code == ITK::Constants::k_StreamingNotSupported);
+}
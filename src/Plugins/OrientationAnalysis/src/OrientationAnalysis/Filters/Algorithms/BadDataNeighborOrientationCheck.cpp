@@ -1,16 +1,263 @@
 #include "BadDataNeighborOrientationCheck.hpp"
 
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
-#include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/LaueOps/LaueOps.h"
 
+#include <array>
+#include <atomic>
+
 using namespace nx::core;
 
+namespace
+{
+constexpr usize k_NumFaces = 6;
+
+// Radians added to the misorientation tolerance when the engine angle is used to skip pairs that are clearly apart
+constexpr float64 k_AnglePrefilterSlack = 1.0e-4;
+
+// State of a cell during the iterations. A cell that is flagged in one sweep only counts as good in the next sweep.
+constexpr uint8 k_BadCell = 0;
+constexpr uint8 k_GoodCell = 1;
+constexpr uint8 k_FlaggedCell = 2;
+
+std::array<bool, k_NumFaces> ValidFaceNeighbors(int64 column, int64 row, int64 plane, const std::array<int64, 3>& dims)
+{
+  return {plane > 0, row > 0, column > 0, column < dims[0] - 1, row < dims[1] - 1, plane < dims[2] - 1};
+}
+
+std::array<int64, k_NumFaces> FaceNeighborOffsets(const std::array<int64, 3>& dims)
+{
+  return {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+}
+
+/**
+ * @brief Finds which face neighbors of every bad cell in a range of rows have a similar orientation and
+ * counts the similar neighbors that are already good.
+ */
+class FindSimilarNeighborsImpl
+{
+public:
+  FindSimilarNeighborsImpl(const MisorientationEngine& misorientationEngine, const std::vector<LaueOps::Pointer>& orientationOps, const MaskCompare& maskCompare,
+                           const Int32AbstractDataStore& cellPhases, const Float32AbstractDataStore& quats, const UInt32AbstractDataStore& crystalStructures, std::array<int64, 3> dims,
+                           float32 misorientationTolerance, std::vector<uint8>& cellStates, std::vector<uint8>& similarNeighbors, std::vector<uint8>& neighborCount)
+  : m_MisorientationEngine(misorientationEngine)
+  , m_OrientationOps(orientationOps)
+  , m_MaskCompare(maskCompare)
+  , m_CellPhases(cellPhases)
+  , m_Quats(quats)
+  , m_CrystalStructures(crystalStructures)
+  , m_Dims(dims)
+  , m_MisorientationTolerance(misorientationTolerance)
+  , m_CellStates(cellStates)
+  , m_SimilarNeighbors(similarNeighbors)
+  , m_NeighborCount(neighborCount)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const std::array<int64, k_NumFaces> neighborOffsets = FaceNeighborOffsets(m_Dims);
+    for(usize rowIndex = range.min(); rowIndex < range.max(); rowIndex++)
+    {
+      const auto plane = static_cast<int64>(rowIndex) / m_Dims[1];
+      const auto row = static_cast<int64>(rowIndex) % m_Dims[1];
+      for(int64 column = 0; column < m_Dims[0]; column++)
+      {
+        const int64 i = (plane * m_Dims[1] + row) * m_Dims[0] + column;
+        if(m_MaskCompare.isTrue(i))
+        {
+          m_CellStates[i] = k_GoodCell;
+          continue;
+        }
+        m_CellStates[i] = k_BadCell;
+
+        const int32 phase = m_CellPhases.getValue(i);
+        if(phase <= 0)
+        {
+          continue;
+        }
+        const uint32 laueClass = m_CrystalStructures.getValue(phase);
+        const std::array<bool, k_NumFaces> validNeighbors = ValidFaceNeighbors(column, row, plane, m_Dims);
+        uint8 similarNeighbors = 0;
+        uint8 neighborCount = 0;
+        for(usize j = 0; j < k_NumFaces; j++)
+        {
+          const int64 neighbor = i + neighborOffsets[j];
+          if(!validNeighbors[j] || m_CellPhases.getValue(neighbor) != phase)
+          {
+            continue;
+          }
+          if(isSimilar(laueClass, i, neighbor))
+          {
+            similarNeighbors |= static_cast<uint8>(1 << j);
+            if(m_MaskCompare.isTrue(neighbor))
+            {
+              neighborCount++;
+            }
+          }
+        }
+        m_SimilarNeighbors[i] = similarNeighbors;
+        m_NeighborCount[i] = neighborCount;
+      }
+    }
+  }
+
+private:
+  /**
+   * @brief Returns whether the misorientation of two cells is below the tolerance. The engine only skips pairs that
+   * are clearly apart: it can differ from the LaueOps angle in the last bits, so the decision itself is made on the
+   * LaueOps angle to keep pairs at the tolerance unchanged.
+   */
+  bool isSimilar(uint32 laueClass, int64 index1, int64 index2) const
+  {
+    if(laueClass >= m_OrientationOps.size() || !m_MisorientationEngine.isBelowTolerance(laueClass, m_Quats, index1, index2, m_MisorientationTolerance + k_AnglePrefilterSlack))
+    {
+      return false;
+    }
+    QuatF quat1(m_Quats.getValue(index1 * 4), m_Quats.getValue(index1 * 4 + 1), m_Quats.getValue(index1 * 4 + 2), m_Quats.getValue(index1 * 4 + 3));
+    QuatF quat2(m_Quats.getValue(index2 * 4), m_Quats.getValue(index2 * 4 + 1), m_Quats.getValue(index2 * 4 + 2), m_Quats.getValue(index2 * 4 + 3));
+    OrientationD axisAngle = m_OrientationOps[laueClass]->calculateMisorientation(quat1, quat2);
+    return axisAngle[3] < m_MisorientationTolerance;
+  }
+
+  const MisorientationEngine& m_MisorientationEngine;
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  const MaskCompare& m_MaskCompare;
+  const Int32AbstractDataStore& m_CellPhases;
+  const Float32AbstractDataStore& m_Quats;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  std::array<int64, 3> m_Dims = {0, 0, 0};
+  float32 m_MisorientationTolerance = 0.0f;
+  std::vector<uint8>& m_CellStates;
+  std::vector<uint8>& m_SimilarNeighbors;
+  std::vector<uint8>& m_NeighborCount;
+};
+
+/**
+ * @brief Flags every bad cell of a range that has enough similar good neighbors. Cells flagged in the previous
+ * sweep become good cells.
+ */
+class FlagCellsImpl
+{
+public:
+  FlagCellsImpl(const std::vector<uint8>& neighborCount, int32 currentLevel, std::vector<uint8>& cellStates, std::atomic<usize>& flaggedCount)
+  : m_NeighborCount(neighborCount)
+  , m_CurrentLevel(currentLevel)
+  , m_CellStates(cellStates)
+  , m_FlaggedCount(flaggedCount)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    usize flaggedCount = 0;
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_CellStates[i] == k_FlaggedCell)
+      {
+        m_CellStates[i] = k_GoodCell;
+      }
+      else if(m_CellStates[i] == k_BadCell && m_NeighborCount[i] >= m_CurrentLevel)
+      {
+        m_CellStates[i] = k_FlaggedCell;
+        flaggedCount++;
+      }
+    }
+    m_FlaggedCount += flaggedCount;
+  }
+
+private:
+  const std::vector<uint8>& m_NeighborCount;
+  int32 m_CurrentLevel = 0;
+  std::vector<uint8>& m_CellStates;
+  std::atomic<usize>& m_FlaggedCount;
+};
+
+/**
+ * @brief Adds the similar neighbors that were flagged in the current sweep to the neighbor count of every bad
+ * cell in a range of rows. Only the cell states of the current sweep are read.
+ */
+class CountFlaggedNeighborsImpl
+{
+public:
+  CountFlaggedNeighborsImpl(const std::vector<uint8>& cellStates, const std::vector<uint8>& similarNeighbors, std::array<int64, 3> dims, std::vector<uint8>& neighborCount)
+  : m_CellStates(cellStates)
+  , m_SimilarNeighbors(similarNeighbors)
+  , m_Dims(dims)
+  , m_NeighborCount(neighborCount)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const std::array<int64, k_NumFaces> neighborOffsets = FaceNeighborOffsets(m_Dims);
+    for(usize rowIndex = range.min(); rowIndex < range.max(); rowIndex++)
+    {
+      const auto plane = static_cast<int64>(rowIndex) / m_Dims[1];
+      const auto row = static_cast<int64>(rowIndex) % m_Dims[1];
+      for(int64 column = 0; column < m_Dims[0]; column++)
+      {
+        const int64 i = (plane * m_Dims[1] + row) * m_Dims[0] + column;
+        if(m_CellStates[i] != k_BadCell || m_SimilarNeighbors[i] == 0)
+        {
+          continue;
+        }
+        const std::array<bool, k_NumFaces> validNeighbors = ValidFaceNeighbors(column, row, plane, m_Dims);
+        for(usize j = 0; j < k_NumFaces; j++)
+        {
+          if(validNeighbors[j] && (m_SimilarNeighbors[i] & (1 << j)) != 0 && m_CellStates[i + neighborOffsets[j]] == k_FlaggedCell)
+          {
+            m_NeighborCount[i]++;
+          }
+        }
+      }
+    }
+  }
+
+private:
+  const std::vector<uint8>& m_CellStates;
+  const std::vector<uint8>& m_SimilarNeighbors;
+  std::array<int64, 3> m_Dims = {0, 0, 0};
+  std::vector<uint8>& m_NeighborCount;
+};
+
+/**
+ * @brief Writes the cells that were turned good back into the mask array.
+ */
+class UpdateMaskImpl
+{
+public:
+  UpdateMaskImpl(const std::vector<uint8>& cellStates, MaskCompare& maskCompare)
+  : m_CellStates(cellStates)
+  , m_MaskCompare(maskCompare)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_CellStates[i] != k_BadCell && !m_MaskCompare.isTrue(i))
+      {
+        m_MaskCompare.setValue(i, true);
+      }
+    }
+  }
+
+private:
+  const std::vector<uint8>& m_CellStates;
+  MaskCompare& m_MaskCompare;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 BadDataNeighborOrientationCheck::BadDataNeighborOrientationCheck(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                                  BadDataNeighborOrientationCheckInputValues* inputValues)
@@ -37,10 +284,11 @@ Result<> BadDataNeighborOrientationCheck::operator()()
 
   auto* imageGeomPtr = m_DataStructure.getDataAs<ImageGeom>(m_InputValues->ImageGeomPath);
   SizeVec3 udims = imageGeomPtr->getDimensions();
-  const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
-  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
-  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
-  size_t totalPoints = quats.getNumberOfTuples();
+  const auto& cellPhasesArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
+  const auto& quatsArray = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
+  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath).getDataStoreRef();
+  auto& maskArray = m_DataStructure.getDataRefAs<IDataArray>(m_InputValues->MaskArrayPath);
+  size_t totalPoints = quatsArray.getNumberOfTuples();
 
   std::unique_ptr<MaskCompare> maskCompare = nullptr;
   try
@@ -54,180 +302,67 @@ Result<> BadDataNeighborOrientationCheck::operator()()
     return MakeErrorResult(-54900, message);
   }
 
-  int64_t dims[3] = {
+  const std::array<int64, 3> dims = {
       static_cast<int64_t>(udims[0]),
       static_cast<int64_t>(udims[1]),
       static_cast<int64_t>(udims[2]),
   };
 
-  int32_t good = 1;
-  int64_t neighbor = 0;
-  int64_t column = 0, row = 0, plane = 0;
-
-  int64_t neighpoints[6] = {0, 0, 0, 0, 0, 0};
-  neighpoints[0] = static_cast<int64_t>(-dims[0] * dims[1]);
-  neighpoints[1] = static_cast<int64_t>(-dims[0]);
-  neighpoints[2] = static_cast<int64_t>(-1);
-  neighpoints[3] = static_cast<int64_t>(1);
-  neighpoints[4] = static_cast<int64_t>(dims[0]);
-  neighpoints[5] = static_cast<int64_t>(dims[0] * dims[1]);
-
-  float w = 10000.0f;
-
-  uint32_t phase1 = 0;
+  const MisorientationEngine misorientationEngine;
+  const std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
 
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  // Every pass reads the cell states of the previous pass only, so the rows of cells can be processed in any order
+  // and every sweep gives the same result as the serial algorithm once it has converged.
+  std::vector<uint8> cellStates(totalPoints, k_BadCell);
+  std::vector<uint8> similarNeighbors(totalPoints, 0);
+  std::vector<uint8> neighborCount(totalPoints, 0);
 
-  std::vector<int32_t> neighborCount(totalPoints, 0);
-
-  int64_t progressInt = 0;
-  auto start = std::chrono::steady_clock::now();
-  for(size_t i = 0; i < totalPoints; i++)
+  m_MessageHandler({IFilter::Message::Type::Info, "Finding similar neighbors"});
   {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
-      std::string ss = fmt::format("Processing Data '{}'% completed", progressInt);
-      m_MessageHandler({IFilter::Message::Type::Info, ss});
-      start = std::chrono::steady_clock::now();
-    }
-
-    if(!maskCompare->isTrue(i))
-    {
-      column = i % dims[0];
-      row = (i / dims[0]) % dims[1];
-      plane = i / (dims[0] * dims[1]);
-      for(int32_t j = 0; j < 6; j++)
-      {
-        good = 1;
-        neighbor = i + neighpoints[j];
-        if(j == 0 && plane == 0)
-        {
-          good = 0;
-        }
-        if(j == 5 && plane == (dims[2] - 1))
-        {
-          good = 0;
-        }
-        if(j == 1 && row == 0)
-        {
-          good = 0;
-        }
-        if(j == 4 && row == (dims[1] - 1))
-        {
-          good = 0;
-        }
-        if(j == 2 && column == 0)
-        {
-          good = 0;
-        }
-        if(j == 3 && column == (dims[0] - 1))
-        {
-          good = 0;
-        }
-        if(good == 1 && maskCompare->isTrue(neighbor))
-        {
-          phase1 = crystalStructures[cellPhases[i]];
-          QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-          QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-
-          if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
-          {
-            OrientationD axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-            w = axisAngle[3];
-          }
-          if(w < misorientationTolerance)
-          {
-            neighborCount[i]++;
-          }
-        }
-      }
-    }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, static_cast<usize>(dims[1] * dims[2]));
+    dataAlg.requireArraysInMemory({&cellPhasesArray, &quatsArray, &maskArray});
+    dataAlg.execute(FindSimilarNeighborsImpl(misorientationEngine, orientationOps, *maskCompare, cellPhasesArray.getDataStoreRef(), quatsArray.getDataStoreRef(), crystalStructures, dims,
+                                             misorientationTolerance, cellStates, similarNeighbors, neighborCount));
   }
 
   const int32_t startLevel = 6;
   int32_t currentLevel = startLevel;
-  int32_t counter = 0;
 
   while(currentLevel > m_InputValues->NumberOfNeighbors)
   {
-    counter = 1;
+    usize counter = 1;
     int32_t loopNumber = 0;
     while(counter > 0)
     {
-      counter = 0;
-      progressInt = 0;
-      start = std::chrono::steady_clock::now();
-      for(size_t i = 0; i < totalPoints; i++)
+      if(getCancel())
       {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-        {
-          progressInt = static_cast<int64_t>((static_cast<float>(i) / totalPoints) * 100.0f);
-          std::string ss =
-              fmt::format("Level '{}' of '{}' || Processing Data ('{}') '{}'% completed", (startLevel - currentLevel) + 1, startLevel - m_InputValues->NumberOfNeighbors, loopNumber, progressInt);
-          m_MessageHandler({IFilter::Message::Type::Info, ss});
-          start = std::chrono::steady_clock::now();
-        }
+        return {};
+      }
+      std::string ss = fmt::format("Level '{}' of '{}' || Processing Data ('{}')", (startLevel - currentLevel) + 1, startLevel - m_InputValues->NumberOfNeighbors, loopNumber);
+      m_MessageHandler({IFilter::Message::Type::Info, ss});
 
-        if(neighborCount[i] >= currentLevel && !maskCompare->isTrue(i))
-        {
-          maskCompare->setValue(i, true);
-          counter++;
-          column = i % dims[0];
-          row = (i / dims[0]) % dims[1];
-          plane = i / (dims[0] * dims[1]);
-          for(int64_t j = 0; j < 6; j++)
-          {
-            good = 1;
-            neighbor = i + neighpoints[j];
-            if(j == 0 && plane == 0)
-            {
-              good = 0;
-            }
-            if(j == 5 && plane == (dims[2] - 1))
-            {
-              good = 0;
-            }
-            if(j == 1 && row == 0)
-            {
-              good = 0;
-            }
-            if(j == 4 && row == (dims[1] - 1))
-            {
-              good = 0;
-            }
-            if(j == 2 && column == 0)
-            {
-              good = 0;
-            }
-            if(j == 3 && column == (dims[0] - 1))
-            {
-              good = 0;
-            }
-            if(good == 1 && !maskCompare->isTrue(neighbor))
-            {
-              QuatF quat1(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-              QuatF quat2(quats[neighbor * 4], quats[neighbor * 4 + 1], quats[neighbor * 4 + 2], quats[neighbor * 4 + 3]);
-
-              if(cellPhases[i] == cellPhases[neighbor] && cellPhases[i] > 0)
-              {
-                OrientationD axisAngle = orientationOps[phase1]->calculateMisorientation(quat1, quat2);
-                w = axisAngle[3];
-              }
-              if(w < misorientationTolerance)
-              {
-                neighborCount[neighbor]++;
-              }
-            }
-          }
-        }
+      std::atomic<usize> flaggedCount = 0;
+      ParallelDataAlgorithm flagAlg;
+      flagAlg.setRange(0, totalPoints);
+      flagAlg.execute(FlagCellsImpl(neighborCount, currentLevel, cellStates, flaggedCount));
+      counter = flaggedCount;
+
+      if(counter > 0)
+      {
+        ParallelDataAlgorithm countAlg;
+        countAlg.setRange(0, static_cast<usize>(dims[1] * dims[2]));
+        countAlg.execute(CountFlaggedNeighborsImpl(cellStates, similarNeighbors, dims, neighborCount));
       }
       ++loopNumber;
     }
     currentLevel = currentLevel - 1;
   }
 
+  ParallelDataAlgorithm maskAlg;
+  maskAlg.setRange(0, totalPoints);
+  maskAlg.requireArraysInMemory({&maskArray});
+  maskAlg.execute(UpdateMaskImpl(cellStates, *maskCompare));
+
   return {};
 }
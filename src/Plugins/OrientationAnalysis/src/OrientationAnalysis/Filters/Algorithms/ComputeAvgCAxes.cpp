@@ -4,14 +4,165 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/Utilities/ImageRotationUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelFeatureReduction.hpp"
 
 #include "EbsdLib/Core/Orientation.hpp"
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
 
+#include <cmath>
+
 using namespace nx::core;
 using namespace nx::core::OrientationUtilities;
 
+namespace
+{
+struct CAxisAccumulator
+{
+  Eigen::Vector3d sum = Eigen::Vector3d::Zero();
+  usize count = 0;
+  bool hasNonHexagonalCell = false;
+};
+
+bool IsHexagonal(uint32 crystalStructureType)
+{
+  return crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_High || crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_Low;
+}
+
+/**
+ * @brief Sums the sample reference frame c-axis of every hexagonal cell per feature. Each c-axis is flipped
+ * into the same half space as the running sum of its feature.
+ */
+class CAxisReducer
+{
+public:
+  using AccumulatorType = CAxisAccumulator;
+
+  CAxisReducer(const Float32AbstractDataStore& quats, const Int32AbstractDataStore& cellPhases, const UInt32AbstractDataStore& crystalStructures)
+  : m_Quats(quats)
+  , m_CellPhases(cellPhases)
+  , m_CrystalStructures(crystalStructures)
+  {
+  }
+
+  void accumulate(AccumulatorType& accumulator, usize cellIndex, usize featureId) const
+  {
+    if(featureId == 0)
+    {
+      return;
+    }
+    if(!IsHexagonal(m_CrystalStructures.getValue(m_CellPhases.getValue(cellIndex))))
+    {
+      accumulator.hasNonHexagonalCell = true;
+      return;
+    }
+
+    const usize quatIndex = cellIndex * 4;
+    // Create the 3x3 Orientation Matrix from the Quaternion. This represents a passive rotation matrix
+    OrientationF oMatrix =
+        OrientationTransformation::qu2om<QuatF, OrientationF>({m_Quats.getValue(quatIndex), m_Quats.getValue(quatIndex + 1), m_Quats.getValue(quatIndex + 2), m_Quats.getValue(quatIndex + 3)});
+
+    // Multiply the active transformation matrix by the C-Axis (as Miller Index). This actively rotates
+    // the crystallographic C-Axis (which is along the <0,0,1> direction) into the physical sample
+    // reference frame
+    const Eigen::Vector3f cAxis{0.0f, 0.0f, 1.0f};
+    Eigen::Vector3f c1 = OrientationMatrixToGMatrixTranspose(oMatrix) * cAxis;
+
+    // normalize so that the magnitude is 1
+    c1.normalize();
+
+    // Ensure that angle between the current point's sample reference frame C-Axis
+    // and the running average sample C-Axis is positive
+    if(accumulator.count > 0)
+    {
+      const Eigen::Vector3f curCAxis = accumulator.sum.cast<float32>().normalized();
+      if(ImageRotationUtilities::CosBetweenVectors(c1, curCAxis) < 0)
+      {
+        c1 *= -1.0f;
+      }
+    }
+    accumulator.sum += c1.cast<float64>();
+    accumulator.count++;
+  }
+
+  void merge(AccumulatorType& total, const AccumulatorType& partial, [[maybe_unused]] usize featureId) const
+  {
+    total.hasNonHexagonalCell = total.hasNonHexagonalCell || partial.hasNonHexagonalCell;
+    if(partial.count == 0)
+    {
+      return;
+    }
+    // Flipping every c-axis of the partial sum is the same as flipping the sum
+    if(total.count > 0 && total.sum.dot(partial.sum) < 0.0)
+    {
+      total.sum -= partial.sum;
+    }
+    else
+    {
+      total.sum += partial.sum;
+    }
+    total.count += partial.count;
+  }
+
+private:
+  const Float32AbstractDataStore& m_Quats;
+  const Int32AbstractDataStore& m_CellPhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+};
+
+/**
+ * @brief Writes the normalized average c-axis of every feature. Features that contain a non hexagonal
+ * cell receive NaN values.
+ */
+class ComputeAvgCAxesImpl
+{
+public:
+  ComputeAvgCAxesImpl(const std::vector<CAxisAccumulator>& cAxisSums, Float32AbstractDataStore& avgCAxes)
+  : m_CAxisSums(cAxisSums)
+  , m_AvgCAxes(avgCAxes)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      const CAxisAccumulator& accumulator = m_CAxisSums[featureId];
+      const usize tupleIndex = featureId * 3;
+      if(accumulator.hasNonHexagonalCell)
+      {
+        m_AvgCAxes.setValue(tupleIndex, NAN);
+        m_AvgCAxes.setValue(tupleIndex + 1, NAN);
+        m_AvgCAxes.setValue(tupleIndex + 2, NAN);
+        continue;
+      }
+
+      if(accumulator.count == 0)
+      {
+        m_AvgCAxes.setValue(tupleIndex, 0.0f);
+        m_AvgCAxes.setValue(tupleIndex + 1, 0.0f);
+        m_AvgCAxes.setValue(tupleIndex + 2, 1.0f);
+        continue;
+      }
+
+      const auto count = static_cast<float64>(accumulator.count);
+      auto x = static_cast<float32>(accumulator.sum[0] / count);
+      auto y = static_cast<float32>(accumulator.sum[1] / count);
+      auto z = static_cast<float32>(accumulator.sum[2] / count);
+      MatrixMath::Normalize3x1(x, y, z);
+      m_AvgCAxes.setValue(tupleIndex, x);
+      m_AvgCAxes.setValue(tupleIndex + 1, y);
+      m_AvgCAxes.setValue(tupleIndex + 2, z);
+    }
+  }
+
+private:
+  const std::vector<CAxisAccumulator>& m_CAxisSums;
+  Float32AbstractDataStore& m_AvgCAxes;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeAvgCAxes::ComputeAvgCAxes(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ComputeAvgCAxesInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -38,8 +189,7 @@ Result<> ComputeAvgCAxes::operator()()
   bool noPhasesHexagonal = true;
   for(usize i = 1; i < crystalStructures.size(); ++i)
   {
-    const auto crystalStructureType = crystalStructures[i];
-    const bool isHex = crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_High || crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_Low;
+    const bool isHex = IsHexagonal(crystalStructures[i]);
     allPhasesHexagonal = allPhasesHexagonal && isHex;
     noPhasesHexagonal = noPhasesHexagonal && !isHex;
   }
@@ -57,99 +207,22 @@ Result<> ComputeAvgCAxes::operator()()
          "Finding the average c-axes requires Hexagonal-Low 6/m or Hexagonal-High 6/mmm type crystal structures. All calculations for non Hexagonal phases will be skipped and a NaN value inserted."});
   }
 
-  const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
-  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
-  const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
-  auto& avgCAxes = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgCAxesArrayPath);
+  const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath).getDataStoreRef();
+  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath).getDataStoreRef();
+  const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath).getDataStoreRef();
+  auto& avgCAxes = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgCAxesArrayPath).getDataStoreRef();
 
-  const usize totalPoints = featureIds.getNumberOfTuples();
   const usize totalFeatures = avgCAxes.getNumberOfTuples();
 
-  Matrix3fR g1T;
-  g1T.fill(0.0f);
-  const Eigen::Vector3f cAxis{0.0f, 0.0f, 1.0f};
-  Eigen::Vector3f c1{0.0f, 0.0f, 0.0f};
-
-  std::vector<int32> counter(totalFeatures, 0);
+  ParallelFeatureReduction featureReduction;
+  featureReduction.setRange(0, featureIds.getNumberOfTuples());
+  featureReduction.requireStoresInMemory({&featureIds, &quats, &cellPhases});
+  std::vector<CAxisAccumulator> cAxisSums = featureReduction.execute(featureIds, totalFeatures, CAxisReducer(quats, cellPhases, crystalStructures.getDataStoreRef()));
 
-  Eigen::Vector3f curCAxis{0.0f, 0.0f, 0.0f};
-  usize cAxesIndex = 0;
-  float32 w = 0.0f;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.requireStoresInMemory({&avgCAxes});
+  dataAlg.execute(ComputeAvgCAxesImpl(cAxisSums, avgCAxes));
 
-  for(usize i = 0; i < totalPoints; i++)
-  {
-    if(featureIds[i] > 0)
-    {
-      cAxesIndex = 3 * featureIds[i];
-      const auto crystalStructureType = crystalStructures[cellPhases[i]];
-      if(crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_High || crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_Low)
-      {
-        const usize quatIndex = i * 4;
-
-        // Create the 3x3 Orientation Matrix from the Quaternion. This represents a passive rotation matrix
-        OrientationF oMatrix = OrientationTransformation::qu2om<QuatF, OrientationF>({quats[quatIndex], quats[quatIndex + 1], quats[quatIndex + 2], quats[quatIndex + 3]});
-
-        // Convert the passive rotation matrix to an active rotation matrix
-        g1T = OrientationMatrixToGMatrixTranspose(oMatrix);
-
-        // Multiply the active transformation matrix by the C-Axis (as Miller Index). This actively rotates
-        // the crystallographic C-Axis (which is along the <0,0,1> direction) into the physical sample
-        // reference frame
-        c1 = g1T * cAxis;
-
-        // normalize so that the magnitude is 1
-        c1.normalize();
-
-        // Compute the running average c-axis and normalize the result
-        curCAxis[0] = avgCAxes[cAxesIndex] / counter[featureIds[i]];
-        curCAxis[1] = avgCAxes[cAxesIndex + 1] / counter[featureIds[i]];
-        curCAxis[2] = avgCAxes[cAxesIndex + 2] / counter[featureIds[i]];
-        curCAxis.normalize();
-
-        // Ensure that angle between the current point's sample reference frame C-Axis
-        // and the running average sample C-Axis is positive
-        w = ImageRotationUtilities::CosBetweenVectors(c1, curCAxis);
-        if(w < 0)
-        {
-          c1 *= -1.0f;
-        }
-        // Continue summing up the rotations
-        counter[featureIds[i]]++;
-        avgCAxes[cAxesIndex] += c1[0];
-        avgCAxes[cAxesIndex + 1] += c1[1];
-        avgCAxes[cAxesIndex + 2] += c1[2];
-      }
-      else
-      {
-        avgCAxes[cAxesIndex] = NAN;
-        avgCAxes[cAxesIndex + 1] = NAN;
-        avgCAxes[cAxesIndex + 2] = NAN;
-      }
-    }
-  }
-
-  for(size_t i = 1; i < totalFeatures; i++)
-  {
-    const usize tupleIndex = i * 3;
-    if(std::isnan(avgCAxes[tupleIndex]))
-    {
-      continue;
-    }
-
-    if(counter[i] == 0)
-    {
-      avgCAxes[tupleIndex] = 0;
-      avgCAxes[tupleIndex + 1] = 0;
-      avgCAxes[tupleIndex + 2] = 1;
-    }
-    else
-    {
-      avgCAxes[tupleIndex] /= counter[i];
-      avgCAxes[tupleIndex + 1] /= counter[i];
-      avgCAxes[tupleIndex + 2] /= counter[i];
-
-      MatrixMath::Normalize3x1(avgCAxes[tupleIndex], avgCAxes[tupleIndex + 1], avgCAxes[tupleIndex + 2]);
-    }
-  }
   return result;
 }
@@ -3,11 +3,90 @@
 #include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
+#include <numeric>
+
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief Computes the average quaternion of each feature with the running average of the original serial
+ * algorithm. The running sum starts from the identity quaternion and every cell adds its symmetric equivalent
+ * that is nearest to the current average. The cells of each feature are visited in increasing cell order, so
+ * the averages are identical to the serial loop no matter how the features are split between threads.
+ */
+class ComputeAvgQuatsImpl
+{
+public:
+  ComputeAvgQuatsImpl(const std::vector<LaueOps::Pointer>& orientationOps, const Int32AbstractDataStore& phases, const Float32AbstractDataStore& quats,
+                      const UInt32AbstractDataStore& crystalStructures, const std::vector<usize>& featureOffsets, const std::vector<usize>& featureCells, Float32AbstractDataStore& avgQuats,
+                      Float32AbstractDataStore& avgEuler)
+  : m_OrientationOps(orientationOps)
+  , m_Phases(phases)
+  , m_Quats(quats)
+  , m_CrystalStructures(crystalStructures)
+  , m_FeatureOffsets(featureOffsets)
+  , m_FeatureCells(featureCells)
+  , m_AvgQuats(avgQuats)
+  , m_AvgEuler(avgEuler)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      QuatF runningQuat(0.0F, 0.0F, 0.0F, 1.0F);
+      float32 count = 0.0F;
+      for(usize cell = m_FeatureOffsets[featureId]; cell < m_FeatureOffsets[featureId + 1]; cell++)
+      {
+        const usize cellIndex = m_FeatureCells[cell];
+        count += 1.0F;
+        QuatF curAvgQuat(runningQuat.x() / count, runningQuat.y() / count, runningQuat.z() / count, runningQuat.w() / count);
+
+        const usize quatIndex = cellIndex * 4;
+        const QuatF voxQuat(m_Quats.getValue(quatIndex), m_Quats.getValue(quatIndex + 1), m_Quats.getValue(quatIndex + 2), m_Quats.getValue(quatIndex + 3));
+        const uint32 crystalStructure = m_CrystalStructures.getValue(m_Phases.getValue(cellIndex));
+        const QuatF nearestQuat = m_OrientationOps[crystalStructure]->getNearestQuat(curAvgQuat, voxQuat);
+
+        // Add the running average quat with the current quat
+        runningQuat = curAvgQuat + nearestQuat;
+      }
+
+      // Create a copy of the quaternion
+      QuatF curAvgQuat(runningQuat.x() / count, runningQuat.y() / count, runningQuat.z() / count, runningQuat.w() / count);
+      curAvgQuat = curAvgQuat.unitQuaternion();
+
+      usize featureIdOffset = featureId * 4;
+      m_AvgQuats.setValue(featureIdOffset, curAvgQuat.x());
+      m_AvgQuats.setValue(featureIdOffset + 1, curAvgQuat.y());
+      m_AvgQuats.setValue(featureIdOffset + 2, curAvgQuat.z());
+      m_AvgQuats.setValue(featureIdOffset + 3, curAvgQuat.w());
+
+      OrientationF eu = OrientationTransformation::qu2eu<Quaternion<float>, Orientation<float>>(curAvgQuat);
+      featureIdOffset = featureId * 3;
+      m_AvgEuler.setValue(featureIdOffset, eu[0]);
+      m_AvgEuler.setValue(featureIdOffset + 1, eu[1]);
+      m_AvgEuler.setValue(featureIdOffset + 2, eu[2]);
+    }
+  }
+
+private:
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  const Int32AbstractDataStore& m_Phases;
+  const Float32AbstractDataStore& m_Quats;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  const std::vector<usize>& m_FeatureOffsets;
+  const std::vector<usize>& m_FeatureCells;
+  Float32AbstractDataStore& m_AvgQuats;
+  Float32AbstractDataStore& m_AvgEuler;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeAvgOrientations::ComputeAvgOrientations(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                ComputeAvgOrientationsInputValues* inputValues)
@@ -24,92 +103,57 @@ ComputeAvgOrientations::~ComputeAvgOrientations() noexcept = default;
 // -----------------------------------------------------------------------------
 Result<> ComputeAvgOrientations::operator()()
 {
-
   std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
 
-  nx::core::Int32Array& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->cellFeatureIdsArrayPath);
-  nx::core::Int32Array& phases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->cellPhasesArrayPath);
-  nx::core::Float32Array& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->cellQuatsArrayPath);
+  const auto& featureIdsArray = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->cellFeatureIdsArrayPath);
+  const auto& featureIds = featureIdsArray.getDataStoreRef();
+  const auto& phases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->cellPhasesArrayPath).getDataStoreRef();
+  const auto& quats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->cellQuatsArrayPath).getDataStoreRef();
 
-  nx::core::UInt32Array& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->crystalStructuresArrayPath);
+  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->crystalStructuresArrayPath).getDataStoreRef();
 
   nx::core::Float32Array& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->avgQuatsArrayPath);
   nx::core::Float32Array& avgEuler = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->avgEulerAnglesArrayPath);
 
-  size_t totalPoints = featureIds.getNumberOfTuples();
-
-  auto numFeatResults = ValidateNumFeaturesInArray(m_DataStructure, m_InputValues->avgQuatsArrayPath, featureIds);
+  auto numFeatResults = ValidateNumFeaturesInArray(m_DataStructure, m_InputValues->avgQuatsArrayPath, featureIdsArray);
   if(numFeatResults.invalid())
   {
     return numFeatResults;
   }
   size_t totalFeatures = avgQuats.getNumberOfTuples();
-  std::vector<float> counts(totalFeatures, 0.0f);
 
   // initialize the output arrays
   avgQuats.fill(0.0F);
   // Initialize all Euler Angles to Zero
   avgEuler.fill(0.0F);
 
-  // Get the DataStore for each output array
-  auto* avgQuatDataStore = avgQuats.getDataStore();
-
-  // Get the Identity Quaternion
-  std::array<float, 4> identityQuat = {0.0F, 0.0F, 0.0F, 1.0F};
-
-  // Initialize all Average Quats to Identity
-  for(size_t tupleIndex = 1; tupleIndex < totalFeatures; tupleIndex++)
+  // Group the cells of every feature in increasing cell order so each feature can be averaged on its own
+  const usize totalPoints = featureIds.getNumberOfTuples();
+  std::vector<usize> featureOffsets(totalFeatures + 1, 0);
+  for(usize i = 0; i < totalPoints; i++)
   {
-    avgQuatDataStore->setTuple(tupleIndex, identityQuat);
+    const int32 featureId = featureIds.getValue(i);
+    if(featureId > 0 && phases.getValue(i) > 0)
+    {
+      featureOffsets[featureId + 1]++;
+    }
   }
-
-  for(size_t i = 0; i < totalPoints; i++)
+  std::partial_sum(featureOffsets.begin(), featureOffsets.end(), featureOffsets.begin());
+  std::vector<usize> featureCells(featureOffsets.back());
+  std::vector<usize> nextCell(featureOffsets.begin(), featureOffsets.end() - 1);
+  for(usize i = 0; i < totalPoints; i++)
   {
-    if(featureIds[i] > 0 && phases[i] > 0)
+    const int32 featureId = featureIds.getValue(i);
+    if(featureId > 0 && phases.getValue(i) > 0)
     {
-      int32 phase = phases[i];
-      size_t featureId = static_cast<size_t>(featureIds[i]);
-
-      size_t featureIdOffset = featureId * 4;
-      counts[featureId] += 1.0f;
-
-      float32 count = counts[featureId];
-      QuatF curAvgQuat(avgQuats[featureIdOffset] / count, avgQuats[featureIdOffset + 1] / count, avgQuats[featureIdOffset + 2] / count, avgQuats[featureIdOffset + 3] / count);
-
-      // Make a copy of the current quaternion from the DataArray into a QuatF object
-      QuatF voxQuat(quats[i * 4], quats[i * 4 + 1], quats[i * 4 + 2], quats[i * 4 + 3]);
-      QuatF nearestQuat = orientationOps[crystalStructures[phase]]->getNearestQuat(curAvgQuat, voxQuat);
-
-      // Add the running average quat with the current quat
-      curAvgQuat = curAvgQuat + nearestQuat;
-      // Copy the new curAvgQuat back into the output array
-      avgQuats[featureIdOffset] = curAvgQuat.x();
-      avgQuats[featureIdOffset + 1] = curAvgQuat.y();
-      avgQuats[featureIdOffset + 2] = curAvgQuat.z();
-      avgQuats[featureIdOffset + 3] = curAvgQuat.w();
+      featureCells[nextCell[featureId]++] = i;
     }
   }
 
-  for(size_t featureId = 1; featureId < totalFeatures; featureId++)
-  {
-    size_t featureIdOffset = featureId * 4;
-    float32 count = counts[featureId];
-
-    // Create a copy of the quaternion
-    QuatF curAvgQuat(avgQuats[featureIdOffset] / count, avgQuats[featureIdOffset + 1] / count, avgQuats[featureIdOffset + 2] / count, avgQuats[featureIdOffset + 3] / count);
-    curAvgQuat = curAvgQuat.unitQuaternion();
-
-    avgQuats[featureIdOffset] = curAvgQuat.x();
-    avgQuats[featureIdOffset + 1] = curAvgQuat.y();
-    avgQuats[featureIdOffset + 2] = curAvgQuat.z();
-    avgQuats[featureIdOffset + 3] = curAvgQuat.w();
-
-    OrientationF eu = OrientationTransformation::qu2eu<Quaternion<float>, Orientation<float>>(curAvgQuat);
-    featureIdOffset = featureId * 3;
-    avgEuler[featureIdOffset] = eu[0];
-    avgEuler[featureIdOffset + 1] = eu[1];
-    avgEuler[featureIdOffset + 2] = eu[2];
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.requireStoresInMemory({&phases, &quats, avgQuats.getDataStore(), avgEuler.getDataStore()});
+  dataAlg.execute(ComputeAvgQuatsImpl(orientationOps, phases, quats, crystalStructures, featureOffsets, featureCells, avgQuats.getDataStoreRef(), avgEuler.getDataStoreRef()));
 
   return {};
 }
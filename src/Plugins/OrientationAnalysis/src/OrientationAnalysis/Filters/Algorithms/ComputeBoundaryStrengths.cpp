@@ -3,12 +3,111 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Utilities/Math/MatrixMath.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/Core/Quaternion.hpp"
 #include "EbsdLib/LaueOps/LaueOps.h"
 
+#include <array>
+#include <atomic>
+
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief The ComputeBoundaryStrengthsImpl class computes the boundary strength metrics of a range of triangles.
+ */
+class ComputeBoundaryStrengthsImpl
+{
+public:
+  ComputeBoundaryStrengthsImpl(const std::vector<LaueOps::Pointer>& orientationOps, const Int32AbstractDataStore& faceLabels, const Float32AbstractDataStore& avgQuats,
+                               const Int32AbstractDataStore& featurePhases, const UInt32AbstractDataStore& crystalStructures, Float32AbstractDataStore& mPrimes, Float32AbstractDataStore& f1s,
+                               Float32AbstractDataStore& f1sPts, Float32AbstractDataStore& f7s, const std::array<float64, 3>& loading, std::atomic_bool& emitLaueClassWarning)
+  : m_OrientationOps(orientationOps)
+  , m_FaceLabels(faceLabels)
+  , m_AvgQuats(avgQuats)
+  , m_FeaturePhases(featurePhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_MPrimes(mPrimes)
+  , m_F1s(f1s)
+  , m_F1sPts(f1sPts)
+  , m_F7s(f7s)
+  , m_Loading(loading)
+  , m_EmitLaueClassWarning(emitLaueClassWarning)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    float32 mPrime_1, mPrime_2, F1_1, F1_2, F1spt_1, F1spt_2, F7_1, F7_2;
+    int32 gName1, gName2;
+
+    float64 LD[3] = {m_Loading[0], m_Loading[1], m_Loading[2]};
+
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      gName1 = m_FaceLabels[i * 2];
+      gName2 = m_FaceLabels[i * 2 + 1];
+      mPrime_1 = 0.0f;
+      F1_1 = 0.0f;
+      F1spt_1 = 0.0f;
+      F7_1 = 0.0f;
+      mPrime_2 = 0.0f;
+      F1_2 = 0.0f;
+      F1spt_2 = 0.0f;
+      F7_2 = 0.0f;
+      if(gName1 > 0 && gName2 > 0)
+      {
+        QuatD q1(m_AvgQuats[gName1 * 4], m_AvgQuats[gName1 * 4 + 1], m_AvgQuats[gName1 * 4 + 2], m_AvgQuats[gName1 * 4 + 3]);
+        QuatD q2(m_AvgQuats[gName2 * 4], m_AvgQuats[gName2 * 4 + 1], m_AvgQuats[gName2 * 4 + 2], m_AvgQuats[gName2 * 4 + 3]);
+
+        uint32 laueClassG1 = static_cast<uint32>(m_FeaturePhases[gName1]);
+        uint32 laueClassG2 = static_cast<uint32>(m_FeaturePhases[gName2]);
+        if(laueClassG1 == laueClassG2 && laueClassG1 != 1)
+        {
+          m_EmitLaueClassWarning = true;
+        }
+        if(m_CrystalStructures[laueClassG1] == m_CrystalStructures[laueClassG2] && m_FeaturePhases[gName1] > 0)
+        {
+          const LaueOps& orientationOps = *m_OrientationOps[m_CrystalStructures[m_FeaturePhases[gName1]]];
+          mPrime_1 = static_cast<float32>(orientationOps.getmPrime(q1, q2, LD));
+          mPrime_2 = static_cast<float32>(orientationOps.getmPrime(q2, q1, LD));
+          F1_1 = static_cast<float32>(orientationOps.getF1(q1, q2, LD, true));
+          F1_2 = static_cast<float32>(orientationOps.getF1(q2, q1, LD, true));
+          F1spt_1 = static_cast<float32>(orientationOps.getF1spt(q1, q2, LD, true));
+          F1spt_2 = static_cast<float32>(orientationOps.getF1spt(q2, q1, LD, true));
+          F7_1 = static_cast<float32>(orientationOps.getF7(q1, q2, LD, true));
+          F7_2 = static_cast<float32>(orientationOps.getF7(q2, q1, LD, true));
+        }
+      }
+
+      m_MPrimes[2 * i] = mPrime_1;
+      m_MPrimes[2 * i + 1] = mPrime_2;
+      m_F1s[2 * i] = F1_1;
+      m_F1s[2 * i + 1] = F1_2;
+      m_F1sPts[2 * i] = F1spt_1;
+      m_F1sPts[2 * i + 1] = F1spt_2;
+      m_F7s[2 * i] = F7_1;
+      m_F7s[2 * i + 1] = F7_2;
+    }
+  }
+
+private:
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  const Int32AbstractDataStore& m_FaceLabels;
+  const Float32AbstractDataStore& m_AvgQuats;
+  const Int32AbstractDataStore& m_FeaturePhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  Float32AbstractDataStore& m_MPrimes;
+  Float32AbstractDataStore& m_F1s;
+  Float32AbstractDataStore& m_F1sPts;
+  Float32AbstractDataStore& m_F7s;
+  std::array<float64, 3> m_Loading;
+  std::atomic_bool& m_EmitLaueClassWarning;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeBoundaryStrengths::ComputeBoundaryStrengths(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                    ComputeBoundaryStrengthsInputValues* inputValues)
@@ -33,10 +132,10 @@ Result<> ComputeBoundaryStrengths::operator()()
 {
   auto orientationOps = LaueOps::GetAllOrientationOps();
 
-  auto& surfaceMeshFaceLabels = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->SurfaceMeshFaceLabelsArrayPath);
-  auto& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
-  auto& featurePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
-  auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
+  const auto& surfaceMeshFaceLabels = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->SurfaceMeshFaceLabelsArrayPath);
+  const auto& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
+  const auto& featurePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
+  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
 
   auto& mPrimes = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->SurfaceMeshmPrimesArrayName);
   auto& f1s = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->SurfaceMeshF1sArrayName);
@@ -45,72 +144,16 @@ Result<> ComputeBoundaryStrengths::operator()()
 
   usize numTriangles = surfaceMeshFaceLabels.getNumberOfTuples();
 
-  float32 mPrime_1, mPrime_2, F1_1, F1_2, F1spt_1, F1spt_2, F7_1, F7_2;
-  int32 gName1, gName2;
-
-  float64 LD[3] = {m_InputValues->Loading[0], m_InputValues->Loading[1], m_InputValues->Loading[2]};
-  MatrixMath::Normalize3x1(LD);
-  bool emitLaueClassWarning = false;
-
-  for(usize i = 0; i < numTriangles; i++)
-  {
-    gName1 = surfaceMeshFaceLabels[i * 2];
-    gName2 = surfaceMeshFaceLabels[i * 2 + 1];
-    if(gName1 > 0 && gName2 > 0)
-    {
-      QuatD q1(avgQuats[gName1 * 4], avgQuats[gName1 * 4 + 1], avgQuats[gName1 * 4 + 2], avgQuats[gName1 * 4 + 3]);
-      QuatD q2(avgQuats[gName2 * 4], avgQuats[gName2 * 4 + 1], avgQuats[gName2 * 4 + 2], avgQuats[gName2 * 4 + 3]);
-
-      uint32 laueClassG1 = static_cast<uint32>(featurePhases[gName1]);
-      uint32 laueClassG2 = static_cast<uint32>(featurePhases[gName2]);
-      if(laueClassG1 == laueClassG2 && laueClassG1 != 1)
-      {
-        emitLaueClassWarning = true;
-      }
-      if(crystalStructures[laueClassG1] == crystalStructures[laueClassG2] && featurePhases[gName1] > 0)
-      {
-        mPrime_1 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getmPrime(q1, q2, LD));
-        mPrime_2 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getmPrime(q2, q1, LD));
-        F1_1 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getF1(q1, q2, LD, true));
-        F1_2 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getF1(q2, q1, LD, true));
-        F1spt_1 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getF1spt(q1, q2, LD, true));
-        F1spt_2 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getF1spt(q2, q1, LD, true));
-        F7_1 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getF7(q1, q2, LD, true));
-        F7_2 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[gName1]]]->getF7(q2, q1, LD, true));
-      }
-      else
-      {
-        mPrime_1 = 0.0f;
-        F1_1 = 0.0f;
-        F1spt_1 = 0.0f;
-        F7_1 = 0.0f;
-        mPrime_2 = 0.0f;
-        F1_2 = 0.0f;
-        F1spt_2 = 0.0f;
-        F7_2 = 0.0f;
-      }
-    }
-    else
-    {
-      mPrime_1 = 0.0f;
-      F1_1 = 0.0f;
-      F1spt_1 = 0.0f;
-      F7_1 = 0.0f;
-      mPrime_2 = 0.0f;
-      F1_2 = 0.0f;
-      F1spt_2 = 0.0f;
-      F7_2 = 0.0f;
-    }
+  std::array<float64, 3> loading = {m_InputValues->Loading[0], m_InputValues->Loading[1], m_InputValues->Loading[2]};
+  MatrixMath::Normalize3x1(loading.data());
+  std::atomic_bool emitLaueClassWarning = false;
 
-    mPrimes[2 * i] = mPrime_1;
-    mPrimes[2 * i + 1] = mPrime_2;
-    f1s[2 * i] = F1_1;
-    f1s[2 * i + 1] = F1_2;
-    f1sPts[2 * i] = F1spt_1;
-    f1sPts[2 * i + 1] = F1spt_2;
-    f7s[2 * i] = F7_1;
-    f7s[2 * i + 1] = F7_2;
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTriangles);
+  dataAlg.requireArraysInMemory({&surfaceMeshFaceLabels, &mPrimes, &f1s, &f1sPts, &f7s});
+  dataAlg.execute(ComputeBoundaryStrengthsImpl(orientationOps, surfaceMeshFaceLabels.getDataStoreRef(), avgQuats.getDataStoreRef(), featurePhases.getDataStoreRef(),
+                                               crystalStructures.getDataStoreRef(), mPrimes.getDataStoreRef(), f1s.getDataStoreRef(), f1sPts.getDataStoreRef(), f7s.getDataStoreRef(), loading,
+                                               emitLaueClassWarning));
 
   if(emitLaueClassWarning)
   {
@@ -3,6 +3,7 @@
 #include "OrientationAnalysis/utilities/OrientationUtilities.hpp"
 
 #include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/Core/Quaternion.hpp"
@@ -11,6 +12,68 @@
 using namespace nx::core;
 using namespace nx::core::OrientationUtilities;
 
+namespace
+{
+/**
+ * @brief The ComputeCAxisLocationsImpl class computes the sample reference frame c-axis of a range of cells.
+ */
+class ComputeCAxisLocationsImpl
+{
+public:
+  ComputeCAxisLocationsImpl(const Float32AbstractDataStore& quaternions, const Int32AbstractDataStore& cellPhases, const UInt32AbstractDataStore& crystalStructures,
+                            Float32AbstractDataStore& cAxisLocation)
+  : m_Quaternions(quaternions)
+  , m_CellPhases(cellPhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_CAxisLocation(cAxisLocation)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const Eigen::Vector3f cAxis{0.0f, 0.0f, 1.0f};
+    Eigen::Vector3f c1{0.0f, 0.0f, 0.0f};
+
+    usize index = 0;
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      index = 3 * i;
+      const auto crystalStructureType = m_CrystalStructures[m_CellPhases[i]];
+      if(crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_High || crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_Low)
+      {
+        const usize quatIndex = i * 4;
+        OrientationF oMatrix =
+            OrientationTransformation::qu2om<QuatF, OrientationF>({m_Quaternions[quatIndex], m_Quaternions[quatIndex + 1], m_Quaternions[quatIndex + 2], m_Quaternions[quatIndex + 3]});
+        // transpose the g matrices so when c-axis is multiplied by it
+        // it will give the sample direction that the c-axis is along
+        c1 = OrientationMatrixToGMatrixTranspose(oMatrix) * cAxis;
+        // normalize so that the magnitude is 1
+        c1.normalize();
+        if(c1[2] < 0)
+        {
+          c1 *= -1.0f;
+        }
+        m_CAxisLocation[index] = c1[0];
+        m_CAxisLocation[index + 1] = c1[1];
+        m_CAxisLocation[index + 2] = c1[2];
+      }
+      else
+      {
+        m_CAxisLocation[index] = NAN;
+        m_CAxisLocation[index + 1] = NAN;
+        m_CAxisLocation[index + 2] = NAN;
+      }
+    }
+  }
+
+private:
+  const Float32AbstractDataStore& m_Quaternions;
+  const Int32AbstractDataStore& m_CellPhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  Float32AbstractDataStore& m_CAxisLocation;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeCAxisLocations::ComputeCAxisLocations(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                              ComputeCAxisLocationsInputValues* inputValues)
@@ -56,45 +119,14 @@ Result<> ComputeCAxisLocations::operator()()
                                         "skipped and a NaN value inserted."});
   }
 
-  std::vector<LaueOps::Pointer> m_OrientationOps = LaueOps::GetAllOrientationOps();
-
   const auto& quaternions = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->QuatsArrayPath);
   const auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellPhasesArrayPath);
   auto& cAxisLocation = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CAxisLocationsArrayName);
 
-  const usize totalPoints = quaternions.getNumberOfTuples();
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, quaternions.getNumberOfTuples());
+  dataAlg.requireArraysInMemory({&quaternions, &cellPhases, &cAxisLocation});
+  dataAlg.execute(ComputeCAxisLocationsImpl(quaternions.getDataStoreRef(), cellPhases.getDataStoreRef(), crystalStructures.getDataStoreRef(), cAxisLocation.getDataStoreRef()));
 
-  const Eigen::Vector3f cAxis{0.0f, 0.0f, 1.0f};
-  Eigen::Vector3f c1{0.0f, 0.0f, 0.0f};
-
-  usize index = 0;
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    index = 3 * i;
-    const auto crystalStructureType = crystalStructures[cellPhases[i]];
-    if(crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_High || crystalStructureType == EbsdLib::CrystalStructure::Hexagonal_Low)
-    {
-      const usize quatIndex = i * 4;
-      OrientationF oMatrix = OrientationTransformation::qu2om<QuatF, OrientationF>({quaternions[quatIndex], quaternions[quatIndex + 1], quaternions[quatIndex + 2], quaternions[quatIndex + 3]});
-      // transpose the g matrices so when c-axis is multiplied by it
-      // it will give the sample direction that the c-axis is along
-      c1 = OrientationMatrixToGMatrixTranspose(oMatrix) * cAxis;
-      // normalize so that the magnitude is 1
-      c1.normalize();
-      if(c1[2] < 0)
-      {
-        c1 *= -1.0f;
-      }
-      cAxisLocation[index] = c1[0];
-      cAxisLocation[index + 1] = c1[1];
-      cAxisLocation[index + 2] = c1[2];
-    }
-    else
-    {
-      cAxisLocation[index] = NAN;
-      cAxisLocation[index + 1] = NAN;
-      cAxisLocation[index + 2] = NAN;
-    }
-  }
   return result;
 }
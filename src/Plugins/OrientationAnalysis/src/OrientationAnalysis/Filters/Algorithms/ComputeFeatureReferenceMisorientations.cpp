@@ -4,11 +4,139 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelFeatureReduction.hpp"
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
 using namespace nx::core;
 
+namespace
+{
+struct FeatureCenterAccumulator
+{
+  float32 distance = 0.0f;
+  size_t center = 0;
+  bool found = false;
+};
+
+/**
+ * @brief Finds the cell of every feature that is furthest from the grain boundary. Ties go to the cell with the
+ * largest index.
+ */
+class FeatureCenterReducer
+{
+public:
+  using AccumulatorType = FeatureCenterAccumulator;
+
+  explicit FeatureCenterReducer(const Float32AbstractDataStore& gbEuclideanDistances)
+  : m_GBEuclideanDistances(gbEuclideanDistances)
+  {
+  }
+
+  void accumulate(AccumulatorType& accumulator, size_t cellIndex, [[maybe_unused]] size_t featureId) const
+  {
+    float32 dist = m_GBEuclideanDistances.getValue(cellIndex);
+    if(dist >= accumulator.distance)
+    {
+      accumulator.distance = dist;
+      accumulator.center = cellIndex;
+      accumulator.found = true;
+    }
+  }
+
+  void merge(AccumulatorType& total, const AccumulatorType& partial, [[maybe_unused]] size_t featureId) const
+  {
+    if(partial.found && partial.distance >= total.distance)
+    {
+      total = partial;
+    }
+  }
+
+private:
+  const Float32AbstractDataStore& m_GBEuclideanDistances;
+};
+
+struct ReferenceMisorientationAccumulator
+{
+  float64 sum = 0.0;
+  size_t count = 0;
+};
+
+/**
+ * @brief Computes the misorientation of every cell with the reference orientation of its feature and sums
+ * the misorientations per feature.
+ */
+class ReferenceMisorientationReducer
+{
+public:
+  using AccumulatorType = ReferenceMisorientationAccumulator;
+
+  ReferenceMisorientationReducer(const std::vector<LaueOps::Pointer>& orientationOps, uint64 referenceOrientation, const std::vector<size_t>& centers, const Int32AbstractDataStore& cellPhases,
+                                 const Float32AbstractDataStore& quats, const Float32AbstractDataStore& avgQuats, const UInt32AbstractDataStore& crystalStructures,
+                                 Float32AbstractDataStore& featureReferenceMisorientations)
+  : m_OrientationOps(orientationOps)
+  , m_ReferenceOrientation(referenceOrientation)
+  , m_Centers(centers)
+  , m_CellPhases(cellPhases)
+  , m_Quats(quats)
+  , m_AvgQuats(avgQuats)
+  , m_CrystalStructures(crystalStructures)
+  , m_FeatureReferenceMisorientations(featureReferenceMisorientations)
+  {
+  }
+
+  void accumulate(AccumulatorType& accumulator, size_t point, size_t gnum) const
+  {
+    const int32 cellPhase = m_CellPhases.getValue(point);
+    if(gnum == 0 || cellPhase == 0)
+    {
+      m_FeatureReferenceMisorientations.setValue(point, 0.0f);
+      return;
+    }
+    if(cellPhase < 0)
+    {
+      return;
+    }
+
+    QuatF q1(m_Quats[point * 4 + 0], m_Quats[point * 4 + 1], m_Quats[point * 4 + 2], m_Quats[point * 4 + 3]);
+    QuatF q2;
+    uint32 phase1 = m_CrystalStructures[cellPhase];
+    if(m_ReferenceOrientation == 0)
+    {
+      q2 = QuatF(m_AvgQuats[gnum * 4 + 0], m_AvgQuats[gnum * 4 + 1], m_AvgQuats[gnum * 4 + 2], m_AvgQuats[gnum * 4 + 3]);
+    }
+    else if(m_ReferenceOrientation == 1)
+    {
+      size_t centerGNum = m_Centers[gnum];
+      q2 = QuatF(m_AvgQuats[centerGNum * 4 + 0], m_AvgQuats[centerGNum * 4 + 1], m_AvgQuats[centerGNum * 4 + 2], m_AvgQuats[centerGNum * 4 + 3]);
+    }
+
+    OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+
+    const auto misorientation = static_cast<float>((180.0 / nx::core::numbers::pi) * axisAngle[3]); // convert to degrees
+    m_FeatureReferenceMisorientations.setValue(point, misorientation);
+    accumulator.sum += misorientation;
+    accumulator.count++;
+  }
+
+  void merge(AccumulatorType& total, const AccumulatorType& partial, [[maybe_unused]] size_t featureId) const
+  {
+    total.sum += partial.sum;
+    total.count += partial.count;
+  }
+
+private:
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  uint64 m_ReferenceOrientation = 0;
+  const std::vector<size_t>& m_Centers;
+  const Int32AbstractDataStore& m_CellPhases;
+  const Float32AbstractDataStore& m_Quats;
+  const Float32AbstractDataStore& m_AvgQuats;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  Float32AbstractDataStore& m_FeatureReferenceMisorientations;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeFeatureReferenceMisorientations::ComputeFeatureReferenceMisorientations(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                                                ComputeFeatureReferenceMisorientationsInputValues* inputValues)
@@ -56,62 +184,35 @@ Result<> ComputeFeatureReferenceMisorientations::operator()()
   size_t totalPoints = featureIds.getNumberOfTuples();
   size_t totalFeatures = avgQuats.getNumberOfTuples();
 
+  const auto& featureIdsStore = featureIds.getDataStoreRef();
+
   std::vector<size_t> m_Centers(totalFeatures, 0);
-  std::vector<float> m_CenterDists(totalFeatures, 0.0f);
   if(m_InputValues->ReferenceOrientation == 1)
   {
-    const auto& m_GBEuclideanDistances = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->GBEuclideanDistancesArrayPath);
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      int32_t gnum = featureIds[i];
-      float32 dist = m_GBEuclideanDistances[i];
-      if(dist >= m_CenterDists[gnum])
-      {
-        m_CenterDists[gnum] = dist;
-        m_Centers[gnum] = i;
-      }
-    }
-  }
-
-  std::vector<float> avgMiso(totalFeatures * 2, 0.0F);
+    const auto& m_GBEuclideanDistances = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->GBEuclideanDistancesArrayPath).getDataStoreRef();
 
-  for(int64_t point = 0; point < totalPoints; point++)
-  {
-    if(featureIds[point] > 0 && cellPhases[point] > 0)
+    ParallelFeatureReduction centerReduction;
+    centerReduction.setRange(0, totalPoints);
+    centerReduction.requireStoresInMemory({&featureIdsStore, &m_GBEuclideanDistances});
+    std::vector<FeatureCenterAccumulator> centers = centerReduction.execute(featureIdsStore, totalFeatures, FeatureCenterReducer(m_GBEuclideanDistances));
+    for(size_t i = 0; i < totalFeatures; i++)
     {
-      QuatF q1(quats[point * 4 + 0], quats[point * 4 + 1], quats[point * 4 + 2], quats[point * 4 + 3]);
-      QuatF q2;
-      uint32 phase1 = crystalStructures[cellPhases[point]];
-      if(m_InputValues->ReferenceOrientation == 0)
-      {
-        auto gnum = static_cast<size_t>(featureIds[point]);
-        q2 = QuatF(avgQuats[gnum * 4 + 0], avgQuats[gnum * 4 + 1], avgQuats[gnum * 4 + 2], avgQuats[gnum * 4 + 3]);
-      }
-      else if(m_InputValues->ReferenceOrientation == 1)
-      {
-        auto gnum = static_cast<size_t>(featureIds[point]);
-        size_t centerGNum = m_Centers[gnum];
-        q2 = QuatF(avgQuats[centerGNum * 4 + 0], avgQuats[centerGNum * 4 + 1], avgQuats[centerGNum * 4 + 2], avgQuats[centerGNum * 4 + 3]);
-      }
-
-      OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-
-      featureReferenceMisorientations[point] = static_cast<float>((180.0 / nx::core::numbers::pi) * axisAngle[3]); // convert to degrees
-      int32_t idx = featureIds[point] * 2;
-      avgMiso[idx + 0]++;
-      avgMiso[idx + 1] = avgMiso[idx + 1] + featureReferenceMisorientations[point];
-    }
-    if(featureIds[point] == 0 || cellPhases[point] == 0)
-    {
-      featureReferenceMisorientations[point] = 0.0f;
+      m_Centers[i] = centers[i].center;
     }
   }
 
+  ParallelFeatureReduction featureReduction;
+  featureReduction.setRange(0, totalPoints);
+  featureReduction.requireStoresInMemory({&featureIdsStore, cellPhases.getDataStore(), quats.getDataStore(), featureReferenceMisorientations.getDataStore()});
+  std::vector<ReferenceMisorientationAccumulator> avgMiso = featureReduction.execute(
+      featureIdsStore, totalFeatures,
+      ReferenceMisorientationReducer(m_OrientationOps, m_InputValues->ReferenceOrientation, m_Centers, cellPhases.getDataStoreRef(), quats.getDataStoreRef(), avgQuats.getDataStoreRef(),
+                                     crystalStructures.getDataStoreRef(), featureReferenceMisorientations.getDataStoreRef()));
+
   for(size_t i = 1; i < totalFeatures; i++)
   {
-    auto idx = static_cast<int32>(i * 2);
-    avgReferenceMisorientation[i] = avgMiso[idx + 1] / avgMiso[idx];
-    if(avgMiso[idx] == 0.0f)
+    avgReferenceMisorientation[i] = static_cast<float>(avgMiso[i].sum / static_cast<double>(avgMiso[i].count));
+    if(avgMiso[i].count == 0)
     {
       avgReferenceMisorientation[i] = 0.0f;
     }
@@ -11,6 +11,7 @@
 #include "EbsdLib/Core/OrientationTransformation.hpp"
 #include "EbsdLib/LaueOps/LaueOps.h"
 
+#include <algorithm>
 #include <cmath>
 
 using LaueOpsShPtrType = std::shared_ptr<LaueOps>;
@@ -19,38 +20,68 @@ using LaueOpsContainerType = std::vector<LaueOpsShPtrType>;
 using namespace nx::core;
 namespace
 {
-const usize k_NumMisoReps = 576 * 4;
-}
+// Number of triangles that are binned into one partial GBCD histogram
+constexpr usize k_TrianglesPerBlock = 2048;
+// Number of blocks that are binned in parallel before they are merged into the GBCD
+constexpr usize k_BlocksPerBatch = 64;
+
+/**
+ * @brief The GBCD bin and face area of one symmetrically equivalent boundary
+ */
+struct GBCDBinArea
+{
+  usize GbcdIndex = 0;
+  float64 Area = 0.0;
+};
+
 /**
- * @brief The CalculateGBCDImpl class implements a threaded algorithm that calculates the
- * grain boundary character distribution (GBCD) for a surface mesh
+ * @brief The partial GBCD histogram of one block of triangles. The bins are sorted by their GBCD index and bins
+ * with the same index keep the order of the triangles.
+ */
+struct GBCDBlockResult
+{
+  std::vector<GBCDBinArea> BinAreas;
+  std::vector<float64> PhaseAreas;
+};
+} // namespace
+
+/**
+ * @brief The CalculateGBCDImpl class implements a threaded algorithm that calculates the partial
+ * grain boundary character distribution (GBCD) histograms of a range of triangle blocks
  */
 class CalculateGBCDImpl
 {
-  usize m_TriangleChunkStartIndex;
-  usize m_NumBinPerTriangle;
-  Int32Array& m_LabelsArray;
-  Float64Array& m_NormalsArray;
-  Int32Array& m_PhasesArray;
-  Float32Array& m_EulersArray;
-  UInt32Array& m_CrystalStructuresArray;
-
-  SizeGBCD& m_SizeGBCD;
+  usize m_FirstTriangleIndex;
+  usize m_NumTriangles;
+  usize m_TotalGBCDBins;
+  const Int32Array& m_LabelsArray;
+  const Float64Array& m_NormalsArray;
+  const Float64Array& m_AreasArray;
+  const Int32Array& m_PhasesArray;
+  const Float32Array& m_EulersArray;
+  const UInt32Array& m_CrystalStructuresArray;
+
+  const SizeGBCD& m_SizeGBCD;
+  std::vector<GBCDBlockResult>& m_BlockResults;
   LaueOpsContainerType m_OrientationOps;
 
 public:
   CalculateGBCDImpl() = delete;
   CalculateGBCDImpl(const CalculateGBCDImpl&) = default;
 
-  CalculateGBCDImpl(usize i, usize numMisoReps, Int32Array& labels, Float64Array& normals, Float32Array& eulers, Int32Array& phases, UInt32Array& crystalStructures, SizeGBCD& sizeGBCD)
-  : m_TriangleChunkStartIndex(i)
-  , m_NumBinPerTriangle(numMisoReps)
+  CalculateGBCDImpl(usize firstTriangleIndex, usize numTriangles, usize totalGBCDBins, const Int32Array& labels, const Float64Array& normals, const Float64Array& areas, const Float32Array& eulers,
+                    const Int32Array& phases, const UInt32Array& crystalStructures, const SizeGBCD& sizeGBCD, std::vector<GBCDBlockResult>& blockResults)
+  : m_FirstTriangleIndex(firstTriangleIndex)
+  , m_NumTriangles(numTriangles)
+  , m_TotalGBCDBins(totalGBCDBins)
   , m_LabelsArray(labels)
   , m_NormalsArray(normals)
+  , m_AreasArray(areas)
   , m_PhasesArray(phases)
   , m_EulersArray(eulers)
   , m_CrystalStructuresArray(crystalStructures)
   , m_SizeGBCD(sizeGBCD)
+  , m_BlockResults(blockResults)
   {
     m_OrientationOps = LaueOps::GetAllOrientationOps();
   }
@@ -60,16 +91,20 @@ public:
   CalculateGBCDImpl& operator=(CalculateGBCDImpl&&) = delete;      // Move Assignment Not Implemented
   virtual ~CalculateGBCDImpl() = default;
 
-  void generate(usize start, usize end) const
+  void generate(usize block) const
   {
-    std::vector<int32>& gbcdBins = m_SizeGBCD.m_GbcdBins;
-    std::vector<bool>& hemiCheck = m_SizeGBCD.m_GbcdHemiCheck; // Definitely do NOT want a raw pointer to vector<bool> because that done in bits, not bytes.
+    GBCDBlockResult& blockResult = m_BlockResults[block];
+    blockResult.BinAreas.clear();
+    blockResult.PhaseAreas.assign(m_CrystalStructuresArray.getNumberOfTuples(), 0.0);
+
+    const usize start = m_FirstTriangleIndex + block * k_TrianglesPerBlock;
+    const usize end = std::min(start + k_TrianglesPerBlock, m_FirstTriangleIndex + m_NumTriangles);
 
-    Int32Array& labels = m_LabelsArray;
-    Float64Array& normals = m_NormalsArray;
-    Int32Array& phases = m_PhasesArray;
-    Float32Array& eulers = m_EulersArray;
-    UInt32Array& crystalStructures = m_CrystalStructuresArray;
+    const Int32Array& labels = m_LabelsArray;
+    const Float64Array& normals = m_NormalsArray;
+    const Int32Array& phases = m_PhasesArray;
+    const Float32Array& eulers = m_EulersArray;
+    const UInt32Array& crystalStructures = m_CrystalStructuresArray;
 
     int32 feature1 = 0, feature2 = 0;
     int32 inversion = 1;
@@ -85,9 +120,6 @@ public:
 
     for(usize triangleIndex = start; triangleIndex < end; triangleIndex++)
     {
-      usize minGbcdBinIndex = (triangleIndex - m_TriangleChunkStartIndex) * m_NumBinPerTriangle;
-
-      int32 symCounter = 0;
       feature1 = labels[2 * triangleIndex];
       feature2 = labels[2 * triangleIndex + 1];
 
@@ -101,6 +133,10 @@ public:
       normal[1] = normals[3 * triangleIndex + 1];
       normal[2] = normals[3 * triangleIndex + 2];
 
+      const int32 phase = phases[feature1];
+      const float64 area = m_AreasArray[triangleIndex];
+      const usize phaseShift = static_cast<usize>(phase) * m_TotalGBCDBins;
+
       if(phases[feature1] == phases[feature2] && phases[feature1] > 0)
       {
         uint32 cryst = crystalStructures[phases[feature1]];
@@ -167,37 +203,40 @@ public:
                 int32 gbcd_index = GBCDIndex(m_SizeGBCD.m_GbcdDeltas, m_SizeGBCD.m_GbcdSizes, m_SizeGBCD.m_GbcdLimits, eulerMis, sqCoord);
                 if(gbcd_index != -1)
                 {
-                  const usize k_GbcdBinIndex = minGbcdBinIndex + symCounter;
-                  hemiCheck[k_GbcdBinIndex] = nhCheck;
-                  gbcdBins[k_GbcdBinIndex] = gbcd_index;
+                  addBin(blockResult, phase, phaseShift, gbcd_index, nhCheck, area);
                 }
-                symCounter++;
                 if(inversion == 1)
                 {
                   gbcd_index = GBCDIndex(m_SizeGBCD.m_GbcdDeltas, m_SizeGBCD.m_GbcdSizes, m_SizeGBCD.m_GbcdLimits, eulerMis, sqCoordInv);
                   if(gbcd_index != -1)
                   {
-                    const usize k_GbcdBinIndex = minGbcdBinIndex + symCounter;
-                    hemiCheck[k_GbcdBinIndex] = nhCheckInv;
-                    gbcdBins[k_GbcdBinIndex] = gbcd_index;
+                    addBin(blockResult, phase, phaseShift, gbcd_index, nhCheckInv, area);
                   }
-                  symCounter++;
                 }
               }
-              else
-              {
-                symCounter += 2;
-              }
             }
           }
         }
       }
     }
+
+    // Equal bins keep the triangle order so the merged sums match the serial summation order
+    std::stable_sort(blockResult.BinAreas.begin(), blockResult.BinAreas.end(), [](const GBCDBinArea& lhs, const GBCDBinArea& rhs) { return lhs.GbcdIndex < rhs.GbcdIndex; });
   }
 
   void operator()(const Range& range) const
   {
-    generate(range.min(), range.max());
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      generate(block);
+    }
+  }
+
+  static void addBin(GBCDBlockResult& blockResult, int32 phase, usize phaseShift, int32 gbcdIndex, bool northernHemisphere, float64 area)
+  {
+    const usize hemisphere = northernHemisphere ? 0 : 1;
+    blockResult.BinAreas.push_back({phaseShift + 2 * static_cast<usize>(gbcdIndex) + hemisphere, area});
+    blockResult.PhaseAreas[phase] += area;
   }
 
   int32 GBCDIndex(const std::vector<float32>& gbcdDelta, const std::vector<int32>& gbcdSz, const std::vector<float32>& gbcdLimits, const float32* eulerN, const float32* sqCoord) const
@@ -211,7 +250,7 @@ public:
     std::array<float32, k_GBCDParamCount> misEulerNorm = {eulerN[0], eulerN[1], eulerN[2], sqCoord[0], sqCoord[1]};
 
     // Check for a valid point in the GBCD space
-    for(int32 i = 0; i < k_GBCDParamCount; i++)
+    for(usize i = 0; i < k_GBCDParamCount; i++)
     {
       if(misEulerNorm[i] < gbcdLimits[i])
       {
@@ -282,16 +321,11 @@ public:
   }
 };
 
-SizeGBCD::SizeGBCD(usize faceChunkSize, usize numMisoReps, float32 gbcdRes)
-: m_FaceChunkSize(faceChunkSize)
-, m_NumMisoReps(numMisoReps)
-, m_GbcdDeltas(std::vector<float32>(5, 0))
+SizeGBCD::SizeGBCD(float32 gbcdRes)
+: m_GbcdDeltas(std::vector<float32>(5, 0))
 , m_GbcdLimits(std::vector<float32>(10, 0))
 , m_GbcdSizes(std::vector<int32>(5, 0))
-, m_GbcdHemiCheck(std::vector<bool>(faceChunkSize * numMisoReps, false))
 {
-  initializeBinsWithValue(0);
-
   // Original Ranges from Dave R.
   // m_GBCDlimits[0] = 0.0f;
   // m_GBCDlimits[1] = cosf(1.0f*m_pi);
@@ -342,10 +376,38 @@ SizeGBCD::SizeGBCD(usize faceChunkSize, usize numMisoReps, float32 gbcdRes)
   m_GbcdDeltas[4] = (m_GbcdLimits[9] - m_GbcdLimits[4]) / float32(m_GbcdSizes[4]);
 }
 
-void SizeGBCD::initializeBinsWithValue(int32 value)
+/**
+ * @brief The MergeGBCDBlocksImpl class adds the partial histograms of a batch of triangle blocks to a range of
+ * GBCD bins. Every bin is summed in block order so the result does not depend on the thread scheduling.
+ */
+class MergeGBCDBlocksImpl
 {
-  m_GbcdBins = std::vector<int32>(m_FaceChunkSize * m_NumMisoReps, value);
-}
+public:
+  MergeGBCDBlocksImpl(const std::vector<GBCDBlockResult>& blockResults, usize numBlocks, Float64AbstractDataStore& gbcd)
+  : m_BlockResults(blockResults)
+  , m_NumBlocks(numBlocks)
+  , m_Gbcd(gbcd)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize block = 0; block < m_NumBlocks; block++)
+    {
+      const std::vector<GBCDBinArea>& binAreas = m_BlockResults[block].BinAreas;
+      auto iter = std::lower_bound(binAreas.begin(), binAreas.end(), range.min(), [](const GBCDBinArea& binArea, usize gbcdIndex) { return binArea.GbcdIndex < gbcdIndex; });
+      for(; iter != binAreas.end() && iter->GbcdIndex < range.max(); ++iter)
+      {
+        m_Gbcd.setValue(iter->GbcdIndex, m_Gbcd.getValue(iter->GbcdIndex) + iter->Area);
+      }
+    }
+  }
+
+private:
+  const std::vector<GBCDBlockResult>& m_BlockResults;
+  usize m_NumBlocks = 0;
+  Float64AbstractDataStore& m_Gbcd;
+};
 
 // -----------------------------------------------------------------------------
 ComputeGBCD::ComputeGBCD(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ComputeGBCDInputValues* inputValues)
@@ -379,14 +441,9 @@ Result<> ComputeGBCD::operator()()
 
   usize totalPhases = crystalStructures.getNumberOfTuples();
   usize totalFaces = faceLabels.getNumberOfTuples();
-  usize triangleChunkSize = 50000;
 
-  if(totalFaces < triangleChunkSize)
-  {
-    triangleChunkSize = totalFaces;
-  }
-  // call the sizeGBCD function with proper chunkSize and numMisoReps to get Bins array set up properly
-  SizeGBCD sizeGbcd(triangleChunkSize, k_NumMisoReps, m_InputValues->GBCDRes);
+  // call the sizeGBCD function to get the GBCD ranges and dimensions
+  SizeGBCD sizeGbcd(m_InputValues->GBCDRes);
   int32 totalGBCDBins = sizeGbcd.m_GbcdSizes[0] * sizeGbcd.m_GbcdSizes[1] * sizeGbcd.m_GbcdSizes[2] * sizeGbcd.m_GbcdSizes[3] * sizeGbcd.m_GbcdSizes[4] * 2;
 
   // create an array to hold the total face area for each phase and initialize the array to 0.0
@@ -395,64 +452,48 @@ Result<> ComputeGBCD::operator()()
   m_MessageHandler({IFilter::Message::Type::Info, ss});
   auto startMillis = std::chrono::steady_clock::now();
 
-  for(usize i = 0; i < totalFaces; i = i + triangleChunkSize)
+  // Every block of triangles is binned into its own sparse partial histogram. The partial histograms of a batch
+  // are then merged into the GBCD in parallel over the GBCD bins, always in block order.
+  const usize trianglesPerBatch = k_TrianglesPerBlock * k_BlocksPerBatch;
+  std::vector<GBCDBlockResult> blockResults(k_BlocksPerBatch);
+  for(usize i = 0; i < totalFaces; i = i + trianglesPerBatch)
   {
     if(getCancel())
     {
       return {};
     }
 
-    if(i + triangleChunkSize >= totalFaces)
-    {
-      triangleChunkSize = totalFaces - i;
-    }
-    sizeGbcd.initializeBinsWithValue(-1);
-    sizeGbcd.m_GbcdHemiCheck.assign(sizeGbcd.m_GbcdHemiCheck.size(), false);
+    const usize numTriangles = std::min(trianglesPerBatch, totalFaces - i);
+    const usize numBlocks = (numTriangles + k_TrianglesPerBlock - 1) / k_TrianglesPerBlock;
 
-    ParallelDataAlgorithm parallelTask;
-    parallelTask.setRange(i, i + triangleChunkSize);
-    parallelTask.execute(CalculateGBCDImpl(i, k_NumMisoReps, faceLabels, faceNormals, eulerAngles, phases, crystalStructures, sizeGbcd));
+    ParallelDataAlgorithm binAlg;
+    binAlg.setRange(0, numBlocks);
+    binAlg.requireArraysInMemory({&faceLabels, &faceNormals, &faceAreas});
+    binAlg.execute(CalculateGBCDImpl(i, numTriangles, totalGBCDBins, faceLabels, faceNormals, faceAreas, eulerAngles, phases, crystalStructures, sizeGbcd, blockResults));
 
     if(getCancel())
     {
       return {};
     }
 
-    int32 phase = 0;
-    int32 feature = 0;
-    double area = 0.0;
-    for(usize j = 0; j < triangleChunkSize; j++)
+    ParallelDataAlgorithm mergeAlg;
+    mergeAlg.setRange(0, gbcd.getSize());
+    mergeAlg.requireArraysInMemory({&gbcd});
+    mergeAlg.execute(MergeGBCDBlocksImpl(blockResults, numBlocks, gbcd.getDataStoreRef()));
+
+    for(usize block = 0; block < numBlocks; block++)
     {
-      area = faceAreas[i + j];
-      feature = faceLabels[2 * (i + j)];
-      if(feature < 0)
+      for(usize phase = 0; phase < totalPhases; phase++)
       {
-        continue;
-      }
-      phase = phases[feature];
-      for(usize k = 0; k < k_NumMisoReps; k++)
-      {
-        usize gbcdBinIdx = (j * k_NumMisoReps) + k;
-
-        if(sizeGbcd.m_GbcdBins[gbcdBinIdx] >= 0)
-        {
-          int32 hemisphere = 0;
-          if(!sizeGbcd.m_GbcdHemiCheck[gbcdBinIdx])
-          {
-            hemisphere = 1;
-          }
-          usize gbcdIdx = (phase * totalGBCDBins) + (2 * sizeGbcd.m_GbcdBins[gbcdBinIdx] + hemisphere);
-          gbcd[gbcdIdx] += area;
-          totalFaceArea[phase] += area;
-        }
+        totalFaceArea[phase] += blockResults[block].PhaseAreas[phase];
       }
     }
 
     auto currentMillis = std::chrono::steady_clock::now();
     if(std::chrono::duration_cast<std::chrono::milliseconds>(currentMillis - startMillis).count() > 1000)
     {
-      const usize k_LastTriangleIndex = i + triangleChunkSize;
-      float32 currentRate = static_cast<float32>(triangleChunkSize) / static_cast<float32>(std::chrono::duration_cast<std::chrono::milliseconds>(currentMillis - startMillis).count());
+      const usize k_LastTriangleIndex = i + numTriangles;
+      float32 currentRate = static_cast<float32>(numTriangles) / static_cast<float32>(std::chrono::duration_cast<std::chrono::milliseconds>(currentMillis - startMillis).count());
       uint64 estimatedTime = static_cast<uint64>(totalFaces - k_LastTriangleIndex) / currentRate;
       ss = fmt::format("Calculating GBCD || Triangles {}/{} Completed || Est. Time Remain: {}", k_LastTriangleIndex, totalFaces, ConvertMillisToHrsMinSecs(estimatedTime));
       startMillis = std::chrono::steady_clock::now();
@@ -462,9 +503,9 @@ Result<> ComputeGBCD::operator()()
 
   m_MessageHandler({IFilter::Message::Type::Info, "2/2 Starting GBCD Normalization Phase"});
 
-  for(int32 i = 0; i < totalPhases; i++)
+  for(usize i = 0; i < totalPhases; i++)
   {
-    const usize k_PhaseShift = i * totalGBCDBins;
+    const usize k_PhaseShift = i * static_cast<usize>(totalGBCDBins);
     const double k_MrdFactor = static_cast<double>(totalGBCDBins) / totalFaceArea[i];
     for(int32 j = 0; j < totalGBCDBins; j++)
     {
@@ -11,18 +11,11 @@ namespace nx::core
 
 struct SizeGBCD
 {
-  SizeGBCD(usize faceChunkSize, usize numMisoReps, float32 gbcdRes);
-
-  void initializeBinsWithValue(int32 value);
+  explicit SizeGBCD(float32 gbcdRes);
 
   std::vector<float32> m_GbcdDeltas;
   std::vector<float32> m_GbcdLimits;
   std::vector<int32> m_GbcdSizes;
-  std::vector<int32> m_GbcdBins;
-  std::vector<bool> m_GbcdHemiCheck;
-
-  usize m_FaceChunkSize;
-  usize m_NumMisoReps;
 };
 
 struct ORIENTATIONANALYSIS_EXPORT ComputeGBCDInputValues
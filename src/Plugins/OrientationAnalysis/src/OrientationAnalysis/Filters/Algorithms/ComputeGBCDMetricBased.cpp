@@ -13,9 +13,7 @@
 
 #include <Eigen/Dense>
 
-#ifdef SIMPLNX_ENABLE_MULTICORE
-#include <tbb/concurrent_vector.h>
-#endif
+#include <algorithm>
 
 using namespace nx::core;
 using namespace nx::core::OrientationUtilities;
@@ -26,7 +24,10 @@ using LaueOpsContainerType = std::vector<LaueOpsShPtrType>;
 namespace
 {
 constexpr float64 k_BallVolumesM3M[ComputeGBCDMetricBased::k_NumberResolutionChoices] = {0.0000641361, 0.000139158, 0.000287439, 0.00038019, 0.000484151, 0.000747069, 0.00145491};
-}
+
+// Number of triangles whose selected boundaries are collected into one list
+constexpr usize k_TrianglesPerBlock = 4096;
+} // namespace
 
 namespace GBCDMetricBased
 {
@@ -59,23 +60,19 @@ struct TriAreaAndNormals
 
 /**
  * @brief The TrianglesSelector class implements a threaded algorithm that determines which triangles to
- * include in the GBCD calculation
+ * include in the GBCD calculation. Every block of triangles collects its selected boundaries into its own
+ * list so the lists can be joined in triangle order.
  */
 class TrianglesSelector
 {
 public:
-  TrianglesSelector(bool excludeTripleLines, const IGeometry::SharedFaceList& triangles, const Int8Array& nodeTypes,
-#ifdef SIMPLNX_ENABLE_MULTICORE
-                    tbb::concurrent_vector<TriAreaAndNormals>& selectedTriangles,
-#else
-                    std::vector<TriAreaAndNormals>& selectedTriangles,
-#endif
+  TrianglesSelector(bool excludeTripleLines, const IGeometry::SharedFaceList& triangles, const Int8Array& nodeTypes, std::vector<std::vector<TriAreaAndNormals>>& blockTriangles,
                     std::vector<int8>& triIncluded, float64 misResolution, int32 phaseOfInterest, const Matrix3dR& gFixedT, const UInt32Array& crystalStructures, const Float32Array& euler,
                     const Int32Array& phases, const Int32Array& faceLabels, const Float64Array& faceNormals, const Float64Array& faceAreas)
   : m_ExcludeTripleLines(excludeTripleLines)
   , m_Triangles(triangles)
   , m_NodeTypes(nodeTypes)
-  , m_SelectedTriangles(selectedTriangles)
+  , m_BlockTriangles(blockTriangles)
   , m_TriIncluded(triIncluded)
   , m_MisResolution(misResolution)
   , m_PhaseOfInterest(phaseOfInterest)
@@ -86,12 +83,16 @@ public:
   , m_FaceNormals(faceNormals)
   , m_FaceAreas(faceAreas)
   {
-    m_OrientationOps = LaueOps::GetAllOrientationOps();
-    m_Crystal = crystalStructures[phaseOfInterest];
-    m_NSym = m_OrientationOps[m_Crystal]->getNumSymOps();
+    LaueOpsContainerType orientationOps = LaueOps::GetAllOrientationOps();
+    const uint32 crystal = crystalStructures[phaseOfInterest];
+    const int32 nSym = orientationOps[crystal]->getNumSymOps();
+    for(int32 symOp = 0; symOp < nSym; symOp++)
+    {
+      m_SymOps.push_back(EbsdLibMatrixToEigenMatrix(orientationOps[crystal]->getMatSymOpD(symOp)));
+    }
   }
 
-  void select(usize start, usize end) const
+  void select(usize start, usize end, std::vector<TriAreaAndNormals>& selectedTriangles) const
   {
     Eigen::Vector3d g1ea = {0.0, 0.0, 0.0};
     Eigen::Vector3d g2ea = {0.0, 0.0, 0.0};
@@ -110,8 +111,6 @@ public:
     Eigen::Vector3d normalGrain1 = {0.0, 0.0, 0.0};
     Eigen::Vector3d normalGrain2 = {0.0, 0.0, 0.0};
 
-    std::set<usize> uniqueTri;
-
     for(usize triIdx = start; triIdx < end; triIdx++)
     {
       const int32 feature1 = m_FaceLabels[2 * triIdx];
@@ -153,18 +152,20 @@ public:
       auto oMatrix1 = OrientationTransformation::eu2om<OrientationD, OrientationD>(OrientationD(g1ea[0], g1ea[1], g1ea[2]));
       auto oMatrix2 = OrientationTransformation::eu2om<OrientationD, OrientationD>(OrientationD(g2ea[0], g2ea[1], g2ea[2]));
 
-      for(int j = 0; j < m_NSym; j++)
+      const Matrix3dR gMatrix1 = OrientationMatrixToGMatrix(oMatrix1);
+      const Matrix3dR gMatrix2 = OrientationMatrixToGMatrix(oMatrix2);
+      for(const Matrix3dR& symOp1 : m_SymOps)
       {
         // rotate g1 by symOp
-        g1s = EbsdLibMatrixToEigenMatrix(m_OrientationOps[m_Crystal]->getMatSymOpD(j)) * OrientationMatrixToGMatrix(oMatrix1);
+        g1s = symOp1 * gMatrix1;
         // get the crystal directions along the triangle normals
         normalGrain1 = g1s * normalLab;
 
-        for(int k = 0; k < m_NSym; k++)
+        for(const Matrix3dR& symOp2 : m_SymOps)
         {
           // calculate the symmetric mis orientation
           // rotate g2 by symOp
-          g2s = EbsdLibMatrixToEigenMatrix(m_OrientationOps[m_Crystal]->getMatSymOpD(k)) * OrientationMatrixToGMatrix(oMatrix2);
+          g2s = symOp2 * gMatrix2;
           // transpose rotated g2
           // calculate delta g
           dg = g1s * g2s.transpose(); // dg -- the mis orientation between adjacent grains
@@ -190,13 +191,12 @@ public:
 
               if(transpose == 0)
               {
-                m_SelectedTriangles.push_back(TriAreaAndNormals(m_FaceAreas[triIdx], normalGrain1[0], normalGrain1[1], normalGrain1[2], -normalGrain2[0], -normalGrain2[1], -normalGrain2[2]));
+                selectedTriangles.emplace_back(m_FaceAreas[triIdx], normalGrain1[0], normalGrain1[1], normalGrain1[2], -normalGrain2[0], -normalGrain2[1], -normalGrain2[2]);
               }
               else
               {
-                m_SelectedTriangles.push_back(TriAreaAndNormals(m_FaceAreas[triIdx], -normalGrain2[0], -normalGrain2[1], -normalGrain2[2], normalGrain1[0], normalGrain1[1], normalGrain1[2]));
+                selectedTriangles.emplace_back(m_FaceAreas[triIdx], -normalGrain2[0], -normalGrain2[1], -normalGrain2[2], normalGrain1[0], normalGrain1[1], normalGrain1[2]);
               }
-              uniqueTri.insert(triIdx);
             }
           }
         }
@@ -206,7 +206,14 @@ public:
 
   void operator()(const Range& range) const
   {
-    select(range.min(), range.max());
+    const usize numTriangles = m_FaceAreas.getNumberOfTuples();
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      std::vector<TriAreaAndNormals>& selectedTriangles = m_BlockTriangles[block];
+      selectedTriangles.clear();
+      const usize start = block * k_TrianglesPerBlock;
+      select(start, std::min(start + k_TrianglesPerBlock, numTriangles), selectedTriangles);
+    }
   }
 
 private:
@@ -214,19 +221,13 @@ private:
   const IGeometry::SharedFaceList& m_Triangles;
   const Int8Array& m_NodeTypes;
 
-#ifdef SIMPLNX_ENABLE_MULTICORE
-  tbb::concurrent_vector<TriAreaAndNormals>& m_SelectedTriangles;
-#else
-  std::vector<TriAreaAndNormals>& m_SelectedTriangles;
-#endif
+  std::vector<std::vector<TriAreaAndNormals>>& m_BlockTriangles;
   std::vector<int8_t>& m_TriIncluded;
   float64 m_MisResolution;
   int32 m_PhaseOfInterest;
   const Matrix3dR& m_GFixedT;
 
-  LaueOpsContainerType m_OrientationOps;
-  uint32 m_Crystal;
-  int32 m_NSym;
+  std::vector<Matrix3dR> m_SymOps;
 
   const Float32Array& m_Euler;
   const Int32Array& m_Phases;
@@ -243,13 +244,7 @@ class ProbeDistribution
 {
 public:
   ProbeDistribution(std::vector<float64>& distributionValues, std::vector<float64>& errorValues, const std::vector<float64>& samplePtsX, const std::vector<float64>& samplePtsY,
-                    const std::vector<float64>& samplePtsZ,
-#ifdef SIMPLNX_ENABLE_MULTICORE
-                    const tbb::concurrent_vector<TriAreaAndNormals>& selectedTriangles,
-#else
-                    const std::vector<TriAreaAndNormals>& selectedTriangles,
-#endif
-                    float64 planeResolutionSq, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, const Matrix3dR& gFixedT)
+                    const std::vector<float64>& samplePtsZ, const std::vector<TriAreaAndNormals>& selectedTriangles, float64 planeResolutionSq, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, const Matrix3dR& gFixedT)
   : m_DistributionValues(distributionValues)
   , m_ErrorValues(errorValues)
   , m_SamplePtsX(samplePtsX)
@@ -309,14 +304,10 @@ public:
 private:
   std::vector<float64>& m_DistributionValues;
   std::vector<float64>& m_ErrorValues;
-  std::vector<float64> m_SamplePtsX;
-  std::vector<float64> m_SamplePtsY;
-  std::vector<float64> m_SamplePtsZ;
-#ifdef SIMPLNX_ENABLE_MULTICORE
-  const tbb::concurrent_vector<TriAreaAndNormals>& m_SelectedTriangles;
-#else
+  const std::vector<float64>& m_SamplePtsX;
+  const std::vector<float64>& m_SamplePtsY;
+  const std::vector<float64>& m_SamplePtsZ;
   const std::vector<TriAreaAndNormals>& m_SelectedTriangles;
-#endif
   float64 m_PlaneResolutionSq;
   float64 m_TotalFaceArea;
   int32 m_NumDistinctGBs;
@@ -464,38 +455,34 @@ Result<> ComputeGBCDMetricBased::operator()()
   const usize numMeshTriangles = faceAreas.getNumberOfTuples();
 
 // ---------  find triangles (and equivalent crystallographic parameters) with +- the fixed mis orientation ---------
-#ifdef SIMPLNX_ENABLE_MULTICORE
-  tbb::concurrent_vector<GBCDMetricBased::TriAreaAndNormals> selectedTriangles(0);
-#else
-  std::vector<GBCDMetricBased::TriAreaAndNormals> selectedTriangles(0);
-#endif
-
+  m_MessageHandler(IFilter::Message::Type::Info, "Step 1/2: Selecting Triangles with the Specified Misorientation");
   std::vector<int8> triIncluded(numMeshTriangles, 0);
-
-  usize triChunkSize = 50000;
-  if(numMeshTriangles < triChunkSize)
+  std::vector<GBCDMetricBased::TriAreaAndNormals> selectedTriangles;
   {
-    triChunkSize = numMeshTriangles;
-  }
+    std::vector<std::vector<GBCDMetricBased::TriAreaAndNormals>> blockTriangles((numMeshTriangles + k_TrianglesPerBlock - 1) / k_TrianglesPerBlock);
 
-  for(usize i = 0; i < numMeshTriangles; i += triChunkSize)
-  {
-    if(getCancel())
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, blockTriangles.size());
+    dataAlg.requireArraysInMemory({&faceLabels, &faceNormals, &faceAreas, &nodeTypes});
+    dataAlg.execute(GBCDMetricBased::TrianglesSelector(m_InputValues->ExcludeTripleLines, triangles, nodeTypes, blockTriangles, triIncluded, misResolution, m_InputValues->PhaseOfInterest, gFixedT,
+                                                       crystalStructures, eulerAngles, phases, faceLabels, faceNormals, faceAreas));
+
+    // Join the blocks in triangle order so the distribution sums do not depend on the thread scheduling
+    usize numSelectedTriangles = 0;
+    for(const auto& triangleList : blockTriangles)
     {
-      return {};
+      numSelectedTriangles += triangleList.size();
     }
-    m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Step 1/2: Selecting Triangles with the Specified Misorientation ({}% completed)",
-                                                               static_cast<int32>(100.0 * static_cast<float64>(i) / static_cast<float64>(numMeshTriangles))));
-    if(i + triChunkSize >= numMeshTriangles)
+    selectedTriangles.reserve(numSelectedTriangles);
+    for(const auto& triangleList : blockTriangles)
     {
-      triChunkSize = numMeshTriangles - i;
+      selectedTriangles.insert(selectedTriangles.end(), triangleList.begin(), triangleList.end());
     }
+  }
 
-    ParallelDataAlgorithm dataAlg;
-    dataAlg.setRange(i, i + triChunkSize);
-    dataAlg.setParallelizationEnabled(true);
-    dataAlg.execute(GBCDMetricBased::TrianglesSelector(m_InputValues->ExcludeTripleLines, triangles, nodeTypes, selectedTriangles, triIncluded, misResolution, m_InputValues->PhaseOfInterest, gFixedT,
-                                                       crystalStructures, eulerAngles, phases, faceLabels, faceNormals, faceAreas));
+  if(getCancel())
+  {
+    return {};
   }
 
   // ------------------------  find the number of distinct boundaries ------------------------------
@@ -533,11 +520,9 @@ Result<> ComputeGBCDMetricBased::operator()()
   std::vector<float64> distributionValues(samplePtsX.size(), 0.0);
   std::vector<float64> errorValues(samplePtsX.size(), 0.0);
 
-  usize pointsChunkSize = 100;
-  if(samplePtsX.size() < pointsChunkSize)
-  {
-    pointsChunkSize = samplePtsX.size();
-  }
+  // Every point sums over all selected triangles so the points are split into a few large chunks that
+  // keep all cores busy while still allowing progress updates and cancellation
+  usize pointsChunkSize = std::max<usize>(samplePtsX.size() / 10, 1);
 
   for(usize i = 0; i < samplePtsX.size(); i += pointsChunkSize)
   {
@@ -554,7 +539,6 @@ Result<> ComputeGBCDMetricBased::operator()()
 
     ParallelDataAlgorithm dataAlg;
     dataAlg.setRange(i, i + pointsChunkSize);
-    dataAlg.setParallelizationEnabled(true);
     dataAlg.execute(GBCDMetricBased::ProbeDistribution(distributionValues, errorValues, samplePtsX, samplePtsY, samplePtsZ, selectedTriangles, planeResolutionSq, totalFaceArea, numDistinctGBs,
                                                        ballVolume, gFixedT));
   }
@@ -11,10 +11,7 @@
 
 #include "EbsdLib/LaueOps/LaueOps.h"
 
-#ifdef SIMPLNX_ENABLE_MULTICORE
-#include <tbb/concurrent_vector.h>
-#endif
-
+#include <algorithm>
 #include <cmath>
 
 using namespace nx::core;
@@ -25,6 +22,25 @@ using LaueOpsContainerType = std::vector<LaueOpsShPtrType>;
 
 namespace gbpd_metric_based
 {
+// Number of triangles whose selected boundaries are collected into one list
+constexpr usize k_TrianglesPerBlock = 4096;
+
+/**
+ * @brief Returns the symmetry operators of a Laue class as Eigen matrices
+ */
+std::vector<Matrix3dR> GetSymOps(uint32 crystal)
+{
+  LaueOpsContainerType orientationOps = LaueOps::GetAllOrientationOps();
+  const int32 nSym = orientationOps[crystal]->getNumSymOps();
+  std::vector<Matrix3dR> symOps;
+  symOps.reserve(nSym);
+  for(int32 symOp = 0; symOp < nSym; symOp++)
+  {
+    symOps.push_back(EbsdLibMatrixToEigenMatrix(orientationOps[crystal]->getMatSymOpD(symOp)));
+  }
+  return symOps;
+}
+
 /**
  * @brief The TriAreaAndNormals class defines a container that stores the area of a given triangle
  * and the two normals for grains on either side of the triangle
@@ -60,23 +76,19 @@ public:
 
 /**
  * @brief The TrianglesSelector class implements a threaded algorithm that determines which triangles to
- * include in the GBPD calculation
+ * include in the GBPD calculation. Every block of triangles collects its selected boundaries into its own
+ * list so the lists can be joined in triangle order.
  */
 class TrianglesSelector
 {
 public:
-  TrianglesSelector(bool excludeTripleLines, const IGeometry::SharedFaceList& triangles, const Int8Array& nodeTypes,
-#ifdef SIMPLNX_ENABLE_MULTICORE
-                    tbb::concurrent_vector<TriAreaAndNormals>& selectedTriangles,
-#else
-                    std::vector<TriAreaAndNormals>& selectedTriangles,
-#endif
-                    int32_t phaseOfInterest, const UInt32Array& crystalStructures, const Float32Array& euler, const Int32Array& phases, const Int32Array& faceLabels, const Float64Array& faceNormals,
+  TrianglesSelector(bool excludeTripleLines, const IGeometry::SharedFaceList& triangles, const Int8Array& nodeTypes, std::vector<std::vector<TriAreaAndNormals>>& blockTriangles,
+                    int32_t phaseOfInterest, const Float32Array& euler, const Int32Array& phases, const Int32Array& faceLabels, const Float64Array& faceNormals,
                     const Float64Array& faceAreas)
   : m_ExcludeTripleLines(excludeTripleLines)
   , m_Triangles(triangles)
   , m_NodeTypes(nodeTypes)
-  , m_SelectedTriangles(selectedTriangles)
+  , m_BlockTriangles(blockTriangles)
   , m_PhaseOfInterest(phaseOfInterest)
   , m_EulerAngles(euler)
   , m_Phases(phases)
@@ -84,12 +96,9 @@ public:
   , m_FaceNormals(faceNormals)
   , m_FaceAreas(faceAreas)
   {
-    m_OrientationOps = LaueOps::GetAllOrientationOps();
-    m_Crystal = crystalStructures[phaseOfInterest];
-    m_NSym = m_OrientationOps[m_Crystal]->getNumSymOps();
   }
 
-  void select(usize start, usize end) const
+  void select(usize start, usize end, std::vector<TriAreaAndNormals>& selectedTriangles) const
   {
     Eigen::Vector3d g1ea = {0.0, 0.0, 0.0};
     Eigen::Vector3d g2ea = {0.0, 0.0, 0.0};
@@ -139,13 +148,20 @@ public:
       normalGrain1 = OrientationMatrixToGMatrix(oMatrix1) * normalLab;
       normalGrain2 = OrientationMatrixToGMatrix(oMatrix2) * normalLab;
 
-      m_SelectedTriangles.push_back(TriAreaAndNormals(m_FaceAreas[triIdx], normalGrain1[0], normalGrain1[1], normalGrain1[2], -normalGrain2[0], -normalGrain2[1], -normalGrain2[2]));
+      selectedTriangles.emplace_back(m_FaceAreas[triIdx], normalGrain1[0], normalGrain1[1], normalGrain1[2], -normalGrain2[0], -normalGrain2[1], -normalGrain2[2]);
     }
   }
 
   void operator()(const Range& range) const
   {
-    select(range.min(), range.max());
+    const usize numTriangles = m_FaceAreas.getNumberOfTuples();
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      std::vector<TriAreaAndNormals>& selectedTriangles = m_BlockTriangles[block];
+      selectedTriangles.clear();
+      const usize start = block * k_TrianglesPerBlock;
+      select(start, std::min(start + k_TrianglesPerBlock, numTriangles), selectedTriangles);
+    }
   }
 
 private:
@@ -153,15 +169,8 @@ private:
   bool m_ExcludeTripleLines;
   const IGeometry::SharedFaceList& m_Triangles;
   const Int8Array& m_NodeTypes;
-#ifdef SIMPLNX_ENABLE_MULTICORE
-  tbb::concurrent_vector<TriAreaAndNormals>& m_SelectedTriangles;
-#else
-  std::vector<TriAreaAndNormals>& m_SelectedTriangles;
-#endif
+  std::vector<std::vector<TriAreaAndNormals>>& m_BlockTriangles;
   int32 m_PhaseOfInterest;
-  LaueOpsContainerType m_OrientationOps;
-  uint32 m_Crystal;
-  int32 m_NSym;
   const Float32Array& m_EulerAngles;
   const Int32Array& m_Phases;
   const Int32Array& m_FaceLabels;
@@ -177,13 +186,7 @@ class ProbeDistribution
 {
 public:
   ProbeDistribution(std::vector<float64>& distributionValues, std::vector<float64>& errorValues, const std::vector<float64>& samplePtsX, const std::vector<float64>& samplePtsY,
-                    const std::vector<float64>& samplePtsZ,
-#ifdef SIMPLNX_ENABLE_MULTICORE
-                    const tbb::concurrent_vector<TriAreaAndNormals>& selectedTriangles,
-#else
-                    const std::vector<TriAreaAndNormals>& selectedTriangles,
-#endif
-                    float64 limitDist, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, int32 crystal)
+                    const std::vector<float64>& samplePtsZ, const std::vector<TriAreaAndNormals>& selectedTriangles, float64 limitDist, float64 totalFaceArea, int32 numDistinctGBs, float64 ballVolume, int32 crystal)
   : m_DistributionValues(distributionValues)
   , m_ErrorValues(errorValues)
   , m_SamplePtsX(samplePtsX)
@@ -194,10 +197,8 @@ public:
   , m_TotalFaceArea(totalFaceArea)
   , m_NumDistinctGBs(numDistinctGBs)
   , m_BallVolume(ballVolume)
-  , m_Crystal(crystal)
+  , m_SymOps(GetSymOps(crystal))
   {
-    m_OrientationOps = LaueOps::GetAllOrientationOps();
-    m_NSym = m_OrientationOps[crystal]->getNumSymOps();
   }
 
   void probe(usize start, usize end) const
@@ -212,10 +213,8 @@ public:
         const Eigen::Vector3d normal1 = {selectedTriangle.NormalGrain1X, selectedTriangle.NormalGrain1Y, selectedTriangle.NormalGrain1Z};
         const Eigen::Vector3d normal2 = {selectedTriangle.NormalGrain2X, selectedTriangle.NormalGrain2Y, selectedTriangle.NormalGrain2Z};
 
-        for(int32 j = 0; j < m_NSym; j++)
+        for(const Matrix3dR& sym : m_SymOps)
         {
-          const Matrix3dR sym = EbsdLibMatrixToEigenMatrix(m_OrientationOps[m_Crystal]->getMatSymOpD(j));
-
           Eigen::Vector3d symNormal1 = sym * normal1;
           Eigen::Vector3d symNormal2 = sym * normal2;
 
@@ -262,21 +261,15 @@ public:
 private:
   std::vector<float64>& m_DistributionValues;
   std::vector<float64>& m_ErrorValues;
-  std::vector<float64> m_SamplePtsX;
-  std::vector<float64> m_SamplePtsY;
-  std::vector<float64> m_SamplePtsZ;
-#ifdef SIMPLNX_ENABLE_MULTICORE
-  const tbb::concurrent_vector<TriAreaAndNormals>& m_SelectedTriangles;
-#else
+  const std::vector<float64>& m_SamplePtsX;
+  const std::vector<float64>& m_SamplePtsY;
+  const std::vector<float64>& m_SamplePtsZ;
   const std::vector<TriAreaAndNormals>& m_SelectedTriangles;
-#endif
   float64 m_LimitDist;
   float64 m_TotalFaceArea;
   int32 m_NumDistinctGBs;
   float64 m_BallVolume;
-  LaueOpsContainerType m_OrientationOps;
-  uint32 m_Crystal;
-  int32 m_NSym;
+  std::vector<Matrix3dR> m_SymOps;
 };
 
 } // namespace gbpd_metric_based
@@ -564,34 +557,33 @@ Result<> ComputeGBPDMetricBased::operator()()
   // ---------  find triangles corresponding to Phase of Interests, and their normals in crystal reference frames ---------
   const usize numMeshTriangles = faceAreas.getNumberOfTuples();
 
-#ifdef SIMPLNX_ENABLE_MULTICORE
-  tbb::concurrent_vector<gbpd_metric_based::TriAreaAndNormals> selectedTriangles(0);
-#else
-  std::vector<gbpd_metric_based::TriAreaAndNormals> selectedTriangles(0);
-#endif
-
-  usize triChunkSize = 50000;
-  if(numMeshTriangles < triChunkSize)
+  m_MessageHandler(IFilter::Message::Type::Info, "Selecting triangles corresponding to Phase Of Interest");
+  std::vector<gbpd_metric_based::TriAreaAndNormals> selectedTriangles;
   {
-    triChunkSize = numMeshTriangles;
-  }
+    std::vector<std::vector<gbpd_metric_based::TriAreaAndNormals>> blockTriangles((numMeshTriangles + gbpd_metric_based::k_TrianglesPerBlock - 1) / gbpd_metric_based::k_TrianglesPerBlock);
 
-  for(usize i = 0; i < numMeshTriangles; i += triChunkSize)
-  {
-    if(getCancel())
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, blockTriangles.size());
+    dataAlg.requireArraysInMemory({&faceLabels, &faceNormals, &faceAreas, &nodeTypes});
+    dataAlg.execute(gbpd_metric_based::TrianglesSelector(m_InputValues->ExcludeTripleLines, triangles, nodeTypes, blockTriangles, m_InputValues->PhaseOfInterest, eulerAngles,
+                                                         phases, faceLabels, faceNormals, faceAreas));
+
+    // Join the blocks in triangle order so the distribution sums do not depend on the thread scheduling
+    usize numSelectedTriangles = 0;
+    for(const auto& triangleList : blockTriangles)
     {
-      return {};
+      numSelectedTriangles += triangleList.size();
     }
-    m_MessageHandler(IFilter::Message::Type::Info, "Selecting triangles corresponding to Phase Of Interest");
-    if(i + triChunkSize >= numMeshTriangles)
+    selectedTriangles.reserve(numSelectedTriangles);
+    for(const auto& triangleList : blockTriangles)
     {
-      triChunkSize = numMeshTriangles - i;
+      selectedTriangles.insert(selectedTriangles.end(), triangleList.begin(), triangleList.end());
     }
+  }
 
-    ParallelDataAlgorithm dataAlg;
-    dataAlg.setRange(i, i + triChunkSize);
-    dataAlg.execute(gbpd_metric_based::TrianglesSelector(m_InputValues->ExcludeTripleLines, triangles, nodeTypes, selectedTriangles, m_InputValues->PhaseOfInterest, crystalStructures, eulerAngles,
-                                                         phases, faceLabels, faceNormals, faceAreas));
+  if(getCancel())
+  {
+    return {};
   }
 
   // ------------------------  find the number of distinct boundaries ------------------------------
@@ -629,11 +621,9 @@ Result<> ComputeGBPDMetricBased::operator()()
   std::vector<float64> distributionValues(samplePtsX.size(), 0.0);
   std::vector<float64> errorValues(samplePtsX.size(), 0.0);
 
-  usize pointsChunkSize = 20;
-  if(samplePtsX.size() < pointsChunkSize)
-  {
-    pointsChunkSize = samplePtsX.size();
-  }
+  // Every point sums over all selected triangles so the points are split into a few large chunks that
+  // keep all cores busy while still allowing progress updates and cancellation
+  usize pointsChunkSize = std::max<usize>(samplePtsX.size() / 10, 1);
 
   for(usize i = 0; i < samplePtsX.size(); i = i + pointsChunkSize)
   {
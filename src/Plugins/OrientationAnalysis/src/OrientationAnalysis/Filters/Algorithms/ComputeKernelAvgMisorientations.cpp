@@ -1,13 +1,14 @@
 #include "ComputeKernelAvgMisorientations.hpp"
 
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
 #include "simplnx/Common/Constants.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
-
+#include <array>
 #include <chrono>
 
 using namespace nx::core;
@@ -43,13 +44,16 @@ public:
     auto& kernelAvgMisorientationsArray = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->KernelAverageMisorientationsArrayName);
     auto& kernelAvgMisorientations = kernelAvgMisorientationsArray.getDataStoreRef();
 
-    std::vector<LaueOps::Pointer> m_OrientationOps = LaueOps::GetAllOrientationOps();
+    const MisorientationEngine misorientationEngine;
 
     auto* gridGeom = m_DataStructure.getDataAs<ImageGeom>(m_InputValues->InputImageGeometry);
     SizeVec3 udims = gridGeom->getDimensions();
 
-    QuatD q1;
-    QuatD q2;
+    // The quaternions of the kernel neighbors of a voxel are gathered so all of their misorientations
+    // are computed in a single batch
+    std::array<float32, 4> q1 = {0.0f, 0.0f, 0.0f, 1.0f};
+    std::vector<float32> neighborQuats;
+    std::vector<float64> neighborAngles;
 
     // messenger values
     usize counter = 0;
@@ -85,7 +89,7 @@ public:
           if(featureIds[point] > 0 && cellPhases[point] > 0)
           {
             float totalMisorientation = 0.0f;
-            int32 numVoxel = 0;
+            neighborQuats.clear();
 
             size_t quatIndex = point * 4;
             q1[0] = quats[quatIndex];
@@ -118,17 +122,22 @@ public:
                   if(featureIds[point] == featureIds[neighbor])
                   {
                     quatIndex = neighbor * 4;
-                    q2[0] = quats[quatIndex];
-                    q2[1] = quats[quatIndex + 1];
-                    q2[2] = quats[quatIndex + 2];
-                    q2[3] = quats[quatIndex + 3];
-                    OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-                    totalMisorientation = totalMisorientation + (axisAngle[3] * nx::core::Constants::k_180OverPiD);
-                    numVoxel++;
+                    neighborQuats.push_back(quats[quatIndex]);
+                    neighborQuats.push_back(quats[quatIndex + 1]);
+                    neighborQuats.push_back(quats[quatIndex + 2]);
+                    neighborQuats.push_back(quats[quatIndex + 3]);
                   }
                 }
               }
             }
+
+            const auto numVoxel = static_cast<int32>(neighborQuats.size() / 4);
+            neighborAngles.resize(numVoxel);
+            misorientationEngine.calculateAngles(phase1, q1.data(), neighborQuats, neighborAngles);
+            for(const float64 angle : neighborAngles)
+            {
+              totalMisorientation = totalMisorientation + (static_cast<float32>(angle) * nx::core::Constants::k_180OverPiD);
+            }
             kernelAvgMisorientations[point] = totalMisorientation / static_cast<float>(numVoxel);
             if(numVoxel == 0)
             {
@@ -1,14 +1,114 @@
 #include "ComputeMisorientations.hpp"
 
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
 #include "simplnx/Common/Constants.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
-#include "EbsdLib/LaueOps/LaueOps.h"
+#include <array>
 
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief The ComputeMisorientationsImpl class computes the misorientations of a range of features with each of
+ * their neighbors. Each feature is computed as one batch.
+ */
+class ComputeMisorientationsImpl
+{
+public:
+  ComputeMisorientationsImpl(const MisorientationEngine& misorientationEngine, const Int32AbstractDataStore& featurePhases, const Float32AbstractDataStore& avgQuats,
+                             const UInt32AbstractDataStore& crystalStructures, const NeighborList<int32>& neighborList, Float32AbstractDataStore* avgMisorientations,
+                             std::vector<std::vector<float>>& misorientationLists)
+  : m_MisorientationEngine(misorientationEngine)
+  , m_FeaturePhases(featurePhases)
+  , m_AvgQuats(avgQuats)
+  , m_CrystalStructures(crystalStructures)
+  , m_NeighborList(neighborList)
+  , m_AvgMisorientations(avgMisorientations)
+  , m_MisorientationLists(misorientationLists)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const auto numLaueClasses = static_cast<int64>(m_MisorientationEngine.getNumberOfLaueClasses());
+    std::array<float32, 4> q1 = {0.0f, 0.0f, 0.0f, 1.0f};
+    std::vector<float32> neighborQuats;
+    std::vector<float64> neighborAngles;
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      usize quatIndex = i * 4;
+      for(usize comp = 0; comp < 4; comp++)
+      {
+        q1[comp] = m_AvgQuats[quatIndex + comp];
+      }
+      uint32_t xtalType1 = m_CrystalStructures[m_FeaturePhases[i]];
+
+      const NeighborList<int32_t>::VectorType& featureNeighborList = m_NeighborList.getListReference(static_cast<int32_t>(i));
+
+      std::vector<float>& misorientationList = m_MisorientationLists[i];
+      misorientationList.assign(featureNeighborList.size(), -1.0);
+
+      // Compute the misorientations with all neighbors of the feature in one batch
+      neighborQuats.resize(featureNeighborList.size() * 4);
+      neighborAngles.resize(featureNeighborList.size());
+      for(size_t j = 0; j < featureNeighborList.size(); j++)
+      {
+        quatIndex = featureNeighborList[j] * 4;
+        for(usize comp = 0; comp < 4; comp++)
+        {
+          neighborQuats[j * 4 + comp] = m_AvgQuats[quatIndex + comp];
+        }
+      }
+      m_MisorientationEngine.calculateAngles(xtalType1, q1.data(), neighborQuats, neighborAngles);
+
+      size_t tempMisoList = featureNeighborList.size();
+      float misorientationSum = 0.0f;
+      for(size_t j = 0; j < featureNeighborList.size(); j++)
+      {
+        int32_t neighborFeatureId = featureNeighborList[j];
+        uint32_t xtalType2 = m_CrystalStructures[m_FeaturePhases[neighborFeatureId]];
+        if(xtalType1 == xtalType2 && static_cast<int64_t>(xtalType1) < numLaueClasses)
+        {
+          misorientationList[j] = static_cast<float>(neighborAngles[j] * nx::core::Constants::k_180OverPiF);
+          misorientationSum += misorientationList[j];
+        }
+        else
+        {
+          tempMisoList--;
+          misorientationList[j] = NAN;
+        }
+      }
+      if(m_AvgMisorientations != nullptr)
+      {
+        if(tempMisoList != 0)
+        {
+          m_AvgMisorientations->setValue(i, (m_AvgMisorientations->getValue(i) + misorientationSum) / static_cast<float>(tempMisoList));
+        }
+        else
+        {
+          m_AvgMisorientations->setValue(i, NAN);
+        }
+      }
+    }
+  }
+
+private:
+  const MisorientationEngine& m_MisorientationEngine;
+  const Int32AbstractDataStore& m_FeaturePhases;
+  const Float32AbstractDataStore& m_AvgQuats;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  const NeighborList<int32>& m_NeighborList;
+  Float32AbstractDataStore* m_AvgMisorientations = nullptr;
+  std::vector<std::vector<float>>& m_MisorientationLists;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeMisorientations::ComputeMisorientations(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                ComputeMisorientationsInputValues* inputValues)
@@ -32,82 +132,34 @@ const std::atomic_bool& ComputeMisorientations::getCancel()
 Result<> ComputeMisorientations::operator()()
 {
 
-  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  const MisorientationEngine misorientationEngine;
 
   // Input Arrays
-  const auto& inFeaturePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
-  const auto& inAvgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
-  const auto& inXtalStruct = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
+  const auto& inFeaturePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath).getDataStoreRef();
+  const auto& inAvgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath).getDataStoreRef();
+  const auto& inXtalStruct = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath).getDataStoreRef();
   const auto& inNeighborList = m_DataStructure.getDataRefAs<NeighborList<int32>>(m_InputValues->NeighborListArrayPath);
 
-  // The output misorientations is going to be used as a vector because the output array is optional and might
+  // The output misorientations is going to be used as a pointer because the output array is optional and might
   // not exist in the DataStructure. We cannot get it by reference.
-  auto* avgMisorientations = m_DataStructure.getDataAs<Float32Array>(m_InputValues->AvgMisorientationsArrayName);
-
-  size_t tempMisoList = 0;
+  auto* avgMisorientations = m_InputValues->ComputeAvgMisors ? m_DataStructure.getDataAs<Float32Array>(m_InputValues->AvgMisorientationsArrayName)->getDataStore() : nullptr;
 
   size_t totalFeatures = inFeaturePhases.getNumberOfTuples();
 
   std::vector<std::vector<float>> tempMisorientationLists(totalFeatures);
-  usize quatIndex = 0;
-  for(size_t i = 1; i < totalFeatures; i++)
-  {
-    quatIndex = i * 4;
 
-    QuatF q1(inAvgQuats[quatIndex], inAvgQuats[quatIndex + 1], inAvgQuats[quatIndex + 2], inAvgQuats[quatIndex + 3]);
-    uint32_t xtalType1 = inXtalStruct[inFeaturePhases[i]];
-
-    const NeighborList<int32_t>::VectorType& featureNeighborList = inNeighborList.getListReference(static_cast<int32_t>(i));
-
-    tempMisorientationLists[i].assign(featureNeighborList.size(), -1.0);
-
-    for(size_t j = 0; j < featureNeighborList.size(); j++)
-    {
-      int32_t neighborFeatureId = featureNeighborList[j];
-      quatIndex = neighborFeatureId * 4;
-      QuatF q2(inAvgQuats[quatIndex], inAvgQuats[quatIndex + 1], inAvgQuats[quatIndex + 2], inAvgQuats[quatIndex + 3]);
-      uint32_t xtalType2 = inXtalStruct[inFeaturePhases[neighborFeatureId]];
-      tempMisoList = featureNeighborList.size();
-      if(xtalType1 == xtalType2 && static_cast<int64_t>(xtalType1) < static_cast<int64_t>(orientationOps.size()))
-      {
-        OrientationD axisAngle = orientationOps[xtalType1]->calculateMisorientation(q1, q2);
-
-        tempMisorientationLists[i][j] = static_cast<float>(axisAngle[3] * nx::core::Constants::k_180OverPiF);
-        if(m_InputValues->ComputeAvgMisors)
-        {
-          (*avgMisorientations)[i] += tempMisorientationLists[i][j];
-        }
-      }
-      else
-      {
-        if(m_InputValues->ComputeAvgMisors)
-        {
-          tempMisoList--;
-        }
-        tempMisorientationLists[i][j] = NAN;
-      }
-    }
-    if(m_InputValues->ComputeAvgMisors)
-    {
-      if(tempMisoList != 0)
-      {
-        (*avgMisorientations)[i] /= static_cast<float>(tempMisoList);
-      }
-      else
-      {
-        (*avgMisorientations)[i] = NAN;
-      }
-      tempMisoList = 0;
-    }
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.requireStoresInMemory({&inFeaturePhases, &inAvgQuats, avgMisorientations});
+  dataAlg.execute(ComputeMisorientationsImpl(misorientationEngine, inFeaturePhases, inAvgQuats, inXtalStruct, inNeighborList, avgMisorientations, tempMisorientationLists));
 
   // Output Variables
   auto& outMisorientationList = m_DataStructure.getDataRefAs<NeighborList<float32>>(m_InputValues->MisorientationListArrayName);
   // Set the vector for each list into the NeighborList Object
   for(size_t i = 1; i < totalFeatures; i++)
   {
-    // Construct a shared vector<float> through the std::vector<> copy constructor.
-    NeighborList<float>::SharedVectorType sharedMisorientationList(new std::vector<float>(tempMisorientationLists[i]));
+    // Move each vector into the shared vector<float> that is handed to the NeighborList
+    NeighborList<float>::SharedVectorType sharedMisorientationList(new std::vector<float>(std::move(tempMisorientationLists[i])));
     outMisorientationList.setList(static_cast<int32_t>(i), sharedMisorientationList);
   }
 
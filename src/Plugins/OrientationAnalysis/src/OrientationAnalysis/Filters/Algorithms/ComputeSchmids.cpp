@@ -4,10 +4,105 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/Utilities/Math/MatrixMath.hpp"
 
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
 #include "EbsdLib/LaueOps/LaueOps.h"
 
+#include <array>
+
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief The ComputeSchmidsImpl class computes the Schmid factor and the active slip system of a range of features.
+ */
+class ComputeSchmidsImpl
+{
+public:
+  ComputeSchmidsImpl(const std::vector<LaueOps::Pointer>& orientationOps, const Float32AbstractDataStore& avgQuats, const Int32AbstractDataStore& featurePhases,
+                     const UInt32AbstractDataStore& crystalStructures, Float32AbstractDataStore& schmids, Int32AbstractDataStore& slipSystems, Int32AbstractDataStore& poles,
+                     Float32AbstractDataStore* phis, Float32AbstractDataStore* lambdas, const std::array<float64, 3>& sampleLoading, bool overrideSystem, const std::array<float64, 3>& plane,
+                     const std::array<float64, 3>& direction)
+  : m_OrientationOps(orientationOps)
+  , m_AvgQuats(avgQuats)
+  , m_FeaturePhases(featurePhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_Schmids(schmids)
+  , m_SlipSystems(slipSystems)
+  , m_Poles(poles)
+  , m_Phis(phis)
+  , m_Lambdas(lambdas)
+  , m_SampleLoading(sampleLoading)
+  , m_OverrideSystem(overrideSystem)
+  , m_Plane(plane)
+  , m_Direction(direction)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    int32_t slipSystem = 0;
+
+    double g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
+    double sampleLoading[3] = {m_SampleLoading[0], m_SampleLoading[1], m_SampleLoading[2]};
+    double crystalLoading[3] = {0.0f, 0.0f, 0.0f};
+    double angleComps[2] = {0.0f, 0.0f};
+    double schmid = 0.0f;
+    double plane[3] = {m_Plane[0], m_Plane[1], m_Plane[2]};
+    double direction[3] = {m_Direction[0], m_Direction[1], m_Direction[2]};
+
+    for(size_t i = range.min(); i < range.max(); i++)
+    {
+      uint32_t xtal = m_CrystalStructures[m_FeaturePhases[i]];
+      if(xtal >= EbsdLib::CrystalStructure::LaueGroupEnd)
+      {
+        continue;
+      }
+      OrientationTransformation::qu2om<QuatF, OrientationD>({m_AvgQuats[i * 4 + 0], m_AvgQuats[i * 4 + 1], m_AvgQuats[i * 4 + 2], m_AvgQuats[i * 4 + 3]}).toGMatrix(g);
+
+      MatrixMath::Multiply3x3with3x1(g, sampleLoading, crystalLoading);
+
+      if(!m_OverrideSystem)
+      {
+        m_OrientationOps[xtal]->getSchmidFactorAndSS(crystalLoading, schmid, angleComps, slipSystem);
+      }
+      else
+      {
+        m_OrientationOps[xtal]->getSchmidFactorAndSS(crystalLoading, plane, direction, schmid, angleComps, slipSystem);
+      }
+
+      m_Schmids[i] = static_cast<float>(schmid);
+      if(m_Phis != nullptr && m_Lambdas != nullptr)
+      {
+        m_Phis->setValue(i, static_cast<float>(angleComps[0]));
+        m_Lambdas->setValue(i, static_cast<float>(angleComps[1]));
+      }
+
+      m_Poles[3 * i] = static_cast<int32>(crystalLoading[0] * 100.0);
+      m_Poles[3 * i + 1] = static_cast<int32>(crystalLoading[1] * 100.0);
+      m_Poles[3 * i + 2] = static_cast<int32>(crystalLoading[2] * 100.0);
+      m_SlipSystems[i] = slipSystem;
+    }
+  }
+
+private:
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  const Float32AbstractDataStore& m_AvgQuats;
+  const Int32AbstractDataStore& m_FeaturePhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  Float32AbstractDataStore& m_Schmids;
+  Int32AbstractDataStore& m_SlipSystems;
+  Int32AbstractDataStore& m_Poles;
+  Float32AbstractDataStore* m_Phis = nullptr;
+  Float32AbstractDataStore* m_Lambdas = nullptr;
+  std::array<float64, 3> m_SampleLoading;
+  bool m_OverrideSystem = false;
+  std::array<float64, 3> m_Plane;
+  std::array<float64, 3> m_Direction;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeSchmids::ComputeSchmids(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ComputeSchmidsInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -53,66 +148,26 @@ Result<> ComputeSchmids::operator()()
 
   size_t totalFeatures = avgQuatPtr.getNumberOfTuples();
 
-  int32_t slipSystem = 0;
-
-  double g[3][3] = {{0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}};
-  double sampleLoading[3] = {0.0f, 0.0f, 0.0f};
-  double crystalLoading[3] = {0.0f, 0.0f, 0.0f};
-  double angleComps[2] = {0.0f, 0.0f};
-  double schmid = 0.0f;
-
-  sampleLoading[0] = m_InputValues->LoadingDirection[0];
-  sampleLoading[1] = m_InputValues->LoadingDirection[1];
-  sampleLoading[2] = m_InputValues->LoadingDirection[2];
-  MatrixMath::Normalize3x1(sampleLoading);
-  double plane[3] = {0.0f, 0.0f};
-  double direction[3] = {0.0f, 0.0f};
+  std::array<float64, 3> sampleLoading = {m_InputValues->LoadingDirection[0], m_InputValues->LoadingDirection[1], m_InputValues->LoadingDirection[2]};
+  MatrixMath::Normalize3x1(sampleLoading.data());
+  std::array<float64, 3> plane = {0.0, 0.0, 0.0};
+  std::array<float64, 3> direction = {0.0, 0.0, 0.0};
 
   if(m_InputValues->OverrideSystem)
   {
-    plane[0] = m_InputValues->SlipPlane[0];
-    plane[1] = m_InputValues->SlipPlane[1];
-    plane[2] = m_InputValues->SlipPlane[2];
-    MatrixMath::Normalize3x1(plane);
-
-    direction[0] = m_InputValues->SlipDirection[0];
-    direction[1] = m_InputValues->SlipDirection[1];
-    direction[2] = m_InputValues->SlipDirection[2];
-    MatrixMath::Normalize3x1(direction);
-  }
-
-  for(size_t i = 1; i < totalFeatures; i++)
-  {
-    uint32_t xtal = crystalStructures[featurePhases[i]];
-    if(xtal >= EbsdLib::CrystalStructure::LaueGroupEnd)
-    {
-      continue;
-    }
-    OrientationTransformation::qu2om<QuatF, OrientationD>({avgQuatPtr[i * 4 + 0], avgQuatPtr[i * 4 + 1], avgQuatPtr[i * 4 + 2], avgQuatPtr[i * 4 + 3]}).toGMatrix(g);
-
-    MatrixMath::Multiply3x3with3x1(g, sampleLoading, crystalLoading);
-
-    if(!m_InputValues->OverrideSystem)
-    {
-      orientationOps[xtal]->getSchmidFactorAndSS(crystalLoading, schmid, angleComps, slipSystem);
-    }
-    else
-    {
-      orientationOps[xtal]->getSchmidFactorAndSS(crystalLoading, plane, direction, schmid, angleComps, slipSystem);
-    }
+    plane = {m_InputValues->SlipPlane[0], m_InputValues->SlipPlane[1], m_InputValues->SlipPlane[2]};
+    MatrixMath::Normalize3x1(plane.data());
 
-    schmidArray[i] = static_cast<float>(schmid);
-    if(m_InputValues->StoreAngleComponents)
-    {
-      (*phiArray)[i] = angleComps[0];
-      (*lambdaArray)[i] = angleComps[1];
-    }
-
-    poleArrays[3 * i] = static_cast<int32>(crystalLoading[0] * 100.0);
-    poleArrays[3 * i + 1] = static_cast<int32>(crystalLoading[1] * 100.0);
-    poleArrays[3 * i + 2] = static_cast<int32>(crystalLoading[2] * 100.0);
-    slipSystems[i] = slipSystem;
+    direction = {m_InputValues->SlipDirection[0], m_InputValues->SlipDirection[1], m_InputValues->SlipDirection[2]};
+    MatrixMath::Normalize3x1(direction.data());
   }
 
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.requireArraysInMemory({&avgQuatPtr, &featurePhases, &schmidArray, &slipSystems, &poleArrays, phiArray, lambdaArray});
+  dataAlg.execute(ComputeSchmidsImpl(orientationOps, avgQuatPtr.getDataStoreRef(), featurePhases.getDataStoreRef(), crystalStructures.getDataStoreRef(), schmidArray.getDataStoreRef(),
+                                     slipSystems.getDataStoreRef(), poleArrays.getDataStoreRef(), m_InputValues->StoreAngleComponents ? phiArray->getDataStore() : nullptr,
+                                     m_InputValues->StoreAngleComponents ? lambdaArray->getDataStore() : nullptr, sampleLoading, m_InputValues->OverrideSystem, plane, direction));
+
   return {};
 }
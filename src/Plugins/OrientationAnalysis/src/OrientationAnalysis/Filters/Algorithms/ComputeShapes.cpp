@@ -5,13 +5,17 @@
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelFeatureReduction.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/Eigenvalues>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <utility>
+
 namespace
 {
 /**
@@ -90,8 +94,277 @@ std::array<size_t, 3> TripletSort(T a, T b, T c, bool lowToHigh)
 }
 
 } // namespace
+
 using namespace nx::core;
 
+namespace
+{
+struct MomentsAccumulator
+{
+  std::array<double, 6> moments = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+  size_t count = 0;
+
+  void merge(const MomentsAccumulator& partial)
+  {
+    for(size_t i = 0; i < moments.size(); i++)
+    {
+      moments[i] += partial.moments[i];
+    }
+    count += partial.count;
+  }
+};
+
+/**
+ * @brief Sums the second order moments of every cell about the centroid of its feature. Each cell is
+ * broken into 8 sub-cells.
+ */
+class Moments3DReducer
+{
+public:
+  using AccumulatorType = MomentsAccumulator;
+
+  Moments3DReducer(const Float32AbstractDataStore& centroids, size_t xPoints, size_t yPoints, const FloatVec3& modRes, const FloatVec3& origin, float scaleFactor)
+  : m_Centroids(centroids)
+  , m_XPoints(xPoints)
+  , m_YPoints(yPoints)
+  , m_ModRes(modRes)
+  , m_Origin(origin)
+  , m_ScaleFactor(scaleFactor)
+  {
+  }
+
+  void accumulate(AccumulatorType& accumulator, size_t cellIndex, size_t featureId) const
+  {
+    const size_t k = cellIndex % m_XPoints;
+    const size_t j = (cellIndex / m_XPoints) % m_YPoints;
+    const size_t i = cellIndex / (m_XPoints * m_YPoints);
+
+    float x = float(k * m_ModRes[0]) + (m_Origin[0] * m_ScaleFactor);
+    float y = float(j * m_ModRes[1]) + (m_Origin[1] * m_ScaleFactor);
+    float z = float(i * m_ModRes[2]) + (m_Origin[2] * m_ScaleFactor);
+    const std::array<float, 2> xs = {x + (m_ModRes[0] / 4.0f), x - (m_ModRes[0] / 4.0f)};
+    const std::array<float, 2> ys = {y + (m_ModRes[1] / 4.0f), y - (m_ModRes[1] / 4.0f)};
+    const std::array<float, 2> zs = {z + (m_ModRes[2] / 4.0f), z - (m_ModRes[2] / 4.0f)};
+    const float centroidX = m_Centroids.getValue(featureId * 3 + 0) * m_ScaleFactor;
+    const float centroidY = m_Centroids.getValue(featureId * 3 + 1) * m_ScaleFactor;
+    const float centroidZ = m_Centroids.getValue(featureId * 3 + 2) * m_ScaleFactor;
+
+    float xx = 0.0f, yy = 0.0f, zz = 0.0f, xy = 0.0f, xz = 0.0f, yz = 0.0f;
+    for(size_t subCell = 0; subCell < 8; subCell++)
+    {
+      const float xdist = xs[subCell / 4] - centroidX;
+      const float ydist = ys[(subCell / 2) % 2] - centroidY;
+      const float zdist = zs[subCell % 2] - centroidZ;
+      xx = xx + (ydist * ydist) + (zdist * zdist);
+      yy = yy + (xdist * xdist) + (zdist * zdist);
+      zz = zz + (xdist * xdist) + (ydist * ydist);
+      xy = xy + (xdist * ydist);
+      yz = yz + (ydist * zdist);
+      xz = xz + (xdist * zdist);
+    }
+
+    accumulator.moments[0] += static_cast<double>(xx);
+    accumulator.moments[1] += static_cast<double>(yy);
+    accumulator.moments[2] += static_cast<double>(zz);
+    accumulator.moments[3] += static_cast<double>(xy);
+    accumulator.moments[4] += static_cast<double>(yz);
+    accumulator.moments[5] += static_cast<double>(xz);
+    accumulator.count++;
+  }
+
+  void merge(AccumulatorType& total, const AccumulatorType& partial, [[maybe_unused]] size_t featureId) const
+  {
+    total.merge(partial);
+  }
+
+private:
+  const Float32AbstractDataStore& m_Centroids;
+  size_t m_XPoints = 0;
+  size_t m_YPoints = 0;
+  FloatVec3 m_ModRes;
+  FloatVec3 m_Origin;
+  float m_ScaleFactor = 1.0f;
+};
+
+/**
+ * @brief Sums the second order moments of every cell about the centroid of its feature for a 2D image.
+ * Each cell is broken into 4 sub-cells. Only the first 3 moments are used.
+ */
+class Moments2DReducer
+{
+public:
+  using AccumulatorType = MomentsAccumulator;
+
+  Moments2DReducer(const Float32AbstractDataStore& centroids, size_t xPoints, const std::array<float, 2>& modRes, const FloatVec3& origin, float scaleFactor)
+  : m_Centroids(centroids)
+  , m_XPoints(xPoints)
+  , m_ModRes(modRes)
+  , m_Origin(origin)
+  , m_ScaleFactor(scaleFactor)
+  {
+  }
+
+  void accumulate(AccumulatorType& accumulator, size_t cellIndex, size_t featureId) const
+  {
+    const size_t xPoint = cellIndex % m_XPoints;
+    const size_t yPoint = cellIndex / m_XPoints;
+
+    float x = static_cast<float>(xPoint * m_ModRes[0]) + (m_Origin[0] * m_ScaleFactor);
+    float y = static_cast<float>(yPoint * m_ModRes[1]) + (m_Origin[1] * m_ScaleFactor);
+    const std::array<float, 2> xs = {x + (m_ModRes[0] / 4.0f), x - (m_ModRes[0] / 4.0f)};
+    const std::array<float, 2> ys = {y + (m_ModRes[1] / 4.0f), y - (m_ModRes[1] / 4.0f)};
+    const float centroidX = m_Centroids.getValue(featureId * 3 + 0) * m_ScaleFactor;
+    const float centroidY = m_Centroids.getValue(featureId * 3 + 1) * m_ScaleFactor;
+
+    float xx = 0.0f, yy = 0.0f, xy = 0.0f;
+    for(size_t subCell = 0; subCell < 4; subCell++)
+    {
+      const float xdist = xs[subCell / 2] - centroidX;
+      const float ydist = ys[subCell % 2] - centroidY;
+      xx = xx + (ydist * ydist);
+      yy = yy + (xdist * xdist);
+      xy = xy + (xdist * ydist);
+    }
+
+    accumulator.moments[0] += xx;
+    accumulator.moments[1] += yy;
+    accumulator.moments[2] += xy;
+    accumulator.count++;
+  }
+
+  void merge(AccumulatorType& total, const AccumulatorType& partial, [[maybe_unused]] size_t featureId) const
+  {
+    total.merge(partial);
+  }
+
+private:
+  const Float32AbstractDataStore& m_Centroids;
+  size_t m_XPoints = 0;
+  std::array<float, 2> m_ModRes;
+  FloatVec3 m_Origin;
+  float m_ScaleFactor = 1.0f;
+};
+
+/**
+ * @brief Scales the summed moments of every feature and computes the eigen values and vectors of its
+ * moment matrix along with the Omega3 value.
+ */
+class FeatureEigenSystemImpl
+{
+public:
+  FeatureEigenSystemImpl(std::vector<double>& featureMoments, std::vector<double>& featureEigenVals, std::vector<float>& efVec, Float32AbstractDataStore& volumes, Float32AbstractDataStore& omega3s,
+                         const FloatVec3& spacing, const FloatVec3& modRes)
+  : m_FeatureMoments(featureMoments)
+  , m_FeatureEigenVals(featureEigenVals)
+  , m_EFVec(efVec)
+  , m_Volumes(volumes)
+  , m_Omega3s(omega3s)
+  , m_Spacing(spacing)
+  , m_ModRes(modRes)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const float modXRes = m_ModRes[0];
+    const float modYRes = m_ModRes[1];
+    const float modZRes = m_ModRes[2];
+
+    double sphere = (2000.0 * M_PI * M_PI) / 9.0;
+    // constant for moments because voxels are broken into smaller voxels
+    double konst1 = static_cast<double>((modXRes / 2.0) * (modYRes / 2.0) * (modZRes / 2.0));
+    // constant for volumes because voxels are counted as one
+    double konst2 = static_cast<double>((m_Spacing[0]) * (m_Spacing[1]) * (m_Spacing[2]));
+    double konst3 = static_cast<double>((modXRes) * (modYRes) * (modZRes));
+    double o3 = 0.0, vol5 = 0.0, omega3 = 0.0;
+    float u200 = 0.0f;
+    float u020 = 0.0f;
+    float u002 = 0.0f;
+    float u110 = 0.0f;
+    float u011 = 0.0f;
+    float u101 = 0.0f;
+    for(size_t featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      // calculating the modified volume for the omega3 value
+      vol5 = m_Volumes[featureId] * konst3;
+      m_Volumes[featureId] = m_Volumes[featureId] * konst2;
+      m_FeatureMoments[featureId * 6 + 0] = m_FeatureMoments[featureId * 6 + 0] * konst1;
+      m_FeatureMoments[featureId * 6 + 1] = m_FeatureMoments[featureId * 6 + 1] * konst1;
+      m_FeatureMoments[featureId * 6 + 2] = m_FeatureMoments[featureId * 6 + 2] * konst1;
+      m_FeatureMoments[featureId * 6 + 3] = -m_FeatureMoments[featureId * 6 + 3] * konst1;
+      m_FeatureMoments[featureId * 6 + 4] = -m_FeatureMoments[featureId * 6 + 4] * konst1;
+      m_FeatureMoments[featureId * 6 + 5] = -m_FeatureMoments[featureId * 6 + 5] * konst1;
+
+      // Now store the 3x3 Matrix for the Eigen Value/Vectors
+      Eigen::Matrix3f moment;
+      // clang-format off
+      moment <<
+        m_FeatureMoments[featureId * 6 + 0], m_FeatureMoments[featureId * 6 + 3], m_FeatureMoments[featureId * 6 + 5],
+        m_FeatureMoments[featureId * 6 + 3], m_FeatureMoments[featureId * 6 + 1], m_FeatureMoments[featureId * 6 + 4],
+        m_FeatureMoments[featureId * 6 + 5], m_FeatureMoments[featureId * 6 + 4], m_FeatureMoments[featureId * 6 + 2];
+      // clang-format on
+      Eigen::EigenSolver<Eigen::Matrix3f> es(moment);
+      Eigen::EigenSolver<Eigen::Matrix3f>::EigenvalueType eigenValues = es.eigenvalues();
+      Eigen::EigenSolver<Eigen::Matrix3f>::EigenvectorsType eigenVectors = es.eigenvectors();
+
+      // Returns the argument order sorted high to low
+      std::array<size_t, 3> idxs = ::TripletSort(eigenValues[0].real(), eigenValues[1].real(), eigenValues[2].real(), false);
+      m_FeatureEigenVals[featureId * 3 + 0] = eigenValues[idxs[0]].real();
+      m_FeatureEigenVals[featureId * 3 + 1] = eigenValues[idxs[1]].real();
+      m_FeatureEigenVals[featureId * 3 + 2] = eigenValues[idxs[2]].real();
+
+      // EigenVector associated with the largest EigenValue goes in the 3rd column
+      auto col = eigenVectors.col(idxs[0]);
+      m_EFVec[featureId * 9 + 2] = col(0).real();
+      m_EFVec[featureId * 9 + 5] = col(1).real();
+      m_EFVec[featureId * 9 + 8] = col(2).real();
+
+      // Then the next largest into the 2nd column
+      col = eigenVectors.col(idxs[1]);
+      m_EFVec[featureId * 9 + 1] = col(0).real();
+      m_EFVec[featureId * 9 + 4] = col(1).real();
+      m_EFVec[featureId * 9 + 7] = col(2).real();
+
+      // The smallest into the 1rst column
+      col = eigenVectors.col(idxs[2]);
+      m_EFVec[featureId * 9 + 0] = col(0).real();
+      m_EFVec[featureId * 9 + 3] = col(1).real();
+      m_EFVec[featureId * 9 + 6] = col(2).real();
+
+      // Only for Omega3 below
+      u200 = static_cast<float>((m_FeatureMoments[featureId * 6 + 1] + m_FeatureMoments[featureId * 6 + 2] - m_FeatureMoments[featureId * 6 + 0]) / 2.0f);
+      u020 = static_cast<float>((m_FeatureMoments[featureId * 6 + 0] + m_FeatureMoments[featureId * 6 + 2] - m_FeatureMoments[featureId * 6 + 1]) / 2.0f);
+      u002 = static_cast<float>((m_FeatureMoments[featureId * 6 + 0] + m_FeatureMoments[featureId * 6 + 1] - m_FeatureMoments[featureId * 6 + 2]) / 2.0f);
+      u110 = static_cast<float>(-m_FeatureMoments[featureId * 6 + 3]);
+      u011 = static_cast<float>(-m_FeatureMoments[featureId * 6 + 4]);
+      u101 = static_cast<float>(-m_FeatureMoments[featureId * 6 + 5]);
+      o3 = static_cast<double>((u200 * u020 * u002) + (2.0f * u110 * u101 * u011) - (u200 * u011 * u011) - (u020 * u101 * u101) - (u002 * u110 * u110));
+      vol5 = pow(vol5, 5.0);
+      omega3 = vol5 / o3;
+      omega3 = omega3 / sphere;
+      if(omega3 > 1)
+      {
+        omega3 = 1.0;
+      }
+      if(vol5 == 0.0)
+      {
+        omega3 = 0.0;
+      }
+      m_Omega3s[featureId] = static_cast<float>(omega3);
+    }
+  }
+
+private:
+  std::vector<double>& m_FeatureMoments;
+  std::vector<double>& m_FeatureEigenVals;
+  std::vector<float>& m_EFVec;
+  Float32AbstractDataStore& m_Volumes;
+  Float32AbstractDataStore& m_Omega3s;
+  FloatVec3 m_Spacing;
+  FloatVec3 m_ModRes;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeShapes::ComputeShapes(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ComputeShapesInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -158,22 +431,13 @@ void ComputeShapes::find_moments()
 {
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
 
-  const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
-  const auto& centroids = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CentroidsArrayPath);
-  auto& volumes = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->VolumesArrayPath);
-  auto& omega3s = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->Omega3sArrayPath);
-
-  float u200 = 0.0f;
-  float u020 = 0.0f;
-  float u002 = 0.0f;
-  float u110 = 0.0f;
-  float u011 = 0.0f;
-  float u101 = 0.0f;
-  float xx = 0.0f, yy = 0.0f, zz = 0.0f, xy = 0.0f, xz = 0.0f, yz = 0.0f;
+  const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath).getDataStoreRef();
+  const auto& centroids = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CentroidsArrayPath).getDataStoreRef();
+  auto& volumes = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->VolumesArrayPath).getDataStoreRef();
+  auto& omega3s = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->Omega3sArrayPath).getDataStoreRef();
 
   size_t xPoints = imageGeom.getNumXCells();
   size_t yPoints = imageGeom.getNumYCells();
-  size_t zPoints = imageGeom.getNumZCells();
   FloatVec3 spacing = imageGeom.getSpacing();
   FloatVec3 origin = imageGeom.getOrigin();
 
@@ -185,156 +449,22 @@ void ComputeShapes::find_moments()
 
   size_t numfeatures = centroids.getNumberOfTuples();
 
-  float x = 0.0f, y = 0.0f, z = 0.0f, x1 = 0.0f, x2 = 0.0f, y1 = 0.0f, y2 = 0.0f, z1 = 0.0f, z2 = 0.0f;
-  float xdist1 = 0.0f, xdist2 = 0.0f, xdist3 = 0.0f, xdist4 = 0.0f, xdist5 = 0.0f, xdist6 = 0.0f, xdist7 = 0.0f, xdist8 = 0.0f;
-  float ydist1 = 0.0f, ydist2 = 0.0f, ydist3 = 0.0f, ydist4 = 0.0f, ydist5 = 0.0f, ydist6 = 0.0f, ydist7 = 0.0f, ydist8 = 0.0f;
-  float zdist1 = 0.0f, zdist2 = 0.0f, zdist3 = 0.0f, zdist4 = 0.0f, zdist5 = 0.0f, zdist6 = 0.0f, zdist7 = 0.0f, zdist8 = 0.0f;
-  size_t zStride = 0, yStride = 0;
-  for(size_t i = 0; i < zPoints; i++)
+  ParallelFeatureReduction featureReduction;
+  featureReduction.setRange(0, featureIds.getNumberOfTuples());
+  featureReduction.requireStoresInMemory({&featureIds, &centroids});
+  std::vector<MomentsAccumulator> featureMoments =
+      featureReduction.execute(featureIds, numfeatures, Moments3DReducer(centroids, xPoints, yPoints, {modXRes, modYRes, modZRes}, origin, static_cast<float>(m_ScaleFactor)));
+
+  for(size_t featureId = 0; featureId < numfeatures; featureId++)
   {
-    zStride = i * xPoints * yPoints;
-    for(size_t j = 0; j < yPoints; j++)
-    {
-      yStride = j * xPoints;
-      for(size_t k = 0; k < xPoints; k++)
-      {
-        int32_t gnum = featureIds[zStride + yStride + k];
-        x = float(k * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
-        y = float(j * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
-        z = float(i * modZRes) + (origin[2] * static_cast<float>(m_ScaleFactor));
-        x1 = x + (modXRes / 4.0f);
-        x2 = x - (modXRes / 4.0f);
-        y1 = y + (modYRes / 4.0f);
-        y2 = y - (modYRes / 4.0f);
-        z1 = z + (modZRes / 4.0f);
-        z2 = z - (modZRes / 4.0f);
-        xdist1 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist1 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist1 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist2 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist2 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist2 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist3 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist3 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist3 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist4 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist4 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist4 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist5 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist5 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist5 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist6 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist6 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist6 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist7 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist7 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist7 = (z1 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-        xdist8 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-        ydist8 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-        zdist8 = (z2 - (centroids[gnum * 3 + 2] * static_cast<float>(m_ScaleFactor)));
-
-        xx = ((ydist1) * (ydist1)) + ((zdist1) * (zdist1)) + ((ydist2) * (ydist2)) + ((zdist2) * (zdist2)) + ((ydist3) * (ydist3)) + ((zdist3) * (zdist3)) + ((ydist4) * (ydist4)) +
-             ((zdist4) * (zdist4)) + ((ydist5) * (ydist5)) + ((zdist5) * (zdist5)) + ((ydist6) * (ydist6)) + ((zdist6) * (zdist6)) + ((ydist7) * (ydist7)) + ((zdist7) * (zdist7)) +
-             ((ydist8) * (ydist8)) + ((zdist8) * (zdist8));
-        yy = ((xdist1) * (xdist1)) + ((zdist1) * (zdist1)) + ((xdist2) * (xdist2)) + ((zdist2) * (zdist2)) + ((xdist3) * (xdist3)) + ((zdist3) * (zdist3)) + ((xdist4) * (xdist4)) +
-             ((zdist4) * (zdist4)) + ((xdist5) * (xdist5)) + ((zdist5) * (zdist5)) + ((xdist6) * (xdist6)) + ((zdist6) * (zdist6)) + ((xdist7) * (xdist7)) + ((zdist7) * (zdist7)) +
-             ((xdist8) * (xdist8)) + ((zdist8) * (zdist8));
-        zz = ((xdist1) * (xdist1)) + ((ydist1) * (ydist1)) + ((xdist2) * (xdist2)) + ((ydist2) * (ydist2)) + ((xdist3) * (xdist3)) + ((ydist3) * (ydist3)) + ((xdist4) * (xdist4)) +
-             ((ydist4) * (ydist4)) + ((xdist5) * (xdist5)) + ((ydist5) * (ydist5)) + ((xdist6) * (xdist6)) + ((ydist6) * (ydist6)) + ((xdist7) * (xdist7)) + ((ydist7) * (ydist7)) +
-             ((xdist8) * (xdist8)) + ((ydist8) * (ydist8));
-        xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4)) + ((xdist5) * (ydist5)) + ((xdist6) * (ydist6)) + ((xdist7) * (ydist7)) +
-             ((xdist8) * (ydist8));
-        yz = ((ydist1) * (zdist1)) + ((ydist2) * (zdist2)) + ((ydist3) * (zdist3)) + ((ydist4) * (zdist4)) + ((ydist5) * (zdist5)) + ((ydist6) * (zdist6)) + ((ydist7) * (zdist7)) +
-             ((ydist8) * (zdist8));
-        xz = ((xdist1) * (zdist1)) + ((xdist2) * (zdist2)) + ((xdist3) * (zdist3)) + ((xdist4) * (zdist4)) + ((xdist5) * (zdist5)) + ((xdist6) * (zdist6)) + ((xdist7) * (zdist7)) +
-             ((xdist8) * (zdist8));
-
-        m_FeatureMoments[gnum * 6 + 0] = m_FeatureMoments[gnum * 6 + 0] + static_cast<double>(xx);
-        m_FeatureMoments[gnum * 6 + 1] = m_FeatureMoments[gnum * 6 + 1] + static_cast<double>(yy);
-        m_FeatureMoments[gnum * 6 + 2] = m_FeatureMoments[gnum * 6 + 2] + static_cast<double>(zz);
-        m_FeatureMoments[gnum * 6 + 3] = m_FeatureMoments[gnum * 6 + 3] + static_cast<double>(xy);
-        m_FeatureMoments[gnum * 6 + 4] = m_FeatureMoments[gnum * 6 + 4] + static_cast<double>(yz);
-        m_FeatureMoments[gnum * 6 + 5] = m_FeatureMoments[gnum * 6 + 5] + static_cast<double>(xz);
-        volumes[gnum] = volumes[gnum] + 1.0;
-      }
-    }
-  }
-  double sphere = (2000.0 * M_PI * M_PI) / 9.0;
-  // constant for moments because voxels are broken into smaller voxels
-  double konst1 = static_cast<double>((modXRes / 2.0) * (modYRes / 2.0) * (modZRes / 2.0));
-  // constant for volumes because voxels are counted as one
-  double konst2 = static_cast<double>((spacing[0]) * (spacing[1]) * (spacing[2]));
-  double konst3 = static_cast<double>((modXRes) * (modYRes) * (modZRes));
-  double o3 = 0.0, vol5 = 0.0, omega3 = 0.0;
-  for(size_t featureId = 1; featureId < numfeatures; featureId++)
-  {
-    // calculating the modified volume for the omega3 value
-    vol5 = volumes[featureId] * konst3;
-    volumes[featureId] = volumes[featureId] * konst2;
-    m_FeatureMoments[featureId * 6 + 0] = m_FeatureMoments[featureId * 6 + 0] * konst1;
-    m_FeatureMoments[featureId * 6 + 1] = m_FeatureMoments[featureId * 6 + 1] * konst1;
-    m_FeatureMoments[featureId * 6 + 2] = m_FeatureMoments[featureId * 6 + 2] * konst1;
-    m_FeatureMoments[featureId * 6 + 3] = -m_FeatureMoments[featureId * 6 + 3] * konst1;
-    m_FeatureMoments[featureId * 6 + 4] = -m_FeatureMoments[featureId * 6 + 4] * konst1;
-    m_FeatureMoments[featureId * 6 + 5] = -m_FeatureMoments[featureId * 6 + 5] * konst1;
-
-    // Now store the 3x3 Matrix for the Eigen Value/Vectors
-    Eigen::Matrix3f moment;
-    // clang-format off
-    moment <<
-      m_FeatureMoments[featureId * 6 + 0], m_FeatureMoments[featureId * 6 + 3], m_FeatureMoments[featureId * 6 + 5],
-      m_FeatureMoments[featureId * 6 + 3], m_FeatureMoments[featureId * 6 + 1], m_FeatureMoments[featureId * 6 + 4],
-      m_FeatureMoments[featureId * 6 + 5], m_FeatureMoments[featureId * 6 + 4], m_FeatureMoments[featureId * 6 + 2];
-    // clang-format on
-    Eigen::EigenSolver<Eigen::Matrix3f> es(moment);
-    Eigen::EigenSolver<Eigen::Matrix3f>::EigenvalueType eigenValues = es.eigenvalues();
-    Eigen::EigenSolver<Eigen::Matrix3f>::EigenvectorsType eigenVectors = es.eigenvectors();
-
-    // Returns the argument order sorted high to low
-    std::array<size_t, 3> idxs = ::TripletSort(eigenValues[0].real(), eigenValues[1].real(), eigenValues[2].real(), false);
-    m_FeatureEigenVals[featureId * 3 + 0] = eigenValues[idxs[0]].real();
-    m_FeatureEigenVals[featureId * 3 + 1] = eigenValues[idxs[1]].real();
-    m_FeatureEigenVals[featureId * 3 + 2] = eigenValues[idxs[2]].real();
-
-    // EigenVector associated with the largest EigenValue goes in the 3rd column
-    auto col = eigenVectors.col(idxs[0]);
-    m_EFVec[featureId * 9 + 2] = col(0).real();
-    m_EFVec[featureId * 9 + 5] = col(1).real();
-    m_EFVec[featureId * 9 + 8] = col(2).real();
-
-    // Then the next largest into the 2nd column
-    col = eigenVectors.col(idxs[1]);
-    m_EFVec[featureId * 9 + 1] = col(0).real();
-    m_EFVec[featureId * 9 + 4] = col(1).real();
-    m_EFVec[featureId * 9 + 7] = col(2).real();
-
-    // The smallest into the 1rst column
-    col = eigenVectors.col(idxs[2]);
-    m_EFVec[featureId * 9 + 0] = col(0).real();
-    m_EFVec[featureId * 9 + 3] = col(1).real();
-    m_EFVec[featureId * 9 + 6] = col(2).real();
-
-    // Only for Omega3 below
-    u200 = static_cast<float>((m_FeatureMoments[featureId * 6 + 1] + m_FeatureMoments[featureId * 6 + 2] - m_FeatureMoments[featureId * 6 + 0]) / 2.0f);
-    u020 = static_cast<float>((m_FeatureMoments[featureId * 6 + 0] + m_FeatureMoments[featureId * 6 + 2] - m_FeatureMoments[featureId * 6 + 1]) / 2.0f);
-    u002 = static_cast<float>((m_FeatureMoments[featureId * 6 + 0] + m_FeatureMoments[featureId * 6 + 1] - m_FeatureMoments[featureId * 6 + 2]) / 2.0f);
-    u110 = static_cast<float>(-m_FeatureMoments[featureId * 6 + 3]);
-    u011 = static_cast<float>(-m_FeatureMoments[featureId * 6 + 4]);
-    u101 = static_cast<float>(-m_FeatureMoments[featureId * 6 + 5]);
-    o3 = static_cast<double>((u200 * u020 * u002) + (2.0f * u110 * u101 * u011) - (u200 * u011 * u011) - (u020 * u101 * u101) - (u002 * u110 * u110));
-    vol5 = pow(vol5, 5.0);
-    omega3 = vol5 / o3;
-    omega3 = omega3 / sphere;
-    if(omega3 > 1)
-    {
-      omega3 = 1.0;
-    }
-    if(vol5 == 0.0)
-    {
-      omega3 = 0.0;
-    }
-    omega3s[featureId] = static_cast<float>(omega3);
+    std::copy(featureMoments[featureId].moments.begin(), featureMoments[featureId].moments.end(), m_FeatureMoments.begin() + featureId * 6);
+    volumes[featureId] = volumes[featureId] + static_cast<float>(featureMoments[featureId].count);
   }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, numfeatures);
+  dataAlg.requireStoresInMemory({&volumes, &omega3s});
+  dataAlg.execute(FeatureEigenSystemImpl(m_FeatureMoments, m_FeatureEigenVals, m_EFVec, volumes, omega3s, spacing, {modXRes, modYRes, modZRes}));
 }
 
 // -----------------------------------------------------------------------------
@@ -343,34 +473,30 @@ void ComputeShapes::find_moments()
 void ComputeShapes::find_moments2D()
 {
 
-  const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath);
-  const auto& centroids = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CentroidsArrayPath);
+  const auto& featureIds = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeatureIdsArrayPath).getDataStoreRef();
+  const auto& centroids = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CentroidsArrayPath).getDataStoreRef();
   auto& volumes = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->VolumesArrayPath);
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
 
-  float xx = 0.0f, yy = 0.0f, xy = 0.0f;
   size_t numfeatures = centroids.getNumberOfTuples();
 
-  size_t xPoints = 0, yPoints = 0;
+  size_t xPoints = 0;
   FloatVec3 spacing = imageGeom.getSpacing();
 
   if(imageGeom.getNumXCells() == 1)
   {
     xPoints = imageGeom.getNumYCells();
-    yPoints = imageGeom.getNumZCells();
     spacing = imageGeom.getSpacing();
   }
   if(imageGeom.getNumYCells() == 1)
   {
     xPoints = imageGeom.getNumXCells();
-    yPoints = imageGeom.getNumZCells();
     spacing = imageGeom.getSpacing();
   }
   if(imageGeom.getNumZCells() == 1)
   {
     xPoints = imageGeom.getNumXCells();
-    yPoints = imageGeom.getNumYCells();
     spacing = imageGeom.getSpacing();
   }
 
@@ -379,41 +505,18 @@ void ComputeShapes::find_moments2D()
 
   FloatVec3 origin = imageGeom.getOrigin();
 
-  for(size_t featureId = 0; featureId < 6 * numfeatures; featureId++)
-  {
-    m_FeatureMoments[featureId] = 0.0;
-  }
+  ParallelFeatureReduction featureReduction;
+  featureReduction.setRange(0, featureIds.getNumberOfTuples());
+  featureReduction.requireStoresInMemory({&featureIds, &centroids});
+  std::vector<MomentsAccumulator> featureMoments =
+      featureReduction.execute(featureIds, numfeatures, Moments2DReducer(centroids, xPoints, {modXRes, modYRes}, origin, static_cast<float>(m_ScaleFactor)));
 
-  size_t yStride = 0;
-  for(size_t yPoint = 0; yPoint < yPoints; yPoint++)
+  for(size_t featureId = 0; featureId < numfeatures; featureId++)
   {
-    yStride = yPoint * xPoints;
-    for(size_t xPoint = 0; xPoint < xPoints; xPoint++)
-    {
-      int32_t gnum = featureIds[yStride + xPoint];
-      float x = static_cast<float>(xPoint * modXRes) + (origin[0] * static_cast<float>(m_ScaleFactor));
-      float y = static_cast<float>(yPoint * modYRes) + (origin[1] * static_cast<float>(m_ScaleFactor));
-      float x1 = x + (modXRes / 4.0f);
-      float x2 = x - (modXRes / 4.0f);
-      float y1 = y + (modYRes / 4.0f);
-      float y2 = y - (modYRes / 4.0f);
-      float xdist1 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist1 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist2 = (x1 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist2 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist3 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist3 = (y1 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      float xdist4 = (x2 - (centroids[gnum * 3 + 0] * static_cast<float>(m_ScaleFactor)));
-      float ydist4 = (y2 - (centroids[gnum * 3 + 1] * static_cast<float>(m_ScaleFactor)));
-      xx = ((ydist1) * (ydist1)) + ((ydist2) * (ydist2)) + ((ydist3) * (ydist3)) + ((ydist4) * (ydist4));
-      yy = ((xdist1) * (xdist1)) + ((xdist2) * (xdist2)) + ((xdist3) * (xdist3)) + ((xdist4) * (xdist4));
-      xy = ((xdist1) * (ydist1)) + ((xdist2) * (ydist2)) + ((xdist3) * (ydist3)) + ((xdist4) * (ydist4));
-      m_FeatureMoments[gnum * 6 + 0] = m_FeatureMoments[gnum * 6 + 0] + xx;
-      m_FeatureMoments[gnum * 6 + 1] = m_FeatureMoments[gnum * 6 + 1] + yy;
-      m_FeatureMoments[gnum * 6 + 2] = m_FeatureMoments[gnum * 6 + 2] + xy;
-      volumes[gnum] = volumes[gnum] + 1.0;
-    }
+    std::copy(featureMoments[featureId].moments.begin(), featureMoments[featureId].moments.end(), m_FeatureMoments.begin() + featureId * 6);
+    volumes[featureId] = volumes[featureId] + static_cast<float>(featureMoments[featureId].count);
   }
+
   double konst1 = static_cast<double>((modXRes / 2.0f) * (modYRes / 2.0f));
   double konst2 = static_cast<double>(spacing[0] * spacing[1]);
   for(size_t featureId = 1; featureId < numfeatures; featureId++)
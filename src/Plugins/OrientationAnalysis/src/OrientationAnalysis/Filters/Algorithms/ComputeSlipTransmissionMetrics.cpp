@@ -2,13 +2,108 @@
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/NeighborList.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include "EbsdLib/Core/Quaternion.hpp"
 #include "EbsdLib/EbsdLibVersion.h"
 #include "EbsdLib/LaueOps/LaueOps.h"
 
+#include <atomic>
+
 using namespace nx::core;
 
+namespace
+{
+/**
+ * @brief The ComputeSlipTransmissionMetricsImpl class computes the slip transmission metrics between a range of
+ * features and each of their neighbors.
+ */
+class ComputeSlipTransmissionMetricsImpl
+{
+public:
+  ComputeSlipTransmissionMetricsImpl(const std::vector<LaueOps::Pointer>& orientationOps, const Float32AbstractDataStore& avgQuats, const Int32AbstractDataStore& featurePhases,
+                                     const UInt32AbstractDataStore& crystalStructures, const Int32NeighborList& neighborList, std::vector<std::vector<float32>>& f1Lists,
+                                     std::vector<std::vector<float32>>& f1sPtLists, std::vector<std::vector<float32>>& f7Lists, std::vector<std::vector<float32>>& mPrimeLists,
+                                     std::atomic_bool& emitLaueClassWarning)
+  : m_OrientationOps(orientationOps)
+  , m_AvgQuats(avgQuats)
+  , m_FeaturePhases(featurePhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_NeighborList(neighborList)
+  , m_F1Lists(f1Lists)
+  , m_F1sPtLists(f1sPtLists)
+  , m_F7Lists(f7Lists)
+  , m_MPrimeLists(mPrimeLists)
+  , m_EmitLaueClassWarning(emitLaueClassWarning)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    float64 LD[3] = {0.0, 0.0, 1.0};
+
+    int32 nName;
+    float32 mPrime, F1, F1sPt, F7;
+
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const Int32NeighborList::VectorType& featureNeighborList = m_NeighborList.getListReference(static_cast<int32>(i));
+      usize listLength = featureNeighborList.size();
+      m_F1Lists[i].assign(listLength, 0.0f);
+      m_F1sPtLists[i].assign(listLength, 0.0f);
+      m_F7Lists[i].assign(listLength, 0.0f);
+      m_MPrimeLists[i].assign(listLength, 0.0f);
+      QuatD q1(m_AvgQuats[i * 4], m_AvgQuats[i * 4 + 1], m_AvgQuats[i * 4 + 2], m_AvgQuats[i * 4 + 3]);
+      for(usize j = 0; j < listLength; j++)
+      {
+        nName = featureNeighborList[j];
+        QuatD q2(m_AvgQuats[nName * 4], m_AvgQuats[nName * 4 + 1], m_AvgQuats[nName * 4 + 2], m_AvgQuats[nName * 4 + 3]);
+
+        uint32 laueClassI = static_cast<uint32>(m_FeaturePhases[i]);
+        uint32 laueClassN = static_cast<uint32>(m_FeaturePhases[nName]);
+
+        if(laueClassI == laueClassN && laueClassN != 1)
+        {
+          m_EmitLaueClassWarning = true;
+        }
+        // Make sure we only run the algorithm on CubicOps: orientationOps[1];
+        if(m_CrystalStructures[laueClassI] == m_CrystalStructures[laueClassN] && m_FeaturePhases[i] > 0 && laueClassN == 1)
+        {
+          const LaueOps& orientationOps = *m_OrientationOps[m_CrystalStructures[m_FeaturePhases[i]]];
+          mPrime = static_cast<float32>(orientationOps.getmPrime(q1, q2, LD));
+          F1 = static_cast<float32>(orientationOps.getF1(q1, q2, LD, true));
+          F1sPt = static_cast<float32>(orientationOps.getF1spt(q1, q2, LD, true));
+          F7 = static_cast<float32>(orientationOps.getF7(q1, q2, LD, true));
+        }
+        else
+        {
+          mPrime = 0.0f;
+          F1 = 0.0f;
+          F1sPt = 0.0f;
+          F7 = 0.0f;
+        }
+        m_MPrimeLists[i][j] = mPrime;
+        m_F1Lists[i][j] = F1;
+        m_F1sPtLists[i][j] = F1sPt;
+        m_F7Lists[i][j] = F7;
+      }
+    }
+  }
+
+private:
+  const std::vector<LaueOps::Pointer>& m_OrientationOps;
+  const Float32AbstractDataStore& m_AvgQuats;
+  const Int32AbstractDataStore& m_FeaturePhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  const Int32NeighborList& m_NeighborList;
+  std::vector<std::vector<float32>>& m_F1Lists;
+  std::vector<std::vector<float32>>& m_F1sPtLists;
+  std::vector<std::vector<float32>>& m_F7Lists;
+  std::vector<std::vector<float32>>& m_MPrimeLists;
+  std::atomic_bool& m_EmitLaueClassWarning;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ComputeSlipTransmissionMetrics::ComputeSlipTransmissionMetrics(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
                                                                ComputeSlipTransmissionMetricsInputValues* inputValues)
@@ -33,67 +128,26 @@ Result<> ComputeSlipTransmissionMetrics::operator()()
 {
   auto orientationOps = LaueOps::GetAllOrientationOps();
 
-  auto& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
-  auto& featurePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
-  auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
+  const auto& avgQuats = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->AvgQuatsArrayPath);
+  const auto& featurePhases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->FeaturePhasesArrayPath);
+  const auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CrystalStructuresArrayPath);
 
   usize totalFeatures = featurePhases.getNumberOfTuples();
 
-  auto& neighborList = m_DataStructure.getDataRefAs<Int32NeighborList>(m_InputValues->NeighborListArrayPath);
+  const auto& neighborList = m_DataStructure.getDataRefAs<Int32NeighborList>(m_InputValues->NeighborListArrayPath);
 
   std::vector<std::vector<float32>> F1Lists(totalFeatures);
   std::vector<std::vector<float32>> F1sPtLists(totalFeatures);
   std::vector<std::vector<float32>> F7Lists(totalFeatures);
   std::vector<std::vector<float32>> mPrimeLists(totalFeatures);
 
-  float64 LD[3] = {0.0, 0.0, 1.0};
+  std::atomic_bool emitLaueClassWarning = false;
 
-  int32 nName;
-  float32 mPrime, F1, F1sPt, F7;
-
-  bool emitLaueClassWarning = false;
-
-  for(usize i = 1; i < totalFeatures; i++)
-  {
-    usize listLength = neighborList[i].size();
-    F1Lists[i].assign(listLength, 0.0f);
-    F1sPtLists[i].assign(listLength, 0.0f);
-    F7Lists[i].assign(listLength, 0.0f);
-    mPrimeLists[i].assign(listLength, 0.0f);
-    for(usize j = 0; j < listLength; j++)
-    {
-      nName = neighborList[i][j];
-      QuatD q1(avgQuats[i * 4], avgQuats[i * 4 + 1], avgQuats[i * 4 + 2], avgQuats[i * 4 + 3]);
-      QuatD q2(avgQuats[nName * 4], avgQuats[nName * 4 + 1], avgQuats[nName * 4 + 2], avgQuats[nName * 4 + 3]);
-
-      uint32 laueClassI = static_cast<uint32>(featurePhases[i]);
-      uint32 laueClassN = static_cast<uint32>(featurePhases[nName]);
-
-      if(laueClassI == laueClassN && laueClassN != 1)
-      {
-        emitLaueClassWarning = true;
-      }
-      // Make sure we only run the algorithm on CubicOps: orientationOps[1];
-      if(crystalStructures[laueClassI] == crystalStructures[laueClassN] && featurePhases[i] > 0 && laueClassN == 1)
-      {
-        mPrime = static_cast<float32>(orientationOps[crystalStructures[featurePhases[i]]]->getmPrime(q1, q2, LD));
-        F1 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[i]]]->getF1(q1, q2, LD, true));
-        F1sPt = static_cast<float32>(orientationOps[crystalStructures[featurePhases[i]]]->getF1spt(q1, q2, LD, true));
-        F7 = static_cast<float32>(orientationOps[crystalStructures[featurePhases[i]]]->getF7(q1, q2, LD, true));
-      }
-      else
-      {
-        mPrime = 0.0f;
-        F1 = 0.0f;
-        F1sPt = 0.0f;
-        F7 = 0.0f;
-      }
-      mPrimeLists[i][j] = mPrime;
-      F1Lists[i][j] = F1;
-      F1sPtLists[i][j] = F1sPt;
-      F7Lists[i][j] = F7;
-    }
-  }
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(1, totalFeatures);
+  dataAlg.requireArraysInMemory({&avgQuats, &featurePhases});
+  dataAlg.execute(ComputeSlipTransmissionMetricsImpl(orientationOps, avgQuats.getDataStoreRef(), featurePhases.getDataStoreRef(), crystalStructures.getDataStoreRef(), neighborList, F1Lists,
+                                                     F1sPtLists, F7Lists, mPrimeLists, emitLaueClassWarning));
 
   auto& F1L = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F1ListArrayName);
   auto& F1sptL = m_DataStructure.getDataRefAs<Float32NeighborList>(m_InputValues->F1sptListArrayName);
@@ -102,16 +156,16 @@ Result<> ComputeSlipTransmissionMetrics::operator()()
 
   for(usize i = 1; i < totalFeatures; i++)
   {
-    Float32NeighborList::SharedVectorType f1L(new std::vector<float32>(F1Lists[i]));
+    Float32NeighborList::SharedVectorType f1L(new std::vector<float32>(std::move(F1Lists[i])));
     F1L.setList(static_cast<int32>(i), f1L);
 
-    Float32NeighborList::SharedVectorType f1sptL(new std::vector<float32>(F1sPtLists[i]));
+    Float32NeighborList::SharedVectorType f1sptL(new std::vector<float32>(std::move(F1sPtLists[i])));
     F1sptL.setList(static_cast<int32>(i), f1sptL);
 
-    Float32NeighborList::SharedVectorType f7L(new std::vector<float32>(F7Lists[i]));
+    Float32NeighborList::SharedVectorType f7L(new std::vector<float32>(std::move(F7Lists[i])));
     F7L.setList(static_cast<int32>(i), f7L);
 
-    Float32NeighborList::SharedVectorType primeL(new std::vector<float32>(mPrimeLists[i]));
+    Float32NeighborList::SharedVectorType primeL(new std::vector<float32>(std::move(mPrimeLists[i])));
     mPrimeL.setList(static_cast<int32>(i), primeL);
   }
 
@@ -7,6 +7,12 @@
 
 using namespace nx::core;
 
+namespace
+{
+// Radians added to the misorientation tolerance when the engine angle is used to skip pairs that are clearly apart
+constexpr float64 k_AnglePrefilterSlack = 1.0e-4;
+} // namespace
+
 // -----------------------------------------------------------------------------
 EBSDSegmentFeatures::EBSDSegmentFeatures(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, EBSDSegmentFeaturesInputValues* inputValues)
 : SegmentFeatures(dataStructure, shouldCancel, mesgHandler)
@@ -119,10 +125,11 @@ bool EBSDSegmentFeatures::determineGrouping(int64 referencePoint, int64 neighbor
   int32_t phase1 = (*m_CrystalStructures)[(*cellPhases)[referencePoint]];
   int32_t phase2 = (*m_CrystalStructures)[(*cellPhases)[neighborPoint]];
   // If either of the phases is 999 then we bail out now.
-  if(phase1 >= m_OrientationOps.size() || phase2 >= m_OrientationOps.size())
+  if(static_cast<usize>(phase1) >= m_MisorientationEngine.getNumberOfLaueClasses() || static_cast<usize>(phase2) >= m_MisorientationEngine.getNumberOfLaueClasses())
   {
     return group;
   }
+  const Float32AbstractDataStore& currentQuats = m_QuatsArray->getDataStoreRef();
   Float32Array& currentQuatPtr = *m_QuatsArray;
   Int32Array& featureIds = *m_FeatureIdsArray;
 
@@ -134,19 +141,20 @@ bool EBSDSegmentFeatures::determineGrouping(int64 referencePoint, int64 neighbor
 
   if(featureIds[neighborPoint] == 0 && (m_GoodVoxelsArray == nullptr || neighborPointIsGood))
   {
-    float w = std::numeric_limits<float>::max();
-    QuatF q1(currentQuatPtr[referencePoint * 4], currentQuatPtr[referencePoint * 4 + 1], currentQuatPtr[referencePoint * 4 + 2], currentQuatPtr[referencePoint * 4 + 3]);
-    QuatF q2(currentQuatPtr[neighborPoint * 4 + 0], currentQuatPtr[neighborPoint * 4 + 1], currentQuatPtr[neighborPoint * 4 + 2], currentQuatPtr[neighborPoint * 4 + 3]);
-
-    if((*cellPhases)[referencePoint] == (*cellPhases)[neighborPoint])
+    // The engine only skips pairs that are clearly above the tolerance. It can differ from the LaueOps angle in the
+    // last bits, so the grouping itself is decided on the LaueOps angle to keep pairs at the tolerance unchanged.
+    if((*cellPhases)[referencePoint] == (*cellPhases)[neighborPoint] &&
+       m_MisorientationEngine.isBelowTolerance(phase1, currentQuats, referencePoint, neighborPoint, m_InputValues->MisorientationTolerance + k_AnglePrefilterSlack))
     {
-      OrientationF axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      w = axisAngle[3];
-    }
-    if(w < m_InputValues->MisorientationTolerance)
-    {
-      group = true;
-      featureIds[neighborPoint] = gnum;
+      QuatF q1(currentQuatPtr[referencePoint * 4], currentQuatPtr[referencePoint * 4 + 1], currentQuatPtr[referencePoint * 4 + 2], currentQuatPtr[referencePoint * 4 + 3]);
+      QuatF q2(currentQuatPtr[neighborPoint * 4 + 0], currentQuatPtr[neighborPoint * 4 + 1], currentQuatPtr[neighborPoint * 4 + 2], currentQuatPtr[neighborPoint * 4 + 3]);
+      OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+      const auto w = static_cast<float32>(axisAngle[3]);
+      if(w < m_InputValues->MisorientationTolerance)
+      {
+        group = true;
+        featureIds[neighborPoint] = gnum;
+      }
     }
   }
 
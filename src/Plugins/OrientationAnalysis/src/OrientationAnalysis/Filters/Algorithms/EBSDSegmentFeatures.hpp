@@ -1,6 +1,7 @@
 #pragma once
 
 #include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
 
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataPath.hpp"
@@ -85,6 +86,7 @@ private:
   FeatureIdsArrayType* m_FeatureIdsArray = nullptr;
 
   std::vector<LaueOps::Pointer> m_OrientationOps;
+  MisorientationEngine m_MisorientationEngine;
 };
 
 } // namespace nx::core
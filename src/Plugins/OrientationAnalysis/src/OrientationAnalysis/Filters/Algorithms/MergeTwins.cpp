@@ -13,6 +13,12 @@
 
 using namespace nx::core;
 
+namespace
+{
+// Degrees added to the angle tolerance when the engine angle is used to skip pairs that are not near 60 degrees
+constexpr float64 k_AnglePrefilterSlack = 0.01;
+} // namespace
+
 // -----------------------------------------------------------------------------
 MergeTwins::MergeTwins(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, MergeTwinsInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -81,20 +87,26 @@ bool MergeTwins::determineGrouping(int32 referenceFeature, int32 neighborFeature
   {
     uint32 phase1 = crystalStructures[phases[referenceFeature]];
 
-    QuatF q1(avgQuats[referenceFeature * 4], avgQuats[referenceFeature * 4 + 1], avgQuats[referenceFeature * 4 + 2], avgQuats[referenceFeature * 4 + 3]);
-    QuatF q2(avgQuats[neighborFeature * 4], avgQuats[neighborFeature * 4 + 1], avgQuats[neighborFeature * 4 + 2], avgQuats[neighborFeature * 4 + 3]);
-
     uint32 phase2 = crystalStructures[phases[neighborFeature]];
     if(phase1 == phase2 && (phase1 == EbsdLib::CrystalStructure::Cubic_High))
     {
-      OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
-      double w = axisAngle[3];
-      w *= (180.0f / numbers::pi);
-      double axisDiff111 = std::acos(std::fabs(axisAngle[0]) * 0.57735f + std::fabs(axisAngle[1]) * 0.57735f + fabs(axisAngle[2]) * 0.57735f);
-      double angDiff60 = std::fabs(w - 60.0f);
-      if(axisDiff111 < axisToleranceRad && angDiff60 < m_InputValues->AngleTolerance)
+      // Only pairs whose misorientation angle is close to 60 degrees need the misorientation axis. The engine angle
+      // is only used to skip the other pairs: it can differ from the LaueOps angle in the last bits, so the filter is
+      // widened by k_AnglePrefilterSlack and the twin test itself is the same one on the LaueOps angle and axis.
+      const float64 engineAngle = m_MisorientationEngine.calculateAngle(phase1, avgQuats, referenceFeature, neighborFeature) * (180.0f / numbers::pi);
+      if(std::fabs(engineAngle - 60.0f) < m_InputValues->AngleTolerance + k_AnglePrefilterSlack)
       {
-        twin = true;
+        QuatF q1(avgQuats[referenceFeature * 4], avgQuats[referenceFeature * 4 + 1], avgQuats[referenceFeature * 4 + 2], avgQuats[referenceFeature * 4 + 3]);
+        QuatF q2(avgQuats[neighborFeature * 4], avgQuats[neighborFeature * 4 + 1], avgQuats[neighborFeature * 4 + 2], avgQuats[neighborFeature * 4 + 3]);
+        OrientationD axisAngle = m_OrientationOps[phase1]->calculateMisorientation(q1, q2);
+        double w = axisAngle[3];
+        w *= (180.0f / numbers::pi);
+        double axisDiff111 = std::acos(std::fabs(axisAngle[0]) * 0.57735f + std::fabs(axisAngle[1]) * 0.57735f + fabs(axisAngle[2]) * 0.57735f);
+        double angDiff60 = std::fabs(w - 60.0f);
+        if(axisDiff111 < axisToleranceRad && angDiff60 < m_InputValues->AngleTolerance)
+        {
+          twin = true;
+        }
       }
       if(twin)
       {
@@ -5,14 +5,47 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Utilities/Math/MatrixMath.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdTextReader.hpp"
+
 #include "EbsdLib/Core/Orientation.hpp"
 
 using namespace nx::core;
 
 using FloatVec3Type = std::vector<float>;
 
+namespace
+{
+/**
+ * @brief The CorrectPhasesImpl class replaces phase values less than 1 with 1 because
+ * TSL writes a phase of zero for single phase scans.
+ */
+class CorrectPhasesImpl
+{
+public:
+  explicit CorrectPhasesImpl(Int32AbstractDataStore& cellPhases)
+  : m_CellPhases(cellPhases)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_CellPhases.getValue(i) < 1)
+      {
+        m_CellPhases.setValue(i, 1);
+      }
+    }
+  }
+
+private:
+  Int32AbstractDataStore& m_CellPhases;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ReadAngData::ReadAngData(DataStructure& dataStructure, const IFilter::MessageHandler& msgHandler, const std::atomic_bool& shouldCancel, ReadAngDataInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -30,7 +63,7 @@ Result<> ReadAngData::operator()()
 {
   AngReader reader;
   reader.setFileName(m_InputValues->InputFile.string());
-  const int32_t err = reader.readFile();
+  const int32_t err = reader.readHeaderOnly();
   if(err < 0)
   {
     return MakeErrorResult(reader.getErrorCode(), reader.getErrorMessage());
@@ -42,9 +75,7 @@ Result<> ReadAngData::operator()()
     return MakeErrorResult(result.first, result.second);
   }
 
-  copyRawEbsdData(&reader);
-
-  return {};
+  return readRawEbsdData();
 }
 
 // -----------------------------------------------------------------------------
@@ -96,82 +127,55 @@ std::pair<int32, std::string> ReadAngData::loadMaterialInfo(AngReader* reader) c
 }
 
 // -----------------------------------------------------------------------------
-void ReadAngData::copyRawEbsdData(AngReader* reader) const
+Result<> ReadAngData::readRawEbsdData() const
 {
-  const DataPath CellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
-
-  std::vector<size_t> cDims = {1};
+  const DataPath cellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->DataContainerName);
-  const size_t totalCells = imageGeom.getNumberOfCells();
-
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total Cells being read from the file.
-  std::vector<size_t> tDims = {imageGeom.getNumXCells(), imageGeom.getNumYCells(), imageGeom.getNumZCells()};
-
-  // Adjust the values of the 'phase' data to correct for invalid values and assign the read Phase Data into the actual DataArray
+  const usize totalCells = imageGeom.getNumberOfCells();
+
+  auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases)).getDataStoreRef();
+  auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles)).getDataStoreRef();
+  auto getFloatStore = [this, &cellAttributeMatrixPath](const std::string& name) {
+    return &m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(name)).getDataStoreRef();
+  };
+
+  // The data section of an .ang file is always laid out as: phi1 PHI phi2 x y IQ CI Phase SEM Fit.
+  // The three Euler angle columns are written directly into the interleaved 1x3 Euler array.
+  const std::vector<EbsdTextReader::ColumnTarget> columns = {
+      {&cellEulerAngles, nullptr, 0},
+      {&cellEulerAngles, nullptr, 1},
+      {&cellEulerAngles, nullptr, 2},
+      {getFloatStore(EbsdLib::Ang::XPosition), nullptr, 0},
+      {getFloatStore(EbsdLib::Ang::YPosition), nullptr, 0},
+      {getFloatStore(EbsdLib::Ang::ImageQuality), nullptr, 0},
+      {getFloatStore(EbsdLib::Ang::ConfidenceIndex), nullptr, 0},
+      {nullptr, &cellPhases, 0},
+      {getFloatStore(EbsdLib::Ang::SEMSignal), nullptr, 0},
+      {getFloatStore(EbsdLib::Ang::Fit), nullptr, 0},
+  };
+
+  auto offsetResult = EbsdTextReader::FindDataSectionOffset(m_InputValues->InputFile, [](std::string_view line) {
+    const usize first = line.find_first_not_of(" \t");
+    return first == std::string_view::npos || line[first] == '#';
+  });
+  if(offsetResult.invalid())
   {
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::Phases));
-    int* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ang::PhaseData));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      if(phasePtr[i] < 1)
-      {
-        phasePtr[i] = 1;
-      }
-      targetArray[i] = phasePtr[i];
-    }
+    return ConvertResult(std::move(offsetResult));
   }
 
-  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
+  m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Reading {} data points...", totalCells)});
+  Result<> readResult = EbsdTextReader::ReadDataSection(m_InputValues->InputFile, offsetResult.value(), totalCells, columns, m_ShouldCancel);
+  if(readResult.invalid())
   {
-    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi1));
-    const auto* fComp1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi));
-    const auto* fComp2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Phi2));
-    cDims[0] = 3;
-
-    auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::AngFile::EulerAngles));
-    for(size_t i = 0; i < totalCells; i++)
-    {
-      cellEulerAngles[3 * i] = fComp0[i];
-      cellEulerAngles[3 * i + 1] = fComp1[i];
-      cellEulerAngles[3 * i + 2] = fComp2[i];
-    }
+    return readResult;
   }
 
-  cDims[0] = 1;
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ImageQuality));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ImageQuality));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  // Adjust the values of the 'phase' data to correct for invalid values
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalCells);
+  dataAlg.requireStoresInMemory({&cellPhases});
+  dataAlg.execute(CorrectPhasesImpl(cellPhases));
 
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::ConfidenceIndex));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::ConfidenceIndex));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::SEMSignal));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::SEMSignal));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::Fit));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::Fit));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::XPosition));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::XPosition));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ang::YPosition));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(CellAttributeMatrixPath.createChildPath(EbsdLib::Ang::YPosition));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  return {};
 }
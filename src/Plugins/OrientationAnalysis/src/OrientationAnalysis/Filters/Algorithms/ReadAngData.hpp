@@ -82,10 +82,10 @@ private:
   std::pair<int32, std::string> loadMaterialInfo(AngReader* reader) const;
 
   /**
-   * @brief
-   * @param reader
+   * @brief Parses the data section of the .ang file directly into the cell arrays.
+   * @return
    */
-  void copyRawEbsdData(AngReader* reader) const;
+  Result<> readRawEbsdData() const;
 };
 
 } // namespace nx::core
@@ -3,14 +3,70 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/StringUtilities.hpp"
+
+#include "OrientationAnalysis/utilities/EbsdTextReader.hpp"
 
 #include "EbsdLib/IO/HKL/CtfConstants.h"
 #include "EbsdLib/Math/EbsdLibMath.h"
 
+#include <set>
+
 using namespace nx::core;
 
 using FloatVec3Type = std::vector<float>;
 
+namespace
+{
+/**
+ * @brief The CorrectEulerAnglesImpl class applies the optional hexagonal alignment correction and
+ * the degrees to radians conversion to the Euler angles after they have been read.
+ */
+class CorrectEulerAnglesImpl
+{
+public:
+  CorrectEulerAnglesImpl(const Int32AbstractDataStore& cellPhases, const UInt32AbstractDataStore& crystalStructures, Float32AbstractDataStore& cellEulerAngles, bool hexagonalAlignment,
+                         bool degreesToRadians)
+  : m_CellPhases(cellPhases)
+  , m_CrystalStructures(crystalStructures)
+  , m_CellEulerAngles(cellEulerAngles)
+  , m_HexagonalAlignment(hexagonalAlignment)
+  , m_DegreesToRadians(degreesToRadians)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      std::array<float32, 3> euler = {m_CellEulerAngles.getValue(3 * i), m_CellEulerAngles.getValue(3 * i + 1), m_CellEulerAngles.getValue(3 * i + 2)};
+      if(m_HexagonalAlignment && m_CrystalStructures.getValue(m_CellPhases.getValue(i)) == EbsdLib::CrystalStructure::Hexagonal_High)
+      {
+        euler[2] = euler[2] + 30.0F; // See the documentation for this correction factor
+      }
+      // Now convert to radians if requested by the user
+      if(m_DegreesToRadians)
+      {
+        euler[0] = euler[0] * EbsdLib::Constants::k_PiOver180F;
+        euler[1] = euler[1] * EbsdLib::Constants::k_PiOver180F;
+        euler[2] = euler[2] * EbsdLib::Constants::k_PiOver180F;
+      }
+      m_CellEulerAngles.setValue(3 * i, euler[0]);
+      m_CellEulerAngles.setValue(3 * i + 1, euler[1]);
+      m_CellEulerAngles.setValue(3 * i + 2, euler[2]);
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_CellPhases;
+  const UInt32AbstractDataStore& m_CrystalStructures;
+  Float32AbstractDataStore& m_CellEulerAngles;
+  bool m_HexagonalAlignment = false;
+  bool m_DegreesToRadians = false;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ReadCtfData::ReadCtfData(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ReadCtfDataInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -34,7 +90,7 @@ Result<> ReadCtfData::operator()()
 {
   CtfReader reader;
   reader.setFileName(m_InputValues->InputFile.string());
-  const int32_t err = reader.readFile();
+  const int32_t err = reader.readHeaderOnly();
   if(err < 0)
   {
     return MakeErrorResult(reader.getErrorCode(), reader.getErrorMessage());
@@ -46,9 +102,7 @@ Result<> ReadCtfData::operator()()
     return MakeErrorResult(result.first, result.second);
   }
 
-  copyRawEbsdData(&reader);
-
-  return {};
+  return readRawEbsdData();
 }
 
 // -----------------------------------------------------------------------------
@@ -97,98 +151,79 @@ std::pair<int32, std::string> ReadCtfData::loadMaterialInfo(CtfReader* reader) c
 }
 
 // -----------------------------------------------------------------------------
-void ReadCtfData::copyRawEbsdData(CtfReader* reader) const
+Result<> ReadCtfData::readRawEbsdData() const
 {
   const DataPath cellAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellAttributeMatrixName);
   const DataPath cellEnsembleAttributeMatrixPath = m_InputValues->DataContainerName.createChildPath(m_InputValues->CellEnsembleAttributeMatrixName);
-  std::vector<size_t> cDims = {1};
 
   const auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->DataContainerName);
-  const size_t totalCells = imageGeom.getNumberOfCells();
-
-  // Prepare the Cell Attribute Matrix with the correct number of tuples based on the total Cells being read from the file.
-  std::vector<size_t> tDims = {imageGeom.getNumXCells(), imageGeom.getNumYCells(), imageGeom.getNumZCells()};
+  const usize totalCells = imageGeom.getNumberOfCells();
 
-  // Copy the Phase Array
-  {
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases));
-    int* phasePtr = reinterpret_cast<int32_t*>(reader->getPointerByName(EbsdLib::Ctf::Phase));
-    for(size_t i = 0; i < totalCells; i++)
+  // The last header line names the columns of the data section
+  const std::array<char, 2> delimiters = {' ', '\t'};
+  std::vector<std::string> columnNames;
+  auto offsetResult = EbsdTextReader::FindDataSectionOffset(m_InputValues->InputFile, [&columnNames, &delimiters](std::string_view line) {
+    if(!columnNames.empty())
     {
-      targetArray[i] = phasePtr[i];
+      return false;
     }
-  }
-
-  // Condense the Euler Angles from 3 separate arrays into a single 1x3 array
-  {
-    auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::CrystalStructures));
-    auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases));
-
-    const auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler1));
-    const auto* fComp1 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler2));
-    const auto* fComp2 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Euler3));
-    cDims[0] = 3;
-
-    auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::EulerAngles));
-    for(size_t i = 0; i < totalCells; i++)
+    std::vector<std::string> tokens = StringUtilities::split(line, delimiters, false);
+    if(!tokens.empty() && tokens[0] == EbsdLib::Ctf::Phase)
     {
-      cellEulerAngles[3 * i] = fComp0[i];
-      cellEulerAngles[3 * i + 1] = fComp1[i];
-      cellEulerAngles[3 * i + 2] = fComp2[i];
-      if(crystalStructures[cellPhases[i]] == EbsdLib::CrystalStructure::Hexagonal_High && m_InputValues->EdaxHexagonalAlignment)
-      {
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] + 30.0F; // See the documentation for this correction factor
-      }
-      // Now convert to radians if requested by the user
-      if(m_InputValues->DegreesToRadians)
-      {
-        cellEulerAngles[3 * i] = cellEulerAngles[3 * i] * EbsdLib::Constants::k_PiOver180F;
-        cellEulerAngles[3 * i + 1] = cellEulerAngles[3 * i + 1] * EbsdLib::Constants::k_PiOver180F;
-        cellEulerAngles[3 * i + 2] = cellEulerAngles[3 * i + 2] * EbsdLib::Constants::k_PiOver180F;
-      }
+      columnNames = std::move(tokens);
     }
-  }
-
-  cDims[0] = 1;
+    return true;
+  });
+  if(offsetResult.invalid())
   {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::Bands));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Bands));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    return ConvertResult(std::move(offsetResult));
   }
 
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::Error));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Error));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  auto& cellPhases = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::Phases)).getDataStoreRef();
+  auto& cellEulerAngles = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::EulerAngles)).getDataStoreRef();
+  auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(cellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::CtfFile::CrystalStructures)).getDataStoreRef();
 
+  // Map each named column onto its destination. The three Euler angle columns are written
+  // directly into the interleaved 1x3 Euler array and unknown columns are skipped.
+  const std::set<std::string> int32Columns = {EbsdLib::Ctf::Bands, EbsdLib::Ctf::Error, EbsdLib::Ctf::BC, EbsdLib::Ctf::BS};
+  const std::set<std::string> float32Columns = {EbsdLib::Ctf::X, EbsdLib::Ctf::Y, EbsdLib::Ctf::MAD};
+  std::vector<EbsdTextReader::ColumnTarget> columns(columnNames.size());
+  for(usize i = 0; i < columnNames.size(); i++)
   {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::MAD));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::MAD));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
-
-  {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::BC));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BC));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    const std::string& name = columnNames[i];
+    if(name == EbsdLib::Ctf::Phase)
+    {
+      columns[i].Int32Store = &cellPhases;
+    }
+    else if(name == EbsdLib::Ctf::Euler1 || name == EbsdLib::Ctf::Euler2 || name == EbsdLib::Ctf::Euler3)
+    {
+      columns[i].Float32Store = &cellEulerAngles;
+      columns[i].Component = name == EbsdLib::Ctf::Euler1 ? 0 : (name == EbsdLib::Ctf::Euler2 ? 1 : 2);
+    }
+    else if(int32Columns.count(name) != 0)
+    {
+      columns[i].Int32Store = &m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(name)).getDataStoreRef();
+    }
+    else if(float32Columns.count(name) != 0)
+    {
+      columns[i].Float32Store = &m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(name)).getDataStoreRef();
+    }
   }
 
+  m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Reading {} data points...", totalCells)});
+  Result<> readResult = EbsdTextReader::ReadDataSection(m_InputValues->InputFile, offsetResult.value(), totalCells, columns, m_ShouldCancel);
+  if(readResult.invalid())
   {
-    auto* fComp0 = reinterpret_cast<int32*>(reader->getPointerByName(EbsdLib::Ctf::BS));
-    auto& targetArray = m_DataStructure.getDataRefAs<Int32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::BS));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    return readResult;
   }
 
+  if(m_InputValues->EdaxHexagonalAlignment || m_InputValues->DegreesToRadians)
   {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::X));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::X));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalCells);
+    dataAlg.requireStoresInMemory({&cellPhases, &cellEulerAngles, &crystalStructures});
+    dataAlg.execute(CorrectEulerAnglesImpl(cellPhases, crystalStructures, cellEulerAngles, m_InputValues->EdaxHexagonalAlignment, m_InputValues->DegreesToRadians));
   }
 
-  {
-    auto* fComp0 = reinterpret_cast<float*>(reader->getPointerByName(EbsdLib::Ctf::Y));
-    auto& targetArray = m_DataStructure.getDataRefAs<Float32Array>(cellAttributeMatrixPath.createChildPath(EbsdLib::Ctf::Y));
-    std::copy(fComp0, fComp0 + totalCells, targetArray.begin());
-  }
+  return {};
 }
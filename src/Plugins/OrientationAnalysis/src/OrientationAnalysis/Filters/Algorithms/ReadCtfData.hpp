@@ -87,10 +87,10 @@ private:
   std::pair<int32, std::string> loadMaterialInfo(CtfReader* reader) const;
 
   /**
-   * @brief
-   * @param reader
+   * @brief Parses the data section of the .ctf file directly into the cell arrays.
+   * @return
    */
-  void copyRawEbsdData(CtfReader* reader) const;
+  Result<> readRawEbsdData() const;
 };
 
 } // namespace nx::core
@@ -1,6 +1,7 @@
 #include "ReadH5Ebsd.hpp"
 
 #include "OrientationAnalysis/Filters/RotateEulerRefFrameFilter.hpp"
+#include "OrientationAnalysis/utilities/EbsdImportUtilities.hpp"
 
 #include "simplnx/Common/Numbers.hpp"
 #include "simplnx/Common/StringLiteral.hpp"
@@ -106,23 +107,25 @@ nx::core::Result<> LoadInfo(const nx::core::ReadH5EbsdInputValues* mInputValues,
 }
 
 template <typename H5EbsdReaderType, typename T>
-void CopyData(nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdReader, const std::vector<std::string>& arrayNames, std::set<std::string> selectedArrayNames,
-              const nx::core::DataPath& cellAttributeMatrixPath, size_t totalPoints)
+nx::core::Result<> CopyData(nx::core::DataStructure& dataStructure, H5EbsdReaderType* ebsdReader, const std::vector<std::string>& arrayNames, std::set<std::string> selectedArrayNames,
+                            const nx::core::DataPath& cellAttributeMatrixPath, size_t totalPoints)
 {
   using DataArrayType = nx::core::DataArray<T>;
   for(const auto& arrayName : arrayNames)
   {
     if(selectedArrayNames.find(arrayName) != selectedArrayNames.end())
     {
-      T* source = reinterpret_cast<T*>(ebsdReader->getPointerByName(arrayName));
+      const T* source = reinterpret_cast<T*>(ebsdReader->getPointerByName(arrayName));
       nx::core::DataPath dataPath = cellAttributeMatrixPath.createChildPath(arrayName); // get the data from the DataStructure
-      auto& destination = dataStructure.getDataRefAs<DataArrayType>(dataPath);
-      for(size_t tupleIndex = 0; tupleIndex < totalPoints; tupleIndex++)
+      auto& destination = dataStructure.getDataRefAs<DataArrayType>(dataPath).getDataStoreRef();
+      nx::core::Result<> result = nx::core::EbsdImportUtilities::CopyBuffer(source, destination, 0, totalPoints);
+      if(result.invalid())
       {
-        destination[tupleIndex] = source[tupleIndex];
+        return result;
       }
     }
   }
+  return {};
 }
 
 /**
@@ -193,56 +196,57 @@ nx::core::Result<> LoadEbsdData(const nx::core::ReadH5EbsdInputValues* mInputVal
   auto& xtalData = dataStructure.getDataRefAs<nx::core::UInt32Array>(xtalDataPath);
 
   // Copy the Phase Values from the EBSDReader to the DataStructure
-  auto* phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(eulerNames[3]));            // get the phase data from the EbsdReader
+  const auto* phasePtr = reinterpret_cast<int32_t*>(ebsdReader->getPointerByName(eulerNames[3]));      // get the phase data from the EbsdReader
   nx::core::DataPath phaseDataPath = cellAttributeMatrixPath.createChildPath(EbsdLib::H5Ebsd::Phases); // get the phase data from the DataStructure
-  nx::core::Int32Array* phaseDataArrayPtr = nullptr;
+  nx::core::Int32AbstractDataStore* phaseDataStorePtr = nullptr;
 
   if(selectedArrayNames.find(eulerNames[3]) != selectedArrayNames.end())
   {
-    phaseDataArrayPtr = dataStructure.getDataAs<nx::core::Int32Array>(phaseDataPath);
-    for(size_t tupleIndex = 0; tupleIndex < totalPoints; tupleIndex++)
+    phaseDataStorePtr = dataStructure.getDataRefAs<nx::core::Int32Array>(phaseDataPath).getDataStore();
+    result = nx::core::EbsdImportUtilities::CopyBuffer(phasePtr, *phaseDataStorePtr, 0, totalPoints);
+    if(result.invalid())
     {
-      (*phaseDataArrayPtr)[tupleIndex] = phasePtr[tupleIndex];
+      return result;
     }
   }
 
   if(selectedArrayNames.find(EbsdLib::CellData::EulerAngles) != selectedArrayNames.end())
   {
     //  radian conversion = M_PI / 180.0;
-    auto* euler0 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[0]));
-    auto* euler1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[1]));
-    auto* euler2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[2]));
-    //  std::vector<size_t> cDims = {3};
+    const auto* euler0 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[0]));
+    const auto* euler1 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[1]));
+    const auto* euler2 = reinterpret_cast<float*>(ebsdReader->getPointerByName(eulerNames[2]));
     nx::core::DataPath eulerDataPath = cellAttributeMatrixPath.createChildPath(EbsdLib::CellData::EulerAngles); // get the Euler data from the DataStructure
-    auto& eulerData = dataStructure.getDataRefAs<nx::core::Float32Array>(eulerDataPath);
+    auto& eulerData = dataStructure.getDataRefAs<nx::core::Float32Array>(eulerDataPath).getDataStoreRef();
 
     float degToRad = 1.0f;
     if(mInputValues->eulerRepresentation != EbsdLib::AngleRepresentation::Radians && mInputValues->useRecommendedTransform)
     {
       degToRad = nx::core::numbers::pi_v<float> / 180.0F;
     }
-    for(size_t elementIndex = 0; elementIndex < totalPoints; elementIndex++)
+    result = nx::core::EbsdImportUtilities::CopyEulerAngles(euler0, euler1, euler2, eulerData, 0, totalPoints, degToRad);
+    if(result.invalid())
     {
-      eulerData[3 * elementIndex] = euler0[elementIndex] * degToRad;
-      eulerData[3 * elementIndex + 1] = euler1[elementIndex] * degToRad;
-      eulerData[3 * elementIndex + 2] = euler2[elementIndex] * degToRad;
+      return result;
     }
     // THIS IS ONLY TO BRING OXFORD DATA INTO THE SAME HEX REFERENCE AS EDAX HEX REFERENCE
-    if(manufacturer == EbsdLib::Ctf::Manufacturer && phaseDataArrayPtr != nullptr)
+    if(manufacturer == EbsdLib::Ctf::Manufacturer && phaseDataStorePtr != nullptr)
     {
-      for(size_t elementIndex = 0; elementIndex < totalPoints; elementIndex++)
-      {
-        if(xtalData[(*phaseDataArrayPtr)[elementIndex]] == EbsdLib::CrystalStructure::Hexagonal_High)
-        {
-          eulerData[3 * elementIndex + 2] = eulerData[3 * elementIndex + 2] + (30.0F * degToRad);
-        }
-      }
+      nx::core::EbsdImportUtilities::ApplyHexagonalAlignment(eulerData, *phaseDataStorePtr, xtalData.getDataStoreRef(), 0, totalPoints, 30.0F * degToRad);
     }
   }
 
   // Copy the EBSD Data from its temp location into the final DataStructure location.
-  ::CopyData<H5EbsdReaderType, float>(dataStructure, ebsdReader.get(), floatArrayNames, selectedArrayNames, cellAttributeMatrixPath, totalPoints);
-  ::CopyData<H5EbsdReaderType, int>(dataStructure, ebsdReader.get(), intArrayNames, selectedArrayNames, cellAttributeMatrixPath, totalPoints);
+  result = ::CopyData<H5EbsdReaderType, float>(dataStructure, ebsdReader.get(), floatArrayNames, selectedArrayNames, cellAttributeMatrixPath, totalPoints);
+  if(result.invalid())
+  {
+    return result;
+  }
+  result = ::CopyData<H5EbsdReaderType, int>(dataStructure, ebsdReader.get(), intArrayNames, selectedArrayNames, cellAttributeMatrixPath, totalPoints);
+  if(result.invalid())
+  {
+    return result;
+  }
 
   return {};
 }
@@ -1,5 +1,7 @@
 #include "ReadH5OinaData.hpp"
 
+#include "OrientationAnalysis/utilities/EbsdImportUtilities.hpp"
+
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 
@@ -7,44 +9,26 @@ using namespace nx::core;
 
 namespace
 {
-
 template <typename T>
-void copyRawData(const ReadH5DataInputValues* m_InputValues, size_t totalPoints, DataStructure& m_DataStructure, H5OINAReader& m_Reader, const std::string& name, usize offset)
+Result<> CopyRawData(const ReadH5DataInputValues* inputValues, DataStructure& dataStructure, H5OINAReader& reader, const std::string& name, usize tupleOffset, usize numTuples)
 {
-  using ArrayType = DataArray<T>;
-  auto& dataRef = m_DataStructure.getDataRefAs<ArrayType>(m_InputValues->CellAttributeMatrixPath.createChildPath(name));
-  auto* dataStorePtr = dataRef.getDataStore();
-
-  const nonstd::span<T> rawDataPtr(reinterpret_cast<T*>(m_Reader.getPointerByName(name)), totalPoints);
-  std::copy(rawDataPtr.begin(), rawDataPtr.end(), dataStorePtr->begin() + offset);
+  auto& dataStore = dataStructure.getDataRefAs<DataArray<T>>(inputValues->CellAttributeMatrixPath.createChildPath(name)).getDataStoreRef();
+  const usize numComponents = dataStore.getNumberOfComponents();
+  const auto* rawDataPtr = reinterpret_cast<const T*>(reader.getPointerByName(name));
+  return EbsdImportUtilities::CopyBuffer(rawDataPtr, dataStore, tupleOffset * numComponents, numTuples * numComponents);
 }
 
 template <typename T>
-void convertHexEulerAngle(const ReadH5DataInputValues* m_InputValues, size_t totalPoints, DataStructure& m_DataStructure)
+void ConvertHexEulerAngle(const ReadH5DataInputValues* inputValues, DataStructure& dataStructure, usize tupleOffset, usize numTuples)
 {
-  using ArrayType = DataArray<T>;
-
-  if(m_InputValues->EdaxHexagonalAlignment)
-  {
-    auto& crystalStructuresRef = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::AngFile::CrystalStructures));
-    auto& crystalStructuresDSRef = crystalStructuresRef.getDataStoreRef();
-
-    auto& cellPhasesRef = m_DataStructure.getDataRefAs<ArrayType>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::Phase));
-    auto& cellPhasesDSRef = cellPhasesRef.getDataStoreRef();
+  const auto& crystalStructures =
+      dataStructure.getDataRefAs<UInt32Array>(inputValues->CellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::AngFile::CrystalStructures)).getDataStoreRef();
+  const auto& cellPhases = dataStructure.getDataRefAs<DataArray<T>>(inputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::Phase)).getDataStoreRef();
+  auto& eulerAngles = dataStructure.getDataRefAs<Float32Array>(inputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::Euler)).getDataStoreRef();
 
-    auto& eulerRef = m_DataStructure.getDataRefAs<Float32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::Euler));
-    auto& eulerDataStoreRef = eulerRef.getDataStoreRef();
-
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      if(crystalStructuresDSRef[cellPhasesDSRef[i]] == EbsdLib::CrystalStructure::Hexagonal_High)
-      {
-        eulerDataStoreRef[3 * i + 2] = eulerDataStoreRef[3 * i + 2] + 30.0F; // See the documentation for this correction factor
-      }
-    }
-  }
+  // See the documentation for this correction factor
+  EbsdImportUtilities::ApplyHexagonalAlignment(eulerAngles, cellPhases, crystalStructures, tupleOffset, numTuples, 30.0F);
 }
-
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -69,39 +53,51 @@ Result<> ReadH5OinaData::copyRawEbsdData(int index)
   const usize totalPoints = imageGeom.getNumXCells() * imageGeom.getNumYCells();
   const usize offset = index * totalPoints;
 
-  copyRawData<uint8>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::BandContrast, offset);
-  copyRawData<uint8>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::BandSlope, offset);
-  copyRawData<uint8>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::Bands, offset);
-  copyRawData<uint8>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::Error, offset);
-  copyRawData<float>(m_InputValues, totalPoints * 3, m_DataStructure, *m_Reader, EbsdLib::H5OINA::Euler, offset);
-  copyRawData<float>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::MeanAngularDeviation, offset);
+  for(const auto& arrayName : {EbsdLib::H5OINA::BandContrast, EbsdLib::H5OINA::BandSlope, EbsdLib::H5OINA::Bands, EbsdLib::H5OINA::Error})
+  {
+    Result<> result = CopyRawData<uint8>(m_InputValues, m_DataStructure, *m_Reader, arrayName, offset, totalPoints);
+    if(result.invalid())
+    {
+      return result;
+    }
+  }
+  for(const auto& arrayName : {EbsdLib::H5OINA::Euler, EbsdLib::H5OINA::MeanAngularDeviation, EbsdLib::H5OINA::X, EbsdLib::H5OINA::Y})
+  {
+    Result<> result = CopyRawData<float32>(m_InputValues, m_DataStructure, *m_Reader, arrayName, offset, totalPoints);
+    if(result.invalid())
+    {
+      return result;
+    }
+  }
+
   if(m_InputValues->ConvertPhaseToInt32)
   {
-    const nonstd::span<uint8> rawDataPtr(reinterpret_cast<uint8*>(m_Reader->getPointerByName(EbsdLib::H5OINA::Phase)), totalPoints);
-    using ArrayType = DataArray<int32>;
-    auto& dataRef = m_DataStructure.getDataRefAs<ArrayType>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::Phase));
-    auto* dataStorePtr = dataRef.getDataStore();
-    for(size_t i = 0; i < totalPoints; i++)
+    const auto* rawDataPtr = reinterpret_cast<const uint8*>(m_Reader->getPointerByName(EbsdLib::H5OINA::Phase));
+    auto& phases = m_DataStructure.getDataRefAs<Int32Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::Phase)).getDataStoreRef();
+    Result<> result = EbsdImportUtilities::CopyBuffer(rawDataPtr, phases, offset, totalPoints);
+    if(result.invalid())
     {
-      dataStorePtr->setValue(i + offset, static_cast<int32>(rawDataPtr[i]));
+      return result;
     }
   }
   else
   {
-    copyRawData<uint8>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::Phase, offset);
+    Result<> result = CopyRawData<uint8>(m_InputValues, m_DataStructure, *m_Reader, EbsdLib::H5OINA::Phase, offset, totalPoints);
+    if(result.invalid())
+    {
+      return result;
+    }
   }
-  copyRawData<float>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::X, offset);
-  copyRawData<float>(m_InputValues, totalPoints, m_DataStructure, *m_Reader, EbsdLib::H5OINA::Y, offset);
 
   if(m_InputValues->EdaxHexagonalAlignment)
   {
     if(m_InputValues->ConvertPhaseToInt32)
     {
-      convertHexEulerAngle<int32>(m_InputValues, totalPoints, m_DataStructure);
+      ConvertHexEulerAngle<int32>(m_InputValues, m_DataStructure, offset, totalPoints);
     }
     else
     {
-      convertHexEulerAngle<uint8>(m_InputValues, totalPoints, m_DataStructure);
+      ConvertHexEulerAngle<uint8>(m_InputValues, m_DataStructure, offset, totalPoints);
     }
   }
 
@@ -112,17 +108,12 @@ Result<> ReadH5OinaData::copyRawEbsdData(int index)
     m_Reader->getPatternDims(pDims);
     if(pDims[0] != 0 && pDims[1] != 0)
     {
-      std::vector<usize> pDimsV(2);
-      pDimsV[0] = pDims[0];
-      pDimsV[1] = pDims[1];
-      auto& patternData = m_DataStructure.getDataRefAs<UInt8Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::UnprocessedPatterns));
+      auto& patternData = m_DataStructure.getDataRefAs<UInt8Array>(m_InputValues->CellAttributeMatrixPath.createChildPath(EbsdLib::H5OINA::UnprocessedPatterns)).getDataStoreRef();
       const usize numComponents = patternData.getNumberOfComponents();
-      for(usize i = 0; i < totalPoints; i++)
+      Result<> result = EbsdImportUtilities::CopyBuffer(patternDataPtr, patternData, offset * numComponents, totalPoints * numComponents);
+      if(result.invalid())
       {
-        for(usize j = 0; j < numComponents; ++j)
-        {
-          patternData[offset + numComponents * i + j] = patternDataPtr[numComponents * i + j];
-        }
+        return result;
       }
     }
   }
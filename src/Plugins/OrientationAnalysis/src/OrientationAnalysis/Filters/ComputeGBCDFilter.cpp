@@ -157,8 +157,8 @@ IFilter::PreflightResult ComputeGBCDFilter::preflightImpl(const DataStructure& d
     return {MakeErrorResult<OutputActions>(-74356, fmt::format("Could not find face areas array at path '{}'", pSurfaceMeshFaceAreasArrayPathValue.toString()))};
   }
 
-  // call the sizeGBCD function to get the GBCD ranges, dimensions, etc.  Note that the input parameters do not affect the size and can be dummy values here;
-  SizeGBCD sizeGbcd(0, 0, pGBCDResValue);
+  // call the sizeGBCD function to get the GBCD ranges, dimensions, etc.
+  SizeGBCD sizeGbcd(pGBCDResValue);
   std::vector<usize> componentShape(6);
   componentShape[0] = sizeGbcd.m_GbcdSizes[0];
   componentShape[1] = sizeGbcd.m_GbcdSizes[1];
@@ -0,0 +1,265 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include "EbsdLib/Core/EbsdLibConstants.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace nx::core
+{
+namespace EbsdImportUtilities
+{
+/**
+ * @brief Number of values each worker prepares before handing them to the DataStore in a single bulk copy.
+ */
+constexpr usize k_CopyBlockSize = 65536;
+
+namespace detail
+{
+/**
+ * @brief Keeps the first error of the bulk copies that run on the worker threads.
+ */
+struct CopyErrors
+{
+  std::mutex Mutex;
+  Result<> FirstError;
+
+  /**
+   * @brief Stores the result if it is the first error. Returns true if the result is valid.
+   */
+  bool check(Result<>&& result)
+  {
+    if(result.valid())
+    {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(Mutex);
+    if(FirstError.valid())
+    {
+      FirstError = std::move(result);
+    }
+    return false;
+  }
+};
+
+/**
+ * @brief The CopyBufferImpl class copies a range of a raw reader buffer into a DataStore one block at a time.
+ */
+template <typename DestT, typename SrcT, typename UnaryOp>
+class CopyBufferImpl
+{
+public:
+  CopyBufferImpl(const SrcT* source, AbstractDataStore<DestT>& destination, usize destOffset, UnaryOp op, CopyErrors& errors)
+  : m_Source(source)
+  , m_Destination(destination)
+  , m_DestOffset(destOffset)
+  , m_Op(op)
+  , m_Errors(errors)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<DestT> block;
+    for(usize start = range.min(); start < range.max(); start += k_CopyBlockSize)
+    {
+      const usize count = std::min(k_CopyBlockSize, range.max() - start);
+      Result<> copyResult;
+      if constexpr(std::is_same_v<DestT, SrcT> && std::is_same_v<UnaryOp, std::identity>)
+      {
+        copyResult = m_Destination.copyFromBuffer(m_DestOffset + start, nonstd::span<const DestT>(m_Source + start, count));
+      }
+      else
+      {
+        block.resize(count);
+        std::transform(m_Source + start, m_Source + start + count, block.begin(), [this](SrcT value) { return static_cast<DestT>(m_Op(value)); });
+        copyResult = m_Destination.copyFromBuffer(m_DestOffset + start, nonstd::span<const DestT>(block.data(), count));
+      }
+      if(!m_Errors.check(std::move(copyResult)))
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  const SrcT* m_Source = nullptr;
+  AbstractDataStore<DestT>& m_Destination;
+  usize m_DestOffset = 0;
+  UnaryOp m_Op;
+  CopyErrors& m_Errors;
+};
+
+/**
+ * @brief The CopyEulerAnglesImpl class interleaves the three separate Euler angle buffers of a reader
+ * into the 3 component Euler DataStore.
+ */
+class CopyEulerAnglesImpl
+{
+public:
+  CopyEulerAnglesImpl(const float32* phi1, const float32* phi, const float32* phi2, AbstractDataStore<float32>& eulerAngles, usize tupleOffset, float32 scale, CopyErrors& errors)
+  : m_Phi1(phi1)
+  , m_Phi(phi)
+  , m_Phi2(phi2)
+  , m_EulerAngles(eulerAngles)
+  , m_TupleOffset(tupleOffset)
+  , m_Scale(scale)
+  , m_Errors(errors)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<float32> block;
+    for(usize start = range.min(); start < range.max(); start += k_CopyBlockSize)
+    {
+      const usize count = std::min(k_CopyBlockSize, range.max() - start);
+      block.resize(count * 3);
+      for(usize i = 0; i < count; i++)
+      {
+        block[3 * i] = m_Phi1[start + i] * m_Scale;
+        block[3 * i + 1] = m_Phi[start + i] * m_Scale;
+        block[3 * i + 2] = m_Phi2[start + i] * m_Scale;
+      }
+      if(!m_Errors.check(m_EulerAngles.copyFromBuffer((m_TupleOffset + start) * 3, nonstd::span<const float32>(block.data(), block.size()))))
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  const float32* m_Phi1 = nullptr;
+  const float32* m_Phi = nullptr;
+  const float32* m_Phi2 = nullptr;
+  AbstractDataStore<float32>& m_EulerAngles;
+  usize m_TupleOffset = 0;
+  float32 m_Scale = 1.0f;
+  CopyErrors& m_Errors;
+};
+
+/**
+ * @brief The HexagonalAlignmentImpl class adds a constant to the third Euler angle of every
+ * tuple whose phase has the Hexagonal_High Laue class.
+ */
+template <typename PhaseT>
+class HexagonalAlignmentImpl
+{
+public:
+  HexagonalAlignmentImpl(AbstractDataStore<float32>& eulerAngles, const AbstractDataStore<PhaseT>& phases, const AbstractDataStore<uint32>& crystalStructures, usize tupleOffset, float32 correction)
+  : m_EulerAngles(eulerAngles)
+  , m_Phases(phases)
+  , m_CrystalStructures(crystalStructures)
+  , m_TupleOffset(tupleOffset)
+  , m_Correction(correction)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numPhases = m_CrystalStructures.getNumberOfTuples();
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const usize tupleIndex = m_TupleOffset + i;
+      const auto phase = static_cast<usize>(m_Phases.getValue(tupleIndex));
+      if(phase < numPhases && m_CrystalStructures.getValue(phase) == EbsdLib::CrystalStructure::Hexagonal_High)
+      {
+        m_EulerAngles.setValue(3 * tupleIndex + 2, m_EulerAngles.getValue(3 * tupleIndex + 2) + m_Correction);
+      }
+    }
+  }
+
+private:
+  AbstractDataStore<float32>& m_EulerAngles;
+  const AbstractDataStore<PhaseT>& m_Phases;
+  const AbstractDataStore<uint32>& m_CrystalStructures;
+  usize m_TupleOffset = 0;
+  float32 m_Correction = 0.0f;
+};
+} // namespace detail
+
+/**
+ * @brief Copies 'count' values from a raw EBSD reader buffer into the DataStore starting at the flat index
+ * 'destOffset'. Each value is passed through 'op' and converted to the DataStore type. The copy runs in
+ * parallel and every worker writes its values in bulk through AbstractDataStore::copyFromBuffer().
+ * @param source
+ * @param destination
+ * @param destOffset
+ * @param count
+ * @param op
+ * @return
+ */
+template <typename DestT, typename SrcT = DestT, typename UnaryOp = std::identity>
+Result<> CopyBuffer(const SrcT* source, AbstractDataStore<DestT>& destination, usize destOffset, usize count, UnaryOp op = {})
+{
+  if(destOffset + count > destination.getSize())
+  {
+    return MakeErrorResult(-74210, fmt::format("Unable to copy {} values into a DataStore of size {} starting at index {}.", count, destination.getSize(), destOffset));
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, count);
+  dataAlg.requireStoresInMemory({&destination});
+  detail::CopyErrors errors;
+  dataAlg.execute(detail::CopyBufferImpl<DestT, SrcT, UnaryOp>(source, destination, destOffset, op, errors));
+  return std::move(errors.FirstError);
+}
+
+/**
+ * @brief Interleaves the separate phi1, PHI and phi2 buffers of an EBSD reader into the 3 component Euler
+ * DataStore starting at tuple 'tupleOffset'. Every angle is multiplied by 'scale'.
+ * @param phi1
+ * @param phi
+ * @param phi2
+ * @param eulerAngles
+ * @param tupleOffset
+ * @param numTuples
+ * @param scale
+ * @return
+ */
+inline Result<> CopyEulerAngles(const float32* phi1, const float32* phi, const float32* phi2, AbstractDataStore<float32>& eulerAngles, usize tupleOffset, usize numTuples, float32 scale)
+{
+  if((tupleOffset + numTuples) * 3 > eulerAngles.getSize())
+  {
+    return MakeErrorResult(-74211, fmt::format("Unable to copy {} Euler angles into a DataStore of size {} starting at tuple {}.", numTuples, eulerAngles.getSize(), tupleOffset));
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.requireStoresInMemory({&eulerAngles});
+  detail::CopyErrors errors;
+  dataAlg.execute(detail::CopyEulerAnglesImpl(phi1, phi, phi2, eulerAngles, tupleOffset, scale, errors));
+  return std::move(errors.FirstError);
+}
+
+/**
+ * @brief Adds 'correction' to the third Euler angle of every tuple in [tupleOffset, tupleOffset + numTuples)
+ * whose phase is hexagonal. This brings Oxford hexagonal data into the EDAX hexagonal reference frame.
+ * @param eulerAngles
+ * @param phases
+ * @param crystalStructures
+ * @param tupleOffset
+ * @param numTuples
+ * @param correction
+ */
+template <typename PhaseT>
+void ApplyHexagonalAlignment(AbstractDataStore<float32>& eulerAngles, const AbstractDataStore<PhaseT>& phases, const AbstractDataStore<uint32>& crystalStructures, usize tupleOffset, usize numTuples,
+                             float32 correction)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numTuples);
+  dataAlg.requireStoresInMemory({&eulerAngles, &phases});
+  dataAlg.execute(detail::HexagonalAlignmentImpl<PhaseT>(eulerAngles, phases, crystalStructures, tupleOffset, correction));
+}
+} // namespace EbsdImportUtilities
+} // namespace nx::core
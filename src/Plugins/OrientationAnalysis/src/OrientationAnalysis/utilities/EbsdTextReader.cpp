@@ -0,0 +1,211 @@
+#include "EbsdTextReader.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <version>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_BlockSize = 64ULL * 1024ULL * 1024ULL;
+
+inline bool IsDelimiter(char value)
+{
+  return value == ' ' || value == '\t' || value == '\r';
+}
+
+template <typename T>
+T ParseToken(const char* first, const char* last)
+{
+  T value = {};
+  if constexpr(std::is_floating_point_v<T>)
+  {
+#if defined(__cpp_lib_to_chars)
+    std::from_chars(first, last, value);
+#else
+    // Floating point std::from_chars is not available in every standard library. Every token is
+    // followed by a delimiter, a newline or the null terminator of the block so strtof stops at 'last'.
+    value = std::strtof(first, nullptr);
+#endif
+  }
+  else
+  {
+    std::from_chars(first, last, value);
+  }
+  return value;
+}
+
+/**
+ * @brief The ParseLinesImpl class tokenizes a range of lines from the current block and writes
+ * every value straight into its destination DataStore.
+ */
+class ParseLinesImpl
+{
+public:
+  ParseLinesImpl(const std::vector<std::string_view>& lines, usize rowOffset, const std::vector<EbsdTextReader::ColumnTarget>& columns, const std::vector<usize>& numComponents)
+  : m_Lines(lines)
+  , m_RowOffset(rowOffset)
+  , m_Columns(columns)
+  , m_NumComponents(numComponents)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numColumns = m_Columns.size();
+    for(usize lineIndex = range.min(); lineIndex < range.max(); lineIndex++)
+    {
+      const std::string_view line = m_Lines[lineIndex];
+      const usize row = m_RowOffset + lineIndex;
+      const char* first = line.data();
+      const char* last = line.data() + line.size();
+      for(usize columnIndex = 0; columnIndex < numColumns; columnIndex++)
+      {
+        while(first != last && IsDelimiter(*first))
+        {
+          ++first;
+        }
+        const char* tokenEnd = first;
+        while(tokenEnd != last && !IsDelimiter(*tokenEnd))
+        {
+          ++tokenEnd;
+        }
+
+        const EbsdTextReader::ColumnTarget& column = m_Columns[columnIndex];
+        const usize index = row * m_NumComponents[columnIndex] + column.Component;
+        if(column.Float32Store != nullptr)
+        {
+          column.Float32Store->setValue(index, first == tokenEnd ? 0.0F : ParseToken<float32>(first, tokenEnd));
+        }
+        else if(column.Int32Store != nullptr)
+        {
+          column.Int32Store->setValue(index, first == tokenEnd ? 0 : ParseToken<int32>(first, tokenEnd));
+        }
+        first = tokenEnd;
+      }
+    }
+  }
+
+private:
+  const std::vector<std::string_view>& m_Lines;
+  usize m_RowOffset = 0;
+  const std::vector<EbsdTextReader::ColumnTarget>& m_Columns;
+  const std::vector<usize>& m_NumComponents;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<uint64> EbsdTextReader::FindDataSectionOffset(const std::filesystem::path& filePath, const HeaderLinePredicate& isHeaderLine)
+{
+  std::ifstream inStream(filePath, std::ios_base::in | std::ios_base::binary);
+  if(!inStream.is_open())
+  {
+    return MakeErrorResult<uint64>(-74200, fmt::format("Could not open file for reading: '{}'", filePath.string()));
+  }
+
+  uint64 offset = 0;
+  std::string line;
+  while(std::getline(inStream, line))
+  {
+    const uint64 lineLength = line.size() + 1;
+    if(!line.empty() && line.back() == '\r')
+    {
+      line.pop_back();
+    }
+    if(!isHeaderLine(line))
+    {
+      return {offset};
+    }
+    offset += lineLength;
+  }
+
+  return MakeErrorResult<uint64>(-74201, fmt::format("The end of the header was reached without finding any data in file '{}'", filePath.string()));
+}
+
+// -----------------------------------------------------------------------------
+Result<> EbsdTextReader::ReadDataSection(const std::filesystem::path& filePath, uint64 dataOffset, usize numRows, const std::vector<ColumnTarget>& columns, const std::atomic_bool& shouldCancel)
+{
+  std::ifstream inStream(filePath, std::ios_base::in | std::ios_base::binary);
+  if(!inStream.is_open())
+  {
+    return MakeErrorResult(-74200, fmt::format("Could not open file for reading: '{}'", filePath.string()));
+  }
+  inStream.seekg(static_cast<std::streamoff>(dataOffset));
+
+  IParallelAlgorithm::AlgorithmStores algStores;
+  std::vector<usize> numComponents;
+  numComponents.reserve(columns.size());
+  for(const auto& column : columns)
+  {
+    const IDataStore* store = column.Float32Store != nullptr ? static_cast<const IDataStore*>(column.Float32Store) : static_cast<const IDataStore*>(column.Int32Store);
+    algStores.push_back(store);
+    numComponents.push_back(store != nullptr ? store->getNumberOfComponents() : 1);
+  }
+
+  // The extra byte keeps the block null terminated for the strtof fallback in ParseToken()
+  std::vector<char> buffer(k_BlockSize + 1, '\0');
+  char* blockBegin = buffer.data();
+  std::vector<std::string_view> lines;
+  usize carryOver = 0;
+  usize rowsRead = 0;
+  bool endOfFile = false;
+  while(rowsRead < numRows && !endOfFile)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    inStream.read(blockBegin + carryOver, static_cast<std::streamsize>(k_BlockSize - carryOver));
+    const usize bytesInBlock = carryOver + static_cast<usize>(inStream.gcount());
+    endOfFile = !inStream.good();
+    buffer[bytesInBlock] = '\0';
+
+    // Split the block into complete lines. The trailing partial line is carried over into the next block.
+    lines.clear();
+    usize lineStart = 0;
+    while(lineStart < bytesInBlock && rowsRead + lines.size() < numRows)
+    {
+      const auto* newLine = static_cast<const char*>(std::memchr(blockBegin + lineStart, '\n', bytesInBlock - lineStart));
+      if(newLine == nullptr && !endOfFile)
+      {
+        break;
+      }
+      const usize lineEnd = newLine == nullptr ? bytesInBlock : static_cast<usize>(newLine - blockBegin);
+      const std::string_view line(blockBegin + lineStart, lineEnd - lineStart);
+      if(line.find_first_not_of(" \t\r") != std::string_view::npos)
+      {
+        lines.push_back(line);
+      }
+      lineStart = lineEnd + 1;
+    }
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, lines.size());
+    dataAlg.requireStoresInMemory(algStores);
+    dataAlg.execute(ParseLinesImpl(lines, rowsRead, columns, numComponents));
+    rowsRead += lines.size();
+
+    carryOver = lineStart < bytesInBlock ? bytesInBlock - lineStart : 0;
+    if(carryOver == k_BlockSize)
+    {
+      return MakeErrorResult(-74202, fmt::format("A data line in file '{}' is longer than {} bytes", filePath.string(), k_BlockSize));
+    }
+    std::memmove(blockBegin, blockBegin + lineStart, carryOver);
+  }
+
+  if(rowsRead < numRows)
+  {
+    return MakeErrorResult(-74203, fmt::format("The data section of file '{}' ended after {} rows but {} rows were expected", filePath.string(), rowsRead, numRows));
+  }
+
+  return {};
+}
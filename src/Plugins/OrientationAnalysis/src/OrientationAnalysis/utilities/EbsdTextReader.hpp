@@ -0,0 +1,58 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+
+#include <atomic>
+#include <filesystem>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace nx::core
+{
+namespace EbsdTextReader
+{
+/**
+ * @brief Describes where one whitespace delimited column of an EBSD text file (.ang, .ctf) is
+ * written. At most one of the stores is set; a column without a store is skipped. The value of
+ * row 'r' is written to component 'Component' of tuple 'r' of the store.
+ */
+struct ORIENTATIONANALYSIS_EXPORT ColumnTarget
+{
+  Float32AbstractDataStore* Float32Store = nullptr;
+  Int32AbstractDataStore* Int32Store = nullptr;
+  usize Component = 0;
+};
+
+using HeaderLinePredicate = std::function<bool(std::string_view)>;
+
+/**
+ * @brief Scans the file from the beginning and returns the byte offset of the first line for which
+ * the predicate returns false, i.e., the first line of the data section. Line endings are removed
+ * before the predicate is called.
+ * @param filePath
+ * @param isHeaderLine
+ * @return Byte offset of the first data line
+ */
+ORIENTATIONANALYSIS_EXPORT Result<uint64> FindDataSectionOffset(const std::filesystem::path& filePath, const HeaderLinePredicate& isHeaderLine);
+
+/**
+ * @brief Reads 'numRows' data lines starting at 'dataOffset' and decodes each column directly into its
+ * target DataStore. The file is streamed in large blocks and each block is split into lines that are
+ * tokenized in parallel, so no intermediate per-column buffers are allocated. Blank lines are ignored
+ * and columns that are missing at the end of a line are written as zero.
+ * @param filePath
+ * @param dataOffset Byte offset returned from FindDataSectionOffset()
+ * @param numRows Number of data lines (tuples) to read
+ * @param columns Destination of each column in file order
+ * @param shouldCancel
+ * @return
+ */
+ORIENTATIONANALYSIS_EXPORT Result<> ReadDataSection(const std::filesystem::path& filePath, uint64 dataOffset, usize numRows, const std::vector<ColumnTarget>& columns,
+                                                    const std::atomic_bool& shouldCancel);
+} // namespace EbsdTextReader
+} // namespace nx::core
@@ -3,6 +3,7 @@
 #include "OrientationAnalysis/OrientationAnalysis_export.hpp"
 #include "OrientationAnalysis/Parameters/OEMEbsdScanSelectionParameter.h"
 
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
@@ -14,6 +15,8 @@
 
 #include <fmt/format.h>
 
+#include <future>
+
 namespace nx::core
 {
 struct ORIENTATIONANALYSIS_EXPORT ReadH5DataInputValues
@@ -57,24 +60,65 @@ public:
     auto& imageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->ImageGeometryPath);
     imageGeom.setUnits(IGeometry::LengthUnit::Micrometer);
 
-    int index = 0;
-    for(const auto& currentScanName : m_InputValues->SelectedScanNames.scanNames)
+    const std::vector<std::string>& scanNames = m_InputValues->SelectedScanNames.scanNames;
+    if(scanNames.empty())
     {
-      m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Importing Index {}", currentScanName)});
+      return {};
+    }
 
-      Result<> readResults = readData(currentScanName);
-      if(readResults.invalid())
+    // The HDF5 read of the next scan runs on a second reader while the current scan is copied into the
+    // cell arrays. Out-of-core arrays may be written through HDF5 themselves so those imports stay serial.
+    const bool pipelineScans = scanNames.size() > 1 && isCellDataInMemory();
+    std::shared_ptr<T> nextReader;
+
+    Result<> readResults = readScan(*m_Reader, scanNames.front());
+    if(readResults.invalid())
+    {
+      return readResults;
+    }
+
+    for(usize index = 0; index < scanNames.size(); index++)
+    {
+      if(m_ShouldCancel)
       {
-        return readResults;
+        return {};
+      }
+      m_MessageHandler({IFilter::Message::Type::Info, fmt::format("Importing Index {}", scanNames[index])});
+
+      const bool hasNextScan = index + 1 < scanNames.size();
+      std::future<Result<>> nextReadResult;
+      if(pipelineScans && hasNextScan)
+      {
+        if(nextReader == nullptr)
+        {
+          nextReader = T::New();
+          nextReader->setFileName(m_InputValues->SelectedScanNames.inputFilePath.string());
+        }
+        nextReadResult = std::async(std::launch::async, [this, reader = nextReader.get(), scanName = scanNames[index + 1]]() { return readScan(*reader, scanName); });
       }
 
-      Result<> copyDataResults = copyRawEbsdData(index);
+      Result<> copyDataResults = loadPhaseInfo(*m_Reader);
+      if(copyDataResults.valid())
+      {
+        copyDataResults = copyRawEbsdData(static_cast<int>(index));
+      }
+      if(nextReadResult.valid())
+      {
+        readResults = nextReadResult.get();
+        std::swap(m_Reader, nextReader);
+      }
+      else if(hasNextScan && copyDataResults.valid())
+      {
+        readResults = readScan(*m_Reader, scanNames[index + 1]);
+      }
       if(copyDataResults.invalid())
       {
         return copyDataResults;
       }
-
-      ++index;
+      if(readResults.invalid())
+      {
+        return readResults;
+      }
     }
     return {};
   }
@@ -86,22 +130,50 @@ public:
 
   Result<> readData(const std::string& scanName)
   {
-    m_Reader->setReadPatternData(m_InputValues->ReadPatternData);
+    Result<> readResults = readScan(*m_Reader, scanName);
+    if(readResults.invalid())
+    {
+      return readResults;
+    }
+    return loadPhaseInfo(*m_Reader);
+  }
+
+  /**
+   * @brief Reads the scan from the .h5 file into the buffers of the given reader. This does not touch the
+   * DataStructure so it can run on a worker thread while a previously read scan is being copied.
+   * @param reader
+   * @param scanName
+   * @return
+   */
+  Result<> readScan(T& reader, const std::string& scanName) const
+  {
+    reader.setReadPatternData(m_InputValues->ReadPatternData);
     // If the user has already set a Scan Name to read then we are good to go.
-    m_Reader->setHDF5Path(scanName);
+    reader.setHDF5Path(scanName);
 
-    if(const int32 err = m_Reader->readFile(); err < 0)
+    if(const int32 err = reader.readFile(); err < 0)
     {
-      return MakeErrorResult(-8970, fmt::format("Attempting to read scan '{}' from file '{}' produced an error from the '{}' class.\n  Error Code: {}\n  Message: {}", scanName,
-                                                m_Reader->getFileName(), m_Reader->getNameOfClass(), m_Reader->getErrorCode(), m_Reader->getErrorMessage()));
+      return MakeErrorResult(-8970, fmt::format("Attempting to read scan '{}' from file '{}' produced an error from the '{}' class.\n  Error Code: {}\n  Message: {}", scanName, reader.getFileName(),
+                                                reader.getNameOfClass(), reader.getErrorCode(), reader.getErrorMessage()));
     }
 
-    const auto phases = m_Reader->getPhaseVector();
-    if(phases.empty())
+    if(reader.getPhaseVector().empty())
     {
-      return MakeErrorResult(-8971, fmt::format("'{}' did not parse any phases from from the .h5 file '{}' for scan '{}'", m_Reader->getNameOfClass(), scanName, m_Reader->getFileName()));
+      return MakeErrorResult(-8971, fmt::format("'{}' did not parse any phases from from the .h5 file '{}' for scan '{}'", reader.getNameOfClass(), scanName, reader.getFileName()));
     }
 
+    return {};
+  }
+
+  /**
+   * @brief Copies the phase information of the scan held by the reader into the ensemble arrays.
+   * @param reader
+   * @return
+   */
+  Result<> loadPhaseInfo(T& reader)
+  {
+    const auto phases = reader.getPhaseVector();
+
     // These arrays are purposely created using the AngFile constant names for BOTH the Oim and the Esprit readers!
     auto& crystalStructures = m_DataStructure.getDataRefAs<UInt32Array>(m_InputValues->CellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::AngFile::CrystalStructures));
     auto& materialNames = m_DataStructure.getDataRefAs<StringArray>(m_InputValues->CellEnsembleAttributeMatrixPath.createChildPath(EbsdLib::AngFile::MaterialName));
@@ -137,6 +209,24 @@ public:
   virtual Result<> copyRawEbsdData(int index) = 0;
 
 protected:
+  /**
+   * @brief Returns true if every array of the cell attribute matrix is held in memory.
+   * @return
+   */
+  bool isCellDataInMemory() const
+  {
+    const auto& cellAttributeMatrix = m_DataStructure.getDataRefAs<AttributeMatrix>(m_InputValues->CellAttributeMatrixPath);
+    for(const auto& [dataId, dataObject] : cellAttributeMatrix)
+    {
+      const auto* dataArray = dynamic_cast<const IDataArray*>(dataObject.get());
+      if(dataArray != nullptr && !dataArray->getDataFormat().empty())
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
   std::shared_ptr<T> m_Reader;
   DataStructure& m_DataStructure;
   const std::atomic_bool& m_ShouldCancel;
@@ -0,0 +1,249 @@
+#include "MisorientationEngine.hpp"
+
+#include "EbsdLib/Core/Quaternion.hpp"
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+using namespace nx::core;
+
+namespace
+{
+// Number of quaternion pairs that are processed together by the batched methods
+constexpr usize k_LaneCount = 64;
+
+struct Quaternion64
+{
+  float64 X = 0.0;
+  float64 Y = 0.0;
+  float64 Z = 0.0;
+  float64 W = 1.0;
+};
+
+/**
+ * @brief Returns q1 * conjugate(q2). 'crossProductSign' selects the handedness convention of the product.
+ */
+inline Quaternion64 MultiplyByConjugate(const float32* q1, const float32* q2, float64 crossProductSign)
+{
+  const float64 ax = q1[0];
+  const float64 ay = q1[1];
+  const float64 az = q1[2];
+  const float64 aw = q1[3];
+  const float64 bx = -static_cast<float64>(q2[0]);
+  const float64 by = -static_cast<float64>(q2[1]);
+  const float64 bz = -static_cast<float64>(q2[2]);
+  const float64 bw = q2[3];
+
+  Quaternion64 product;
+  product.X = aw * bx + bw * ax + crossProductSign * (ay * bz - az * by);
+  product.Y = aw * by + bw * ay + crossProductSign * (az * bx - ax * bz);
+  product.Z = aw * bz + bw * az + crossProductSign * (ax * by - ay * bx);
+  product.W = aw * bw - (ax * bx + ay * by + az * bz);
+  return product;
+}
+
+/**
+ * @brief Converts the largest |w| found over all symmetry operators into the misorientation angle.
+ */
+inline float64 AngleFromScalarPart(float64 maxScalarPart)
+{
+  return 2.0 * std::acos(std::min(maxScalarPart, 1.0));
+}
+
+/**
+ * @brief The quaternions of one batch stored as separate component arrays.
+ */
+struct QuaternionLanes
+{
+  std::array<float64, k_LaneCount> X = {};
+  std::array<float64, k_LaneCount> Y = {};
+  std::array<float64, k_LaneCount> Z = {};
+  std::array<float64, k_LaneCount> W = {};
+
+  void set(usize lane, const Quaternion64& quat)
+  {
+    X[lane] = quat.X;
+    Y[lane] = quat.Y;
+    Z[lane] = quat.Z;
+    W[lane] = quat.W;
+  }
+};
+
+/**
+ * @brief Finds the largest |w| of (symOp * q) over all symmetry operators for every lane. The inner
+ * loop runs over the lanes so it maps directly onto SIMD registers.
+ */
+template <typename TableT>
+void MaxScalarParts(const TableT& table, const QuaternionLanes& lanes, usize count, std::array<float64, k_LaneCount>& maxScalarParts)
+{
+  std::fill_n(maxScalarParts.begin(), count, 0.0);
+  const usize numSymOps = table.W.size();
+  for(usize symOp = 0; symOp < numSymOps; symOp++)
+  {
+    const float64 sw = table.W[symOp];
+    const float64 sx = table.X[symOp];
+    const float64 sy = table.Y[symOp];
+    const float64 sz = table.Z[symOp];
+    for(usize lane = 0; lane < count; lane++)
+    {
+      const float64 scalarPart = std::fabs(sw * lanes.W[lane] + sx * lanes.X[lane] + sy * lanes.Y[lane] + sz * lanes.Z[lane]);
+      maxScalarParts[lane] = maxScalarParts[lane] < scalarPart ? scalarPart : maxScalarParts[lane];
+    }
+  }
+}
+
+std::array<float32, 4> GetQuat(const AbstractDataStore<float32>& quats, usize tupleIndex)
+{
+  const usize index = tupleIndex * 4;
+  return {quats.getValue(index), quats.getValue(index + 1), quats.getValue(index + 2), quats.getValue(index + 3)};
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+MisorientationEngine::MisorientationEngine()
+{
+  // Form the quaternion products with the same handedness convention that EbsdLib uses
+  const QuatD product = QuatD(1.0, 0.0, 0.0, 0.0) * QuatD(0.0, 1.0, 0.0, 0.0);
+  m_CrossProductSign = product.z() < 0.0 ? -1.0 : 1.0;
+
+  m_IdentityTable.W = {1.0};
+  m_IdentityTable.X = {0.0};
+  m_IdentityTable.Y = {0.0};
+  m_IdentityTable.Z = {0.0};
+
+  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  m_Tables.resize(orientationOps.size());
+  for(usize laueClass = 0; laueClass < orientationOps.size(); laueClass++)
+  {
+    SymmetryTable& table = m_Tables[laueClass];
+    const auto numSymOps = static_cast<usize>(orientationOps[laueClass]->getNumSymOps());
+    table.W.resize(numSymOps);
+    table.X.resize(numSymOps);
+    table.Y.resize(numSymOps);
+    table.Z.resize(numSymOps);
+    for(usize symOp = 0; symOp < numSymOps; symOp++)
+    {
+      const QuatD quat = orientationOps[laueClass]->getQuatSymOp(static_cast<int32>(symOp));
+      table.W[symOp] = quat.w();
+      table.X[symOp] = -quat.x();
+      table.Y[symOp] = -quat.y();
+      table.Z[symOp] = -quat.z();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+MisorientationEngine::~MisorientationEngine() noexcept = default;
+
+// -----------------------------------------------------------------------------
+usize MisorientationEngine::getNumberOfLaueClasses() const
+{
+  return m_Tables.size();
+}
+
+// -----------------------------------------------------------------------------
+const MisorientationEngine::SymmetryTable& MisorientationEngine::getTable(uint32 laueClass) const
+{
+  return laueClass < m_Tables.size() ? m_Tables[laueClass] : m_IdentityTable;
+}
+
+// -----------------------------------------------------------------------------
+float64 MisorientationEngine::calculateAngle(uint32 laueClass, const float32* q1, const float32* q2) const
+{
+  const SymmetryTable& table = getTable(laueClass);
+  const Quaternion64 delta = MultiplyByConjugate(q1, q2, m_CrossProductSign);
+
+  float64 maxScalarPart = 0.0;
+  const usize numSymOps = table.W.size();
+  for(usize symOp = 0; symOp < numSymOps; symOp++)
+  {
+    const float64 scalarPart = std::fabs(table.W[symOp] * delta.W + table.X[symOp] * delta.X + table.Y[symOp] * delta.Y + table.Z[symOp] * delta.Z);
+    maxScalarPart = std::max(maxScalarPart, scalarPart);
+  }
+  return AngleFromScalarPart(maxScalarPart);
+}
+
+// -----------------------------------------------------------------------------
+float64 MisorientationEngine::calculateAngle(uint32 laueClass, const AbstractDataStore<float32>& quats, usize tuple1, usize tuple2) const
+{
+  const std::array<float32, 4> q1 = GetQuat(quats, tuple1);
+  const std::array<float32, 4> q2 = GetQuat(quats, tuple2);
+  return calculateAngle(laueClass, q1.data(), q2.data());
+}
+
+// -----------------------------------------------------------------------------
+bool MisorientationEngine::isBelowTolerance(uint32 laueClass, const float32* q1, const float32* q2, float64 tolerance) const
+{
+  // angle < tolerance  <=>  2 * acos(|w|) < tolerance  <=>  |w| > cos(tolerance / 2)
+  const float64 threshold = std::cos(tolerance * 0.5);
+  const SymmetryTable& table = getTable(laueClass);
+  const Quaternion64 delta = MultiplyByConjugate(q1, q2, m_CrossProductSign);
+
+  const usize numSymOps = table.W.size();
+  for(usize symOp = 0; symOp < numSymOps; symOp++)
+  {
+    const float64 scalarPart = std::fabs(table.W[symOp] * delta.W + table.X[symOp] * delta.X + table.Y[symOp] * delta.Y + table.Z[symOp] * delta.Z);
+    if(std::min(scalarPart, 1.0) > threshold)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+bool MisorientationEngine::isBelowTolerance(uint32 laueClass, const AbstractDataStore<float32>& quats, usize tuple1, usize tuple2, float64 tolerance) const
+{
+  const std::array<float32, 4> q1 = GetQuat(quats, tuple1);
+  const std::array<float32, 4> q2 = GetQuat(quats, tuple2);
+  return isBelowTolerance(laueClass, q1.data(), q2.data(), tolerance);
+}
+
+// -----------------------------------------------------------------------------
+void MisorientationEngine::calculateAngles(uint32 laueClass, const float32* reference, nonstd::span<const float32> quats, nonstd::span<float64> angles) const
+{
+  const SymmetryTable& table = getTable(laueClass);
+  const usize numQuats = std::min(quats.size() / 4, angles.size());
+
+  QuaternionLanes lanes;
+  std::array<float64, k_LaneCount> maxScalarParts = {};
+  for(usize batchStart = 0; batchStart < numQuats; batchStart += k_LaneCount)
+  {
+    const usize count = std::min(k_LaneCount, numQuats - batchStart);
+    for(usize lane = 0; lane < count; lane++)
+    {
+      lanes.set(lane, MultiplyByConjugate(reference, quats.data() + (batchStart + lane) * 4, m_CrossProductSign));
+    }
+    MaxScalarParts(table, lanes, count, maxScalarParts);
+    for(usize lane = 0; lane < count; lane++)
+    {
+      angles[batchStart + lane] = AngleFromScalarPart(maxScalarParts[lane]);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+void MisorientationEngine::calculateAngles(uint32 laueClass, nonstd::span<const float32> quats1, nonstd::span<const float32> quats2, nonstd::span<float64> angles) const
+{
+  const SymmetryTable& table = getTable(laueClass);
+  const usize numPairs = std::min({quats1.size() / 4, quats2.size() / 4, angles.size()});
+
+  QuaternionLanes lanes;
+  std::array<float64, k_LaneCount> maxScalarParts = {};
+  for(usize batchStart = 0; batchStart < numPairs; batchStart += k_LaneCount)
+  {
+    const usize count = std::min(k_LaneCount, numPairs - batchStart);
+    for(usize lane = 0; lane < count; lane++)
+    {
+      const usize quatIndex = (batchStart + lane) * 4;
+      lanes.set(lane, MultiplyByConjugate(quats1.data() + quatIndex, quats2.data() + quatIndex, m_CrossProductSign));
+    }
+    MaxScalarParts(table, lanes, count, maxScalarParts);
+    for(usize lane = 0; lane < count; lane++)
+    {
+      angles[batchStart + lane] = AngleFromScalarPart(maxScalarParts[lane]);
+    }
+  }
+}
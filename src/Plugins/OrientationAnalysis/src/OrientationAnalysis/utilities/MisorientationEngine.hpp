@@ -0,0 +1,124 @@
+#pragma once
+
+#include "OrientationAnalysis/OrientationAnalysis_export.hpp"
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @class MisorientationEngine
+ * @brief Computes crystallographic misorientation angles for batches of quaternion pairs.
+ *
+ * The quaternion symmetry operators of every Laue class are copied once into structure of arrays
+ * tables. The loop over the symmetry operators is then a branch free dot product that the compiler
+ * vectorizes across the quaternion pairs of a batch. Only the misorientation angle is computed, the
+ * angles match LaueOps::calculateMisorientation() for the same Laue class. Use LaueOps when the
+ * misorientation axis is needed.
+ *
+ * Quaternions are given in the <x, y, z, w> layout used by the Quats DataArrays and angles are in
+ * radians. All methods are const and can be called concurrently from multiple threads.
+ */
+class ORIENTATIONANALYSIS_EXPORT MisorientationEngine
+{
+public:
+  MisorientationEngine();
+  ~MisorientationEngine() noexcept;
+
+  MisorientationEngine(const MisorientationEngine&) = default;
+  MisorientationEngine(MisorientationEngine&&) noexcept = default;
+  MisorientationEngine& operator=(const MisorientationEngine&) = default;
+  MisorientationEngine& operator=(MisorientationEngine&&) noexcept = default;
+
+  /**
+   * @brief Returns the number of Laue classes that have symmetry tables. Larger Laue class indices, e.g.,
+   * the unknown crystal structure, only use the identity operator.
+   * @return
+   */
+  usize getNumberOfLaueClasses() const;
+
+  /**
+   * @brief Returns the misorientation angle between two quaternions.
+   * @param laueClass Index of the Laue class (EbsdLib::CrystalStructure)
+   * @param q1 Pointer to the 4 values of the first quaternion
+   * @param q2 Pointer to the 4 values of the second quaternion
+   * @return Angle in radians
+   */
+  float64 calculateAngle(uint32 laueClass, const float32* q1, const float32* q2) const;
+
+  /**
+   * @brief Returns the misorientation angle between tuples 'tuple1' and 'tuple2' of a Quats DataStore.
+   * @param laueClass
+   * @param quats
+   * @param tuple1
+   * @param tuple2
+   * @return Angle in radians
+   */
+  float64 calculateAngle(uint32 laueClass, const AbstractDataStore<float32>& quats, usize tuple1, usize tuple2) const;
+
+  /**
+   * @brief Returns true if the misorientation angle between the two quaternions is less than 'tolerance'.
+   * The symmetry operators are only visited until the first one brings the pair within the tolerance.
+   * @param laueClass
+   * @param q1
+   * @param q2
+   * @param tolerance Tolerance in radians
+   * @return
+   */
+  bool isBelowTolerance(uint32 laueClass, const float32* q1, const float32* q2, float64 tolerance) const;
+
+  /**
+   * @brief Returns true if the misorientation angle between tuples 'tuple1' and 'tuple2' of a Quats
+   * DataStore is less than 'tolerance'.
+   * @param laueClass
+   * @param quats
+   * @param tuple1
+   * @param tuple2
+   * @param tolerance Tolerance in radians
+   * @return
+   */
+  bool isBelowTolerance(uint32 laueClass, const AbstractDataStore<float32>& quats, usize tuple1, usize tuple2, float64 tolerance) const;
+
+  /**
+   * @brief Computes the misorientation angle between a reference quaternion and each quaternion of a batch.
+   * @param laueClass
+   * @param reference Pointer to the 4 values of the reference quaternion
+   * @param quats Batch of quaternions, 4 values per quaternion
+   * @param angles Receives one angle in radians per quaternion of the batch
+   */
+  void calculateAngles(uint32 laueClass, const float32* reference, nonstd::span<const float32> quats, nonstd::span<float64> angles) const;
+
+  /**
+   * @brief Computes the misorientation angle of each pair (quats1[i], quats2[i]).
+   * @param laueClass
+   * @param quats1 First quaternion of each pair, 4 values per quaternion
+   * @param quats2 Second quaternion of each pair, 4 values per quaternion
+   * @param angles Receives one angle in radians per pair
+   */
+  void calculateAngles(uint32 laueClass, nonstd::span<const float32> quats1, nonstd::span<const float32> quats2, nonstd::span<float64> angles) const;
+
+private:
+  /**
+   * @brief Scalar parts of the symmetry operators of one Laue class stored as separate arrays. The
+   * vector components are negated so the scalar part of (symOp * q) is the plain dot product.
+   */
+  struct SymmetryTable
+  {
+    std::vector<float64> W;
+    std::vector<float64> X;
+    std::vector<float64> Y;
+    std::vector<float64> Z;
+  };
+
+  const SymmetryTable& getTable(uint32 laueClass) const;
+
+  std::vector<SymmetryTable> m_Tables;
+  SymmetryTable m_IdentityTable;
+  float64 m_CrossProductSign = 1.0;
+};
+} // namespace nx::core
@@ -37,8 +37,12 @@ of doing that.
 #include "simplnx/Parameters/NumericTypeParameter.hpp"
 #include "simplnx/UnitTest/UnitTestCommon.hpp"
 
+#include "EbsdLib/LaueOps/LaueOps.h"
+
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <cmath>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -191,3 +195,87 @@ TEST_CASE("OrientationAnalysis::ComputeAvgOrientations", "[OrientationAnalysis][
     }
   }
 }
+
+TEST_CASE("OrientationAnalysis::ComputeAvgOrientations: Large Features", "[OrientationAnalysis][ComputeAvgOrientations]")
+{
+  Application::GetOrCreateInstance()->loadPlugins(unit_test::k_BuildDir.view(), true);
+
+  // Feature 1 spans several 32768 cell chunks, feature 2 is interleaved with it and feature 3 is a single cell
+  const usize k_NumTuples = 100000;
+  const usize k_NumFeatures = 4;
+  const std::string k_GrainDataStr = "Grain Data";
+  const std::string k_AvgEulers("AvgEulerAngles");
+  const DataPath k_AvgQuatsDataPath({k_GrainDataStr, k_AvgQuats});
+  const DataPath k_AvgEulersDataPath({k_GrainDataStr, k_AvgEulers});
+  const DataPath k_CrystalStructureDataPath({"Crystal Structures"});
+
+  DataStructure dataStructure;
+  UInt32Array* crystalStructuresPtr = UnitTest::CreateTestDataArray<uint32>(dataStructure, "Crystal Structures", {2}, {1});
+  (*crystalStructuresPtr)[0] = 999;
+  (*crystalStructuresPtr)[1] = 1;
+  Int32Array* featureIdsPtr = UnitTest::CreateTestDataArray<int32>(dataStructure, k_FeatureIds, {k_NumTuples}, {1});
+  Int32Array* phasesPtr = UnitTest::CreateTestDataArray<int32>(dataStructure, k_Phases, {k_NumTuples}, {1});
+  Float32Array* quatsPtr = UnitTest::CreateTestDataArray<float32>(dataStructure, k_Quats, {k_NumTuples}, {4});
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    (*featureIdsPtr)[i] = (i == k_NumTuples - 1) ? 3 : (i % 7 == 0 ? 2 : 1);
+    (*phasesPtr)[i] = (i % 101 == 0) ? 0 : 1;
+
+    // Small rotations about varying axes, some flipped to the opposite hemisphere of the quaternion sphere
+    const float32 angle = 0.05F + 0.1F * static_cast<float32>((i * 7919) % 97) / 97.0F;
+    std::array<float32, 3> axis = {static_cast<float32>((i * 31) % 17) + 1.0F, static_cast<float32>((i * 53) % 13), static_cast<float32>((i * 71) % 11)};
+    const float32 axisLength = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    const float32 sign = (i % 5 == 0) ? -1.0F : 1.0F;
+    for(usize comp = 0; comp < 3; comp++)
+    {
+      (*quatsPtr)[i * 4 + comp] = sign * std::sin(angle * 0.5F) * axis[comp] / axisLength;
+    }
+    (*quatsPtr)[i * 4 + 3] = sign * std::cos(angle * 0.5F);
+  }
+  AttributeMatrix::Create(dataStructure, k_GrainDataStr, {k_NumFeatures});
+
+  ComputeAvgOrientationsFilter filter;
+  Arguments args;
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(DataPath({k_FeatureIds})));
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_CellPhasesArrayPath_Key, std::make_any<DataPath>(DataPath({k_Phases})));
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_CellQuatsArrayPath_Key, std::make_any<DataPath>(DataPath({k_Quats})));
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_CrystalStructuresArrayPath_Key, std::make_any<DataPath>(k_CrystalStructureDataPath));
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_CellFeatureAttributeMatrixPath_Key, std::make_any<DataPath>({k_GrainDataStr}));
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_AvgQuatsArrayName_Key, std::make_any<std::string>(k_AvgQuats));
+  args.insertOrAssign(ComputeAvgOrientationsFilter::k_AvgEulerAnglesArrayName_Key, std::make_any<std::string>(k_AvgEulers));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+
+  // Serial reference: the running average that is stored and divided by the count after every cell
+  std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  std::vector<QuatF> runningQuats(k_NumFeatures, QuatF(0.0F, 0.0F, 0.0F, 1.0F));
+  std::vector<float32> counts(k_NumFeatures, 0.0F);
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    const int32 featureId = (*featureIdsPtr)[i];
+    if(featureId <= 0 || (*phasesPtr)[i] <= 0)
+    {
+      continue;
+    }
+    const float32 count = counts[featureId] += 1.0F;
+    const QuatF& runningQuat = runningQuats[featureId];
+    const QuatF curAvgQuat(runningQuat.x() / count, runningQuat.y() / count, runningQuat.z() / count, runningQuat.w() / count);
+    const QuatF voxQuat((*quatsPtr)[i * 4], (*quatsPtr)[i * 4 + 1], (*quatsPtr)[i * 4 + 2], (*quatsPtr)[i * 4 + 3]);
+    runningQuats[featureId] = curAvgQuat + orientationOps[1]->getNearestQuat(curAvgQuat, voxQuat);
+  }
+
+  const auto& avgQuats = dataStructure.getDataRefAs<Float32Array>(k_AvgQuatsDataPath);
+  for(usize featureId = 1; featureId < k_NumFeatures; featureId++)
+  {
+    const float32 count = counts[featureId];
+    const QuatF& runningQuat = runningQuats[featureId];
+    const QuatF expected = QuatF(runningQuat.x() / count, runningQuat.y() / count, runningQuat.z() / count, runningQuat.w() / count).unitQuaternion();
+    REQUIRE(avgQuats[featureId * 4] == expected.x());
+    REQUIRE(avgQuats[featureId * 4 + 1] == expected.y());
+    REQUIRE(avgQuats[featureId * 4 + 2] == expected.z());
+    REQUIRE(avgQuats[featureId * 4 + 3] == expected.w());
+  }
+}
@@ -0,0 +1,124 @@
+#include <catch2/catch.hpp>
+
+#include "OrientationAnalysis/utilities/MisorientationEngine.hpp"
+
+#include "simplnx/Common/Types.hpp"
+
+#include "EbsdLib/LaueOps/LaueOps.h"
+
+#include <fmt/format.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+// More pairs than the engine processes in one batch so that full and partial batches are both checked
+constexpr usize k_NumPairs = 200;
+
+// Largest difference in radians that is allowed between the engine angle and the LaueOps angle
+constexpr float64 k_AngleEpsilon = 1.0e-5;
+
+// Slack in radians that EBSDSegmentFeatures, NeighborOrientationCorrelation and BadDataNeighborOrientationCheck add to the
+// tolerance when the engine is used to skip pairs before the LaueOps decision
+constexpr float64 k_AnglePrefilterSlack = 1.0e-4;
+
+// Pairs below this angle are skipped by the tolerance checks because the angle is badly conditioned close to zero
+constexpr float64 k_MinToleranceAngle = 0.01;
+
+std::vector<float32> CreateRandomQuats(usize numQuats, uint32 seed)
+{
+  std::mt19937 generator(seed);
+  std::normal_distribution<float64> distribution(0.0, 1.0);
+  std::vector<float32> quats(numQuats * 4);
+  for(usize i = 0; i < numQuats; i++)
+  {
+    const float64 x = distribution(generator);
+    const float64 y = distribution(generator);
+    const float64 z = distribution(generator);
+    const float64 w = distribution(generator);
+    const float64 norm = std::sqrt(x * x + y * y + z * z + w * w);
+    quats[i * 4] = static_cast<float32>(x / norm);
+    quats[i * 4 + 1] = static_cast<float32>(y / norm);
+    quats[i * 4 + 2] = static_cast<float32>(z / norm);
+    quats[i * 4 + 3] = static_cast<float32>(w / norm);
+  }
+  return quats;
+}
+
+QuatF ToQuat(const float32* quat)
+{
+  return QuatF(quat[0], quat[1], quat[2], quat[3]);
+}
+} // namespace
+
+TEST_CASE("OrientationAnalysis::MisorientationEngine: Matches LaueOps", "[OrientationAnalysis][MisorientationEngine]")
+{
+  const std::vector<LaueOps::Pointer> orientationOps = LaueOps::GetAllOrientationOps();
+  const MisorientationEngine misorientationEngine;
+  REQUIRE(misorientationEngine.getNumberOfLaueClasses() == orientationOps.size());
+
+  const std::vector<float32> quats1 = CreateRandomQuats(k_NumPairs, 5489);
+  const std::vector<float32> quats2 = CreateRandomQuats(k_NumPairs, 1234);
+  std::vector<float64> pairAngles(k_NumPairs);
+  std::vector<float64> referenceAngles(k_NumPairs);
+
+  for(uint32 laueClass = 0; laueClass < static_cast<uint32>(orientationOps.size()); laueClass++)
+  {
+    INFO(fmt::format("Laue class {}", laueClass));
+    const LaueOps& laueOps = *orientationOps[laueClass];
+
+    misorientationEngine.calculateAngles(laueClass, quats1, quats2, pairAngles);
+    misorientationEngine.calculateAngles(laueClass, quats1.data(), quats2, referenceAngles);
+
+    for(usize i = 0; i < k_NumPairs; i++)
+    {
+      INFO(fmt::format("Pair {}", i));
+      const float32* q1 = quats1.data() + i * 4;
+      const float32* q2 = quats2.data() + i * 4;
+      const float64 laueAngle = laueOps.calculateMisorientation(ToQuat(q1), ToQuat(q2))[3];
+
+      const float64 angle = misorientationEngine.calculateAngle(laueClass, q1, q2);
+      REQUIRE(angle == Approx(laueAngle).margin(k_AngleEpsilon));
+      REQUIRE(pairAngles[i] == Approx(angle).margin(1.0e-12));
+
+      const float64 referenceAngle = laueOps.calculateMisorientation(ToQuat(quats1.data()), ToQuat(q2))[3];
+      REQUIRE(referenceAngles[i] == Approx(referenceAngle).margin(k_AngleEpsilon));
+
+      if(laueAngle < k_MinToleranceAngle)
+      {
+        continue;
+      }
+
+      // The pair is exactly at the tolerance. LaueOps does not count it as below the tolerance while the engine
+      // may answer either way, so the widened prefilter has to keep the pair and leave the decision to LaueOps.
+      const float64 tolerance = laueAngle;
+      REQUIRE(misorientationEngine.isBelowTolerance(laueClass, q1, q2, tolerance + k_AnglePrefilterSlack));
+      REQUIRE_FALSE(misorientationEngine.isBelowTolerance(laueClass, q1, q2, tolerance - k_AnglePrefilterSlack));
+    }
+  }
+}
+
+TEST_CASE("OrientationAnalysis::MisorientationEngine: Identical Quaternions", "[OrientationAnalysis][MisorientationEngine]")
+{
+  const MisorientationEngine misorientationEngine;
+  const std::vector<float32> quats = CreateRandomQuats(k_NumPairs, 42);
+  std::vector<float64> angles(k_NumPairs);
+
+  // The unknown crystal structure has no symmetry table and only uses the identity operator
+  const auto numLaueClasses = static_cast<uint32>(misorientationEngine.getNumberOfLaueClasses());
+  for(uint32 laueClass : {0U, numLaueClasses - 1, 999U})
+  {
+    misorientationEngine.calculateAngles(laueClass, quats, quats, angles);
+    for(usize i = 0; i < k_NumPairs; i++)
+    {
+      const float32* quat = quats.data() + i * 4;
+      REQUIRE(misorientationEngine.calculateAngle(laueClass, quat, quat) == Approx(0.0).margin(2.0e-3));
+      REQUIRE(angles[i] == Approx(0.0).margin(2.0e-3));
+      REQUIRE(misorientationEngine.isBelowTolerance(laueClass, quat, quat, 1.0e-2));
+    }
+  }
+}
@@ -3,9 +3,7 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry0D.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 using namespace nx::core;
 
@@ -62,11 +60,6 @@ Result<> ApplyTransformationToGeometry::applyImageGeometryTransformation()
 
   ImageRotationUtilities::FilterProgressCallback filterProgressCallback(m_MessageHandler, m_ShouldCancel);
 
-  // The actual rotating of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
-  ParallelTaskAlgorithm taskRunner;
-  taskRunner.setParallelizationEnabled(true);
-
   const DataPath srcCelLDataAMPath = srcImageGeom.getCellDataPath();
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
 
@@ -90,38 +83,29 @@ Result<> ApplyTransformationToGeometry::applyImageGeometryTransformation()
     destCellDataAM.resizeTuples(dataArrayShape);
   }
 
+  std::vector<std::pair<const IDataArray*, IDataArray*>> cellArrays;
   for(const auto& [dataId, srcDataObject] : srcCellDataAM)
   {
-    if(m_ShouldCancel)
-    {
-      return {};
-    }
-
     const auto* srcDataArrayPtr = m_DataStructure.getDataAs<IDataArray>(srcCelLDataAMPath.createChildPath(srcDataObject->getName()));
     auto* destDataArrayPtr = m_DataStructure.getDataAs<IDataArray>(destCellDataAMPath.createChildPath(srcDataObject->getName()));
+    cellArrays.emplace_back(srcDataArrayPtr, destDataArrayPtr);
+  }
 
-    if(m_InputValues->InterpolationSelection == detail::k_NearestNeighborInterpolationIdx)
-    {
-      m_MessageHandler(fmt::format("Applying Transform || Nearest Neighbor Interpolation {}", srcDataObject->getName()));
-
-      ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithNearestNeighbor>(srcDataArrayPtr->getDataType(), taskRunner, srcDataArrayPtr, destDataArrayPtr, rotateArgs,
-                                                                                              m_TransformationMatrix, false, &filterProgressCallback);
-    }
-    else if(m_InputValues->InterpolationSelection == detail::k_LinearInterpolationIdx)
-    {
-      m_MessageHandler(fmt::format("Applying Transform || Trilinear Interpolation {}", srcDataObject->getName()));
-
-      ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithTrilinearInterpolation, NoBooleanType>(srcDataArrayPtr->getDataType(), taskRunner, srcDataArrayPtr, destDataArrayPtr,
-                                                                                                                    rotateArgs, m_TransformationMatrix, &filterProgressCallback);
-    }
-
-    if(getCancel())
-    {
-      break;
-    }
+  // The mapping from each transformed voxel back to the original voxels is computed once per tile of the
+  // transformed geometry and shared by every cell array.
+  auto interpolationType = ImageRotationUtilities::InterpolationType::NearestNeighbor;
+  if(m_InputValues->InterpolationSelection == detail::k_LinearInterpolationIdx)
+  {
+    interpolationType = ImageRotationUtilities::InterpolationType::Trilinear;
+    m_MessageHandler(fmt::format("Applying Transform || Trilinear Interpolation of {} Cell Arrays", cellArrays.size()));
+  }
+  else
+  {
+    m_MessageHandler(fmt::format("Applying Transform || Nearest Neighbor Interpolation of {} Cell Arrays", cellArrays.size()));
   }
 
-  taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
+  const ImageRotationUtilities::VoxelRemapPlan remapPlan(rotateArgs, m_TransformationMatrix, interpolationType);
+  ImageRotationUtilities::RemapImageGeometryArrays(remapPlan, cellArrays, &filterProgressCallback);
 
   return {};
 }
@@ -7,66 +7,273 @@
 #include "simplnx/Utilities/Math/StatisticsCalculations.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
-#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <numeric>
 
 using namespace nx::core;
 
 namespace
 {
-// -----------------------------------------------------------------------------
-bool CheckArraysInMemory(const nx::core::IParallelAlgorithm::AlgorithmArrays& arrays)
+// Number of tuples read from the input arrays at a time while grouping the values by feature
+constexpr usize k_GroupChunkSize = 4096;
+
+// Upper bound on the number of tuple blocks that group their values on their own
+constexpr usize k_MaxGroupBlocks = 64;
+
+/**
+ * @brief The values of the selected (masked) tuples grouped by feature id. The values of feature i are stored in
+ * tuple order in Values[Offsets[i]] up to (but not including) Values[Offsets[i + 1]].
+ */
+template <typename T>
+struct FeatureGroupedValues
+{
+  std::vector<usize> Offsets;
+  std::unique_ptr<T[]> Values;
+};
+
+/**
+ * @brief Reads the feature ids and values of a block of tuples in chunks and calls function(featureId, value) for
+ * every tuple that is selected by the mask and belongs to a valid feature.
+ */
+template <typename T, typename FunctionT>
+void ForEachFeatureValue(const Int32AbstractDataStore& featureIds, const AbstractDataStore<T>& source, const std::unique_ptr<MaskCompare>& mask, usize numFeatures, usize start, usize end,
+                         FunctionT&& function)
+{
+  auto featureIdChunk = std::make_unique<int32[]>(k_GroupChunkSize);
+  auto valueChunk = std::make_unique<T[]>(k_GroupChunkSize);
+  for(usize chunkStart = start; chunkStart < end; chunkStart += k_GroupChunkSize)
+  {
+    const usize count = std::min(k_GroupChunkSize, end - chunkStart);
+    featureIds.copyIntoBuffer(chunkStart, nonstd::span<int32>(featureIdChunk.get(), count));
+    source.copyIntoBuffer(chunkStart, nonstd::span<T>(valueChunk.get(), count));
+    for(usize i = 0; i < count; i++)
+    {
+      if(mask != nullptr && !mask->isTrue(chunkStart + i))
+      {
+        continue;
+      }
+      const int32 featureId = featureIdChunk[i];
+      if(featureId < 0 || static_cast<usize>(featureId) >= numFeatures)
+      {
+        continue;
+      }
+      function(featureId, valueChunk[i]);
+    }
+  }
+}
+
+/**
+ * @brief First half of the grouping: counts the values of every feature in each tuple block.
+ */
+template <typename T>
+class CountFeatureValuesImpl
+{
+public:
+  CountFeatureValuesImpl(const Int32AbstractDataStore& featureIds, const AbstractDataStore<T>& source, const std::unique_ptr<MaskCompare>& mask, usize numFeatures, usize blockSize,
+                         std::vector<usize>& blockCounts)
+  : m_FeatureIds(featureIds)
+  , m_Source(source)
+  , m_Mask(mask)
+  , m_NumFeatures(numFeatures)
+  , m_BlockSize(blockSize)
+  , m_BlockCounts(blockCounts)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numTuples = m_FeatureIds.getNumberOfTuples();
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      usize* counts = m_BlockCounts.data() + block * m_NumFeatures;
+      const usize start = block * m_BlockSize;
+      ForEachFeatureValue(m_FeatureIds, m_Source, m_Mask, m_NumFeatures, start, std::min(start + m_BlockSize, numTuples), [counts](int32 featureId, T) { counts[featureId]++; });
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  const AbstractDataStore<T>& m_Source;
+  const std::unique_ptr<MaskCompare>& m_Mask;
+  usize m_NumFeatures = 0;
+  usize m_BlockSize = 0;
+  std::vector<usize>& m_BlockCounts;
+};
+
+/**
+ * @brief Second half of the grouping: every tuple block copies its values into its own slice of each feature. The
+ * slices of a feature are ordered by block, so the values of every feature stay in tuple order.
+ */
+template <typename T>
+class ScatterFeatureValuesImpl
 {
-  if(arrays.empty())
+public:
+  ScatterFeatureValuesImpl(const Int32AbstractDataStore& featureIds, const AbstractDataStore<T>& source, const std::unique_ptr<MaskCompare>& mask, usize numFeatures, usize blockSize,
+                           std::vector<usize>& blockCursors, FeatureGroupedValues<T>& groupedValues)
+  : m_FeatureIds(featureIds)
+  , m_Source(source)
+  , m_Mask(mask)
+  , m_NumFeatures(numFeatures)
+  , m_BlockSize(blockSize)
+  , m_BlockCursors(blockCursors)
+  , m_GroupedValues(groupedValues)
   {
-    return true;
   }
 
-  for(const auto* arrayPtr : arrays)
+  void operator()(const Range& range) const
   {
-    if(arrayPtr == nullptr)
+    const usize numTuples = m_FeatureIds.getNumberOfTuples();
+    for(usize block = range.min(); block < range.max(); block++)
     {
-      continue;
+      usize* cursors = m_BlockCursors.data() + block * m_NumFeatures;
+      const usize* offsets = m_GroupedValues.Offsets.data();
+      T* values = m_GroupedValues.Values.get();
+      const usize start = block * m_BlockSize;
+      ForEachFeatureValue(m_FeatureIds, m_Source, m_Mask, m_NumFeatures, start, std::min(start + m_BlockSize, numTuples),
+                          [cursors, offsets, values](int32 featureId, T value) { values[offsets[featureId] + cursors[featureId]++] = value; });
     }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  const AbstractDataStore<T>& m_Source;
+  const std::unique_ptr<MaskCompare>& m_Mask;
+  usize m_NumFeatures = 0;
+  usize m_BlockSize = 0;
+  std::vector<usize>& m_BlockCursors;
+  FeatureGroupedValues<T>& m_GroupedValues;
+};
 
-    if(!arrayPtr->getIDataStoreRef().getDataFormat().empty())
+/**
+ * @brief Turns the per block counts of a range of features into the start of each block's slice within the feature
+ * and stores the number of values of each feature.
+ */
+class FeatureBlockOffsetsImpl
+{
+public:
+  FeatureBlockOffsetsImpl(std::vector<usize>& blockCounts, usize numBlocks, usize numFeatures, std::vector<usize>& featureCounts)
+  : m_BlockCounts(blockCounts)
+  , m_NumBlocks(numBlocks)
+  , m_NumFeatures(numFeatures)
+  , m_FeatureCounts(featureCounts)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
     {
-      return false;
+      usize running = 0;
+      for(usize block = 0; block < m_NumBlocks; block++)
+      {
+        usize& count = m_BlockCounts[block * m_NumFeatures + featureId];
+        const usize blockCount = count;
+        count = running;
+        running += blockCount;
+      }
+      m_FeatureCounts[featureId] = running;
     }
   }
 
-  return true;
+private:
+  std::vector<usize>& m_BlockCounts;
+  usize m_NumBlocks = 0;
+  usize m_NumFeatures = 0;
+  std::vector<usize>& m_FeatureCounts;
+};
+
+/**
+ * @brief Groups the selected values by feature with a parallel, stable counting sort.
+ */
+template <typename T>
+FeatureGroupedValues<T> GroupValuesByFeature(const Int32Array& featureIdsArray, const DataArray<T>& sourceArray, const std::unique_ptr<MaskCompare>& mask, usize numFeatures)
+{
+  const auto& featureIds = featureIdsArray.getDataStoreRef();
+  const auto& source = sourceArray.getDataStoreRef();
+  const usize numTuples = featureIds.getNumberOfTuples();
+
+  // Keep the per block counters at no more than a quarter of the number of tuples
+  const usize numBlocks = std::clamp<usize>(numTuples / std::max<usize>(4 * numFeatures, 1), 1, k_MaxGroupBlocks);
+  const usize blockSize = (numTuples + numBlocks - 1) / numBlocks;
+  std::vector<usize> blockCounts(numBlocks * numFeatures, 0);
+
+  ParallelDataAlgorithm blockAlg;
+  blockAlg.setRange(0, numBlocks);
+  blockAlg.requireArraysInMemory({&featureIdsArray, &sourceArray});
+  blockAlg.execute(CountFeatureValuesImpl<T>(featureIds, source, mask, numFeatures, blockSize, blockCounts));
+
+  std::vector<usize> featureCounts(numFeatures, 0);
+  ParallelDataAlgorithm featureAlg;
+  featureAlg.setRange(0, numFeatures);
+  featureAlg.execute(FeatureBlockOffsetsImpl(blockCounts, numBlocks, numFeatures, featureCounts));
+
+  FeatureGroupedValues<T> groupedValues;
+  groupedValues.Offsets.assign(numFeatures + 1, 0);
+  std::partial_sum(featureCounts.begin(), featureCounts.end(), groupedValues.Offsets.begin() + 1);
+  groupedValues.Values = std::make_unique<T[]>(groupedValues.Offsets[numFeatures]);
+
+  blockAlg.execute(ScatterFeatureValuesImpl<T>(featureIds, source, mask, numFeatures, blockSize, blockCounts, groupedValues));
+
+  return groupedValues;
 }
 
+/**
+ * @brief Counts the values of a feature with one bin per possible value. Only used for one byte types.
+ */
 template <typename T>
-class ComputeArrayStatisticsByIndexImpl
+std::array<uint64, 256> CountSmallValues(const T* values, usize numValues)
+{
+  std::array<uint64, 256> counts = {};
+  for(usize i = 0; i < numValues; i++)
+  {
+    counts[static_cast<usize>(static_cast<int32>(values[i]) - static_cast<int32>(std::numeric_limits<T>::min()))]++;
+  }
+  return counts;
+}
+
+/**
+ * @brief Returns the value at the given rank (0 is the smallest) of a feature counted with CountSmallValues().
+ */
+template <typename T>
+T SmallValueAtRank(const std::array<uint64, 256>& counts, usize rank)
+{
+  usize seen = 0;
+  for(usize bin = 0; bin < counts.size(); bin++)
+  {
+    seen += counts[bin];
+    if(rank < seen)
+    {
+      return static_cast<T>(static_cast<int32>(bin) + static_cast<int32>(std::numeric_limits<T>::min()));
+    }
+  }
+  return std::numeric_limits<T>::max();
+}
+
+/**
+ * @brief Computes every statistic of a range of features from the grouped values.
+ *
+ * The order dependent statistics (summation, mean and standard deviation) are accumulated in tuple order first. After
+ * that the values of the feature are sorted in place once (or, for one byte types, counted per value) and the mode,
+ * median and number of unique values are read off the sorted run.
+ */
+template <typename T>
+class ComputeFeatureStatisticsImpl
 {
 public:
-  ComputeArrayStatisticsByIndexImpl(bool length, bool min, bool max, bool mean, bool mode, bool stdDeviation, bool summation, bool hist, float64 histmin, float64 histmax, bool histfullrange,
-                                    int32 numBins, bool modalBinRanges, const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIds, const DataArray<T>& source,
-                                    BoolArray* featureHasDataArray, UInt64Array* lengthArray, DataArray<T>* minArray, DataArray<T>* maxArray, Float32Array* meanArray, NeighborList<T>* modeArray,
-                                    Float32Array* stdDevArray, Float32Array* summationArray, UInt64Array* histBinCountsArray, DataArray<T>* histBinRangesArray, UInt64Array* mostPopulatedBinArray,
-                                    NeighborList<T>* modalBinRangesArray, ComputeArrayStatistics* filter)
-  : m_Length(length)
-  , m_Min(min)
-  , m_Max(max)
-  , m_Mean(mean)
-  , m_Mode(mode)
-  , m_StdDeviation(stdDeviation)
-  , m_Summation(summation)
-  , m_Histogram(hist)
-  , m_HistMin(histmin)
-  , m_HistMax(histmax)
-  , m_HistFullRange(histfullrange)
-  , m_NumBins(numBins)
-  , m_ModalBinRanges(modalBinRanges)
-  , m_Mask(mask)
-  , m_FeatureIds(featureIds)
-  , m_Source(source)
+  ComputeFeatureStatisticsImpl(const ComputeArrayStatisticsInputValues* inputValues, FeatureGroupedValues<T>& groupedValues, usize numTuples, BoolArray* featureHasDataArray, UInt64Array* lengthArray,
+                               DataArray<T>* minArray, DataArray<T>* maxArray, Float32Array* meanArray, Float32Array* medianArray, NeighborList<T>* modeArray, Float32Array* stdDevArray,
+                               Float32Array* summationArray, UInt64Array* histBinCountsArray, DataArray<T>* histBinRangesArray, UInt64Array* mostPopulatedBinArray,
+                               NeighborList<T>* modalBinRangesArray, Int32Array* numUniqueValuesArray, ComputeArrayStatistics* filter)
+  : m_InputValues(inputValues)
+  , m_GroupedValues(groupedValues)
+  , m_NumTuples(numTuples)
   , m_FeatureHasDataArray(featureHasDataArray)
   , m_LengthArray(lengthArray)
   , m_MinArray(minArray)
   , m_MaxArray(maxArray)
   , m_MeanArray(meanArray)
+  , m_MedianArray(medianArray)
   , m_ModeArray(modeArray)
   , m_StdDevArray(stdDevArray)
   , m_SummationArray(summationArray)
@@ -74,332 +281,279 @@ public:
   , m_HistBinRangesArray(histBinRangesArray)
   , m_MostPopulatedBinArray(mostPopulatedBinArray)
   , m_ModalBinRangesArray(modalBinRangesArray)
+  , m_NumUniqueValuesArray(numUniqueValuesArray)
   , m_Filter(filter)
   {
   }
 
-  void compute(usize start, usize end) const
+  void operator()(const Range& range) const
   {
-    std::chrono::steady_clock::time_point initialTime = std::chrono::steady_clock::now();
-    auto now = std::chrono::steady_clock::now();
-    const usize milliDelay = 1000;
-
     const std::atomic_bool& shouldCancel = m_Filter->getCancel();
-    const usize numTuples = m_FeatureIds->getNumberOfTuples();
-    const usize numCurrentFeatures = end - start;
-
-    std::vector<uint64> length(numCurrentFeatures, 0);
-    std::vector<T> min(numCurrentFeatures, std::numeric_limits<T>::max());
-    std::vector<T> max(numCurrentFeatures, std::numeric_limits<T>::min());
-    std::vector<float32> summation(numCurrentFeatures, 0);
-    std::vector<std::map<T, uint64>> modalMaps(numCurrentFeatures);
-    usize progressCount = 0;
-
-    usize progressIncrement = numTuples / 100;
-
-    for(usize i = 0; i < numTuples; ++i)
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
     {
       if(shouldCancel)
       {
         return;
       }
-      if(m_Mask != nullptr && !m_Mask->isTrue(i))
+      computeFeature(featureId);
+    }
+  }
+
+private:
+  void computeFeature(usize j) const
+  {
+    T* values = m_GroupedValues.Values.get() + m_GroupedValues.Offsets[j];
+    const usize length = m_GroupedValues.Offsets[j + 1] - m_GroupedValues.Offsets[j];
+
+    T min = std::numeric_limits<T>::max();
+    T max = std::numeric_limits<T>::min();
+    float32 summation = 0;
+    for(usize i = 0; i < length; i++)
+    {
+      if(values[i] < min)
       {
-        continue;
+        min = values[i];
       }
-      for(usize j = 0; j < numCurrentFeatures; j++)
+      if(values[i] > max)
       {
-        if((*m_FeatureIds)[i] != static_cast<int32>(start + j))
-        {
-          continue;
-        }
-
-        ++length[j];
-
-        if(m_Source[i] < min[j])
-        {
-          min[j] = m_Source[i];
-        }
-
-        if(m_Source[i] > max[j])
-        {
-          max[j] = m_Source[i];
-        }
+        max = values[i];
+      }
+      summation = summation + values[i];
+    }
 
-        summation[j] = summation[j] + m_Source[i];
+    m_FeatureHasDataArray->initializeTuple(j, (length > 0));
+    if(m_InputValues->FindLength)
+    {
+      m_LengthArray->initializeTuple(j, length);
+    }
+    if(m_InputValues->FindMin)
+    {
+      m_MinArray->initializeTuple(j, min);
+    }
+    if(m_InputValues->FindMax)
+    {
+      m_MaxArray->initializeTuple(j, max);
+    }
+    if(m_InputValues->FindSummation)
+    {
+      m_SummationArray->initializeTuple(j, summation);
+    }
 
-        modalMaps[j][m_Source[i]]++;
+    float32 meanValue = 0.0f;
+    if(length > 0)
+    {
+      if constexpr(std::is_same_v<T, bool>)
+      {
+        meanValue = static_cast<float32>(summation >= (m_NumTuples - summation));
       }
-
-      progressCount++;
-      now = std::chrono::steady_clock::now();
-      if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
+      else
       {
-        m_Filter->sendThreadSafeInfoMessage(fmt::format("Calculating FeatureHasData Array [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(i) / static_cast<float>(numTuples)));
-        progressCount = 0;
-        initialTime = std::chrono::steady_clock::now();
+        meanValue = summation / static_cast<float32>(length);
       }
     }
-
-    m_Filter->sendThreadSafeInfoMessage(fmt::format("Storing Results Feature/Ensemble Range [{}-{}]", start, end));
-    progressIncrement = numCurrentFeatures / 100;
-    progressCount = 0;
-    std::vector<float32> meanArray;
-    if(m_StdDeviation && !m_Mean)
+    if(m_InputValues->FindMean)
     {
-      meanArray.resize(numCurrentFeatures);
+      m_MeanArray->initializeTuple(j, meanValue);
     }
-    for(usize j = start; j < end; j++)
+
+    if(m_InputValues->FindStdDeviation)
     {
-      if(shouldCancel)
+      float64 sumOfDiffs = 0.0;
+      for(usize i = 0; i < length; i++)
       {
-        return;
+        sumOfDiffs += static_cast<float64>((values[i] - meanValue) * (values[i] - meanValue));
       }
-      const usize localFeatureIndex = j - start;
+      m_StdDevArray->operator[](j) = static_cast<float32>(std::sqrt(sumOfDiffs / static_cast<float64>(length)));
+    }
 
-      m_FeatureHasDataArray->initializeTuple(j, (length[localFeatureIndex] > 0));
-      if(m_Length)
+    // Everything below only depends on which values the feature has, not on their order
+    constexpr bool k_CountValues = sizeof(T) == 1 && std::is_integral_v<T>;
+    std::array<uint64, 256> smallCounts = {};
+    if(m_InputValues->FindMode || m_InputValues->FindMedian || m_InputValues->FindNumUniqueValues)
+    {
+      if constexpr(k_CountValues)
       {
-        m_LengthArray->initializeTuple(j, length[localFeatureIndex]);
+        smallCounts = CountSmallValues(values, length);
       }
-      if(m_Min)
+      else
       {
-        m_MinArray->initializeTuple(j, min[localFeatureIndex]);
+        std::sort(values, values + length);
       }
-      if(m_Max)
+    }
+
+    if(m_InputValues->FindMode && length > 0)
+    {
+      if constexpr(k_CountValues)
       {
-        m_MaxArray->initializeTuple(j, max[localFeatureIndex]);
+        const uint64 maxCount = *std::max_element(smallCounts.begin(), smallCounts.end());
+        for(usize bin = 0; bin < smallCounts.size(); bin++)
+        {
+          if(smallCounts[bin] == maxCount)
+          {
+            m_ModeArray->addEntry(j, static_cast<T>(static_cast<int32>(bin) + static_cast<int32>(std::numeric_limits<T>::min())));
+          }
+        }
       }
-      if(m_Summation)
+      else
       {
-        m_SummationArray->initializeTuple(j, summation[localFeatureIndex]);
+        usize maxCount = 0;
+        for(usize runStart = 0; runStart < length;)
+        {
+          usize runEnd = runStart + 1;
+          while(runEnd < length && !(values[runStart] < values[runEnd]))
+          {
+            runEnd++;
+          }
+          maxCount = std::max(maxCount, runEnd - runStart);
+          runStart = runEnd;
+        }
+        for(usize runStart = 0; runStart < length;)
+        {
+          usize runEnd = runStart + 1;
+          while(runEnd < length && !(values[runStart] < values[runEnd]))
+          {
+            runEnd++;
+          }
+          if(runEnd - runStart == maxCount)
+          {
+            m_ModeArray->addEntry(j, values[runStart]);
+          }
+          runStart = runEnd;
+        }
       }
+    }
 
-      float32 meanValue = 0.0f;
-      if(length[localFeatureIndex] > 0)
+    if(m_InputValues->FindHistogram && m_HistBinCountsArray != nullptr && m_HistBinRangesArray != nullptr)
+    {
+      computeHistogram(j, values, length, min, max);
+    }
+
+    if(m_InputValues->FindMedian)
+    {
+      float32 medVal = 0.0f;
+      if(length > 0)
       {
-        if constexpr(std::is_same_v<T, bool>)
+        auto valueAtRank = [&](usize rank) -> T {
+          if constexpr(k_CountValues)
+          {
+            return SmallValueAtRank<T>(smallCounts, rank);
+          }
+          else
+          {
+            return values[rank];
+          }
+        };
+        if(length % 2 == 1)
         {
-          meanValue = static_cast<float32>(summation[localFeatureIndex] >= (numTuples - summation[localFeatureIndex]));
+          medVal = valueAtRank(length / 2);
         }
         else
         {
-          meanValue = summation[localFeatureIndex] / static_cast<float32>(length[localFeatureIndex]);
+          medVal = (valueAtRank(length / 2 - 1) + valueAtRank(length / 2)) * 0.5f;
         }
       }
+      m_MedianArray->setValue(j, medVal);
+    }
 
-      if(m_Mean)
-      {
-        m_MeanArray->initializeTuple(j, meanValue);
-      }
-      else if(m_StdDeviation)
+    if(m_InputValues->FindNumUniqueValues)
+    {
+      int32 numUnique = 0;
+      if constexpr(k_CountValues)
       {
-        meanArray[localFeatureIndex] = meanValue;
+        numUnique = static_cast<int32>(std::count_if(smallCounts.begin(), smallCounts.end(), [](uint64 count) { return count > 0; }));
       }
-
-      if(m_Mode)
+      else
       {
-        if(!modalMaps[localFeatureIndex].empty())
+        for(usize i = 0; i < length; i++)
         {
-          // Find the maximum occurrence
-          auto pr = std::max_element(modalMaps[localFeatureIndex].begin(), modalMaps[localFeatureIndex].end(), [](const auto& x, const auto& y) { return x.second < y.second; });
-          int maxCount = pr->second;
-
-          // Store all values that have this maximum occurrence under the proper feature id
-          for(const auto& modalPair : modalMaps[localFeatureIndex])
+          if(i == 0 || values[i - 1] < values[i])
           {
-            if(modalPair.second == maxCount)
-            {
-              m_ModeArray->addEntry(j, modalPair.first);
-            }
+            numUnique++;
           }
         }
       }
+      m_NumUniqueValuesArray->setValue(j, numUnique);
+    }
+  }
 
-      AbstractDataStore<uint64>* binCountsStorePtr = nullptr;
-      if(m_HistBinCountsArray != nullptr)
-      {
-        binCountsStorePtr = m_HistBinCountsArray->getDataStore();
-      }
+  void computeHistogram(usize j, const T* values, usize length, T min, T max) const
+  {
+    const int32 numBins = m_InputValues->NumBins;
+    std::vector<T> ranges(numBins * 2);
+    std::vector<uint64> histogram(numBins, 0);
+    if(length > 0)
+    {
+      T histMin = static_cast<T>(m_InputValues->MinRange);
+      T histMax = static_cast<T>(m_InputValues->MaxRange);
 
-      AbstractDataStore<T>* binRangesStorePtr = nullptr;
-      if(m_HistBinRangesArray != nullptr)
+      if(m_InputValues->UseFullRange)
       {
-        binRangesStorePtr = m_HistBinRangesArray->getDataStore();
+        histMin = min;
+        histMax = max + static_cast<T>(1.0);
       }
 
-      AbstractDataStore<uint64>* mostPopulatedBinDataStorePtr = nullptr;
-      if(m_MostPopulatedBinArray != nullptr)
+      HistogramUtilities::serial::FillBinRanges(ranges, std::make_pair(histMin, histMax), numBins);
+
+      const float32 increment = HistogramUtilities::serial::CalculateIncrement(histMin, histMax, numBins);
+      if(std::fabs(increment) < 1E-10)
       {
-        mostPopulatedBinDataStorePtr = m_MostPopulatedBinArray->getDataStore();
+        histogram[0] = length;
       }
-
-      if(m_Histogram && binCountsStorePtr != nullptr && binRangesStorePtr != nullptr)
+      else
       {
-        std::vector<T> ranges(m_NumBins * 2);
-        std::vector<uint64> histogram(m_NumBins, 0);
-        if(length[localFeatureIndex] > 0)
+        for(usize i = 0; i < length; i++)
         {
-          T histMin = static_cast<T>(m_HistMin);
-          T histMax = static_cast<T>(m_HistMax);
-
-          if(m_HistFullRange)
-          {
-            histMin = min[localFeatureIndex];
-            histMax = max[localFeatureIndex] + static_cast<T>(1.0);
-          }
-
-          HistogramUtilities::serial::FillBinRanges(ranges, std::make_pair(histMin, histMax), m_NumBins);
-
-          const float32 increment = HistogramUtilities::serial::CalculateIncrement(histMin, histMax, m_NumBins);
-          if(std::fabs(increment) < 1E-10)
+          const auto bin = static_cast<int32>(HistogramUtilities::serial::CalculateBin(values[i], histMin, increment)); // find bin for this input array value
+          if((bin >= 0) && (bin < numBins))                                                                              // make certain bin is in range
           {
-            histogram[0] = length[localFeatureIndex];
+            histogram[bin]++; // increment histogram element corresponding to this input array value
           }
-          else
-          {
-            for(usize i = 0; i < numTuples; ++i)
-            {
-              if(shouldCancel)
-              {
-                return;
-              }
-              if(m_Mask != nullptr && !m_Mask->isTrue(i))
-              {
-                continue;
-              }
-              if((*m_FeatureIds)[i] != static_cast<int32>(j))
-              {
-                continue;
-              }
-              const T value = m_Source[i];
-              const auto bin = static_cast<int32>(HistogramUtilities::serial::CalculateBin(value, histMin, increment)); // find bin for this input array value
-              if((bin >= 0) && (bin < m_NumBins))                                                                       // make certain bin is in range
-              {
-                histogram[bin]++; // increment histogram element corresponding to this input array value
-              }
-            } // end of numTuples loop
-          }   // end of increment else
-
-          if(m_ModalBinRanges)
-          {
-            if(std::fabs(increment) < 1E-10)
-            {
-              m_ModalBinRangesArray->addEntry(j, histMin);
-              m_ModalBinRangesArray->addEntry(j, histMax);
-            }
-            else
-            {
-              auto modeList = m_ModeArray->getList(j);
-              for(int i = 0; i < modeList->size(); i++)
-              {
-                const T mode = modeList->at(i);
-                const auto modalBin = HistogramUtilities::serial::CalculateBin(mode, histMin, increment);
-                if((modalBin >= 0) && (modalBin < m_NumBins)) // make certain bin is in range
-                {
-                  m_ModalBinRangesArray->addEntry(j, ranges[modalBin]);
-                  m_ModalBinRangesArray->addEntry(j, ranges[modalBin + 1]);
-                }
-              }
-            }
-          }
-        } // end of length if
-
-        binCountsStorePtr->setTuple(j, histogram);
-        binRangesStorePtr->setTuple(j, ranges);
-
-        auto maxElementIt = std::max_element(histogram.begin(), histogram.end());
-        uint64 index = std::distance(histogram.begin(), maxElementIt);
-        mostPopulatedBinDataStorePtr->setComponent(j, 0, index);
-        mostPopulatedBinDataStorePtr->setComponent(j, 1, histogram[index]);
-      } // end of m_Histogram if
-
-      progressCount++;
-      now = std::chrono::steady_clock::now();
-      if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
-      {
-        m_Filter->sendThreadSafeInfoMessage(fmt::format("Storing data for feature/ensembles [{}-{}] {}/{}", start, end, j, end));
-        progressCount = 0;
-        initialTime = std::chrono::steady_clock::now();
+        }
       }
-    }
 
-    if(m_StdDeviation)
-    {
-      // https://www.khanacademy.org/math/statistics-probability/summarizing-quantitative-data/variance-standard-deviation-population/a/calculating-standard-deviation-step-by-step
-      m_Filter->sendThreadSafeInfoMessage(fmt::format("Computing StdDev Feature/Ensemble [{}-{}]", start, end));
-      // This should probably be done with Kahan Summation instead
-      std::vector<float64> sumOfDiffs(numCurrentFeatures, 0.0f);
-      progressCount = 0;
-
-      for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
+      if(m_InputValues->FindModalBinRanges)
       {
-        if(shouldCancel)
-        {
-          return;
-        }
-        // Is the value in a mask and if so, is that mask TRUE
-        if(m_Mask != nullptr && !m_Mask->isTrue(tupleIndex))
+        if(std::fabs(increment) < 1E-10)
         {
-          continue;
+          m_ModalBinRangesArray->addEntry(j, histMin);
+          m_ModalBinRangesArray->addEntry(j, histMax);
         }
-        // Is the featureId within our range that we care about
-        const int32 featureId = (*m_FeatureIds)[tupleIndex];
-        if(featureId < start || featureId >= end)
-        {
-          continue;
-        }
-
-        const float32 meanVal = m_Mean ? m_MeanArray->operator[](featureId) : meanArray[featureId - start];
-        sumOfDiffs[featureId - start] += static_cast<float64>((m_Source[tupleIndex] - meanVal) * (m_Source[tupleIndex] - meanVal));
-
-        progressCount++;
-        now = std::chrono::steady_clock::now();
-        if(progressCount > progressIncrement && std::chrono::duration_cast<std::chrono::milliseconds>(now - initialTime).count() > milliDelay)
+        else
         {
-          m_Filter->sendThreadSafeInfoMessage(fmt::format("StdDev Calculation Feature/Ensemble [{}-{}]: {:.2f}%", start, end, 100.0f * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-          progressCount = 0;
-          initialTime = std::chrono::steady_clock::now();
+          auto modeList = m_ModeArray->getList(j);
+          for(int i = 0; i < modeList->size(); i++)
+          {
+            const T mode = modeList->at(i);
+            const auto modalBin = HistogramUtilities::serial::CalculateBin(mode, histMin, increment);
+            if((modalBin >= 0) && (modalBin < numBins)) // make certain bin is in range
+            {
+              m_ModalBinRangesArray->addEntry(j, ranges[modalBin]);
+              m_ModalBinRangesArray->addEntry(j, ranges[modalBin + 1]);
+            }
+          }
         }
       }
-
-      for(usize j = 0; j < numCurrentFeatures; j++)
-      {
-        // Set the value into the output array
-        const uint64 lengthVal = m_Length ? m_LengthArray->operator[](j + start) : length[j];
-        m_StdDevArray->operator[](j + start) = static_cast<float32>(std::sqrt(sumOfDiffs[j] / static_cast<float64>(lengthVal)));
-      }
     }
 
-  } // end of compute
+    m_HistBinCountsArray->getDataStoreRef().setTuple(j, histogram);
+    m_HistBinRangesArray->getDataStoreRef().setTuple(j, ranges);
 
-  void operator()(const Range& range) const
-  {
-    compute(range.min(), range.max());
+    auto maxElementIt = std::max_element(histogram.begin(), histogram.end());
+    uint64 index = std::distance(histogram.begin(), maxElementIt);
+    auto& mostPopulatedBinStore = m_MostPopulatedBinArray->getDataStoreRef();
+    mostPopulatedBinStore.setComponent(j, 0, index);
+    mostPopulatedBinStore.setComponent(j, 1, histogram[index]);
   }
 
-private:
-  bool m_Length;
-  bool m_Min;
-  bool m_Max;
-  bool m_Mean;
-  bool m_Mode;
-  bool m_StdDeviation;
-  bool m_Summation;
-  bool m_Histogram;
-  bool m_ModalBinRanges;
-  float64 m_HistMin;
-  float64 m_HistMax;
-  bool m_HistFullRange;
-  int32 m_NumBins;
-  const std::unique_ptr<MaskCompare>& m_Mask = nullptr;
-  const Int32Array* m_FeatureIds = nullptr;
-  const DataArray<T>& m_Source;
+  const ComputeArrayStatisticsInputValues* m_InputValues = nullptr;
+  FeatureGroupedValues<T>& m_GroupedValues;
+  usize m_NumTuples = 0;
   BoolArray* m_FeatureHasDataArray = nullptr;
   UInt64Array* m_LengthArray = nullptr;
   DataArray<T>* m_MinArray = nullptr;
   DataArray<T>* m_MaxArray = nullptr;
   Float32Array* m_MeanArray = nullptr;
+  Float32Array* m_MedianArray = nullptr;
   NeighborList<T>* m_ModeArray = nullptr;
   Float32Array* m_StdDevArray = nullptr;
   Float32Array* m_SummationArray = nullptr;
@@ -407,94 +561,7 @@ private:
   DataArray<T>* m_HistBinRangesArray = nullptr;
   UInt64Array* m_MostPopulatedBinArray = nullptr;
   NeighborList<T>* m_ModalBinRangesArray = nullptr;
-  ComputeArrayStatistics* m_Filter = nullptr;
-};
-
-template <typename T>
-class FindArrayMedianUniqueByIndexImpl
-{
-public:
-  FindArrayMedianUniqueByIndexImpl(const std::unique_ptr<MaskCompare>& mask, const Int32Array* featureIds, const DataArray<T>& source, bool findMedian, bool findNumUnique, Float32Array* medianArray,
-                                   Int32Array* numUniqueValuesArray, DataArray<uint64>* lengthArray, ComputeArrayStatistics* filter)
-  : m_FindMedian(findMedian)
-  , m_FindNumUniqueValues(findNumUnique)
-  , m_MedianArray(medianArray)
-  , m_NumUniqueValuesArray(numUniqueValuesArray)
-  , m_Mask(mask)
-  , m_FeatureIds(featureIds)
-  , m_Source(source)
-  , m_LengthArray(lengthArray)
-  , m_Filter(filter)
-  {
-  }
-
-  virtual ~FindArrayMedianUniqueByIndexImpl() = default;
-
-  FindArrayMedianUniqueByIndexImpl(const FindArrayMedianUniqueByIndexImpl&) = default;           // Copy Constructor Not Implemented
-  FindArrayMedianUniqueByIndexImpl(FindArrayMedianUniqueByIndexImpl&&) noexcept = default;       // Move Constructor Not Implemented
-  FindArrayMedianUniqueByIndexImpl& operator=(const FindArrayMedianUniqueByIndexImpl&) = delete; // Copy Assignment Not Implemented
-  FindArrayMedianUniqueByIndexImpl& operator=(FindArrayMedianUniqueByIndexImpl&&) = delete;      // Move Assignment Not Implemented
-
-  void compute(usize start, usize end) const
-  {
-    m_Filter->sendThreadSafeInfoMessage(fmt::format("Starting Median Array Calculation: Feature/Ensemble [{}-{}]", start, end));
-
-    const usize numFeatureSources = end - start;
-    // Create the arrays that will collect the values from the arrays. allocate them to the correct size based on the length array
-    std::vector<std::vector<T>> featureSources(numFeatureSources);
-    for(usize featureSourceIndex = 0; featureSourceIndex < numFeatureSources; featureSourceIndex++)
-    {
-      featureSources[featureSourceIndex].reserve(m_LengthArray->operator[](featureSourceIndex + start));
-    }
-    const usize numTuples = m_Source.getNumberOfTuples();
-    const auto& featureIds = m_FeatureIds->getDataStoreRef();
-    const auto& source = m_Source.getDataStoreRef();
-
-    for(usize tupleIndex = 0; tupleIndex < numTuples; tupleIndex++)
-    {
-      // Is the value in a mask and if so, is that mask TRUE
-      if(m_Mask != nullptr && !m_Mask->isTrue(tupleIndex))
-      {
-        continue;
-      }
-      // Is the featureId within our range that we care about
-      const int32 featureId = featureIds[tupleIndex];
-      if(featureId < start || featureId >= end)
-      {
-        continue;
-      }
-      featureSources[featureId - start].push_back(source[tupleIndex]);
-    }
-
-    for(usize featureSourceIndex = 0; featureSourceIndex < numFeatureSources; featureSourceIndex++)
-    {
-      if(m_FindMedian)
-      {
-        const float32 val = StatisticsCalculations::findMedian(featureSources[featureSourceIndex]);
-        m_MedianArray->setValue(featureSourceIndex + start, val);
-      }
-      if(m_FindNumUniqueValues)
-      {
-        const auto val = StatisticsCalculations::findNumUniqueValues(featureSources[featureSourceIndex]);
-        m_NumUniqueValuesArray->setValue(featureSourceIndex + start, val);
-      }
-    }
-  }
-
-  void operator()(const Range& range) const
-  {
-    compute(range.min(), range.max());
-  }
-
-private:
-  bool m_FindMedian;
-  bool m_FindNumUniqueValues;
-  Float32Array* m_MedianArray;
-  Int32Array* m_NumUniqueValuesArray;
-  const std::unique_ptr<MaskCompare>& m_Mask = nullptr;
-  const Int32Array* m_FeatureIds = nullptr;
-  const DataArray<T>& m_Source;
-  const DataArray<uint64>* m_LengthArray = nullptr;
+  Int32Array* m_NumUniqueValuesArray = nullptr;
   ComputeArrayStatistics* m_Filter = nullptr;
 };
 
@@ -700,77 +767,37 @@ void FindStatistics(const DataArray<T>& source, const Int32Array* featureIds, co
     auto* minArrayPtr = dynamic_cast<DataArray<T>*>(arrays[1]);
     auto* maxArrayPtr = dynamic_cast<DataArray<T>*>(arrays[2]);
     auto* meanArrayPtr = dynamic_cast<Float32Array*>(arrays[3]);
+    auto* medianArrayPtr = dynamic_cast<Float32Array*>(arrays[4]);
     auto* modeArrayPtr = dynamic_cast<NeighborList<T>*>(arrays[5]);
     auto* stdDevArrayPtr = dynamic_cast<Float32Array*>(arrays[6]);
     auto* summationArrayPtr = dynamic_cast<Float32Array*>(arrays[7]);
 
     auto* histBinCountsArrayPtr = dynamic_cast<UInt64Array*>(arrays[8]);
+    auto* numUniqueValuesArrayPtr = dynamic_cast<Int32Array*>(arrays[9]);
     auto* histBinRangesArrayPtr = dynamic_cast<DataArray<T>*>(arrays[12]);
     auto* mostPopulatedBinPtr = dynamic_cast<UInt64Array*>(arrays[10]);
     auto* modalBinsArrayPtr = dynamic_cast<NeighborList<T>*>(arrays[11]);
 
     auto* featureHasDataPtr = dynamic_cast<BoolArray*>(arrays[13]);
 
-    IParallelAlgorithm::AlgorithmArrays indexAlgArrays;
-    indexAlgArrays.push_back(&source);
-    indexAlgArrays.push_back(featureHasDataPtr);
-    indexAlgArrays.push_back(lengthArrayPtr);
-    indexAlgArrays.push_back(minArrayPtr);
-    indexAlgArrays.push_back(maxArrayPtr);
-    indexAlgArrays.push_back(meanArrayPtr);
-    indexAlgArrays.push_back(stdDevArrayPtr);
-    indexAlgArrays.push_back(summationArrayPtr);
-    indexAlgArrays.push_back(histBinCountsArrayPtr);
-    indexAlgArrays.push_back(histBinRangesArrayPtr);
-    indexAlgArrays.push_back(mostPopulatedBinPtr);
-
-#ifdef SIMPLNX_ENABLE_MULTICORE
-    if(CheckArraysInMemory(indexAlgArrays))
-    {
-      const tbb::simple_partitioner simplePartitioner;
-      const size_t grainSize = 500;
-      const tbb::blocked_range<size_t> tbbRange(0, numFeatures, grainSize);
-      tbb::parallel_for(tbbRange,
-                        ComputeArrayStatisticsByIndexImpl<T>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
-                                                             inputValues->FindStdDeviation, inputValues->FindSummation, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
-                                                             inputValues->UseFullRange, inputValues->NumBins, inputValues->FindModalBinRanges, mask, featureIds, source, featureHasDataPtr,
-                                                             lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr,
-                                                             histBinRangesArrayPtr, mostPopulatedBinPtr, modalBinsArrayPtr, filter),
-                        simplePartitioner);
-    }
-    else
+    // Group the values by feature once, then every statistic of a feature comes out of its own contiguous run
+    filter->sendThreadSafeInfoMessage("Grouping values by feature...");
+    FeatureGroupedValues<T> groupedValues = GroupValuesByFeature(*featureIds, source, mask, numFeatures);
+    if(filter->getCancel())
     {
-      ParallelDataAlgorithm indexAlg;
-      indexAlg.setRange(0, numFeatures);
-      indexAlg.requireArraysInMemory(indexAlgArrays);
-      indexAlg.execute(ComputeArrayStatisticsByIndexImpl<T>(inputValues->FindLength, inputValues->FindMin, inputValues->FindMax, inputValues->FindMean, inputValues->FindMode,
-                                                            inputValues->FindStdDeviation, inputValues->FindSummation, inputValues->FindHistogram, inputValues->MinRange, inputValues->MaxRange,
-                                                            inputValues->UseFullRange, inputValues->NumBins, inputValues->FindModalBinRanges, mask, featureIds, source, featureHasDataPtr,
-                                                            lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr,
-                                                            histBinRangesArrayPtr, mostPopulatedBinPtr, modalBinsArrayPtr, filter));
+      return;
     }
-#endif
 
-    if(inputValues->FindMedian || inputValues->FindNumUniqueValues)
-    {
-      filter->sendThreadSafeInfoMessage("Starting Median Calculation..");
-
-      auto* medianArrayPtr = dynamic_cast<Float32Array*>(arrays[4]);
-      auto* numUniqueValuesArrayPtr = dynamic_cast<Int32Array*>(arrays[9]);
-
-      IParallelAlgorithm::AlgorithmArrays medianAlgArrays;
-      medianAlgArrays.push_back(featureIds);
-      medianAlgArrays.push_back(&source);
-      medianAlgArrays.push_back(medianArrayPtr);
-      medianAlgArrays.push_back(numUniqueValuesArrayPtr);
-      medianAlgArrays.push_back(lengthArrayPtr);
-
-      ParallelDataAlgorithm medianDataAlg;
-      medianDataAlg.requireArraysInMemory(medianAlgArrays);
-      medianDataAlg.setRange(0, numFeatures);
-      medianDataAlg.execute(
-          FindArrayMedianUniqueByIndexImpl<T>(mask, featureIds, source, inputValues->FindMedian, inputValues->FindNumUniqueValues, medianArrayPtr, numUniqueValuesArrayPtr, lengthArrayPtr, filter));
-    }
+    filter->sendThreadSafeInfoMessage("Computing feature statistics...");
+    IParallelAlgorithm::AlgorithmArrays indexAlgArrays = {featureHasDataPtr,    lengthArrayPtr,        minArrayPtr,           maxArrayPtr,        meanArrayPtr,           medianArrayPtr,
+                                                          stdDevArrayPtr,       summationArrayPtr,     histBinCountsArrayPtr, histBinRangesArrayPtr, mostPopulatedBinPtr, numUniqueValuesArrayPtr};
+
+    ParallelDataAlgorithm indexAlg;
+    indexAlg.setRange(0, numFeatures);
+    indexAlg.requireArraysInMemory(indexAlgArrays);
+    indexAlg.execute(ComputeFeatureStatisticsImpl<T>(inputValues, groupedValues, source.getNumberOfTuples(), featureHasDataPtr, lengthArrayPtr, minArrayPtr, maxArrayPtr, meanArrayPtr, medianArrayPtr,
+                                                     modeArrayPtr, stdDevArrayPtr, summationArrayPtr, histBinCountsArrayPtr, histBinRangesArrayPtr, mostPopulatedBinPtr, modalBinsArrayPtr,
+                                                     numUniqueValuesArrayPtr, filter));
   }
   else
   {
@@ -4,14 +4,13 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/DataStructure/Geometry/VertexGeom.hpp"
+#include "simplnx/Utilities/BoundingVolumeHierarchy.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
-#include "simplnx/Utilities/RTree.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-using RTreeType = RTree<size_t, float, 3, float>;
 using SharedTriListT = AbstractDataStore<IGeometry::SharedTriList::value_type>;
 using SharedVertexListT = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
 
@@ -301,11 +300,15 @@ float32 PointTriangleDistance(const Vec3fa& point, const Vec3fa& vert0, const Ve
   return dist;
 }
 
+/**
+ * @brief Finds the closest triangle of every source vertex with a nearest primitive query on the
+ * bounding volume hierarchy of the triangles. The hierarchy is shared read-only by all threads.
+ */
 class ComputeVertexToTriangleDistancesImpl
 {
 public:
   ComputeVertexToTriangleDistancesImpl(ComputeVertexToTriangleDistances* filter, const SharedTriListT& triangles, const SharedVertexListT& vertices, SharedVertexListT& sourcePoints,
-                                       Float32AbstractDataStore& distances, Int64AbstractDataStore& closestTri, const Float64AbstractDataStore& normals, const RTreeType rtree)
+                                       Float32AbstractDataStore& distances, Int64AbstractDataStore& closestTri, const Float64AbstractDataStore& normals, const BoundingVolumeHierarchy& hierarchy)
   : m_Filter(filter)
   , m_SharedTriangleList(triangles)
   , m_TriangleVertices(vertices)
@@ -313,7 +316,7 @@ public:
   , m_Distances(distances)
   , m_ClosestTri(closestTri)
   , m_Normals(normals)
-  , m_RTree(rtree)
+  , m_Hierarchy(hierarchy)
   {
   }
   virtual ~ComputeVertexToTriangleDistancesImpl() = default;
@@ -323,74 +326,43 @@ public:
     compute(range.min(), range.max());
   }
 
+  std::array<Vec3fa, 3> getTriangleVertices(usize t) const
+  {
+    auto p = static_cast<int64>(m_SharedTriangleList[t * 3 + 0]);
+    auto q = static_cast<int64>(m_SharedTriangleList[t * 3 + 1]);
+    auto r = static_cast<int64>(m_SharedTriangleList[t * 3 + 2]);
+    return {Vec3fa(m_TriangleVertices[p * 3 + 0], m_TriangleVertices[p * 3 + 1], m_TriangleVertices[p * 3 + 2]),
+            Vec3fa(m_TriangleVertices[q * 3 + 0], m_TriangleVertices[q * 3 + 1], m_TriangleVertices[q * 3 + 2]),
+            Vec3fa(m_TriangleVertices[r * 3 + 0], m_TriangleVertices[r * 3 + 1], m_TriangleVertices[r * 3 + 2])};
+  }
+
   void compute(usize start, usize end) const
   {
     int64 counter = 0;
     auto progIncrement = static_cast<int64>((end - start) / 100);
 
-    size_t numTuples = m_SharedTriangleList.getNumberOfTuples(); // allocate vector of all possible indexes
     for(usize v = start; v < end; v++)
     {
-      Vec3fa sourcePoint(m_SourcePoints[3 * v], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]);
-
-      std::vector<size_t> hitTriangleIds;
-      std::function<bool(size_t)> func = [&](size_t triangleIndex) {
-        hitTriangleIds.push_back(triangleIndex);
-        return true; // keep going
-      };
-
-      int32 nhits = m_RTree.Search(sourcePoint.data(), sourcePoint.data(), func);
-      if(nhits > 0) // Point is within the RTree bounding box so just loop over those triangles that are in the RTree
+      if(m_Filter->getCancel())
       {
-        for(const auto t : hitTriangleIds)
-        {
-          if(m_Filter->getCancel())
-          {
-            return;
-          }
-
-          auto p = static_cast<int64>(m_SharedTriangleList[t * 3 + 0]);
-          auto q = static_cast<int64>(m_SharedTriangleList[t * 3 + 1]);
-          auto r = static_cast<int64>(m_SharedTriangleList[t * 3 + 2]);
-          const Vec3fa point = {m_SourcePoints[3 * v + 0], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]};
-          const Vec3fa v0(m_TriangleVertices[p * 3 + 0], m_TriangleVertices[p * 3 + 1], m_TriangleVertices[p * 3 + 2]);
-          const Vec3fa v1(m_TriangleVertices[q * 3 + 0], m_TriangleVertices[q * 3 + 1], m_TriangleVertices[q * 3 + 2]);
-          const Vec3fa v2(m_TriangleVertices[r * 3 + 0], m_TriangleVertices[r * 3 + 1], m_TriangleVertices[r * 3 + 2]);
-
-          float32 d = PointTriangleDistance(point, v0, v1, v2, static_cast<int64>(t), m_Normals);
-
-          if(std::abs(d) < std::abs(m_Distances[v]))
-          {
-            m_Distances[v] = d;
-            m_ClosestTri[v] = static_cast<int64>(t);
-          }
-        }
+        return;
       }
-      else // Point was not in the RTree, so we need to search against every triangle
+
+      const Vec3fa point = {m_SourcePoints[3 * v + 0], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]};
+      const Point3Df queryPoint(point[0], point[1], point[2]);
+
+      // Only the squared distance is needed to find the closest triangle
+      auto squaredDistance = [this, &point](usize t) {
+        const std::array<Vec3fa, 3> triVerts = getTriangleVertices(t);
+        const Vec3fa diffPoint = point - closestPointTriangle(point, triVerts[0], triVerts[1], triVerts[2]);
+        return diffPoint.dot(diffPoint);
+      };
+      const BoundingVolumeHierarchy::NearestResult nearest = m_Hierarchy.findNearest(queryPoint, squaredDistance);
+      if(nearest.PrimitiveIndex != BoundingVolumeHierarchy::k_InvalidIndex)
       {
-        for(size_t t = 0; t < numTuples; t++)
-        {
-          if(m_Filter->getCancel())
-          {
-            return;
-          }
-
-          auto p = static_cast<int64>(m_SharedTriangleList[t * 3 + 0]);
-          auto q = static_cast<int64>(m_SharedTriangleList[t * 3 + 1]);
-          auto r = static_cast<int64>(m_SharedTriangleList[t * 3 + 2]);
-          const Vec3fa point = {m_SourcePoints[3 * v + 0], m_SourcePoints[3 * v + 1], m_SourcePoints[3 * v + 2]};
-          const Vec3fa v0(m_TriangleVertices[p * 3 + 0], m_TriangleVertices[p * 3 + 1], m_TriangleVertices[p * 3 + 2]);
-          const Vec3fa v1(m_TriangleVertices[q * 3 + 0], m_TriangleVertices[q * 3 + 1], m_TriangleVertices[q * 3 + 2]);
-          const Vec3fa v2(m_TriangleVertices[r * 3 + 0], m_TriangleVertices[r * 3 + 1], m_TriangleVertices[r * 3 + 2]);
-
-          float32 d = PointTriangleDistance(point, v0, v1, v2, static_cast<int64>(t), m_Normals);
-
-          if(std::abs(d) < std::abs(m_Distances[v]))
-          {
-            m_Distances[v] = d;
-            m_ClosestTri[v] = static_cast<int64>(t);
-          }
-        }
+        const std::array<Vec3fa, 3> triVerts = getTriangleVertices(nearest.PrimitiveIndex);
+        m_Distances[v] = PointTriangleDistance(point, triVerts[0], triVerts[1], triVerts[2], static_cast<int64>(nearest.PrimitiveIndex), m_Normals);
+        m_ClosestTri[v] = static_cast<int64>(nearest.PrimitiveIndex);
       }
 
       if(m_Distances[v] >= 0.0f)
@@ -422,25 +394,8 @@ private:
   Float32AbstractDataStore& m_Distances;
   Int64AbstractDataStore& m_ClosestTri;
   const Float64AbstractDataStore& m_Normals;
-  const RTreeType m_RTree;
+  const BoundingVolumeHierarchy& m_Hierarchy;
 };
-
-void GetBoundingBoxAtTri(const SharedTriListT& triList, const SharedVertexListT& vertList, size_t triId, nonstd::span<float> bounds)
-{
-  size_t v0Index = triList[triId * 3 + 0] * 3;
-  size_t v1Index = triList[triId * 3 + 1] * 3;
-  size_t v2Index = triList[triId * 3 + 2] * 3;
-
-  auto xMinMax = std::minmax({vertList[v0Index + 0], vertList[v1Index + 0], vertList[v2Index + 0]});
-  auto yMinMax = std::minmax({vertList[v0Index + 1], vertList[v1Index + 1], vertList[v2Index + 1]});
-  auto zMinMax = std::minmax({vertList[v0Index + 2], vertList[v1Index + 2], vertList[v2Index + 2]});
-  bounds[0] = xMinMax.first;
-  bounds[1] = yMinMax.first;
-  bounds[2] = zMinMax.first;
-  bounds[3] = xMinMax.second;
-  bounds[4] = yMinMax.second;
-  bounds[5] = zMinMax.second;
-}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -487,18 +442,11 @@ Result<> ComputeVertexToTriangleDistances::operator()()
   m_TotalElements = vertexGeom.getNumberOfVertices();
 
   auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->TriangleDataContainer);
-  auto numTris = static_cast<usize>(triangleGeom.getNumberOfFaces());
   const SharedTriListT& triangles = triangleGeom.getFaces()->getDataStoreRef();
   const SharedVertexListT& vertices = triangleGeom.getVertices()->getDataStoreRef();
 
-  RTreeType m_RTree;
-  // Populate the RTree
-  std::vector<float> triBoundsArray(numTris * 6, 0.0F);
-  for(size_t triIndex = 0; triIndex < numTris; triIndex++)
-  {
-    GetBoundingBoxAtTri(triangles, vertices, triIndex, {triBoundsArray.data() + (6 * triIndex), 6});
-    m_RTree.Insert(triBoundsArray.data() + (6 * triIndex), triBoundsArray.data() + (6 * triIndex) + 3, triIndex); // Note, all values including zero are fine in this version
-  }
+  // Bulk load the triangles into one hierarchy that every thread queries
+  const BoundingVolumeHierarchy hierarchy = BoundingVolumeHierarchy::CreateFromTriangles(triangles, vertices);
 
   const auto& normalsArray = m_DataStructure.getDataAs<Float64Array>(m_InputValues->TriangleNormalsArrayPath)->getDataStoreRef();
   auto& distancesArray = m_DataStructure.getDataAs<Float32Array>(m_InputValues->DistancesArrayPath)->getDataStoreRef();
@@ -510,7 +458,7 @@ Result<> ComputeVertexToTriangleDistances::operator()()
   ParallelDataAlgorithm dataAlg;
   dataAlg.setParallelizationEnabled(true);
   dataAlg.setRange(0, m_TotalElements);
-  dataAlg.execute(ComputeVertexToTriangleDistancesImpl(this, triangles, vertices, sourceVertices, distancesArray, closestTriangleIdsArray, normalsArray, m_RTree));
+  dataAlg.execute(ComputeVertexToTriangleDistancesImpl(this, triangles, vertices, sourceVertices, distancesArray, closestTriangleIdsArray, normalsArray, hierarchy));
 
   return {};
 }
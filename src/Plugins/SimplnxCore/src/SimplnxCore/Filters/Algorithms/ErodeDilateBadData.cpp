@@ -4,7 +4,8 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+#include "simplnx/Utilities/FaceNeighborStencil.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 using namespace nx::core;
 namespace
@@ -12,58 +13,36 @@ namespace
 class ErodeDilateBadDataTransferDataImpl
 {
 public:
-  ErodeDilateBadDataTransferDataImpl() = delete;
-  ErodeDilateBadDataTransferDataImpl(const ErodeDilateBadDataTransferDataImpl&) = default;
-
-  ErodeDilateBadDataTransferDataImpl(ErodeDilateBadData* filterAlg, usize totalPoints, ChoicesParameter::ValueType operation, const Int32AbstractDataStore& featureIds,
-                                     const std::vector<int64>& neighbors, const std::shared_ptr<IDataArray>& dataArrayPtr)
-  : m_FilterAlg(filterAlg)
-  , m_TotalPoints(totalPoints)
-  , m_Operation(operation)
+  ErodeDilateBadDataTransferDataImpl(ChoicesParameter::ValueType operation, const Int32AbstractDataStore& featureIds, const std::vector<int64>& neighbors, IDataArray& dataArray)
+  : m_Operation(operation)
   , m_FeatureIds(featureIds)
   , m_Neighbors(neighbors)
-  , m_DataArrayPtr(dataArrayPtr)
+  , m_DataArray(dataArray)
   {
   }
-  ErodeDilateBadDataTransferDataImpl(ErodeDilateBadDataTransferDataImpl&&) = default;                // Move Constructor Not Implemented
-  ErodeDilateBadDataTransferDataImpl& operator=(const ErodeDilateBadDataTransferDataImpl&) = delete; // Copy Assignment Not Implemented
-  ErodeDilateBadDataTransferDataImpl& operator=(ErodeDilateBadDataTransferDataImpl&&) = delete;      // Move Assignment Not Implemented
 
-  ~ErodeDilateBadDataTransferDataImpl() = default;
-
-  void operator()() const
+  void operator()(const Range& range) const
   {
-    auto start = std::chrono::steady_clock::now();
-    for(usize i = 0; i < m_TotalPoints; i++)
+    // The sources of an iteration never change their feature so every voxel can be updated independently
+    for(usize i = range.min(); i < range.max(); i++)
     {
-      auto now = std::chrono::steady_clock::now();
-      //// Only send updates every 1 second
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        const float progress = static_cast<float>(i) / static_cast<float>(m_TotalPoints) * 100.0f;
-        m_FilterAlg->updateProgress(fmt::format("Processing {}: {}% completed", m_DataArrayPtr->getName(), static_cast<int>(progress)));
-        start = std::chrono::steady_clock::now();
-      }
-
       const int32 featureName = m_FeatureIds[i];
       const int64 neighbor = m_Neighbors[i];
       if(neighbor >= 0)
       {
         if((featureName == 0 && m_FeatureIds[neighbor] > 0 && m_Operation == detail::k_ErodeIndex) || (featureName > 0 && m_FeatureIds[neighbor] == 0 && m_Operation == detail::k_DilateIndex))
         {
-          m_DataArrayPtr->copyTuple(neighbor, i);
+          m_DataArray.copyTuple(neighbor, i);
         }
       }
     }
   }
 
 private:
-  ErodeDilateBadData* m_FilterAlg = nullptr;
-  usize m_TotalPoints = 0;
   ChoicesParameter::ValueType m_Operation = 0;
-  std::vector<int64> m_Neighbors;
-  const std::shared_ptr<IDataArray> m_DataArrayPtr;
   const Int32AbstractDataStore& m_FeatureIds;
+  const std::vector<int64>& m_Neighbors;
+  IDataArray& m_DataArray;
 };
 } // namespace
 
@@ -101,131 +80,63 @@ Result<> ErodeDilateBadData::operator()()
 
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->InputImageGeometry);
 
-  SizeVec3 udims = selectedImageGeom.getDimensions();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
-
-  usize numFeatures = 0;
-  for(usize i = 0; i < totalPoints; i++)
-  {
-    const int32 featureName = featureIds[i];
-    if(featureName > numFeatures)
-    {
-      numFeatures = featureName;
-    }
-  }
-
-  std::array<int64, 6> neighpoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+  const SizeVec3 udims = selectedImageGeom.getDimensions();
 
-  std::vector<int32> featureCount(numFeatures + 1, 0);
+  const FaceNeighborStencil stencil(udims, m_InputValues->XDirOn, m_InputValues->YDirOn, m_InputValues->ZDirOn);
+  const auto* featureIdsArray = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath);
 
   for(int32 iteration = 0; iteration < m_InputValues->NumIterations; iteration++)
   {
-    for(int64 zIndex = 0; zIndex < dims[2]; zIndex++)
+    if(m_InputValues->Operation == detail::k_DilateIndex)
     {
-      const int64 zStride = dims[0] * dims[1] * zIndex;
-      for(int64 yIndex = 0; yIndex < dims[1]; yIndex++)
-      {
-        const int64 yStride = dims[0] * yIndex;
-        for(int64 xIndex = 0; xIndex < dims[0]; xIndex++)
-        {
-          const int64 voxelIndex = zStride + yStride + xIndex;
-          const int32 featureName = featureIds[voxelIndex];
-          if(featureName == 0)
-          {
-            int32 most = 0;
-            for(int32 neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
+      // Every bad voxel used to mark each of its good neighbors, so a good voxel keeps the last (highest index) bad neighbor
+      ExecuteStencilPass(
+          stencil,
+          [&](usize xIndex, usize yIndex, usize zIndex, usize voxelIndex) {
+            if(featureIds[voxelIndex] <= 0)
             {
-              const int64 neighborPoint = voxelIndex + neighpoints[neighPointIdx];
-              if(neighPointIdx == 0 && (zIndex == 0 || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 5 && (zIndex == (dims[2] - 1) || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 1 && (yIndex == 0 || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 4 && (yIndex == (dims[1] - 1) || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 2 && (xIndex == 0 || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 3 && (xIndex == (dims[0] - 1) || !m_InputValues->XDirOn))
+              return;
+            }
+            stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighborPoint) {
+              if(featureIds[neighborPoint] == 0)
               {
-                continue;
+                neighbors[voxelIndex] = static_cast<int64>(neighborPoint);
               }
-
+            });
+          },
+          {featureIdsArray});
+    }
+    else
+    {
+      // A bad voxel takes the first neighbor of the feature that most of its good neighbors belong to
+      ExecuteStencilPass(
+          stencil,
+          [&](usize xIndex, usize yIndex, usize zIndex, usize voxelIndex) {
+            if(featureIds[voxelIndex] != 0)
+            {
+              return;
+            }
+            FeatureVote vote;
+            int32 most = 0;
+            stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighborPoint) {
               const int32 feature = featureIds[neighborPoint];
-              if(m_InputValues->Operation == detail::k_DilateIndex && feature > 0)
+              if(feature > 0)
               {
-                neighbors[neighborPoint] = voxelIndex;
-              }
-              if(feature > 0 && m_InputValues->Operation == detail::k_ErodeIndex)
-              {
-                featureCount[feature]++;
-                const int32 current = featureCount[feature];
+                const int32 current = vote.add(feature);
                 if(current > most)
                 {
                   most = current;
-                  neighbors[voxelIndex] = neighborPoint;
-                }
-              }
-            }
-            if(m_InputValues->Operation == detail::k_ErodeIndex)
-            {
-              for(int32 neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-              {
-                const int64 neighborPoint = voxelIndex + neighpoints[neighPointIdx];
-                if(neighPointIdx == 0 && zIndex == 0)
-                {
-                  continue;
-                }
-                if(neighPointIdx == 5 && zIndex == (dims[2] - 1))
-                {
-                  continue;
-                }
-                if(neighPointIdx == 1 && yIndex == 0)
-                {
-                  continue;
-                }
-                if(neighPointIdx == 4 && yIndex == (dims[1] - 1))
-                {
-                  continue;
-                }
-                if(neighPointIdx == 2 && xIndex == 0)
-                {
-                  continue;
+                  neighbors[voxelIndex] = static_cast<int64>(neighborPoint);
                 }
-                if(neighPointIdx == 3 && xIndex == (dims[0] - 1))
-                {
-                  continue;
-                }
-
-                const int32 feature = featureIds[neighborPoint];
-                featureCount[feature] = 0;
               }
-            }
-          }
-        }
-      }
+            });
+          },
+          {featureIdsArray});
     }
 
     // Build up a list of the DataArrays that we are going to operate on.
     const std::vector<std::shared_ptr<IDataArray>> voxelArrays = nx::core::GenerateDataArrayList(m_DataStructure, m_InputValues->FeatureIdsArrayPath, m_InputValues->IgnoredDataArrayPaths);
 
-    ParallelTaskAlgorithm taskRunner;
-    taskRunner.setParallelizationEnabled(true);
     for(const auto& voxelArray : voxelArrays)
     {
       // We need to skip updating the FeatureIds until all the other arrays are updated
@@ -235,14 +146,19 @@ Result<> ErodeDilateBadData::operator()()
         continue;
       }
 
-      taskRunner.execute(ErodeDilateBadDataTransferDataImpl(this, totalPoints, m_InputValues->Operation, featureIds, neighbors, voxelArray));
+      updateProgress(fmt::format("Iteration {}: Processing {}", iteration + 1, voxelArray->getName()));
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, totalPoints);
+      dataAlg.requireArraysInMemory({featureIdsArray, voxelArray.get()});
+      dataAlg.execute(ErodeDilateBadDataTransferDataImpl(m_InputValues->Operation, featureIds, neighbors, *voxelArray));
     }
-    taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 
     // Now update the feature Ids
     auto featureIDataArray = m_DataStructure.getSharedDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath);
-    taskRunner.setParallelizationEnabled(false); // Do this to make the next call synchronous
-    taskRunner.execute(ErodeDilateBadDataTransferDataImpl(this, totalPoints, m_InputValues->Operation, featureIds, neighbors, featureIDataArray));
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.requireArraysInMemory({featureIdsArray});
+    dataAlg.execute(ErodeDilateBadDataTransferDataImpl(m_InputValues->Operation, featureIds, neighbors, *featureIDataArray));
   }
 
   return {};
@@ -3,9 +3,36 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/FaceNeighborStencil.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 using namespace nx::core;
 
+namespace
+{
+class CopyMaskImpl
+{
+public:
+  CopyMaskImpl(const std::vector<uint8>& source, AbstractDataStore<bool>& mask)
+  : m_Source(source)
+  , m_Mask(mask)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      m_Mask[i] = m_Source[i] != 0;
+    }
+  }
+
+private:
+  const std::vector<uint8>& m_Source;
+  AbstractDataStore<bool>& m_Mask;
+};
+} // namespace
+
 // -----------------------------------------------------------------------------
 ErodeDilateMask::ErodeDilateMask(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, ErodeDilateMaskInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -28,86 +55,39 @@ const std::atomic_bool& ErodeDilateMask::getCancel()
 Result<> ErodeDilateMask::operator()()
 {
 
-  auto& mask = m_DataStructure.getDataRefAs<BoolArray>(m_InputValues->MaskArrayPath);
-  const size_t totalPoints = mask.getNumberOfTuples();
+  auto& maskArray = m_DataStructure.getDataRefAs<BoolArray>(m_InputValues->MaskArrayPath);
+  auto& mask = maskArray.getDataStoreRef();
+  const usize totalPoints = mask.getNumberOfTuples();
 
-  std::vector<bool> maskCopy(totalPoints, false);
+  // Each iteration reads the mask and writes the next one into this buffer, so every voxel can be done in parallel
+  std::vector<uint8> maskCopy(totalPoints, 0);
 
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->InputImageGeometry);
 
-  SizeVec3 udims = selectedImageGeom.getDimensions();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
-
-  std::array<int64, 6> neighpoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
+  const FaceNeighborStencil stencil(selectedImageGeom.getDimensions(), m_InputValues->XDirOn, m_InputValues->YDirOn, m_InputValues->ZDirOn);
+  const bool dilate = m_InputValues->Operation == detail::k_DilateIndex;
+  const bool erode = m_InputValues->Operation == detail::k_ErodeIndex;
 
   for(int32_t iteration = 0; iteration < m_InputValues->NumIterations; iteration++)
   {
-    for(size_t j = 0; j < totalPoints; j++)
-    {
-      maskCopy[j] = mask[j];
-    }
-    for(int64 zIndex = 0; zIndex < dims[2]; zIndex++)
-    {
-      const int64 zStride = dims[0] * dims[1] * zIndex;
-      for(int64 yIndex = 0; yIndex < dims[1]; yIndex++)
-      {
-        const int64 yStride = dims[0] * yIndex;
-        for(int64 xIndex = 0; xIndex < dims[0]; xIndex++)
-        {
-          const int64 voxelIndex = zStride + yStride + xIndex;
-
-          if(!mask[voxelIndex])
+    // Dilate turns on every voxel next to a voxel that is on, erode turns off every voxel next to a voxel that is off
+    ExecuteStencilPass(
+        stencil,
+        [&](usize xIndex, usize yIndex, usize zIndex, usize voxelIndex) {
+          const bool value = mask[voxelIndex];
+          bool flip = false;
+          if(value ? erode : dilate)
           {
-            for(int32_t neighPointIdx = 0; neighPointIdx < 6; neighPointIdx++)
-            {
-              const int64 neighpoint = voxelIndex + neighpoints[neighPointIdx];
-              if(neighPointIdx == 0 && (zIndex == 0 || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 5 && (zIndex == (dims[2] - 1) || !m_InputValues->ZDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 1 && (yIndex == 0 || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 4 && (yIndex == (dims[1] - 1) || !m_InputValues->YDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 2 && (xIndex == 0 || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-              if(neighPointIdx == 3 && (xIndex == (dims[0] - 1) || !m_InputValues->XDirOn))
-              {
-                continue;
-              }
-
-              if(m_InputValues->Operation == detail::k_DilateIndex && mask[neighpoint])
-              {
-                maskCopy[voxelIndex] = true;
-              }
-              if(m_InputValues->Operation == detail::k_ErodeIndex && mask[neighpoint])
-              {
-                maskCopy[neighpoint] = false;
-              }
-            }
+            stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighpoint) { flip = flip || mask[neighpoint] != value; });
           }
-        }
-      }
-    }
-    for(size_t j = 0; j < totalPoints; j++)
-    {
-      mask[j] = maskCopy[j];
-    }
+          maskCopy[voxelIndex] = static_cast<uint8>(value != flip);
+        },
+        {&maskArray});
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, totalPoints);
+    dataAlg.requireArraysInMemory({&maskArray});
+    dataAlg.execute(CopyMaskImpl(maskCopy, mask));
   }
 
   return {};
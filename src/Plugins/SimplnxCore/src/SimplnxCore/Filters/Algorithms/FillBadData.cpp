@@ -4,45 +4,241 @@
 #include "simplnx/DataStructure/DataGroup.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FaceNeighborStencil.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <atomic>
 
 using namespace nx::core;
 
 namespace
 {
-template <typename T>
-void FillBadDataUpdateTuples(const Int32AbstractDataStore& featureIds, AbstractDataStore<T>& outputDataStore, const std::vector<int32>& neighbors)
+// Number of slabs the defect labeling is split into. Each slab is labeled on its own and the slabs are joined afterwards
+constexpr usize k_NumLabelSlabs = 64;
+
+/**
+ * @brief Returns the root of the defect that the voxel belongs to and halves the path to it. In the union find
+ * array a root stores the negated size of its defect and every other voxel a lower index of the same defect.
+ */
+int64 FindDefectRoot(std::vector<int64>& parents, int64 index)
 {
-  usize start = 0;
-  usize stop = outputDataStore.getNumberOfTuples();
-  const usize numComponents = outputDataStore.getNumberOfComponents();
-  for(usize tupleIndex = start; tupleIndex < stop; tupleIndex++)
+  while(parents[index] >= 0)
   {
-    const int32 featureName = featureIds[tupleIndex];
-    const int32 neighbor = neighbors[tupleIndex];
-    if(neighbor == tupleIndex)
+    const int64 grandParent = parents[parents[index]];
+    if(grandParent >= 0)
     {
-      continue;
+      parents[index] = grandParent;
     }
+    index = parents[index];
+  }
+  return index;
+}
+
+/**
+ * @brief Returns the root of the defect that the voxel belongs to without modifying the union find array.
+ */
+int64 FindDefectRoot(const std::vector<int64>& parents, int64 index)
+{
+  while(parents[index] >= 0)
+  {
+    index = parents[index];
+  }
+  return index;
+}
+
+/**
+ * @brief Joins the defects of both voxels. The lower root becomes the root of the joined defect.
+ */
+void JoinDefects(std::vector<int64>& parents, int64 first, int64 second)
+{
+  int64 firstRoot = FindDefectRoot(parents, first);
+  int64 secondRoot = FindDefectRoot(parents, second);
+  if(firstRoot == secondRoot)
+  {
+    return;
+  }
+  if(secondRoot < firstRoot)
+  {
+    std::swap(firstRoot, secondRoot);
+  }
+  parents[firstRoot] += parents[secondRoot];
+  parents[secondRoot] = firstRoot;
+}
+
+/**
+ * @brief Labels the face connected defects (voxels with a feature id of 0) of a range of slabs. A slab is a run of
+ * whole rows, so only voxels of the slab itself are joined and slabs can be labeled at the same time.
+ */
+class LabelDefectSlabsImpl
+{
+public:
+  LabelDefectSlabsImpl(const Int32AbstractDataStore& featureIds, const SizeVec3& dims, usize rowsPerSlab, std::vector<int64>& parents)
+  : m_FeatureIds(featureIds)
+  , m_Dims(dims)
+  , m_RowsPerSlab(rowsPerSlab)
+  , m_Parents(parents)
+  {
+  }
 
-    if(featureName < 0 && neighbor != -1 && featureIds[static_cast<size_t>(neighbor)] > 0)
+  void operator()(const Range& range) const
+  {
+    const usize numRows = m_Dims[1] * m_Dims[2];
+    const usize planeSize = m_Dims[0] * m_Dims[1];
+    for(usize slab = range.min(); slab < range.max(); slab++)
     {
-      for(usize i = 0; i < numComponents; i++)
+      const usize firstRow = slab * m_RowsPerSlab;
+      const usize endRow = std::min(firstRow + m_RowsPerSlab, numRows);
+      const usize slabStart = firstRow * m_Dims[0];
+      for(usize row = firstRow; row < endRow; row++)
       {
-        auto value = outputDataStore[neighbor * numComponents + i];
-        outputDataStore[tupleIndex * numComponents + i] = value;
+        const usize yIndex = row % m_Dims[1];
+        const usize zIndex = row / m_Dims[1];
+        for(usize xIndex = 0; xIndex < m_Dims[0]; xIndex++)
+        {
+          const usize index = row * m_Dims[0] + xIndex;
+          if(m_FeatureIds[index] != 0)
+          {
+            continue;
+          }
+          m_Parents[index] = -1;
+          if(xIndex > 0 && m_FeatureIds[index - 1] == 0)
+          {
+            JoinDefects(m_Parents, static_cast<int64>(index - 1), static_cast<int64>(index));
+          }
+          if(yIndex > 0 && index - m_Dims[0] >= slabStart && m_FeatureIds[index - m_Dims[0]] == 0)
+          {
+            JoinDefects(m_Parents, static_cast<int64>(index - m_Dims[0]), static_cast<int64>(index));
+          }
+          if(zIndex > 0 && index - planeSize >= slabStart && m_FeatureIds[index - planeSize] == 0)
+          {
+            JoinDefects(m_Parents, static_cast<int64>(index - planeSize), static_cast<int64>(index));
+          }
+        }
       }
     }
   }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  SizeVec3 m_Dims;
+  usize m_RowsPerSlab = 1;
+  std::vector<int64>& m_Parents;
+};
+
+/**
+ * @brief Marks the voxels of defects that are at least the minimum size as 0 (optionally moving them into a new
+ * phase) and the voxels of smaller defects as -1 so they get filled.
+ */
+class ClassifyDefectsImpl
+{
+public:
+  ClassifyDefectsImpl(Int32AbstractDataStore& featureIds, Int32AbstractDataStore* cellPhases, const std::vector<int64>& parents, int32 minAllowedDefectSize, int32 newPhase)
+  : m_FeatureIds(featureIds)
+  , m_CellPhases(cellPhases)
+  , m_Parents(parents)
+  , m_MinAllowedDefectSize(minAllowedDefectSize)
+  , m_NewPhase(newPhase)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      if(m_FeatureIds[i] != 0)
+      {
+        continue;
+      }
+      // The original breadth first search visited the first voxel of a defect a second time from any of its
+      // neighbors, so a defect of more than one voxel was counted one voxel larger. The count is kept that way so
+      // the same defects are kept or filled.
+      const int64 voxelCount = -m_Parents[FindDefectRoot(m_Parents, static_cast<int64>(i))];
+      const int64 defectSize = voxelCount > 1 ? voxelCount + 1 : voxelCount;
+      if(defectSize >= m_MinAllowedDefectSize)
+      {
+        if(m_CellPhases != nullptr)
+        {
+          m_CellPhases->setValue(i, m_NewPhase);
+        }
+      }
+      else
+      {
+        m_FeatureIds[i] = -1;
+      }
+    }
+  }
+
+private:
+  Int32AbstractDataStore& m_FeatureIds;
+  Int32AbstractDataStore* m_CellPhases = nullptr;
+  const std::vector<int64>& m_Parents;
+  int32 m_MinAllowedDefectSize = 0;
+  int32 m_NewPhase = 0;
+};
+
+/**
+ * @brief Copies the tuple of the chosen neighbor into every voxel that is being filled. The neighbors always belong
+ * to a feature and are never filled themselves, so every voxel can be updated independently.
+ */
+template <typename T>
+class FillBadDataUpdateTuplesImpl
+{
+public:
+  FillBadDataUpdateTuplesImpl(const Int32AbstractDataStore& featureIds, AbstractDataStore<T>& outputDataStore, const std::vector<int32>& neighbors)
+  : m_FeatureIds(featureIds)
+  , m_OutputDataStore(outputDataStore)
+  , m_Neighbors(neighbors)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize numComponents = m_OutputDataStore.getNumberOfComponents();
+    for(usize tupleIndex = range.min(); tupleIndex < range.max(); tupleIndex++)
+    {
+      const int32 featureName = m_FeatureIds[tupleIndex];
+      const int32 neighbor = m_Neighbors[tupleIndex];
+      if(static_cast<usize>(neighbor) == tupleIndex)
+      {
+        continue;
+      }
+
+      if(featureName < 0 && neighbor != -1 && m_FeatureIds[static_cast<size_t>(neighbor)] > 0)
+      {
+        for(usize i = 0; i < numComponents; i++)
+        {
+          auto value = m_OutputDataStore[neighbor * numComponents + i];
+          m_OutputDataStore[tupleIndex * numComponents + i] = value;
+        }
+      }
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  AbstractDataStore<T>& m_OutputDataStore;
+  const std::vector<int32>& m_Neighbors;
+};
+
+template <typename T>
+void FillBadDataUpdateTuples(const IDataArray* featureIdsArray, const Int32AbstractDataStore& featureIds, IDataArray* outputIDataArray, AbstractDataStore<T>& outputDataStore,
+                             const std::vector<int32>& neighbors)
+{
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, outputDataStore.getNumberOfTuples());
+  dataAlg.requireArraysInMemory({featureIdsArray, outputIDataArray});
+  dataAlg.execute(FillBadDataUpdateTuplesImpl<T>(featureIds, outputDataStore, neighbors));
 }
 
 struct FillBadDataUpdateTuplesFunctor
 {
   template <typename T>
-  void operator()(const Int32AbstractDataStore& featureIds, IDataArray* outputIDataArray, const std::vector<int32>& neighbors)
+  void operator()(const IDataArray* featureIdsArray, const Int32AbstractDataStore& featureIds, IDataArray* outputIDataArray, const std::vector<int32>& neighbors)
   {
     auto& outputStore = outputIDataArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
-    FillBadDataUpdateTuples(featureIds, outputStore, neighbors);
+    FillBadDataUpdateTuples(featureIdsArray, featureIds, outputIDataArray, outputStore, neighbors);
   }
 };
 } // namespace
@@ -68,13 +264,12 @@ const std::atomic_bool& FillBadData::getCancel()
 // -----------------------------------------------------------------------------
 Result<> FillBadData::operator()()
 {
-  auto& featureIdsStore = m_DataStructure.getDataAs<Int32Array>(m_InputValues->featureIdsArrayPath)->getDataStoreRef();
+  auto* featureIdsArray = m_DataStructure.getDataAs<Int32Array>(m_InputValues->featureIdsArrayPath);
+  auto& featureIdsStore = featureIdsArray->getDataStoreRef();
   const size_t totalPoints = featureIdsStore.getNumberOfTuples();
 
   std::vector<int32> neighbors(totalPoints, -1);
 
-  std::vector<bool> alreadyChecked(totalPoints, false);
-
   const auto& selectedImageGeom = m_DataStructure.getDataRefAs<ImageGeom>(m_InputValues->inputImageGeometry);
 
   const SizeVec3 udims = selectedImageGeom.getDimensions();
@@ -86,36 +281,7 @@ Result<> FillBadData::operator()()
     cellPhasesPtr = m_DataStructure.getDataAs<Int32Array>(m_InputValues->cellPhasesArrayPath);
   }
 
-  std::array<int64_t, 3> dims = {
-      static_cast<int64_t>(udims[0]),
-      static_cast<int64_t>(udims[1]),
-      static_cast<int64_t>(udims[2]),
-  };
-
-  size_t count = 1;
-  // int32_t good = 1;
-  // int64_t neighbor = 0;
-  // int64_t index = 0;
-  // float32 x = 0.0F;
-  //  float32 y = 0.0F;
-  //  float32 z = 0.0F;
-  // int64 column = 0;
-  // int64 row = 0;
-  // int64 plane = 0;
-  //  int64 neighborPoint = 0;
-  //  int32 featureName = 0;
-  //  int32 feature = 0;
-  size_t numFeatures = 0;
-  size_t maxPhase = 0;
-
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    int32 featureName = featureIdsStore[i];
-    if(featureName > numFeatures)
-    {
-      numFeatures = featureName;
-    }
-  }
+  int32 maxPhase = 0;
 
   if(m_InputValues->storeAsNewPhase)
   {
@@ -128,179 +294,93 @@ Result<> FillBadData::operator()()
     }
   }
 
-  std::array<int64_t, 6> neighborPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-  std::vector<int64_t> currentVisitedList;
-
-  for(size_t iter = 0; iter < totalPoints; iter++)
+  // Label the face connected defects slab by slab in parallel and then join the slabs along their first rows. A slab
+  // holds at least one plane (or one row of a single plane image) so its first rows are the only ones with neighbors
+  // in the previous slab.
   {
-    alreadyChecked[iter] = false;
-    if(featureIdsStore[iter] != 0)
-    {
-      alreadyChecked[iter] = true;
-    }
-  }
+    std::vector<int64> parents(totalPoints, 0);
+    const usize numRows = udims[1] * udims[2];
+    const usize planeSize = udims[0] * udims[1];
+    const usize boundaryRows = udims[2] > 1 ? udims[1] : 1;
+    const usize rowsPerSlab = std::max(boundaryRows, (numRows + k_NumLabelSlabs - 1) / k_NumLabelSlabs);
+    const usize numSlabs = numRows == 0 ? 0 : (numRows + rowsPerSlab - 1) / rowsPerSlab;
 
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    if(!alreadyChecked[i] && featureIdsStore[i] == 0)
+    ParallelDataAlgorithm labelAlg;
+    labelAlg.setRange(0, numSlabs);
+    labelAlg.requireArraysInMemory({featureIdsArray});
+    labelAlg.execute(LabelDefectSlabsImpl(featureIdsStore, udims, rowsPerSlab, parents));
+
+    for(usize slab = 1; slab < numSlabs; slab++)
     {
-      currentVisitedList.push_back(static_cast<int64_t>(i));
-      count = 0;
-      while(count < currentVisitedList.size())
+      const usize firstRow = slab * rowsPerSlab;
+      const usize slabStart = firstRow * udims[0];
+      const usize boundaryEnd = std::min(firstRow + boundaryRows, numRows) * udims[0];
+      for(usize index = slabStart; index < boundaryEnd; index++)
       {
-        int64_t index = currentVisitedList[count];
-        int64 column = index % dims[0];
-        int64 row = (index / dims[0]) % dims[1];
-        int64 plane = index / (dims[0] * dims[1]);
-        for(int32_t j = 0; j < 6; j++)
+        if(featureIdsStore[index] != 0)
         {
-          int64_t neighbor = index + neighborPoints[j];
-          if(j == 0 && plane == 0)
-          {
-            continue;
-          }
-          if(j == 5 && plane == (dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && row == 0)
-          {
-            continue;
-          }
-          if(j == 4 && row == (dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && column == 0)
-          {
-            continue;
-          }
-          if(j == 3 && column == (dims[0] - 1))
-          {
-            continue;
-          }
-          if(featureIdsStore[neighbor] == 0 && !alreadyChecked[neighbor])
-          {
-            currentVisitedList.push_back(neighbor);
-            alreadyChecked[neighbor] = true;
-          }
+          continue;
         }
-        count++;
-      }
-      if((int32_t)currentVisitedList.size() >= m_InputValues->minAllowedDefectSizeValue)
-      {
-        for(const auto& currentIndex : currentVisitedList)
+        const usize yIndex = (index / udims[0]) % udims[1];
+        const usize zIndex = index / planeSize;
+        if(yIndex > 0 && index - udims[0] < slabStart && featureIdsStore[index - udims[0]] == 0)
         {
-          featureIdsStore[currentIndex] = 0;
-          if(m_InputValues->storeAsNewPhase)
-          {
-            (*cellPhasesPtr)[currentIndex] = static_cast<int32>(maxPhase) + 1;
-          }
+          JoinDefects(parents, static_cast<int64>(index - udims[0]), static_cast<int64>(index));
         }
-      }
-      if((int32_t)currentVisitedList.size() < m_InputValues->minAllowedDefectSizeValue)
-      {
-        for(const auto& currentIndex : currentVisitedList)
+        if(zIndex > 0 && index - planeSize < slabStart && featureIdsStore[index - planeSize] == 0)
         {
-          featureIdsStore[currentIndex] = -1;
+          JoinDefects(parents, static_cast<int64>(index - planeSize), static_cast<int64>(index));
         }
       }
-      currentVisitedList.clear();
     }
+
+    IParallelAlgorithm::AlgorithmArrays classifyArrays = {featureIdsArray};
+    if(cellPhasesPtr != nullptr)
+    {
+      classifyArrays.push_back(cellPhasesPtr);
+    }
+    ParallelDataAlgorithm classifyAlg;
+    classifyAlg.setRange(0, totalPoints);
+    classifyAlg.requireArraysInMemory(classifyArrays);
+    classifyAlg.execute(ClassifyDefectsImpl(featureIdsStore, cellPhasesPtr != nullptr ? &cellPhasesPtr->getDataStoreRef() : nullptr, parents, m_InputValues->minAllowedDefectSizeValue,
+                                            maxPhase + 1));
   }
 
-  std::vector<int32_t> featureNumber(numFeatures + 1, 0);
+  const FaceNeighborStencil stencil(udims);
 
-  while(count != 0)
+  bool foundBadVoxel = true;
+  while(foundBadVoxel)
   {
-    count = 0;
-    for(size_t i = 0; i < totalPoints; i++)
-    {
-      int32 featureName = featureIdsStore[i];
-      if(featureName < 0)
-      {
-        count++;
-        // int32 current = 0;
-        int32 most = 0;
-        auto xIndex = static_cast<float32>(i % dims[0]);
-        auto yIndex = static_cast<float32>((i / dims[0]) % dims[1]);
-        auto zIndex = static_cast<float32>(i / (dims[0] * dims[1]));
-        for(int32_t j = 0; j < 6; j++)
-        {
-          auto neighborPoint = static_cast<int64_t>(i + neighborPoints[j]);
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
+    // Every voxel to fill picks the first neighbor of the feature that most of its neighbors belong to
+    std::atomic_bool foundBad = false;
+    ExecuteStencilPass(
+        stencil,
+        [&](usize xIndex, usize yIndex, usize zIndex, usize voxelIndex) {
+          if(featureIdsStore[voxelIndex] >= 0)
           {
-            continue;
+            return;
           }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
+          if(!foundBad.load(std::memory_order_relaxed))
           {
-            continue;
+            foundBad.store(true, std::memory_order_relaxed);
           }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
-
-          int32 feature = featureIdsStore[neighborPoint];
-          if(feature > 0)
-          {
-            featureNumber[feature]++;
-            int32 current = featureNumber[feature];
-            if(current > most)
+          FeatureVote vote;
+          int32 most = 0;
+          stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighborPoint) {
+            const int32 feature = featureIdsStore[neighborPoint];
+            if(feature > 0)
             {
-              most = current;
-              neighbors[i] = static_cast<int32>(neighborPoint);
+              const int32 current = vote.add(feature);
+              if(current > most)
+              {
+                most = current;
+                neighbors[voxelIndex] = static_cast<int32>(neighborPoint);
+              }
             }
-          }
-        }
-        for(int32_t j = 0; j < 6; j++)
-        {
-          int64 neighborPoint = static_cast<int64>(i) + neighborPoints[j];
-          if(j == 0 && zIndex == 0)
-          {
-            continue;
-          }
-          if(j == 5 && zIndex == static_cast<float32>(dims[2] - 1))
-          {
-            continue;
-          }
-          if(j == 1 && yIndex == 0)
-          {
-            continue;
-          }
-          if(j == 4 && yIndex == static_cast<float32>(dims[1] - 1))
-          {
-            continue;
-          }
-          if(j == 2 && xIndex == 0)
-          {
-            continue;
-          }
-          if(j == 3 && xIndex == static_cast<float32>(dims[0] - 1))
-          {
-            continue;
-          }
-
-          int32 feature = featureIdsStore[neighborPoint];
-          if(feature > 0)
-          {
-            featureNumber[feature] = 0;
-          }
-        }
-      }
-    }
+          });
+        },
+        {featureIdsArray});
+    foundBadVoxel = foundBad;
 
     std::optional<std::vector<DataPath>> allChildArrays = GetAllChildDataPaths(m_DataStructure, selectedImageGeom.getCellDataPath(), DataObject::Type::DataArray, m_InputValues->ignoredDataArrayPaths);
     std::vector<DataPath> voxelArrayNames;
@@ -317,11 +397,11 @@ Result<> FillBadData::operator()()
       }
       auto* oldCellArray = m_DataStructure.getDataAs<IDataArray>(cellArrayPath);
 
-      ExecuteDataFunction(FillBadDataUpdateTuplesFunctor{}, oldCellArray->getDataType(), featureIdsStore, oldCellArray, neighbors);
+      ExecuteDataFunction(FillBadDataUpdateTuplesFunctor{}, oldCellArray->getDataType(), featureIdsArray, featureIdsStore, oldCellArray, neighbors);
     }
 
     // We need to update the FeatureIds array _LAST_ since the above operations depend on that values in that array
-    FillBadDataUpdateTuples<int32>(featureIdsStore, featureIdsStore, neighbors);
+    FillBadDataUpdateTuples<int32>(featureIdsArray, featureIdsStore, featureIdsArray, featureIdsStore, neighbors);
   }
   return {};
 }
@@ -5,9 +5,136 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/INodeGeometry2D.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/GeometryHelpers.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 using namespace nx::core;
 
+namespace
+{
+using VertexAdjacency = GeometryHelpers::Connectivity::VertexAdjacency<IGeometry::MeshIndexType>;
+
+// Number of vertices copied between the vertex array and the working buffers at a time
+constexpr usize k_VertexBlockSize = 4096;
+
+/**
+ * @brief Holds the vertex positions as separate x, y and z arrays.
+ */
+struct VertexBuffer
+{
+  explicit VertexBuffer(usize numVerts)
+  : Coords{std::vector<float32>(numVerts), std::vector<float32>(numVerts), std::vector<float32>(numVerts)}
+  {
+  }
+
+  std::array<std::vector<float32>, 3> Coords;
+};
+
+/**
+ * @brief Copies the interleaved vertex array into (or out of) the working buffer.
+ */
+class CopyVerticesImpl
+{
+public:
+  CopyVerticesImpl(Float32AbstractDataStore& verts, VertexBuffer& buffer, bool toBuffer)
+  : m_Verts(verts)
+  , m_Buffer(buffer)
+  , m_ToBuffer(toBuffer)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<float32> block(k_VertexBlockSize * 3);
+    for(usize blockStart = range.min(); blockStart < range.max(); blockStart += k_VertexBlockSize)
+    {
+      const usize count = std::min(k_VertexBlockSize, range.max() - blockStart);
+      const nonstd::span<float32> blockSpan(block.data(), count * 3);
+      if(m_ToBuffer)
+      {
+        m_Verts.copyIntoBuffer(blockStart * 3, blockSpan);
+      }
+      for(usize i = 0; i < count; i++)
+      {
+        for(usize j = 0; j < 3; j++)
+        {
+          float32& value = m_Buffer.Coords[j][blockStart + i];
+          if(m_ToBuffer)
+          {
+            value = block[i * 3 + j];
+          }
+          else
+          {
+            block[i * 3 + j] = value;
+          }
+        }
+      }
+      if(!m_ToBuffer)
+      {
+        m_Verts.copyFromBuffer(blockStart * 3, nonstd::span<const float32>(block.data(), count * 3));
+      }
+    }
+  }
+
+private:
+  Float32AbstractDataStore& m_Verts;
+  VertexBuffer& m_Buffer;
+  bool m_ToBuffer = true;
+};
+
+/**
+ * @brief Moves every vertex by its lambda times the average of the vectors to its neighbors. The new positions are
+ * written into a second buffer so every vertex can be moved independently.
+ */
+class LaplacianStepImpl
+{
+public:
+  LaplacianStepImpl(const VertexAdjacency& adjacency, const std::vector<float>& lambdas, float32 lambdaFactor, const VertexBuffer& source, VertexBuffer& destination)
+  : m_Adjacency(adjacency)
+  , m_Lambdas(lambdas)
+  , m_LambdaFactor(lambdaFactor)
+  , m_Source(source)
+  , m_Destination(destination)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      const usize neighborsStart = m_Adjacency.Offsets[i];
+      const usize neighborsEnd = m_Adjacency.Offsets[i + 1];
+      const float ll = m_Lambdas[i] * m_LambdaFactor;
+      for(usize j = 0; j < 3; j++)
+      {
+        const std::vector<float32>& coords = m_Source.Coords[j];
+        const float32 position = coords[i];
+        if(neighborsStart == neighborsEnd)
+        {
+          m_Destination.Coords[j][i] = position;
+          continue;
+        }
+        // Ascending neighbor order adds the deltas up in the same order as the sorted edge list did
+        double delta = 0.0;
+        for(usize n = neighborsStart; n < neighborsEnd; n++)
+        {
+          delta += static_cast<double>(coords[m_Adjacency.Neighbors[n]] - position);
+        }
+        delta = delta / static_cast<int32>(neighborsEnd - neighborsStart);
+        m_Destination.Coords[j][i] = static_cast<float32>(position + ll * delta);
+      }
+    }
+  }
+
+private:
+  const VertexAdjacency& m_Adjacency;
+  const std::vector<float>& m_Lambdas;
+  float32 m_LambdaFactor = 1.0f;
+  const VertexBuffer& m_Source;
+  VertexBuffer& m_Destination;
+};
+} // namespace
+
 LaplacianSmoothing::LaplacianSmoothing(DataStructure& dataStructure, LaplacianSmoothingInputValues* inputValues, const std::atomic_bool& shouldCancel, const IFilter::MessageHandler& mesgHandler)
 : m_DataStructure(dataStructure)
 , m_InputValues(inputValues)
@@ -20,13 +147,13 @@ LaplacianSmoothing::~LaplacianSmoothing() noexcept = default;
 
 Result<> LaplacianSmoothing::operator()()
 {
-  return edgeBasedSmoothing();
+  return vertexBasedSmoothing();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-Result<> LaplacianSmoothing::edgeBasedSmoothing()
+Result<> LaplacianSmoothing::vertexBasedSmoothing()
 {
   auto& surfaceMesh = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->pTriangleGeometryDataPath);
 
@@ -37,19 +164,17 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
   // Generate the Lambda Array
   std::vector<float> lambdas = generateLambdaArray();
 
-  //  Generate the Unique Edges
-  if(surfaceMesh.findEdges(false) < 0)
-  {
-    return MakeErrorResult(-560, "Error retrieving the shared edge list");
-  }
+  // Each vertex gathers from its own neighbors, so no edge list is needed
+  m_MessageHandler(IFilter::Message::Type::Info, "Finding vertex neighbors");
+  const VertexAdjacency adjacency = GeometryHelpers::Connectivity::Find2DVertexAdjacency(surfaceMesh.getFaces(), nvert);
 
-  AbstractDataStore<IGeometry::SharedEdgeList::value_type>& edges = surfaceMesh.getEdges()->getDataStoreRef();
-  IGeometry::MeshIndexType numEdges = edges.getNumberOfTuples();
+  VertexBuffer current(nvert);
+  VertexBuffer next(nvert);
 
-  std::vector<int32> numConnections(nvert, 0);
-
-  std::vector<double> deltaArray(nvert * 3);
-  double dlta = 0.0;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, nvert);
+  dataAlg.requireStoresInMemory({&verts});
+  dataAlg.execute(CopyVerticesImpl(verts, current, true));
 
   for(int32_t q = 0; q < m_InputValues->pIterationSteps; q++)
   {
@@ -58,89 +183,25 @@ Result<> LaplacianSmoothing::edgeBasedSmoothing()
       return {};
     }
     m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-    // Compute the Deltas for each point
-    for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
-    {
-      IGeometry::MeshIndexType in1 = edges[2 * i];     // row of the first vertex
-      IGeometry::MeshIndexType in2 = edges[2 * i + 1]; // row the second vertex
-
-      for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-#if 0
-        Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-        Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-        dlta = static_cast<double>(verts[3 * in2 + j] - verts[3 * in1 + j]);
-        deltaArray[3 * in1 + j] += dlta;
-        deltaArray[3 * in2 + j] += -1.0 * dlta;
-      }
-      numConnections[in1] += 1;
-      numConnections[in2] += 1;
-    }
-
-    // Move each point
-    for(IGeometry::MeshIndexType i = 0; i < nvert; i++)
-    {
-      for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-      {
-        IGeometry::MeshIndexType in0 = 3 * i + j;
-        dlta = deltaArray[in0] / numConnections[i];
-
-        float ll = lambdas[i];
-        verts[3 * i + j] += ll * dlta;
-        deltaArray[in0] = 0.0; // reset for next iteration
-      }
-      numConnections[i] = 0; // reset for next iteration
-    }
+    dataAlg.execute(LaplacianStepImpl(adjacency, lambdas, 1.0f, current, next));
+    std::swap(current, next);
 
     // Now optionally apply a negative lambda based on the mu Factor value.
     // This is from Taubin's paper on smoothing without shrinkage. This effectively
     // runs a low pass filter on the data
     if(m_InputValues->pUseTaubinSmoothing)
     {
-
       if(m_ShouldCancel)
       {
         return {};
       }
-      m_MessageHandler(IFilter::Message::Type::Info, fmt::format("Iteration {} of {}", q, m_InputValues->pIterationSteps));
-      // Compute the Delta's
-      for(IGeometry::MeshIndexType i = 0; i < numEdges; i++)
-      {
-        IGeometry::MeshIndexType in1 = edges[2 * i];     // row of the first vertex
-        IGeometry::MeshIndexType in2 = edges[2 * i + 1]; // row the second vertex
-
-        for(int32_t j = 0; j < 3; j++)
-        {
-#if 0
-          Q_ASSERT(static_cast<size_t>(3 * in1 + j) < static_cast<size_t>(nvert * 3));
-          Q_ASSERT(static_cast<size_t>(3 * in2 + j) < static_cast<size_t>(nvert * 3));
-#endif
-          dlta = verts[3 * in2 + j] - verts[3 * in1 + j];
-          deltaArray[3 * in1 + j] += dlta;
-          deltaArray[3 * in2 + j] += -1.0 * dlta;
-        }
-        numConnections[in1] += 1;
-        numConnections[in2] += 1;
-      }
-
-      // MOve the points
-      for(IGeometry::MeshIndexType i = 0; i < nvert; i++)
-      {
-        for(IGeometry::MeshIndexType j = 0; j < 3; j++)
-        {
-          IGeometry::MeshIndexType in0 = 3 * i + j;
-          dlta = deltaArray[in0] / numConnections[i];
-
-          float ll = lambdas[i] * m_InputValues->pMuFactor;
-          verts[3 * i + j] += ll * dlta;
-          deltaArray[in0] = 0.0; // reset for next iteration
-        }
-        numConnections[i] = 0; // reset for next iteration
-      }
+      dataAlg.execute(LaplacianStepImpl(adjacency, lambdas, m_InputValues->pMuFactor, current, next));
+      std::swap(current, next);
     }
   }
 
+  dataAlg.execute(CopyVerticesImpl(verts, current, false));
+
   return {};
 }
 
@@ -49,7 +49,7 @@ private:
   const IFilter::MessageHandler& m_MessageHandler;
 
   std::vector<float> generateLambdaArray();
-  Result<> edgeBasedSmoothing();
+  Result<> vertexBasedSmoothing();
 };
 
 } // namespace nx::core
@@ -1,19 +1,13 @@
 #include "ReadBinaryCTNorthstar.hpp"
 
-#include "simplnx/Common/ScopeGuard.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
+#include "simplnx/Utilities/RawVolumeUtilities.hpp"
 
 using namespace nx::core;
 
 namespace
 {
-#if defined(_MSC_VER)
-#define FSEEK64 _fseeki64
-#else
-#define FSEEK64 std::fseek
-#endif
-
 // -----------------------------------------------------------------------------
 Result<> SanityCheckFileSizeVersusAllocatedSize(size_t allocatedBytes, size_t fileSize)
 {
@@ -35,8 +29,6 @@ Result<> ReadBinaryCTFiles(DataStructure& dataStructure, const IFilter::MessageH
   auto& density = dataStructure.getDataAs<Float32Array>(inputValues->DensityArrayPath)->getDataStoreRef();
   density.fill(0xABCDEF);
 
-  usize deltaX = inputValues->EndVoxelCoord[0] - inputValues->StartVoxelCoord[0] + 1;
-
   usize zShift = 0;
   int32 fileIndex = 1;
 
@@ -54,54 +46,28 @@ Result<> ReadBinaryCTFiles(DataStructure& dataStructure, const IFilter::MessageH
                                                  fileSize, allocatedBytes));
     }
 
-    FILE* f = fopen(dataFilePath.string().c_str(), "rb");
-    if(nullptr == f)
+    // Only the slices of this file that are inside the subvolume are read
+    const usize fileZStart = zShift;
+    const usize fileZEnd = zShift + dataFileInput.second; // exclusive
+    const auto zStart = std::max(static_cast<usize>(inputValues->StartVoxelCoord[2]), fileZStart);
+    const auto zEnd = std::min(static_cast<usize>(inputValues->EndVoxelCoord[2]) + 1, fileZEnd); // exclusive
+    if(zStart < zEnd)
     {
-      return MakeErrorResult(-38706, fmt::format("Error opening binary input file: {}.", dataFilePath.string()));
-    }
-
-    auto fileGuard = MakeScopeGuard([f]() noexcept { fclose(f); });
+      messageHandler(fmt::format("Importing Data || Data File: {} || Importing Slices {}-{}", dataFileInput.first.string(), zStart, zEnd - 1));
 
-    usize fileZSlice = 0;
+      RawVolumeUtilities::FileLayout layout;
+      layout.Dimensions = {inputValues->OriginalGeometryDims[0], inputValues->OriginalGeometryDims[1], dataFileInput.second};
 
-    // Now start reading the data in chunks if needed.
-    std::vector<float32> buffer(deltaX);
+      RawVolumeUtilities::Subvolume subvolume;
+      subvolume.Start = {static_cast<usize>(inputValues->StartVoxelCoord[0]), static_cast<usize>(inputValues->StartVoxelCoord[1]), zStart - fileZStart};
+      subvolume.End = {static_cast<usize>(inputValues->EndVoxelCoord[0]), static_cast<usize>(inputValues->EndVoxelCoord[1]), zEnd - 1 - fileZStart};
 
-    for(usize z = zShift; z < (zShift + dataFileInput.second); z++)
-    {
-      if(inputValues->ImportSubvolume && (z < inputValues->StartVoxelCoord[2] || z > inputValues->EndVoxelCoord[2]))
-      {
-        fileZSlice++;
-        continue;
-      }
-      messageHandler(fmt::format("Importing Data || Data File: {} || Importing Slice {}", dataFileInput.first.string(), z));
-      for(usize y = 0; y < inputValues->OriginalGeometryDims[1]; y++)
+      const usize storeIndex = inputValues->ImportedGeometryDims[0] * inputValues->ImportedGeometryDims[1] * (zStart - static_cast<usize>(inputValues->StartVoxelCoord[2]));
+      result = RawVolumeUtilities::ReadVolume<float32, float32>(dataFilePath, layout, subvolume, density, messageHandler, shouldCancel, storeIndex);
+      if(result.invalid())
       {
-        if(inputValues->ImportSubvolume && (y < inputValues->StartVoxelCoord[1] || y > inputValues->EndVoxelCoord[1]))
-        {
-          continue;
-        }
-
-        usize fpOffset = ((inputValues->OriginalGeometryDims[1] * inputValues->OriginalGeometryDims[0] * fileZSlice) + (inputValues->OriginalGeometryDims[0] * y) + inputValues->StartVoxelCoord[0]) *
-                         sizeof(float32);
-        if(FSEEK64(f, static_cast<int32>(fpOffset), SEEK_SET) != 0)
-        {
-          return MakeErrorResult(-38707, fmt::format("Could not seek to position {} in file '{}'.", fpOffset, dataFileInput.first.string()));
-        }
-
-        usize index = (inputValues->ImportedGeometryDims[0] * inputValues->ImportedGeometryDims[1] * (z - inputValues->StartVoxelCoord[2])) +
-                      (inputValues->ImportedGeometryDims[0] * (y - inputValues->StartVoxelCoord[1])) + (0);
-        if(fread(buffer.data(), sizeof(float32), deltaX, f) != deltaX)
-        {
-          return MakeErrorResult(-38708, fmt::format("Error reading file at position {} in file '{}'.", fpOffset, dataFileInput.first.string()));
-        }
-
-        for(usize i = index; i < deltaX + index; i++)
-        {
-          density[i] = buffer[i - index];
-        }
+        return MakeErrorResult(-38708, fmt::format("Error reading file '{}': {}", dataFileInput.first.string(), result.errors().front().message));
       }
-      fileZSlice++;
     }
     zShift += dataFileInput.second;
     fileIndex++;
@@ -81,18 +81,9 @@ Result<> ReadBinaryFile(IDataArray* dataArrayPtr, const std::string& filename, u
     return MakeErrorResult(k_RbrFileTooSmall, "The file size is smaller than the allocated size");
   }
 
-  Result<> result = ImportFromBinaryFile(fs::path(filename), dataArray->getDataStoreRef(), skipHeaderBytes, k_DefaultBlockSize);
-  if(result.invalid())
-  {
-    return result;
-  }
-
-  if(endian != static_cast<ChoicesParameter::ValueType>(nx::core::endian::native))
-  {
-    dataArray->byteSwapElements();
-  }
-
-  return result;
+  // The values are swapped in parallel while they are read
+  const bool swapBytes = endian != static_cast<ChoicesParameter::ValueType>(nx::core::endian::native);
+  return ImportFromBinaryFile(fs::path(filename), dataArray->getDataStoreRef(), skipHeaderBytes, k_DefaultBlockSize, swapBytes);
 }
 } // namespace
 
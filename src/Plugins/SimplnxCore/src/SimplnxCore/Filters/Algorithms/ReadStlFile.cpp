@@ -2,15 +2,19 @@
 
 #include "SimplnxCore/utils/StlUtilities.hpp"
 
+#include "simplnx/Common/Bit.hpp"
 #include "simplnx/Common/Range.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
-#include "simplnx/Utilities/GeometryUtilities.hpp"
+#include "simplnx/Utilities/ParallelChunkAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
+#include "simplnx/Utilities/VertexWelder.hpp"
 
 #include <cstdio>
+#include <cstring>
 #include <utility>
 
 using namespace nx::core;
@@ -63,6 +67,110 @@ bool IsVxElementsFile(const std::string& stlHeader)
   // ignore the 2 bytes are anything meaningful.
   return nx::core::StringUtilities::contains(stlHeader, "VXelements");
 }
+
+constexpr usize k_ReadBufferSize = 4 * 1024 * 1024;
+constexpr usize k_TrianglesPerBlock = 65536;
+
+// Normal and three vertices (12 total float32 = 48 Bytes) followed by the uint16 attribute byte count
+constexpr usize k_StlElementCount = 12;
+constexpr usize k_StlTriangleSize = k_StlElementCount * sizeof(float32);
+
+/**
+ * @brief Reads the file through one large buffer so that the triangles are not read one fread at a time. The
+ * position includes the bytes that were skipped past the end of the file, like fseek() does.
+ */
+class StlFileBuffer
+{
+public:
+  StlFileBuffer(FILE* file, uint64 position)
+  : m_File(file)
+  , m_Buffer(k_ReadBufferSize)
+  , m_Position(position)
+  {
+  }
+
+  /**
+   * @brief Makes at least numBytes bytes available unless the end of the file is reached first.
+   * @return usize The number of bytes that are available
+   */
+  usize require(usize numBytes)
+  {
+    if(m_End - m_Begin < numBytes)
+    {
+      std::memmove(m_Buffer.data(), m_Buffer.data() + m_Begin, m_End - m_Begin);
+      m_End -= m_Begin;
+      m_Begin = 0;
+      m_End += std::fread(m_Buffer.data() + m_End, 1, m_Buffer.size() - m_End, m_File);
+    }
+    return m_End - m_Begin;
+  }
+
+  const uint8* data() const
+  {
+    return m_Buffer.data() + m_Begin;
+  }
+
+  void consume(usize numBytes)
+  {
+    m_Begin += numBytes;
+    m_Position += numBytes;
+  }
+
+  void skip(usize numBytes)
+  {
+    const usize buffered = std::min(numBytes, m_End - m_Begin);
+    consume(buffered);
+    if(numBytes > buffered)
+    {
+      std::ignore = std::fseek(m_File, static_cast<long>(numBytes - buffered), SEEK_CUR);
+      m_Position += numBytes - buffered;
+    }
+  }
+
+  uint64 position() const
+  {
+    return m_Position;
+  }
+
+private:
+  FILE* m_File = nullptr;
+  std::vector<uint8> m_Buffer;
+  usize m_Begin = 0;
+  usize m_End = 0;
+  uint64 m_Position = 0;
+};
+
+/**
+ * @brief Splits the raw triangle records of a block into the face normals and the vertex coordinates.
+ */
+class DecodeTrianglesImpl
+{
+public:
+  DecodeTrianglesImpl(const uint8* records, float64* normals, float32* coords)
+  : m_Records(records)
+  , m_Normals(normals)
+  , m_Coords(coords)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::array<float32, k_StlElementCount> fileVert = {0.0F};
+    for(usize t = range.min(); t < range.max(); t++)
+    {
+      std::memcpy(fileVert.data(), m_Records + t * k_StlTriangleSize, k_StlTriangleSize);
+      m_Normals[3 * t + 0] = static_cast<float64>(fileVert[0]);
+      m_Normals[3 * t + 1] = static_cast<float64>(fileVert[1]);
+      m_Normals[3 * t + 2] = static_cast<float64>(fileVert[2]);
+      std::copy(fileVert.cbegin() + 3, fileVert.cend(), m_Coords + 9 * t);
+    }
+  }
+
+private:
+  const uint8* m_Records;
+  float64* m_Normals;
+  float32* m_Coords;
+};
 } // End anonymous namespace
 
 ReadStlFile::ReadStlFile(DataStructure& dataStructure, fs::path stlFilePath, const DataPath& geometryPath, const DataPath& faceGroupPath, const DataPath& faceNormalsDataPath, bool scaleOutput,
@@ -121,29 +229,36 @@ Result<> ReadStlFile::operator()()
   auto& triangleGeom = m_DataStructure.getDataRefAs<TriangleGeom>(m_GeometryDataPath);
 
   triangleGeom.resizeFaceList(triCount);
-  triangleGeom.resizeVertexList(triCount * 3);
 
   using SharedTriList = AbstractDataStore<IGeometry::MeshIndexArrayType::value_type>;
   using SharedVertList = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
 
   SharedTriList& triangles = triangleGeom.getFaces()->getDataStoreRef();
-  SharedVertList& nodes = triangleGeom.getVertices()->getDataStoreRef();
 
   auto& faceNormalsStore = m_DataStructure.getDataAs<Float64Array>(m_FaceNormalsDataPath)->getDataStoreRef();
 
-  // Read the triangles
-  constexpr size_t k_StlElementCount = 12;
-  std::array<float, k_StlElementCount> fileVert = {0.0F};
+  // The triangles are read in blocks. The records of a block are gathered from the file buffer in order, since the
+  // attribute data makes the records variable length, and are then decoded in parallel. The vertices of every block
+  // are welded right away so the duplicated vertices of the file are never stored in the geometry.
+  const usize numTriangles = triCount > 0 ? static_cast<usize>(triCount) : 0;
+  const usize blockCapacity = std::min(numTriangles, k_TrianglesPerBlock);
+  std::vector<uint8> records(blockCapacity * k_StlTriangleSize);
+  std::vector<float64> blockNormals(blockCapacity * 3);
+  std::vector<float32> blockCoords(blockCapacity * 9);
+  std::vector<IGeometry::MeshIndexType> blockFaces(blockCapacity * 3);
+
+  VertexWelder welder;
+  welder.reserve(numTriangles / 2);
+
+  StlFileBuffer fileBuffer(f, nx::core::StlConstants::k_STL_HEADER_LENGTH + sizeof(int32_t));
   uint16_t attr = 0;
-  std::vector<uint8_t> triangleAttributeBuffer(std::numeric_limits<uint16_t>::max()); // Just allocate a buffer of max UINT16 elements
 
-  fpos_t pos;
   auto start = std::chrono::steady_clock::now();
   int32_t progInt = 0;
 
-  for(int32_t t = 0; t < triCount; ++t)
+  for(usize blockStart = 0; blockStart < numTriangles; blockStart += k_TrianglesPerBlock)
   {
-    progInt = static_cast<float>(t) / static_cast<float>(triCount) * 100.0f;
+    progInt = static_cast<float>(blockStart) / static_cast<float>(triCount) * 100.0f;
 
     auto now = std::chrono::steady_clock::now();
     // Only send updates every 1 second
@@ -157,65 +272,91 @@ Result<> ReadStlFile::operator()()
     {
       return {};
     }
-    // Get the current File Position
-    fgetpos(f, &pos);
-#if defined(__APPLE__) || defined(_WIN32)
-    if(pos >= stlFileSize)
-#else
-    if(pos.__pos >= stlFileSize)
-#endif
+
+    const usize blockSize = std::min(k_TrianglesPerBlock, numTriangles - blockStart);
+    for(usize i = 0; i < blockSize; i++)
     {
-      std::string msg = fmt::format(
-          "Trying to read at file position {} >= file size {}.\n  File Header: '{}'\n  Header Triangle Count: {}  Current Triangle: {}\n  The STL File does not conform to the STL file specification.",
-#if defined(__APPLE__) || defined(_WIN32)
-          pos,
-#else
-          pos.__pos,
-#endif
-          stlFileSize, stlHeaderStr, triCount, t);
-      return MakeErrorResult(nx::core::StlConstants::k_StlFileLengthError, msg);
+      const usize t = blockStart + i;
+      if(fileBuffer.position() >= stlFileSize)
+      {
+        std::string msg = fmt::format(
+            "Trying to read at file position {} >= file size {}.\n  File Header: '{}'\n  Header Triangle Count: {}  Current Triangle: {}\n  The STL File does not conform to the STL file specification.",
+            fileBuffer.position(), stlFileSize, stlHeaderStr, triCount, t);
+        return MakeErrorResult(nx::core::StlConstants::k_StlFileLengthError, msg);
+      }
+
+      // Read the Vertices and Normal (12 total float32 = 48 Bytes)
+      const usize available = fileBuffer.require(k_StlTriangleSize + sizeof(uint16_t));
+      if(available < k_StlTriangleSize)
+      {
+        std::string msg = fmt::format("Error reading Triangle '{}'. Object Count was {} and should have been {}", t, available / sizeof(float32), k_StlElementCount);
+        return MakeErrorResult(nx::core::StlConstants::k_TriangleParseError, msg);
+      }
+      std::memcpy(records.data() + i * k_StlTriangleSize, fileBuffer.data(), k_StlTriangleSize);
+      fileBuffer.consume(k_StlTriangleSize);
+
+      // Read the Uint16 value that is supposed to represent the number of bytes following that are file/vendor specific metadata
+      // Lots of writers/vendors do NOT set this properly which can cause problems.
+      if(available < k_StlTriangleSize + sizeof(uint16_t))
+      {
+        std::string msg = fmt::format("Error reading Number of attributes for triangle '{}'. uint16 count was {} and should have been 1", t, 0);
+        return MakeErrorResult(nx::core::StlConstants::k_AttributeParseError, msg);
+      }
+      attr = bit_cast_ptr<uint16_t>(reinterpret_cast<const std::byte*>(fileBuffer.data()));
+      fileBuffer.consume(sizeof(uint16_t));
+      // If we are trying to follow along the STL Spec, skip the stated bytes unless
+      // we detected known Vendors that do not write proper STL Files.
+      if(attr > 0 && !ignoreMetaSizeValue)
+      {
+        fileBuffer.skip(static_cast<usize>(attr)); // Skip past the Triangle Attribute data since we don't know how to read it anyway
+      }
     }
 
-    // Read the Vertices and Normal (12 total float32 = 48 Bytes)
-    size_t objsRead = std::fread(fileVert.data(), sizeof(float), k_StlElementCount, f); // Read the Triangle
-    if(k_StlElementCount != objsRead)
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, blockSize);
+    dataAlg.execute(DecodeTrianglesImpl(records.data(), blockNormals.data(), blockCoords.data()));
+
+    welder.addVertices(nonstd::span<const float32>(blockCoords.data(), blockSize * 9), nonstd::span<IGeometry::MeshIndexType>(blockFaces.data(), blockSize * 3));
+
+    // Write the data into the actual geometry
+    Result<> result = faceNormalsStore.copyFromBuffer(blockStart * 3, nonstd::span<const float64>(blockNormals.data(), blockSize * 3));
+    if(result.invalid())
     {
-      std::string msg = fmt::format("Error reading Triangle '{}'. Object Count was {} and should have been {}", t, objsRead, k_StlElementCount);
-      return MakeErrorResult(nx::core::StlConstants::k_TriangleParseError, msg);
+      return result;
     }
-    // Read the Uint16 value that is supposed to represent the number of bytes following that are file/vendor specific metadata
-    // Lots of writers/vendors do NOT set this properly which can cause problems.
-    objsRead = std::fread(&attr, sizeof(uint16_t), 1, f); // Read the Triangle Attribute Data length
-    if(objsRead != 1)
+    result = triangles.copyFromBuffer(blockStart * 3, nonstd::span<const IGeometry::MeshIndexType>(blockFaces.data(), blockSize * 3));
+    if(result.invalid())
     {
-      std::string msg = fmt::format("Error reading Number of attributes for triangle '{}'. uint16 count was {} and should have been 1", t, objsRead);
-      return MakeErrorResult(nx::core::StlConstants::k_AttributeParseError, msg);
+      return result;
     }
-    // If we are trying to follow along the STL Spec, skip the stated bytes unless
-    // we detected known Vendors that do not write proper STL Files.
-    if(attr > 0 && !ignoreMetaSizeValue)
+  }
+
+  triangleGeom.resizeVertexList(welder.getNumberOfVertices());
+  SharedVertList& nodes = triangleGeom.getVertices()->getDataStoreRef();
+  Result<> result = nodes.copyFromBuffer(0, nonstd::span<const float32>(welder.getVertices().data(), welder.getVertices().size()));
+  if(result.invalid())
+  {
+    return result;
+  }
+  if(m_ScaleOutput)
+  {
+    const float32 scaleFactor = m_ScaleFactor;
+    ParallelChunkAlgorithm chunkAlg;
+    result = chunkAlg.executeInPlace(nodes, [scaleFactor](nonstd::span<float32> coords, const Range& /*tupleRange*/) {
+      for(float32& coord : coords)
+      {
+        coord *= scaleFactor;
+      }
+    });
+    if(result.invalid())
     {
-      std::ignore = std::fseek(f, static_cast<size_t>(attr), SEEK_CUR); // Skip past the Triangle Attribute data since we don't know how to read it anyway
+      return result;
     }
+  }
 
-    // Write the data into the actual geometry
-    faceNormalsStore[3 * t + 0] = static_cast<double>(fileVert[0]);
-    faceNormalsStore[3 * t + 1] = static_cast<double>(fileVert[1]);
-    faceNormalsStore[3 * t + 2] = static_cast<double>(fileVert[2]);
-    nodes[3 * (3 * t + 0) + 0] = fileVert[3];
-    nodes[3 * (3 * t + 0) + 1] = fileVert[4];
-    nodes[3 * (3 * t + 0) + 2] = fileVert[5];
-    nodes[3 * (3 * t + 1) + 0] = fileVert[6];
-    nodes[3 * (3 * t + 1) + 1] = fileVert[7];
-    nodes[3 * (3 * t + 1) + 2] = fileVert[8];
-    nodes[3 * (3 * t + 2) + 0] = fileVert[9];
-    nodes[3 * (3 * t + 2) + 1] = fileVert[10];
-    nodes[3 * (3 * t + 2) + 2] = fileVert[11];
-    triangles[t * 3] = 3 * t + 0;
-    triangles[t * 3 + 1] = 3 * t + 1;
-    triangles[t * 3 + 2] = 3 * t + 2;
-  }
-
-  return GeometryUtilities::EliminateDuplicateNodes(triangleGeom, m_ScaleOutput ? std::optional<float32>(m_ScaleFactor) : std::nullopt);
+  triangleGeom.getFaceAttributeMatrix()->resizeTuples({triangleGeom.getNumberOfFaces()});
+  triangleGeom.getVertexAttributeMatrix()->resizeTuples({triangleGeom.getNumberOfVertices()});
+
+  return {};
   // The fileSentinel will ensure the FILE* is closed.
 }
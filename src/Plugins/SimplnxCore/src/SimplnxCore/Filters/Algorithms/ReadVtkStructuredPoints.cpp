@@ -1,5 +1,7 @@
 #include "ReadVtkStructuredPoints.hpp"
 
+#include "SimplnxCore/utils/VtkUtilities.hpp"
+
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
@@ -15,7 +17,6 @@ using namespace nx::core;
 namespace
 {
 constexpr usize kBufferSize = 1024ULL;
-constexpr usize DEFAULT_BLOCKSIZE = 1048576; // This is evenly divisible by 2,4, & 8.
 
 constexpr StringLiteral k_DatasetKeyword = "DATASET";
 constexpr StringLiteral k_StructuredPointsKeyword = "STRUCTURED_POINTS";
@@ -83,100 +84,85 @@ int32 skipVolume(std::istream& in, bool binary, usize numElements)
 
 // -------------------------------------------------------------------------
 template <typename T>
-int32 vtkReadBinaryData(std::istream& in, DataArray<T>& data)
+Result<> vtkReadBinaryBytes(std::istream& in, nonstd::span<T> values)
 {
-  if(data.getNumberOfComponents() == 0 || data.getNumberOfTuples() == 0)
+  const usize numBytesToRead = values.size() * sizeof(T);
+  in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(numBytesToRead));
+  const usize bytesRead = static_cast<usize>(in.gcount());
+  if(bytesRead == numBytesToRead)
   {
-    // nothing to read here.
-    return 1;
+    return {};
   }
-  usize numTuples = data.getNumberOfTuples();
-  usize numComp = data.getNumberOfComponents();
-
-  using DataStoreType = typename DataArray<T>::store_type;
-
-  DataStoreType& dataStore = data.getDataStoreRef();
-
-  usize numBytesToRead = static_cast<usize>(numTuples) * static_cast<usize>(numComp) * sizeof(T);
-  // Cast our pointer to a pointer that std::istream will take
-
-  usize numRead = 0;
-  // Now start reading the data in chunks if needed.
-  usize chunkSize = DEFAULT_BLOCKSIZE;
-
-  // Sanity check the chunk size to make sure it is not any larger than the chunk of data we are about to read
-  if(numBytesToRead < DEFAULT_BLOCKSIZE)
+  if((in.rdstate() & std::ifstream::badbit) != 0)
   {
-    chunkSize = numBytesToRead;
+    return MakeErrorResult(-12021, fmt::format("The stream failed after {} bytes could be read. Needed {} bytes.", bytesRead, numBytesToRead));
   }
-
-  std::vector<char> chunk(chunkSize, 0);
-  char* chunkPtr = chunk.data();
-  nonstd::span<T> typedArray(reinterpret_cast<T*>(chunk.data()), chunkSize);
-
-  usize masterByteCounter = 0;
-  usize bytes_read = 0;
-  usize typeSize = sizeof(T);
-  usize totalElementsRead = 0;
-
-  // Now chunk through the file reading up chunks of data that can actually be
-  // read in a single read. DEFAULT_BLOCKSIZE will control this.
-  while(true)
+  if((in.rdstate() & std::ifstream::eofbit) != 0)
   {
-    in.read(chunkPtr, chunkSize);
-    bytes_read = in.gcount();
-
-    // Copy the buffer to the DataArray<T> object
-    std::copy(typedArray.begin(), typedArray.end(), dataStore.begin() + totalElementsRead);
+    return MakeErrorResult(-12021, fmt::format("The end of the file was reached after {} bytes could be read. Needed {} bytes.", bytesRead, numBytesToRead));
+  }
+  return MakeErrorResult(-12020, fmt::format("Only {} bytes could be read. Needed {} bytes.", bytesRead, numBytesToRead));
+}
 
-    totalElementsRead += bytes_read / typeSize; // Keep track of the number of actual values read, not just the bytes
-    masterByteCounter += bytes_read;            // Keep track of the total number of bytes that have been read.
+// -------------------------------------------------------------------------
+template <typename T>
+Result<> vtkReadBinaryData(std::istream& in, DataArray<T>& data)
+{
+  if(data.getNumberOfComponents() == 0 || data.getNumberOfTuples() == 0)
+  {
+    // nothing to read here.
+    return {};
+  }
 
-    // Check if we are done reading the data, if so, break from the loop
-    if(masterByteCounter >= numBytesToRead)
-    {
-      break;
-    }
+  // VTK binary data is always big endian
+  constexpr bool k_SwapBytes = endian::little == endian::native;
 
-    // Adjust the chunk size for next time
-    if(numBytesToRead - masterByteCounter < chunkSize)
+  // An in memory store is read with a single call straight into its memory
+  auto* dataStore = dynamic_cast<DataStore<T>*>(data.getDataStore());
+  if(dataStore != nullptr)
+  {
+    nonstd::span<T> values(dataStore->data(), dataStore->getSize());
+    Result<> readResult = vtkReadBinaryBytes(in, values);
+    if(readResult.invalid())
     {
-      chunkSize = numBytesToRead - masterByteCounter;
+      return readResult;
     }
-
-    if(in.good())
+    if constexpr(k_SwapBytes)
     {
-      // std::cout << "all data read successfully." << in.gcount() << std::endl;
+      VtkByteSwapValues(values);
     }
+    return {};
+  }
 
-    if((in.rdstate() & std::ifstream::failbit) != 0)
+  // Any other store is filled block by block
+  AbstractDataStore<T>& abstractDataStore = data.getDataStoreRef();
+  const usize totalValues = abstractDataStore.getSize();
+  const usize blockValues = std::min(std::max<usize>(k_VtkBinaryBlockBytes / sizeof(T), 1), totalValues);
+  auto block = std::make_unique<T[]>(blockValues);
+  for(usize start = 0; start < totalValues; start += blockValues)
+  {
+    nonstd::span<T> values(block.get(), std::min(blockValues, totalValues - start));
+    Result<> readResult = vtkReadBinaryBytes(in, values);
+    if(readResult.invalid())
     {
-      std::cout << "FAIL " << in.gcount() << " could be read. Needed " << chunkSize << " total bytes read = " << masterByteCounter << std::endl;
-      return -12020;
+      return readResult;
     }
-    if((in.rdstate() & std::ifstream::eofbit) != 0)
+    if constexpr(k_SwapBytes)
     {
-      std::cout << "EOF " << in.gcount() << " could be read. Needed " << chunkSize << " total bytes read = " << masterByteCounter << std::endl;
-      return -12021;
+      VtkByteSwapValues(values);
     }
-    if((in.rdstate() & std::ifstream::badbit) != 0)
+    Result<> copyResult = abstractDataStore.copyFromBuffer(start, values);
+    if(copyResult.invalid())
     {
-      std::cout << "BAD " << in.gcount() << " could be read. Needed " << chunkSize << " total bytes read = " << masterByteCounter << std::endl;
-      return -12021;
+      return copyResult;
     }
   }
-
-  // Swap to big Endian... because
-  if constexpr(endian::little == endian::native)
-  {
-    data.byteSwapElements();
-  }
-  return 0;
+  return {};
 }
 
 // -----------------------------------------------------------------------------
 template <typename T>
-Result<> readDataChunk(DataStructure* dataStructurePtr, std::istream& in, bool binary, const DataPath& dataArrayPath)
+Result<> readDataChunk(DataStructure* dataStructurePtr, std::istream& in, bool binary, const DataPath& dataArrayPath, const IFilter::MessageHandler& messageHandler)
 {
   using DataArrayType = DataArray<T>;
 
@@ -184,22 +170,19 @@ Result<> readDataChunk(DataStructure* dataStructurePtr, std::istream& in, bool b
   std::vector<usize> tDims = dataArrayRef.getTupleShape();
   std::vector<usize> cDims = dataArrayRef.getComponentShape();
 
-  dataArrayRef.fill(static_cast<T>(0));
   if(binary)
   {
-    int32 err = vtkReadBinaryData<T>(in, dataArrayRef);
-    if(err < 0)
+    // Every value is overwritten, so the array is not cleared first
+    Result<> readResult = vtkReadBinaryData<T>(in, dataArrayRef);
+    if(readResult.invalid())
     {
       return MakeErrorResult(to_underlying(ReadVtkStructuredPoints::ErrorCodes::VtkReadBinaryDataErr),
-                             fmt::format("Error Reading Binary Data '{}'.  numTuples = {}\n", dataArrayPath.toString(), dataArrayRef.getNumberOfTuples()));
-    }
-    if(nx::core::checkEndian() == nx::core::endian::big)
-    {
-      dataArrayRef.byteSwapElements();
+                             fmt::format("Error Reading Binary Data '{}'.  numTuples = {}\n{}", dataArrayPath.toString(), dataArrayRef.getNumberOfTuples(), readResult.errors().front().message));
     }
   }
   else
   {
+    dataArrayRef.fill(static_cast<T>(0));
     auto start = std::chrono::steady_clock::now();
 
     usize totalSize = dataArrayRef.size();
@@ -212,7 +195,7 @@ Result<> readDataChunk(DataStructure* dataStructurePtr, std::istream& in, bool b
       auto now = std::chrono::steady_clock::now();
       if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
       {
-        std::cout << "Read " << index << "/" << totalSize << "  " << std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() << std::endl;
+        messageHandler(IFilter::Message::Type::Info, fmt::format("Reading '{}': {}/{} values", dataArrayPath.toString(), index, totalSize));
         start = std::chrono::steady_clock::now();
       }
 
@@ -1036,43 +1019,43 @@ Result<> ReadVtkStructuredPoints::readScalarData(std::istream& in, int32 numPts)
   // Read the data
   if(scalarType == "unsigned_char")
   {
-    return readDataChunk<uint8>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<uint8>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "char")
   {
-    return readDataChunk<int8>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<int8>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "unsigned_short")
   {
-    return readDataChunk<uint16>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<uint16>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "short")
   {
-    return readDataChunk<int16>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<int16>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "unsigned_int")
   {
-    return readDataChunk<uint32>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<uint32>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "int")
   {
-    return readDataChunk<int32>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<int32>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "unsigned_long")
   {
-    return readDataChunk<uint64>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<uint64>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "long")
   {
-    return readDataChunk<int64>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<int64>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "float")
   {
-    return readDataChunk<float32>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<float32>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
   else if(scalarType == "double")
   {
-    return readDataChunk<float64>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath);
+    return readDataChunk<float64>(&m_DataStructure, in, m_FileIsBinary, arrayDataPath, m_MessageHandler);
   }
 
   return {};
@@ -3,7 +3,12 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/EdgeGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/BoundingVolumeHierarchy.hpp"
 #include "simplnx/Utilities/GeometryUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <limits>
 
 using namespace nx::core;
 
@@ -34,128 +39,118 @@ char RayIntersectsPlane(const float32 d, const std::array<float32, 3>& q, const
 
   return '0';
 }
-} // namespace
-
-// -----------------------------------------------------------------------------
-SliceTriangleGeometry::SliceTriangleGeometry(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
-                                             SliceTriangleGeometryInputValues* inputValues)
-: m_DataStructure(dataStructure)
-, m_InputValues(inputValues)
-, m_ShouldCancel(shouldCancel)
-, m_MessageHandler(mesgHandler)
-{
-}
-
-// -----------------------------------------------------------------------------
-SliceTriangleGeometry::~SliceTriangleGeometry() noexcept = default;
 
-// -----------------------------------------------------------------------------
-const std::atomic_bool& SliceTriangleGeometry::getCancel()
+/**
+ * @brief The segments cut from a contiguous block of triangles, in triangle order.
+ */
+struct SliceSegments
 {
-  return m_ShouldCancel;
-}
+  std::vector<float32> Vertices;
+  std::vector<int32> SliceIds;
+  std::vector<int32> RegionIds;
+};
 
-// -----------------------------------------------------------------------------
-Result<> SliceTriangleGeometry::operator()()
+/**
+ * @brief Cuts the triangles of each block with every slice plane they span. Each block writes its own
+ * segment lists so the blocks can be concatenated in triangle order afterwards.
+ */
+class SliceTrianglesImpl
 {
-  // geometry will be rotated so that the sectioning direction is always 001 before rotating back
-  std::array<float32, 3> n = {0.0f, 0.0f, 1.0f};
+public:
+  static constexpr usize k_TrianglesPerBlock = 4096;
 
-  auto& triangle = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->CADDataContainerName);
-  int32 err = triangle.findEdges(true);
-  if(err < 0)
+  SliceTrianglesImpl(const std::vector<usize>& triangleIds, const AbstractDataStore<IGeometry::MeshIndexType>& tris, const AbstractDataStore<float32>& triVerts,
+                     const AbstractDataStore<int32>* triRegionIds, float32 sliceResolution, float32 minDim, float32 maxDim, std::vector<SliceSegments>& blockSegments)
+  : m_TriangleIds(triangleIds)
+  , m_Tris(tris)
+  , m_TriVerts(triVerts)
+  , m_TriRegionIds(triRegionIds)
+  , m_HaveRegionIds(triRegionIds != nullptr)
+  , m_SliceResolution(sliceResolution)
+  , m_MinDim(minDim)
+  , m_MaxDim(maxDim)
+  , m_MinSlice(static_cast<int64>(minDim / sliceResolution))
+  , m_MaxSlice(static_cast<int64>(maxDim / sliceResolution))
+  , m_BlockSegments(blockSegments)
   {
-    return MakeErrorResult(-62101, "Error retrieving the shared edge list");
   }
 
-  TriStore& tris = triangle.getFaces()->getDataStoreRef();
-  VertsStore& triVerts = triangle.getVertices()->getDataStoreRef();
-  usize numTris = triangle.getNumberOfFaces();
-  usize numTriVerts = triangle.getNumberOfVertices();
-
-  // rotate CAD triangles to get into sectioning orientation
-  // rotateVertices(rotForward, n, numTriVerts, triVerts);
-
-  // determine bounds and number of slices needed for CAD geometry
-  float32 minDim = std::numeric_limits<float32>::max();
-  float32 maxDim = -minDim;
-  usize numberOfSlices = determineBoundsAndNumSlices(minDim, maxDim, numTris, tris, triVerts);
-  const auto minSlice = static_cast<int64>(minDim / m_InputValues->SliceResolution);
-  const auto maxSlice = static_cast<int64>(maxDim / m_InputValues->SliceResolution);
-
-  std::array<float32, 3> q = {0.0f, 0.0f, 0.0f};
-  std::array<float32, 3> r = {0.0f, 0.0f, 0.0f};
-  std::array<float32, 3> p = {0.0f, 0.0f, 0.0f};
-  std::array<float32, 3> corner = {0.0f, 0.0f, 0.0f};
-  float32 d = 0;
-
-  std::vector<float32> slicedVerts;
-  std::vector<int32> sliceIds;
-  std::vector<int32> regionIds;
-
-  AbstractDataStore<int32>* triRegionIdPtr = nullptr;
-  // Get an object reference to the pointer
-  if(m_InputValues->HaveRegionIds)
+  void operator()(const Range& range) const
   {
-    triRegionIdPtr = m_DataStructure.getDataAs<Int32Array>(m_InputValues->RegionIdArrayPath)->getDataStore();
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      SliceSegments& segments = m_BlockSegments[block];
+      const usize start = block * k_TrianglesPerBlock;
+      const usize end = std::min(start + k_TrianglesPerBlock, m_TriangleIds.size());
+      for(usize index = start; index < end; index++)
+      {
+        sliceTriangle(m_TriangleIds[index], segments);
+      }
+    }
   }
-  int32 edgeCounter = 0;
-  for(usize i = 0; i < numTris; i++)
+
+  void sliceTriangle(usize i, SliceSegments& segments) const
   {
+    std::array<float32, 3> q = {0.0f, 0.0f, 0.0f};
+    std::array<float32, 3> r = {0.0f, 0.0f, 0.0f};
+    std::array<float32, 3> p = {0.0f, 0.0f, 0.0f};
+    std::array<float32, 3> corner = {0.0f, 0.0f, 0.0f};
+    float32 d = 0;
+
     int32 regionId = 0;
     // get regionId of this triangle (if they are available)
-    if(m_InputValues->HaveRegionIds)
+    if(m_HaveRegionIds)
     {
-      regionId = triRegionIdPtr->operator[](i);
+      regionId = m_TriRegionIds->getValue(i);
     }
     // determine which slices would hit the triangle
     auto minTriDim = std::numeric_limits<float32>::max();
     float32 maxTriDim = -minTriDim;
     for(usize j = 0; j < 3; j++)
     {
-      TriStore::value_type vert = tris[3 * i + j];
-      if(minTriDim > triVerts[3 * vert + 2])
+      const IGeometry::MeshIndexType vert = m_Tris[3 * i + j];
+      if(minTriDim > m_TriVerts[3 * vert + 2])
       {
-        minTriDim = triVerts[3 * vert + 2];
+        minTriDim = m_TriVerts[3 * vert + 2];
       }
-      if(maxTriDim < triVerts[3 * vert + 2])
+      if(maxTriDim < m_TriVerts[3 * vert + 2])
       {
-        maxTriDim = triVerts[3 * vert + 2];
+        maxTriDim = m_TriVerts[3 * vert + 2];
       }
     }
-    if(minTriDim > maxDim || maxTriDim < minDim)
+    if(minTriDim > m_MaxDim || maxTriDim < m_MinDim)
     {
-      continue;
+      return;
     }
-    if(minTriDim < minDim)
+    if(minTriDim < m_MinDim)
     {
-      minTriDim = minDim;
+      minTriDim = m_MinDim;
     }
-    if(maxTriDim > maxDim)
+    if(maxTriDim > m_MaxDim)
     {
-      maxTriDim = maxDim;
+      maxTriDim = m_MaxDim;
     }
-    auto firstSlice = static_cast<int64>(minTriDim / m_InputValues->SliceResolution);
-    auto lastSlice = static_cast<int64>(maxTriDim / m_InputValues->SliceResolution);
-    if(firstSlice < minSlice)
+    auto firstSlice = static_cast<int64>(minTriDim / m_SliceResolution);
+    auto lastSlice = static_cast<int64>(maxTriDim / m_SliceResolution);
+    if(firstSlice < m_MinSlice)
     {
-      firstSlice = minSlice;
+      firstSlice = m_MinSlice;
     }
-    if(lastSlice > maxSlice)
+    if(lastSlice > m_MaxSlice)
     {
-      lastSlice = maxSlice;
+      lastSlice = m_MaxSlice;
     }
     // get cross product of triangle vectors to get normals
     float32 vecAB[3];
     float32 vecAC[3];
     float32 triCross[3];
     char val;
-    vecAB[0] = triVerts[3 * tris[3 * i + 1]] - triVerts[3 * tris[3 * i]];
-    vecAB[1] = triVerts[3 * tris[3 * i + 1] + 1] - triVerts[3 * tris[3 * i] + 1];
-    vecAB[2] = triVerts[3 * tris[3 * i + 1] + 2] - triVerts[3 * tris[3 * i] + 2];
-    vecAC[0] = triVerts[3 * tris[3 * i + 2]] - triVerts[3 * tris[3 * i]];
-    vecAC[1] = triVerts[3 * tris[3 * i + 2] + 1] - triVerts[3 * tris[3 * i] + 1];
-    vecAC[2] = triVerts[3 * tris[3 * i + 2] + 2] - triVerts[3 * tris[3 * i] + 2];
+    vecAB[0] = m_TriVerts[3 * m_Tris[3 * i + 1]] - m_TriVerts[3 * m_Tris[3 * i]];
+    vecAB[1] = m_TriVerts[3 * m_Tris[3 * i + 1] + 1] - m_TriVerts[3 * m_Tris[3 * i] + 1];
+    vecAB[2] = m_TriVerts[3 * m_Tris[3 * i + 1] + 2] - m_TriVerts[3 * m_Tris[3 * i] + 2];
+    vecAC[0] = m_TriVerts[3 * m_Tris[3 * i + 2]] - m_TriVerts[3 * m_Tris[3 * i]];
+    vecAC[1] = m_TriVerts[3 * m_Tris[3 * i + 2] + 1] - m_TriVerts[3 * m_Tris[3 * i] + 1];
+    vecAC[2] = m_TriVerts[3 * m_Tris[3 * i + 2] + 2] - m_TriVerts[3 * m_Tris[3 * i] + 2];
     triCross[0] = vecAB[1] * vecAC[2] - vecAB[2] * vecAC[1];
     triCross[1] = vecAB[2] * vecAC[0] - vecAB[0] * vecAC[2];
     triCross[2] = vecAB[0] * vecAC[1] - vecAB[1] * vecAC[0];
@@ -163,13 +158,13 @@ Result<> SliceTriangleGeometry::operator()()
     {
       int cut = 0;
       bool cornerHit = false;
-      d = (m_InputValues->SliceResolution * static_cast<float32>(j));
-      q[0] = triVerts[3 * tris[3 * i]];
-      q[1] = triVerts[3 * tris[3 * i] + 1];
-      q[2] = triVerts[3 * tris[3 * i] + 2];
-      r[0] = triVerts[3 * tris[3 * i + 1]];
-      r[1] = triVerts[3 * tris[3 * i + 1] + 1];
-      r[2] = triVerts[3 * tris[3 * i + 1] + 2];
+      d = (m_SliceResolution * static_cast<float32>(j));
+      q[0] = m_TriVerts[3 * m_Tris[3 * i]];
+      q[1] = m_TriVerts[3 * m_Tris[3 * i] + 1];
+      q[2] = m_TriVerts[3 * m_Tris[3 * i] + 2];
+      r[0] = m_TriVerts[3 * m_Tris[3 * i + 1]];
+      r[1] = m_TriVerts[3 * m_Tris[3 * i + 1] + 1];
+      r[2] = m_TriVerts[3 * m_Tris[3 * i + 1] + 2];
       if(q[2] > r[2])
       {
         val = RayIntersectsPlane(d, r, q, p);
@@ -180,9 +175,9 @@ Result<> SliceTriangleGeometry::operator()()
       }
       if(val == '1')
       {
-        slicedVerts.push_back(p[0]);
-        slicedVerts.push_back(p[1]);
-        slicedVerts.push_back(p[2]);
+        segments.Vertices.push_back(p[0]);
+        segments.Vertices.push_back(p[1]);
+        segments.Vertices.push_back(p[2]);
         cut++;
       }
       else if(val == 'q' || val == 'r')
@@ -192,9 +187,9 @@ Result<> SliceTriangleGeometry::operator()()
         corner[1] = p[1];
         corner[2] = p[2];
       }
-      r[0] = triVerts[3 * tris[3 * i + 2]];
-      r[1] = triVerts[3 * tris[3 * i + 2] + 1];
-      r[2] = triVerts[3 * tris[3 * i + 2] + 2];
+      r[0] = m_TriVerts[3 * m_Tris[3 * i + 2]];
+      r[1] = m_TriVerts[3 * m_Tris[3 * i + 2] + 1];
+      r[2] = m_TriVerts[3 * m_Tris[3 * i + 2] + 2];
       if(q[2] > r[2])
       {
         val = RayIntersectsPlane(d, r, q, p);
@@ -205,9 +200,9 @@ Result<> SliceTriangleGeometry::operator()()
       }
       if(val == '1')
       {
-        slicedVerts.push_back(p[0]);
-        slicedVerts.push_back(p[1]);
-        slicedVerts.push_back(p[2]);
+        segments.Vertices.push_back(p[0]);
+        segments.Vertices.push_back(p[1]);
+        segments.Vertices.push_back(p[2]);
         cut++;
       }
       else if(val == 'q' || val == 'r')
@@ -217,9 +212,9 @@ Result<> SliceTriangleGeometry::operator()()
         corner[1] = p[1];
         corner[2] = p[2];
       }
-      q[0] = triVerts[3 * tris[3 * i + 1]];
-      q[1] = triVerts[3 * tris[3 * i + 1] + 1];
-      q[2] = triVerts[3 * tris[3 * i + 1] + 2];
+      q[0] = m_TriVerts[3 * m_Tris[3 * i + 1]];
+      q[1] = m_TriVerts[3 * m_Tris[3 * i + 1] + 1];
+      q[2] = m_TriVerts[3 * m_Tris[3 * i + 1] + 2];
       if(q[2] > r[2])
       {
         val = RayIntersectsPlane(d, r, q, p);
@@ -230,9 +225,9 @@ Result<> SliceTriangleGeometry::operator()()
       }
       if(val == '1')
       {
-        slicedVerts.push_back(p[0]);
-        slicedVerts.push_back(p[1]);
-        slicedVerts.push_back(p[2]);
+        segments.Vertices.push_back(p[0]);
+        segments.Vertices.push_back(p[1]);
+        segments.Vertices.push_back(p[2]);
         cut++;
       }
       else if(val == 'q' || val == 'r')
@@ -246,49 +241,146 @@ Result<> SliceTriangleGeometry::operator()()
       {
         for(int k = 0; k < 3; k++)
         {
-          slicedVerts.pop_back();
+          segments.Vertices.pop_back();
         }
       }
       if(cut == 1 && cornerHit)
       {
-        slicedVerts.push_back(corner[0]);
-        slicedVerts.push_back(corner[1]);
-        slicedVerts.push_back(corner[2]);
+        segments.Vertices.push_back(corner[0]);
+        segments.Vertices.push_back(corner[1]);
+        segments.Vertices.push_back(corner[2]);
         cut++;
       }
       if(cut == 3)
       {
         for(int k = 0; k < 9; k++)
         {
-          slicedVerts.pop_back();
+          segments.Vertices.pop_back();
         }
       }
       if(cut == 2)
       {
-        const usize size = slicedVerts.size();
+        const usize size = segments.Vertices.size();
         // get delta x for the current ordering of the segment
-        const float32 delX = slicedVerts[size - 6] - slicedVerts[size - 3];
+        const float32 delX = segments.Vertices[size - 6] - segments.Vertices[size - 3];
         // get cross product of vec with 001 slicing direction
         if((triCross[1] > 0 && delX < 0) || (triCross[1] < 0 && delX > 0))
         {
-          const float32 temp[3] = {slicedVerts[size - 3], slicedVerts[size - 2], slicedVerts[size - 1]};
-          slicedVerts[size - 3] = slicedVerts[size - 6];
-          slicedVerts[size - 2] = slicedVerts[size - 5];
-          slicedVerts[size - 1] = slicedVerts[size - 4];
-          slicedVerts[size - 6] = temp[0];
-          slicedVerts[size - 5] = temp[1];
-          slicedVerts[size - 4] = temp[2];
+          const float32 temp[3] = {segments.Vertices[size - 3], segments.Vertices[size - 2], segments.Vertices[size - 1]};
+          segments.Vertices[size - 3] = segments.Vertices[size - 6];
+          segments.Vertices[size - 2] = segments.Vertices[size - 5];
+          segments.Vertices[size - 1] = segments.Vertices[size - 4];
+          segments.Vertices[size - 6] = temp[0];
+          segments.Vertices[size - 5] = temp[1];
+          segments.Vertices[size - 4] = temp[2];
         }
-        sliceIds.push_back(j);
-        if(m_InputValues->HaveRegionIds)
+        segments.SliceIds.push_back(j);
+        if(m_HaveRegionIds)
         {
-          regionIds.push_back(regionId);
+          segments.RegionIds.push_back(regionId);
         }
-        edgeCounter++;
       }
     }
   }
 
+private:
+  const std::vector<usize>& m_TriangleIds;
+  const AbstractDataStore<IGeometry::MeshIndexType>& m_Tris;
+  const AbstractDataStore<float32>& m_TriVerts;
+  const AbstractDataStore<int32>* m_TriRegionIds = nullptr;
+  bool m_HaveRegionIds = false;
+  float32 m_SliceResolution = 1.0f;
+  float32 m_MinDim = 0.0f;
+  float32 m_MaxDim = 0.0f;
+  int64 m_MinSlice = 0;
+  int64 m_MaxSlice = 0;
+  std::vector<SliceSegments>& m_BlockSegments;
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+SliceTriangleGeometry::SliceTriangleGeometry(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
+                                             SliceTriangleGeometryInputValues* inputValues)
+: m_DataStructure(dataStructure)
+, m_InputValues(inputValues)
+, m_ShouldCancel(shouldCancel)
+, m_MessageHandler(mesgHandler)
+{
+}
+
+// -----------------------------------------------------------------------------
+SliceTriangleGeometry::~SliceTriangleGeometry() noexcept = default;
+
+// -----------------------------------------------------------------------------
+const std::atomic_bool& SliceTriangleGeometry::getCancel()
+{
+  return m_ShouldCancel;
+}
+
+// -----------------------------------------------------------------------------
+Result<> SliceTriangleGeometry::operator()()
+{
+  // geometry will be rotated so that the sectioning direction is always 001 before rotating back
+  std::array<float32, 3> n = {0.0f, 0.0f, 1.0f};
+
+  auto& triangle = m_DataStructure.getDataRefAs<TriangleGeom>(m_InputValues->CADDataContainerName);
+  int32 err = triangle.findEdges(true);
+  if(err < 0)
+  {
+    return MakeErrorResult(-62101, "Error retrieving the shared edge list");
+  }
+
+  TriStore& tris = triangle.getFaces()->getDataStoreRef();
+  VertsStore& triVerts = triangle.getVertices()->getDataStoreRef();
+  usize numTris = triangle.getNumberOfFaces();
+  usize numTriVerts = triangle.getNumberOfVertices();
+
+  // rotate CAD triangles to get into sectioning orientation
+  // rotateVertices(rotForward, n, numTriVerts, triVerts);
+
+  // determine bounds and number of slices needed for CAD geometry
+  float32 minDim = std::numeric_limits<float32>::max();
+  float32 maxDim = -minDim;
+  usize numberOfSlices = determineBoundsAndNumSlices(minDim, maxDim, numTris, tris, triVerts);
+
+  AbstractDataStore<int32>* triRegionIdPtr = nullptr;
+  // Get an object reference to the pointer
+  if(m_InputValues->HaveRegionIds)
+  {
+    triRegionIdPtr = m_DataStructure.getDataAs<Int32Array>(m_InputValues->RegionIdArrayPath)->getDataStore();
+  }
+  // Only the triangles whose z extent overlaps the slicing range can be cut. They are sliced in
+  // increasing triangle order so the segments are in the same order as a serial pass over all triangles.
+  std::vector<usize> triangleIds;
+  if(numTris > 0 && minDim <= maxDim)
+  {
+    const BoundingVolumeHierarchy hierarchy = BoundingVolumeHierarchy::CreateFromTriangles(tris, triVerts);
+    const BoundingBox3Df sliceRange(Point3Df(std::numeric_limits<float32>::lowest(), std::numeric_limits<float32>::lowest(), minDim),
+                                    Point3Df(std::numeric_limits<float32>::max(), std::numeric_limits<float32>::max(), maxDim));
+    hierarchy.visitOverlapping(sliceRange, [&triangleIds](usize triIndex) {
+      triangleIds.push_back(triIndex);
+      return true;
+    });
+    std::sort(triangleIds.begin(), triangleIds.end());
+  }
+
+  const usize numBlocks = (triangleIds.size() + SliceTrianglesImpl::k_TrianglesPerBlock - 1) / SliceTrianglesImpl::k_TrianglesPerBlock;
+  std::vector<SliceSegments> blockSegments(numBlocks);
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.requireStoresInMemory({&tris, &triVerts, triRegionIdPtr});
+  dataAlg.execute(SliceTrianglesImpl(triangleIds, tris, triVerts, triRegionIdPtr, m_InputValues->SliceResolution, minDim, maxDim, blockSegments));
+
+  std::vector<float32> slicedVerts;
+  std::vector<int32> sliceIds;
+  std::vector<int32> regionIds;
+  for(const SliceSegments& segments : blockSegments)
+  {
+    slicedVerts.insert(slicedVerts.end(), segments.Vertices.begin(), segments.Vertices.end());
+    sliceIds.insert(sliceIds.end(), segments.SliceIds.begin(), segments.SliceIds.end());
+    regionIds.insert(regionIds.end(), segments.RegionIds.begin(), segments.RegionIds.end());
+  }
+
   usize numVerts = slicedVerts.size() / 3;
   usize numEdges = slicedVerts.size() / 6;
 
@@ -84,33 +84,11 @@ Result<> WriteAvizoRectilinearCoordinate::writeData(FILE* outputFile) const
 
   fprintf(outputFile, "@1 # FeatureIds in z, y, x with X moving fastest, then Y, then Z\n");
 
-  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<DataStore<int32>>();
-  const usize totalPoints = featureIds.getNumberOfTuples();
-
-  if(m_InputValues->WriteBinaryFile)
-  {
-    fwrite(featureIds.data(), sizeof(int32_t), totalPoints, outputFile);
-  }
-  else
+  Result<> featureIdsResult = writeFeatureIds(outputFile);
+  if(featureIdsResult.invalid())
   {
-    // The "20 Items" is purely arbitrary and is put in to try and save some space in the ASCII file
-    int count = 0;
-    for(size_t i = 0; i < totalPoints; ++i)
-    {
-      fprintf(outputFile, "%d", featureIds[i]);
-      if(count < 20)
-      {
-        fprintf(outputFile, " ");
-        count++;
-      }
-      else
-      {
-        fprintf(outputFile, "\n");
-        count = 0;
-      }
-    }
+    return featureIdsResult;
   }
-  fprintf(outputFile, "\n");
 
   fprintf(outputFile, "@2 # x coordinates, then y, then z\n");
 
@@ -87,32 +87,5 @@ Result<> WriteAvizoUniformCoordinate::writeData(FILE* outputFile) const
 {
   fprintf(outputFile, "@1\n");
 
-  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<DataStore<int32>>();
-  const usize totalPoints = featureIds.getNumberOfTuples();
-
-  if(m_InputValues->WriteBinaryFile)
-  {
-    fwrite(featureIds.data(), sizeof(int32), totalPoints, outputFile);
-  }
-  else
-  {
-    // The "20 Items" is purely arbitrary and is put in to try and save some space in the ASCII file
-    int count = 0;
-    for(size_t i = 0; i < totalPoints; ++i)
-    {
-      fprintf(outputFile, "%d", featureIds[i]);
-      if(count < 20)
-      {
-        fprintf(outputFile, " ");
-        count++;
-      }
-      else
-      {
-        fprintf(outputFile, "\n");
-        count = 0;
-      }
-    }
-  }
-  fprintf(outputFile, "\n");
-  return {};
+  return writeFeatureIds(outputFile);
 }
\ No newline at end of file
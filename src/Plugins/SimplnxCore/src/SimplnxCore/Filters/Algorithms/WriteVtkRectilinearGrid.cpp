@@ -67,15 +67,20 @@ Result<> WriteVtkRectilinearGrid::operator()()
   const auto totalCells = imageGeom.getNumXCells() * imageGeom.getNumYCells() * imageGeom.getNumZCells();
   fprintf(outputFile, "CELL_DATA %d\n", static_cast<int>(totalCells));
 
+  Result<> result;
   for(const DataPath& arrayPath : m_InputValues->SelectedDataArrayPaths)
   {
-    ExecuteDataFunction(WriteVtkDataArrayFunctor{}, m_DataStructure.getDataAs<IDataArray>(arrayPath)->getDataType(), outputFile, m_InputValues->WriteBinaryFile, m_DataStructure, arrayPath,
-                        m_MessageHandler);
+    result = MergeResults(result, ExecuteDataFunction(WriteVtkDataArrayFunctor{}, m_DataStructure.getDataAs<IDataArray>(arrayPath)->getDataType(), outputFile, m_InputValues->WriteBinaryFile,
+                                                      m_DataStructure, arrayPath, m_MessageHandler, m_ShouldCancel));
+    if(result.invalid() || m_ShouldCancel)
+    {
+      break;
+    }
   }
 
   fclose(outputFile);
 
-  return {};
+  return result;
 }
 
 // -----------------------------------------------------------------------------
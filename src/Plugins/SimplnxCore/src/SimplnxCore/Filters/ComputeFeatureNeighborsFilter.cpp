@@ -14,10 +14,168 @@
 #include "simplnx/Parameters/DataObjectNameParameter.hpp"
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 
+#include "simplnx/Utilities/FaceNeighborStencil.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <sstream>
 
+using namespace nx::core;
+
+namespace
+{
+// Number of slabs of whole rows that the voxels are split into
+constexpr usize k_NumSlabs = 256;
+
+/**
+ * @brief Number of voxel faces shared by two features. The key holds the lower feature id in its upper 32 bits and the
+ * higher feature id in its lower 32 bits, so sorting the keys sorts the pairs by feature and then by neighbor.
+ */
+struct FeatureFaceCount
+{
+  uint64 Key = 0;
+  int32 Count = 0;
+};
+
+uint64 MakeFeaturePairKey(int32 feature, int32 neighbor)
+{
+  const auto [low, high] = std::minmax(feature, neighbor);
+  return (static_cast<uint64>(low) << 32) | static_cast<uint64>(high);
+}
+
+/**
+ * @brief Appends the sorted keys to the face counts, merging equal keys.
+ */
+void AppendFeatureFaceCounts(const std::vector<uint64>& sortedKeys, std::vector<FeatureFaceCount>& faceCounts)
+{
+  for(const uint64 key : sortedKeys)
+  {
+    if(faceCounts.empty() || faceCounts.back().Key != key)
+    {
+      faceCounts.push_back({key, 0});
+    }
+    faceCounts.back().Count++;
+  }
+}
+
+/**
+ * @brief Finds the faces between different features for a range of slabs. Every face is recorded once, by the voxel
+ * with the lower index, and each slab reduces its own faces to one count per pair of features. The number of faces
+ * that every voxel shares with other features is written into the boundary cells.
+ */
+class FindFeatureFacesImpl
+{
+public:
+  FindFeatureFacesImpl(const Int32AbstractDataStore& featureIds, const FaceNeighborStencil& stencil, usize rowsPerSlab, AbstractDataStore<int8>* boundaryCells,
+                       std::vector<std::vector<FeatureFaceCount>>& slabFaceCounts)
+  : m_FeatureIds(featureIds)
+  , m_Stencil(stencil)
+  , m_RowsPerSlab(rowsPerSlab)
+  , m_BoundaryCells(boundaryCells)
+  , m_SlabFaceCounts(slabFaceCounts)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const SizeVec3& dims = m_Stencil.getDimensions();
+    const usize numRows = dims[1] * dims[2];
+    std::vector<uint64> keys;
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      keys.clear();
+      const usize endRow = std::min((slab + 1) * m_RowsPerSlab, numRows);
+      for(usize row = slab * m_RowsPerSlab; row < endRow; row++)
+      {
+        const usize yIndex = row % dims[1];
+        const usize zIndex = row / dims[1];
+        for(usize xIndex = 0; xIndex < dims[0]; xIndex++)
+        {
+          const usize voxelIndex = row * dims[0] + xIndex;
+          const int32 feature = m_FeatureIds[voxelIndex];
+          int8 onSurface = 0;
+          if(feature > 0)
+          {
+            m_Stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighborIndex) {
+              const int32 neighbor = m_FeatureIds[neighborIndex];
+              if(neighbor != feature && neighbor > 0)
+              {
+                onSurface++;
+                if(neighborIndex > voxelIndex)
+                {
+                  keys.push_back(MakeFeaturePairKey(feature, neighbor));
+                }
+              }
+            });
+          }
+          if(m_BoundaryCells != nullptr)
+          {
+            m_BoundaryCells->setValue(voxelIndex, onSurface);
+          }
+        }
+      }
+      std::sort(keys.begin(), keys.end());
+      AppendFeatureFaceCounts(keys, m_SlabFaceCounts[slab]);
+    }
+  }
+
+private:
+  const Int32AbstractDataStore& m_FeatureIds;
+  const FaceNeighborStencil& m_Stencil;
+  usize m_RowsPerSlab = 1;
+  AbstractDataStore<int8>* m_BoundaryCells = nullptr;
+  std::vector<std::vector<FeatureFaceCount>>& m_SlabFaceCounts;
+};
+
+/**
+ * @brief Fills the neighbor and shared surface area lists of a range of features from the compressed (CSR) lists.
+ */
+class FillNeighborListsImpl
+{
+public:
+  FillNeighborListsImpl(const std::vector<usize>& offsets, const std::vector<int32>& neighbors, const std::vector<int32>& faceCounts, const FloatVec3& spacing, Int32AbstractDataStore& numNeighbors,
+                        std::vector<NeighborList<int32>::SharedVectorType>& neighborLists, std::vector<NeighborList<float32>::SharedVectorType>& surfaceAreaLists)
+  : m_Offsets(offsets)
+  , m_Neighbors(neighbors)
+  , m_FaceCounts(faceCounts)
+  , m_Spacing(spacing)
+  , m_NumNeighbors(numNeighbors)
+  , m_NeighborLists(neighborLists)
+  , m_SurfaceAreaLists(surfaceAreaLists)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize feature = range.min(); feature < range.max(); feature++)
+    {
+      const usize start = m_Offsets[feature];
+      const usize end = m_Offsets[feature + 1];
+      m_NumNeighbors[feature] = static_cast<int32>(end - start);
+
+      m_NeighborLists[feature] = std::make_shared<std::vector<int32>>(m_Neighbors.begin() + start, m_Neighbors.begin() + end);
+      auto surfaceAreas = std::make_shared<std::vector<float32>>(end - start);
+      for(usize i = start; i < end; i++)
+      {
+        (*surfaceAreas)[i - start] = static_cast<float>(m_FaceCounts[i]) * m_Spacing[0] * m_Spacing[1];
+      }
+      m_SurfaceAreaLists[feature] = surfaceAreas;
+    }
+  }
+
+private:
+  const std::vector<usize>& m_Offsets;
+  const std::vector<int32>& m_Neighbors;
+  const std::vector<int32>& m_FaceCounts;
+  FloatVec3 m_Spacing;
+  Int32AbstractDataStore& m_NumNeighbors;
+  std::vector<NeighborList<int32>::SharedVectorType>& m_NeighborLists;
+  std::vector<NeighborList<float32>::SharedVectorType>& m_SurfaceAreaLists;
+};
+} // namespace
+
 namespace nx::core
 {
 //------------------------------------------------------------------------------
@@ -202,7 +360,6 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
   auto* boundaryCells = storeBoundaryCells ? dataStructure.getDataAs<Int8Array>(boundaryCellsPath)->getDataStore() : nullptr;
   auto* surfaceFeatures = storeSurfaceFeatures ? dataStructure.getDataAs<BoolArray>(surfaceFeaturesPath)->getDataStore() : nullptr;
 
-  usize totalPoints = featureIds.getNumberOfTuples();
   usize totalFeatures = numNeighbors.getNumberOfTuples();
 
   /* Ensure that we will be able to work with the user selected featureId Array */
@@ -217,205 +374,126 @@ Result<> ComputeFeatureNeighborsFilter::executeImpl(DataStructure& dataStructure
   }
 
   auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-  SizeVec3 uDims = imageGeom.getDimensions();
-  const auto imageGeomNumX = imageGeom.getNumXCells();
-  const auto imageGeomNumY = imageGeom.getNumYCells();
-  const auto imageGeomNumZ = imageGeom.getNumZCells();
-
-  std::array<int64, 3> dims = {
-      static_cast<int64>(uDims[0]),
-      static_cast<int64>(uDims[1]),
-      static_cast<int64>(uDims[2]),
-  };
-
-  std::array<int64, 6> neighPoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-
-  int64 column = 0;
-  int64 row = 0;
-  int64 plane = 0;
-  int32 feature = 0;
-  int32 nnum = 0;
-  uint8 onsurf = 0;
-  bool good = false;
-  int64 neighbor = 0;
-
-  std::vector<std::vector<int32>> neighborlist(totalFeatures);
-  std::vector<std::vector<float>> neighborsurfacearealist(totalFeatures);
-
-  int32 nListSize = 100;
-
-  float progInt = 0.0F;
-  auto start = std::chrono::steady_clock::now();
-  // Initialize the neighbor lists
-  for(usize i = 1; i < totalFeatures; i++)
-  {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(i) / static_cast<float>(totalFeatures) * 100.0f;
-      std::string message = fmt::format("Initializing Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-
-    if(shouldCancel)
-    {
-      return {};
-    }
-
-    numNeighbors[i] = 0;
-    neighborlist[i].resize(nListSize);
-    neighborsurfacearealist[i].assign(nListSize, -1.0f);
-    if(storeSurfaceFeatures && surfaceFeatures != nullptr)
-    {
-      surfaceFeatures->setValue(i, false);
-    }
-  }
+  const SizeVec3 uDims = imageGeom.getDimensions();
+  const FaceNeighborStencil stencil(uDims);
 
-  progInt = 0.0F;
-  start = std::chrono::steady_clock::now();
-  // Loop over all points to generate the neighbor lists
-  for(usize j = 0; j < totalPoints; j++)
+  // Features that touch the outside of the geometry. A single plane only counts its X and Y borders
+  if(storeSurfaceFeatures && surfaceFeatures != nullptr)
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(j) / static_cast<float>(totalPoints) * 100.0f;
-      std::string message = fmt::format("Determining Neighbor Lists || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32_t>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-
-    if(shouldCancel)
+    for(usize i = 1; i < totalFeatures; i++)
     {
-      return {};
+      surfaceFeatures->setValue(i, false);
     }
-
-    onsurf = 0;
-    feature = featureIds[j];
-    if(feature > 0 && feature < neighborlist.size())
+    const bool singlePlane = uDims[2] == 1;
+    for(usize zIndex = 0; zIndex < uDims[2]; zIndex++)
     {
-      column = static_cast<int64>(j % imageGeomNumX);
-      row = static_cast<int64>((j / imageGeomNumX) % imageGeomNumY);
-      plane = static_cast<int64>(j / (imageGeomNumX * imageGeomNumY));
-      if(storeSurfaceFeatures && surfaceFeatures != nullptr)
+      for(usize yIndex = 0; yIndex < uDims[1]; yIndex++)
       {
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY)-1) || plane == 0 ||
-            plane == static_cast<int64>((imageGeomNumZ - 1))) &&
-           imageGeomNumZ != 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-        if((column == 0 || column == static_cast<int64>((imageGeomNumX - 1)) || row == 0 || row == static_cast<int64>((imageGeomNumY - 1))) && imageGeomNumZ == 1)
-        {
-          surfaceFeatures->setValue(feature, true);
-        }
-      }
-      for(size_t k = 0; k < 6; k++)
-      {
-        good = true;
-        neighbor = static_cast<int64>(j + neighPoints[k]);
-        if(k == 0 && plane == 0)
-        {
-          good = false;
-        }
-        if(k == 5 && plane == (imageGeomNumZ - 1))
-        {
-          good = false;
-        }
-        if(k == 1 && row == 0)
-        {
-          good = false;
-        }
-        if(k == 4 && row == (imageGeomNumY - 1))
-        {
-          good = false;
-        }
-        if(k == 2 && column == 0)
-        {
-          good = false;
-        }
-        if(k == 3 && column == (imageGeomNumX - 1))
+        const bool wholeRow = yIndex == 0 || yIndex == uDims[1] - 1 || (!singlePlane && (zIndex == 0 || zIndex == uDims[2] - 1));
+        const usize xStep = wholeRow || uDims[0] < 2 ? 1 : uDims[0] - 1;
+        for(usize xIndex = 0; xIndex < uDims[0]; xIndex += xStep)
         {
-          good = false;
-        }
-        if(good && featureIds[neighbor] != feature && featureIds[neighbor] > 0)
-        {
-          onsurf++;
-          nnum = numNeighbors[feature];
-          neighborlist[feature].push_back(featureIds[neighbor]);
-          nnum++;
-          numNeighbors[feature] = nnum;
+          const int32 feature = featureIds[stencil.getIndex(xIndex, yIndex, zIndex)];
+          if(feature > 0)
+          {
+            surfaceFeatures->setValue(feature, true);
+          }
         }
       }
     }
+  }
+
+  // Each slab counts the faces between every pair of features on its own
+  messageHandler(IFilter::Message::Type::Info, "Determining Neighbor Lists");
+  const usize numRows = uDims[1] * uDims[2];
+  const usize rowsPerSlab = std::max<usize>(1, (numRows + k_NumSlabs - 1) / k_NumSlabs);
+  const usize numSlabs = (numRows + rowsPerSlab - 1) / rowsPerSlab;
+  std::vector<std::vector<FeatureFaceCount>> slabFaceCounts(numSlabs);
+  {
+    IParallelAlgorithm::AlgorithmArrays algorithmArrays = {dataStructure.getDataAs<IDataArray>(featureIdsPath)};
     if(storeBoundaryCells && boundaryCells != nullptr)
     {
-      boundaryCells->setValue(j, static_cast<int32>(onsurf));
+      algorithmArrays.push_back(dataStructure.getDataAs<IDataArray>(boundaryCellsPath));
     }
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numSlabs);
+    dataAlg.requireArraysInMemory(algorithmArrays);
+    dataAlg.execute(FindFeatureFacesImpl(featureIds, stencil, rowsPerSlab, storeBoundaryCells ? boundaryCells : nullptr, slabFaceCounts));
   }
 
-  FloatVec3 spacing = imageGeom.getSpacing();
+  if(shouldCancel)
+  {
+    return {};
+  }
 
-  progInt = 0;
-  start = std::chrono::steady_clock::now();
-  // We do this to create new set of NeighborList objects
-  for(usize i = 1; i < totalFeatures; i++)
+  // Merge the slabs into one sorted list of feature pairs
+  std::vector<FeatureFaceCount> pairCounts;
   {
-    auto now = std::chrono::steady_clock::now();
-    // Only send updates every 1 second
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-    {
-      progInt = static_cast<float>(i) / static_cast<float>(totalFeatures) * 100.0f;
-      std::string message = fmt::format("Calculating Surface Areas || {:2.0f}% Complete", progInt);
-      messageHandler(nx::core::IFilter::ProgressMessage{nx::core::IFilter::Message::Type::Info, message, static_cast<int32>(progInt)});
-      start = std::chrono::steady_clock::now();
-    }
-    if(shouldCancel)
+    usize numSlabPairs = 0;
+    for(const auto& faceCounts : slabFaceCounts)
     {
-      return {};
+      numSlabPairs += faceCounts.size();
     }
-
-    std::map<int32, int32> neighToCount;
-    auto numneighs = static_cast<int32>(neighborlist[i].size());
-
-    // this increments the voxel counts for each feature
-    for(int32 j = 0; j < numneighs; j++)
+    std::vector<FeatureFaceCount> slabPairs;
+    slabPairs.reserve(numSlabPairs);
+    for(auto& faceCounts : slabFaceCounts)
     {
-      neighToCount[neighborlist[i][j]]++;
+      slabPairs.insert(slabPairs.end(), faceCounts.begin(), faceCounts.end());
+      faceCounts = std::vector<FeatureFaceCount>();
     }
-
-    auto neighborIter = neighToCount.find(0);
-    neighToCount.erase(neighborIter);
-    neighborIter = neighToCount.find(-1);
-    if(neighborIter != neighToCount.end())
+    std::sort(slabPairs.begin(), slabPairs.end(), [](const FeatureFaceCount& lhs, const FeatureFaceCount& rhs) { return lhs.Key < rhs.Key; });
+    for(const FeatureFaceCount& slabPair : slabPairs)
     {
-      neighToCount.erase(neighborIter);
+      if(pairCounts.empty() || pairCounts.back().Key != slabPair.Key)
+      {
+        pairCounts.push_back({slabPair.Key, 0});
+      }
+      pairCounts.back().Count += slabPair.Count;
     }
-    // Resize the features neighbor list to zero
-    neighborlist[i].resize(0);
-    neighborsurfacearealist[i].resize(0);
+  }
 
-    for(const auto [neigh, number] : neighToCount)
+  // Expand every pair into both of its features. The pairs are sorted, so every feature first receives its lower
+  // neighbors (from pairs where it is the higher feature) and then its higher neighbors, each in ascending order
+  std::vector<usize> offsets(totalFeatures + 1, 0);
+  for(const FeatureFaceCount& pairCount : pairCounts)
+  {
+    offsets[(pairCount.Key >> 32) + 1]++;
+    offsets[(pairCount.Key & 0xFFFFFFFF) + 1]++;
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  std::vector<int32> neighbors(offsets[totalFeatures]);
+  std::vector<int32> faceCounts(offsets[totalFeatures]);
+  {
+    std::vector<usize> cursors(offsets.begin(), offsets.end() - 1);
+    for(const FeatureFaceCount& pairCount : pairCounts)
     {
-      float area = static_cast<float>(number) * spacing[0] * spacing[1];
-
-      // Push the neighbor feature identifier back onto the list, so we stay synced up
-      neighborlist[i].push_back(neigh);
-      neighborsurfacearealist[i].push_back(area);
+      const auto lowFeature = static_cast<int32>(pairCount.Key >> 32);
+      const auto highFeature = static_cast<int32>(pairCount.Key & 0xFFFFFFFF);
+      neighbors[cursors[lowFeature]] = highFeature;
+      faceCounts[cursors[lowFeature]++] = pairCount.Count;
+      neighbors[cursors[highFeature]] = lowFeature;
+      faceCounts[cursors[highFeature]++] = pairCount.Count;
     }
-    numNeighbors[i] = static_cast<int32>(neighborlist[i].size());
+  }
+  pairCounts = std::vector<FeatureFaceCount>();
 
-    // Set the vector for each list into the NeighborList Object
-    NeighborList<int32>::SharedVectorType sharedNeiLst(new std::vector<int32>);
-    sharedNeiLst->assign(neighborlist[i].begin(), neighborlist[i].end());
-    neighborList.setList(static_cast<int32>(i), sharedNeiLst);
+  messageHandler(IFilter::Message::Type::Info, "Calculating Surface Areas");
+  const FloatVec3 spacing = imageGeom.getSpacing();
+  std::vector<NeighborList<int32>::SharedVectorType> neighborLists(totalFeatures);
+  std::vector<NeighborList<float32>::SharedVectorType> surfaceAreaLists(totalFeatures);
+  if(totalFeatures > 1)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(1, totalFeatures);
+    dataAlg.requireArraysInMemory({dataStructure.getDataAs<IDataArray>(numNeighborsPath)});
+    dataAlg.execute(FillNeighborListsImpl(offsets, neighbors, faceCounts, spacing, numNeighbors, neighborLists, surfaceAreaLists));
+  }
 
-    NeighborList<float32>::SharedVectorType sharedSAL(new std::vector<float32>);
-    sharedSAL->assign(neighborsurfacearealist[i].begin(), neighborsurfacearealist[i].end());
-    sharedSurfaceAreaList.setList(static_cast<int32>(i), sharedSAL);
+  // Set the vector for each list into the NeighborList Object
+  for(usize i = 1; i < totalFeatures; i++)
+  {
+    neighborList.setList(static_cast<int32>(i), neighborLists[i]);
+    sharedSurfaceAreaList.setList(static_cast<int32>(i), surfaceAreaLists[i]);
   }
 
   return {};
@@ -7,6 +7,7 @@
 #include "simplnx/Parameters/StringParameter.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelChunkAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 using namespace nx::core;
@@ -33,22 +34,23 @@ ScalarType convertFromStringToType(const std::string& convertValue)
 struct ReplaceValueInArrayFunctor
 {
   template <typename ScalarType>
-  void operator()(IDataArray& workingArray, const std::string& removeValue, const std::string& replaceValue)
+  Result<> operator()(IDataArray& workingArray, const std::string& removeValue, const std::string& replaceValue)
   {
     auto& dataStore = workingArray.template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
 
     auto removeVal = convertFromStringToType<ScalarType>(removeValue);
     auto replaceVal = convertFromStringToType<ScalarType>(replaceValue);
 
-    const auto size = dataStore.getNumberOfTuples() * dataStore.getNumberOfComponents();
-
-    for(usize index = 0; index < size; index++)
-    {
-      if(dataStore[index] == removeVal)
+    ParallelChunkAlgorithm chunkAlg;
+    return chunkAlg.executeInPlace(dataStore, [removeVal, replaceVal](nonstd::span<ScalarType> values, const Range&) {
+      for(ScalarType& value : values)
       {
-        dataStore[index] = replaceVal;
+        if(value == removeVal)
+        {
+          value = replaceVal;
+        }
       }
-    }
+    });
   }
 };
 } // namespace
@@ -192,7 +194,7 @@ Result<> ConditionalSetValueFilter::executeImpl(DataStructure& dataStructure, co
   else
   {
     auto& inputDataArray = dataStructure.getDataRefAs<IDataArray>(selectedArrayPath);
-    ExecuteDataFunction(ReplaceValueInArrayFunctor{}, inputDataArray.getDataType(), inputDataArray, filterArgs.value<std::string>(k_RemoveValue_Key), replaceValueString);
+    return ExecuteDataFunction(ReplaceValueInArrayFunctor{}, inputDataArray.getDataType(), inputDataArray, filterArgs.value<std::string>(k_RemoveValue_Key), replaceValueString);
   }
 
   return {};
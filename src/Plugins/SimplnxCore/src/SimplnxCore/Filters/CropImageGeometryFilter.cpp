@@ -3,7 +3,9 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/INeighborList.hpp"
+#include "simplnx/DataStructure/IO/Generic/IOConstants.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
+#include "simplnx/DataStructure/StridedViewDataStore.hpp"
 #include "simplnx/Filter/Actions/CopyDataObjectAction.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
 #include "simplnx/Filter/Actions/CreateAttributeMatrixAction.hpp"
@@ -19,6 +21,7 @@
 #include "simplnx/Parameters/VectorParameter.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
 #include "simplnx/Utilities/GeometryHelpers.hpp"
 #include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
@@ -27,6 +30,8 @@
 #include "simplnx/Utilities/SamplingUtils.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
+#include <mutex>
+
 using namespace nx::core;
 
 namespace
@@ -64,18 +69,20 @@ FloatVec3 GetCurrentVolumeDataContainerResolutions(const DataStructure& dataStru
 }
 
 /**
- * @brief
+ * @brief Copies the cropped box of one cell array. Errors from stores that are not held in memory are stored in the
+ * given result.
  * @tparam T
  */
 template <typename T>
 class CropImageGeomDataArray
 {
 public:
-  CropImageGeomDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const ImageGeom& srcImageGeom, std::array<uint64, 6> bounds, const std::atomic_bool& shouldCancel)
+  CropImageGeomDataArray(const IDataArray& oldCellArray, IDataArray& newCellArray, const ImageGeom& srcImageGeom, std::array<uint64, 6> bounds, Result<>& result, const std::atomic_bool& shouldCancel)
   : m_OldCellStore(oldCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_NewCellStore(newCellArray.template getIDataStoreRefAs<AbstractDataStore<T>>())
   , m_SrcImageGeom(srcImageGeom)
   , m_Bounds(bounds)
+  , m_Result(result)
   , m_ShouldCancel(shouldCancel)
   {
   }
@@ -95,32 +102,55 @@ public:
 protected:
   void convert() const
   {
-    size_t numComps = m_OldCellStore.getNumberOfComponents();
-
-    m_NewCellStore.fill(static_cast<T>(-1));
-
-    auto srcDims = m_SrcImageGeom.getDimensions();
-
-    uint64 destTupleIndex = 0;
-    for(uint64 zIndex = m_Bounds[4]; zIndex < m_Bounds[5]; zIndex++)
-    {
-      if(m_ShouldCancel)
-      {
-        return;
-      }
-      for(uint64 yIndex = m_Bounds[2]; yIndex < m_Bounds[3]; yIndex++)
+    const usize numComps = m_OldCellStore.getNumberOfComponents();
+    const SizeVec3 srcDims = m_SrcImageGeom.getDimensions();
+    const usize rowSize = (m_Bounds[1] - m_Bounds[0]) * numComps;
+    const usize numRowsY = m_Bounds[3] - m_Bounds[2];
+    const usize numRows = numRowsY * (m_Bounds[5] - m_Bounds[4]);
+
+    const auto* oldDataStore = dynamic_cast<const DataStore<T>*>(&m_OldCellStore);
+    auto* newDataStore = dynamic_cast<DataStore<T>*>(&m_NewCellStore);
+
+    // Every cropped x row is contiguous in both arrays, so each row is copied as one block
+    std::mutex resultMutex;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numRows);
+    dataAlg.requireStoresInMemory({&m_OldCellStore, &m_NewCellStore});
+    dataAlg.execute([&](const Range& range) {
+      std::unique_ptr<T[]> rowBuffer;
+      for(usize row = range.min(); row < range.max(); row++)
       {
-        for(uint64 xIndex = m_Bounds[0]; xIndex < m_Bounds[1]; xIndex++)
+        if(m_ShouldCancel)
         {
-          uint64 srcIndex = (srcDims[0] * srcDims[1] * zIndex) + (srcDims[0] * yIndex) + xIndex;
-          for(size_t compIndex = 0; compIndex < numComps; compIndex++)
-          {
-            m_NewCellStore.setValue(destTupleIndex * numComps + compIndex, m_OldCellStore.getValue(srcIndex * numComps + compIndex));
-          }
-          destTupleIndex++;
+          return;
+        }
+        const usize zIndex = m_Bounds[4] + row / numRowsY;
+        const usize yIndex = m_Bounds[2] + row % numRowsY;
+        const usize srcIndex = ((zIndex * srcDims[1] + yIndex) * srcDims[0] + m_Bounds[0]) * numComps;
+        const usize destIndex = row * rowSize;
+        if(oldDataStore != nullptr && newDataStore != nullptr)
+        {
+          std::copy_n(oldDataStore->data() + srcIndex, rowSize, newDataStore->data() + destIndex);
+          continue;
+        }
+
+        if(rowBuffer == nullptr)
+        {
+          rowBuffer = std::make_unique<T[]>(rowSize);
+        }
+        Result<> copyResult = m_OldCellStore.copyIntoBuffer(srcIndex, nonstd::span<T>(rowBuffer.get(), rowSize));
+        if(copyResult.valid())
+        {
+          copyResult = m_NewCellStore.copyFromBuffer(destIndex, nonstd::span<const T>(rowBuffer.get(), rowSize));
+        }
+        if(copyResult.invalid())
+        {
+          std::lock_guard<std::mutex> lock(resultMutex);
+          m_Result = MergeResults(std::move(m_Result), std::move(copyResult));
+          return;
         }
       }
-    }
+    });
   }
 
 private:
@@ -128,8 +158,20 @@ private:
   AbstractDataStore<T>& m_NewCellStore;
   const ImageGeom& m_SrcImageGeom;
   std::array<uint64, 6> m_Bounds;
+  Result<>& m_Result;
   const std::atomic_bool& m_ShouldCancel;
 };
+
+struct CreateCroppedViewFunctor
+{
+  template <typename T>
+  void operator()(const IDataArray& oldCellArray, IDataArray& newCellArray, const SizeVec3& srcDims, const std::array<uint64, 6>& bounds)
+  {
+    std::shared_ptr<const AbstractDataStore<T>> srcStore = dynamic_cast<const DataArray<T>&>(oldCellArray).getDataStorePtr().lock();
+    const std::array<usize, 6> viewBounds = {bounds[0], bounds[1], bounds[2], bounds[3], bounds[4], bounds[5]};
+    dynamic_cast<DataArray<T>&>(newCellArray).setDataStore(std::make_shared<StridedViewDataStore<T>>(srcStore, srcDims, viewBounds));
+  }
+};
 } // namespace
 
 //------------------------------------------------------------------------------
@@ -195,6 +237,10 @@ Parameters CropImageGeometryFilter::parameters() const
   params.insert(std::make_unique<VectorFloat64Parameter>(k_MaxCoord_Key, "Max Coordinate (Physical Units) [Inclusive]", "Upper bound in real units of the volume to crop.",
                                                          std::vector<float64>{0.0, 0.0, 0.0}, std::vector<std::string>{"X", "Y", "Z"}));
   params.insertLinkableParameter(std::make_unique<BoolParameter>(k_RemoveOriginalGeometry_Key, "Perform In Place", "Removes the original Image Geometry after filter is completed", true));
+  params.insert(std::make_unique<BoolParameter>(k_CreateReadOnlyViews_Key, "Create Read-Only Views",
+                                                "If true the cropped cell arrays read their values from the selected geometry instead of holding a copy. The views are read-only, so "
+                                                "only use this when the cropped cell arrays are not modified later in the pipeline. Writing to a view fails.",
+                                                false));
 
   params.insertSeparator(Parameters::Separator{"Input Image Geometry"});
   params.insert(
@@ -246,6 +292,7 @@ IFilter::PreflightResult CropImageGeometryFilter::preflightImpl(const DataStruct
   auto shouldRenumberFeatures = filterArgs.value<bool>(k_RenumberFeatures_Key);
   auto cellFeatureAmPath = filterArgs.value<DataPath>(k_FeatureAttributeMatrixPath_Key);
   auto pRemoveOriginalGeometry = filterArgs.value<bool>(k_RemoveOriginalGeometry_Key);
+  auto pCreateReadOnlyViews = filterArgs.value<bool>(k_CreateReadOnlyViews_Key);
   auto pUsePhysicalBounds = filterArgs.value<bool>(k_UsePhysicalBounds_Key);
   auto pCropXDim = filterArgs.value<BoolParameter::ValueType>(k_CropXDim_Key);
   auto pCropYDim = filterArgs.value<BoolParameter::ValueType>(k_CropYDim_Key);
@@ -467,7 +514,10 @@ IFilter::PreflightResult CropImageGeometryFilter::preflightImpl(const DataStruct
       DataType dataType = srcArray.getDataType();
       IDataStore::ShapeType componentShape = srcArray.getIDataStoreRef().getComponentShape();
       DataPath dataArrayPath = newCellAttributeMatrixPath.createChildPath(srcArray.getName());
-      resultOutputActions.value().appendAction(std::make_unique<CreateArrayAction>(dataType, dataArrayShape, std::move(componentShape), dataArrayPath));
+      // Views get their store during execute, except for the feature ids which are modified when renumbering
+      const bool createView = pCreateReadOnlyViews && !(shouldRenumberFeatures && srcArray.getName() == featureIdsArrayPath.getTargetName());
+      std::string dataFormat = createView ? IOConstants::k_DeferredDataFormat.str() : "";
+      resultOutputActions.value().appendAction(std::make_unique<CreateArrayAction>(dataType, dataArrayShape, std::move(componentShape), dataArrayPath, dataFormat));
     }
 
     // Store the preflight updated value(s) into the preflightUpdatedValues vector using the appropriate methods.
@@ -573,6 +623,7 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
   auto shouldRenumberFeatures = filterArgs.value<bool>(k_RenumberFeatures_Key);
   auto cellFeatureAMPath = filterArgs.value<DataPath>(k_FeatureAttributeMatrixPath_Key);
   auto removeOriginalGeometry = filterArgs.value<bool>(k_RemoveOriginalGeometry_Key);
+  auto createReadOnlyViews = filterArgs.value<bool>(k_CreateReadOnlyViews_Key);
 
   uint64 xMin = s_HeaderCache[m_InstanceId].xMin;
   uint64 xMax = s_HeaderCache[m_InstanceId].xMax;
@@ -586,11 +637,7 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
   // No matter where the AM is (same DC or new DC), we have the correct DC and AM pointers...now it's time to crop
   SizeVec3 udims = srcImageGeom.getDimensions();
 
-  int64 dims[3] = {
-      static_cast<int64>(udims[0]),
-      static_cast<int64>(udims[1]),
-      static_cast<int64>(udims[2]),
-  };
+  const uint64 dims[3] = {udims[0], udims[1], udims[2]};
 
   // Check to see if the dims have actually changed.
   if(dims[0] == (xMax - xMin) && dims[1] == (yMax - yMin) && dims[2] == (zMax - zMin))
@@ -639,6 +686,9 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
   ParallelTaskAlgorithm taskRunner;
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
   auto& destCellDataAM = destImageGeom.getCellDataRef();
+  // One result per array, reserved up front so the tasks can hold references to them
+  std::vector<Result<>> cropResults;
+  cropResults.reserve(srcCellDataAM.getSize());
   for(const auto& [dataId, oldDataObject] : srcCellDataAM)
   {
     if(shouldCancel)
@@ -651,11 +701,25 @@ Result<> CropImageGeometryFilter::executeImpl(DataStructure& dataStructure, cons
 
     auto& newDataArray = dynamic_cast<IDataArray&>(destCellDataAM.at(srcName));
 
+    if(createReadOnlyViews && !(shouldRenumberFeatures && srcName == featureIdsArrayPath.getTargetName()))
+    {
+      messageHandler(fmt::format("Cropping Volume || Creating View of Data Array {}", srcName));
+      ExecuteDataFunction(CreateCroppedViewFunctor{}, oldDataArray.getDataType(), oldDataArray, newDataArray, udims, bounds);
+      continue;
+    }
+
     messageHandler(fmt::format("Cropping Volume || Copying Data Array {}", srcName));
-    ExecuteParallelFunction<CropImageGeomDataArray>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, srcImageGeom, bounds, shouldCancel);
+    Result<>& cropResult = cropResults.emplace_back();
+    ExecuteParallelFunction<CropImageGeomDataArray>(oldDataArray.getDataType(), taskRunner, oldDataArray, newDataArray, srcImageGeom, bounds, cropResult, shouldCancel);
   }
   taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
 
+  Result<> cropResult = MergeResults(std::move(cropResults));
+  if(cropResult.invalid())
+  {
+    return cropResult;
+  }
+
   if(shouldCancel)
   {
     return {};
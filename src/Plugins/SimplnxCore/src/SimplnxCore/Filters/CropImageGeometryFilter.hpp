@@ -36,6 +36,7 @@ public:
   static inline constexpr StringLiteral k_CellFeatureIdsArrayPath_Key = "feature_ids_path";
   static inline constexpr StringLiteral k_FeatureAttributeMatrixPath_Key = "cell_feature_attribute_matrix_path";
   static inline constexpr StringLiteral k_RemoveOriginalGeometry_Key = "remove_original_geometry";
+  static inline constexpr StringLiteral k_CreateReadOnlyViews_Key = "create_read_only_views";
 
   /**
    * @brief Reads SIMPL json and converts it simplnx Arguments.
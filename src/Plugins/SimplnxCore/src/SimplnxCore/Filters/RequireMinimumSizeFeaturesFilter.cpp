@@ -9,7 +9,9 @@
 #include "simplnx/Parameters/GeometrySelectionParameter.hpp"
 #include "simplnx/Parameters/NumberParameter.hpp"
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
+#include "simplnx/Utilities/FeatureRemovalUtilities.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/SIMPLConversion.hpp"
 
 #include <algorithm>
@@ -27,167 +29,24 @@ namespace
 constexpr int32 k_BadMinAllowedFeatureSize = -5555;
 constexpr int32 k_BadNumCellsPath = -5556;
 constexpr int32 k_ParentlessPathError = -5557;
+constexpr int32 k_UnfilledVoxelsWarning = -5558;
 
-void assign_badpoints(DataStructure& dataStructure, const DataPath& featureIdsPath, SizeVec3 dimensions, const NumCellsArrayType::store_type& numCellsStoreRef)
+usize assign_badpoints(DataStructure& dataStructure, const DataPath& featureIdsPath, const SizeVec3& dimensions, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
 {
-  FeatureIdsArrayType::store_type* featureIds = dataStructure.getDataAs<FeatureIdsArrayType>(featureIdsPath)->getDataStore();
-  usize totalPoints = featureIds->getNumberOfTuples();
-
-  std::array<int64_t, 3> dims = {
-      static_cast<int64>(dimensions[0]),
-      static_cast<int64>(dimensions[1]),
-      static_cast<int64>(dimensions[2]),
-  };
-
-  std::vector<int32_t> neighbors(totalPoints * featureIds->getNumberOfComponents(), -1);
-
-  int32 good = 1;
-  int32 current = 0;
-  int32 most = 0;
-  int64 neighpoint = 0;
-
-  std::array<int64_t, 6> neighpoints = {-dims[0] * dims[1], -dims[0], -1, 1, dims[0], dims[0] * dims[1]};
-
-  usize counter = 1;
-  int64 count = 0;
-  int64 kstride = 0;
-  int64 jstride = 0;
-  int32 featurename = 0;
-  int32 feature = 0;
-  int32 neighbor = 0;
-  std::vector<int32> n(numCellsStoreRef.getNumberOfTuples(), 0);
-
-  while(counter != 0)
+  auto& featureIds = dataStructure.getDataRefAs<FeatureIdsArrayType>(featureIdsPath).getDataStoreRef();
+
+  // Every cell array next to the feature ids is filled along with them
+  std::vector<std::shared_ptr<IDataArray>> voxelArrays;
+  const auto& parentGroup = dataStructure.getDataRefAs<BaseGroup>(featureIdsPath.getParent());
+  for(const auto& [identifier, sharedChild] : parentGroup)
   {
-    counter = 0;
-    for(int64 k = 0; k < dims[2]; k++)
-    {
-      kstride = dims[0] * dims[1] * k;
-      for(int64 j = 0; j < dims[1]; j++)
-      {
-        jstride = dims[0] * j;
-        for(int64 i = 0; i < dims[0]; i++)
-        {
-          count = kstride + jstride + i;
-          featurename = featureIds->getValue(count);
-          if(featurename < 0)
-          {
-            counter++;
-            most = 0;
-            for(size_t l = 0; l < neighpoints.size(); l++)
-            {
-              good = 1;
-              neighpoint = count + neighpoints[l];
-              if(l == 0 && k == 0)
-              {
-                good = 0;
-              }
-              if(l == 5 && k == (dims[2] - 1))
-              {
-                good = 0;
-              }
-              if(l == 1 && j == 0)
-              {
-                good = 0;
-              }
-              if(l == 4 && j == (dims[1] - 1))
-              {
-                good = 0;
-              }
-              if(l == 2 && i == 0)
-              {
-                good = 0;
-              }
-              if(l == 3 && i == (dims[0] - 1))
-              {
-                good = 0;
-              }
-              if(good == 1)
-              {
-                feature = featureIds->getValue(neighpoint);
-                if(feature >= 0)
-                {
-                  n[feature]++;
-                  current = n[feature];
-                  if(current > most)
-                  {
-                    most = current;
-                    neighbors[count] = neighpoint;
-                  }
-                }
-              }
-            }
-            for(int32 l = 0; l < neighpoints.size(); l++)
-            {
-              good = 1;
-              neighpoint = count + neighpoints[l];
-              if(l == 0 && k == 0)
-              {
-                good = 0;
-              }
-              if(l == 5 && k == (dims[2] - 1))
-              {
-                good = 0;
-              }
-              if(l == 1 && j == 0)
-              {
-                good = 0;
-              }
-              if(l == 4 && j == (dims[1] - 1))
-              {
-                good = 0;
-              }
-              if(l == 2 && i == 0)
-              {
-                good = 0;
-              }
-              if(l == 3 && i == (dims[0] - 1))
-              {
-                good = 0;
-              }
-              if(good == 1)
-              {
-                feature = featureIds->getValue(neighpoint);
-                if(feature >= 0)
-                {
-                  n[feature] = 0;
-                }
-              }
-            }
-          }
-        }
-      }
-    }
-    DataPath attrMatPath = featureIdsPath.getParent();
-    auto* parentGroup = dataStructure.getDataAs<BaseGroup>(attrMatPath);
-    std::vector<std::string> voxelArrayNames;
-    for(const auto& [identifier, sharedChild] : *parentGroup)
+    if(auto dataArray = std::dynamic_pointer_cast<IDataArray>(sharedChild); dataArray != nullptr)
     {
-      if(std::dynamic_pointer_cast<IDataArray>(sharedChild))
-      {
-        voxelArrayNames.push_back(sharedChild->getName());
-      }
-    }
-
-    // TODO: This loop could be parallelized. Look at NeighborOrientationCorrelation filter
-    for(size_t j = 0; j < totalPoints; j++)
-    {
-      featurename = featureIds->getValue(j);
-      neighbor = neighbors[j];
-      if(neighbor >= 0)
-      {
-        if(featurename < 0 && featureIds->getValue(neighbor) >= 0)
-        {
-          for(auto& voxelArrayName : voxelArrayNames)
-          {
-            auto arrayPath = attrMatPath.createChildPath(voxelArrayName);
-            auto* arr = dataStructure.getDataAs<IDataArray>(arrayPath);
-            arr->copyTuple(neighbor, j);
-          }
-        }
-      }
+      voxelArrays.push_back(dataArray);
     }
   }
+
+  return FeatureRemovalUtilities::FillRemovedVoxels(featureIds, dimensions, FeatureRemovalUtilities::FillVote::MostCommonNeighbor, voxelArrays, messageHandler, shouldCancel);
 }
 
 // -----------------------------------------------------------------------------
@@ -197,7 +56,6 @@ std::vector<bool> remove_smallfeatures(FeatureIdsArrayType::store_type& featureI
   size_t totalPoints = featureIdsStoreRef.getNumberOfTuples();
 
   bool good = false;
-  int32 gnum;
 
   size_t totalFeatures = numCells.getNumberOfTuples();
 
@@ -233,14 +91,18 @@ std::vector<bool> remove_smallfeatures(FeatureIdsArrayType::store_type& featureI
     errorReturn = Error{-1, "The minimum size is larger than the largest Feature.  All Features would be removed"};
     return activeObjects;
   }
-  for(size_t i = 0; i < totalPoints; i++)
-  {
-    gnum = featureIdsStoreRef.getValue(i);
-    if(!activeObjects[gnum])
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, totalPoints);
+  dataAlg.requireStoresInMemory({&featureIdsStoreRef});
+  dataAlg.execute([&](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
     {
-      featureIdsStoreRef.setValue(i, -1);
+      if(!activeObjects[featureIdsStoreRef.getValue(i)])
+      {
+        featureIdsStoreRef.setValue(i, -1);
+      }
     }
-  }
+  });
   return activeObjects;
 }
 } // namespace
@@ -425,7 +287,13 @@ Result<> RequireMinimumSizeFeaturesFilter::executeImpl(DataStructure& dataStruct
   }
 
   auto& imageGeom = dataStructure.getDataRefAs<ImageGeom>(imageGeomPath);
-  assign_badpoints(dataStructure, featureIdsPath, imageGeom.getDimensions(), numCellsStoreRef);
+  Result<> result;
+  const usize numUnfilledVoxels = assign_badpoints(dataStructure, featureIdsPath, imageGeom.getDimensions(), messageHandler, shouldCancel);
+  if(numUnfilledVoxels > 0)
+  {
+    result.warnings().push_back(Warning{k_UnfilledVoxelsWarning, fmt::format("{} voxels of the removed features have no neighboring feature and could not be filled. Their Feature Ids are still -1.",
+                                                                             numUnfilledVoxels)});
+  }
 
   DataPath cellFeatureGroupPath = numCellsPath.getParent();
   size_t currentFeatureCount = numCellsStoreRef.getNumberOfTuples();
@@ -443,7 +311,7 @@ Result<> RequireMinimumSizeFeaturesFilter::executeImpl(DataStructure& dataStruct
 
   nx::core::RemoveInactiveObjects(dataStructure, cellFeatureGroupPath, activeObjects, featureIdsStoreRef, currentFeatureCount, messageHandler, shouldCancel);
 
-  return {};
+  return result;
 }
 
 namespace
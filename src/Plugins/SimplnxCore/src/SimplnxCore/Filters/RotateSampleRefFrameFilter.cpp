@@ -21,8 +21,6 @@
 #include "simplnx/Utilities/DataGroupUtilities.hpp"
 #include "simplnx/Utilities/GeometryHelpers.hpp"
 #include "simplnx/Utilities/ImageRotationUtilities.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
-#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <Eigen/Dense>
@@ -534,31 +532,23 @@ Result<> RotateSampleRefFrameFilter::executeImpl(DataStructure& dataStructure, c
 
   ImageRotationUtilities::FilterProgressCallback filterProgressCallback(messageHandler, shouldCancel);
 
-  // The actual rotating of the dataStructure arrays is done in parallel where parallel here
-  // refers to the cropping of each DataArray being done on a separate thread.
-  ParallelTaskAlgorithm taskRunner;
-  taskRunner.setParallelizationEnabled(true);
   const DataPath srcCelLDataAMPath = srcImageGeom.getCellDataPath();
   const auto& srcCellDataAM = srcImageGeom.getCellDataRef();
 
   const DataPath destCellDataAMPath = destImageGeom.getCellDataPath();
 
+  std::vector<std::pair<const IDataArray*, IDataArray*>> cellArrays;
   for(const auto& [dataId, srcDataObject] : srcCellDataAM)
   {
-    if(shouldCancel)
-    {
-      return {};
-    }
-
     const auto* srcDataArray = dataStructure.getDataAs<IDataArray>(srcCelLDataAMPath.createChildPath(srcDataObject->getName()));
     auto* destDataArray = dataStructure.getDataAs<IDataArray>(destCellDataAMPath.createChildPath(srcDataObject->getName()));
-    messageHandler(fmt::format("Rotating Volume || Copying Data Array {}", srcDataObject->getName()));
-
-    ExecuteParallelFunction<ImageRotationUtilities::RotateImageGeometryWithNearestNeighbor>(srcDataArray->getDataType(), taskRunner, srcDataArray, destDataArray, rotateArgs, rotationMatrix,
-                                                                                            sliceBySlice, &filterProgressCallback);
+    cellArrays.emplace_back(srcDataArray, destDataArray);
   }
+  messageHandler(fmt::format("Rotating Volume || Copying {} Data Arrays", cellArrays.size()));
 
-  taskRunner.wait(); // This will spill over if the number of DataArrays to process does not divide evenly by the number of threads.
+  // The source voxel of every rotated voxel is computed once per tile and shared by all of the cell arrays
+  const ImageRotationUtilities::VoxelRemapPlan remapPlan(rotateArgs, rotationMatrix, ImageRotationUtilities::InterpolationType::NearestNeighbor, sliceBySlice);
+  ImageRotationUtilities::RemapImageGeometryArrays(remapPlan, cellArrays, &filterProgressCallback);
 
   return {};
 }
@@ -3,8 +3,17 @@
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
 
+#include <algorithm>
+#include <vector>
+
 using namespace nx::core;
 
+namespace
+{
+// Number of feature ids that are copied out of the store at a time for the binary file
+constexpr usize k_BinaryChunkSize = 1048576;
+} // namespace
+
 // -----------------------------------------------------------------------------
 AvizoWriter::AvizoWriter(DataStructure& dataStructure, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, AvizoWriterInputValues* inputValues)
 : m_DataStructure(dataStructure)
@@ -56,3 +65,46 @@ Result<> AvizoWriter::execute()
 
   return {};
 }
+
+// -----------------------------------------------------------------------------
+Result<> AvizoWriter::writeFeatureIds(FILE* outputFile) const
+{
+  const auto& featureIds = m_DataStructure.getDataAs<IDataArray>(m_InputValues->FeatureIdsArrayPath)->template getIDataStoreRefAs<AbstractDataStore<int32>>();
+  const usize totalPoints = featureIds.getNumberOfTuples();
+
+  if(m_InputValues->WriteBinaryFile)
+  {
+    std::vector<int32> buffer(std::min(totalPoints, k_BinaryChunkSize));
+    for(usize offset = 0; offset < totalPoints; offset += buffer.size())
+    {
+      const usize count = std::min(buffer.size(), totalPoints - offset);
+      Result<> copyResult = featureIds.copyIntoBuffer(offset, nonstd::span<int32>(buffer.data(), count));
+      if(copyResult.invalid())
+      {
+        return copyResult;
+      }
+      fwrite(buffer.data(), sizeof(int32), count, outputFile);
+    }
+  }
+  else
+  {
+    // The "20 Items" is purely arbitrary and is put in to try and save some space in the ASCII file
+    int count = 0;
+    for(usize i = 0; i < totalPoints; ++i)
+    {
+      fprintf(outputFile, "%d", featureIds.getValue(i));
+      if(count < 20)
+      {
+        fprintf(outputFile, " ");
+        count++;
+      }
+      else
+      {
+        fprintf(outputFile, "\n");
+        count = 0;
+      }
+    }
+  }
+  fprintf(outputFile, "\n");
+  return {};
+}
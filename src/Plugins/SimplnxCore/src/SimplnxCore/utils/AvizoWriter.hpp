@@ -44,6 +44,14 @@ protected:
   virtual Result<> generateHeader(FILE* outputFile) const = 0;
   virtual Result<> writeData(FILE* outputFile) const = 0;
 
+  /**
+   * @brief Writes the feature ids as binary or ASCII values. The values are read through the store, so stores that are
+   * not held in memory are written in chunks.
+   * @param outputFile
+   * @return Result<>
+   */
+  Result<> writeFeatureIds(FILE* outputFile) const;
+
   DataStructure& m_DataStructure;
   const AvizoWriterInputValues* m_InputValues = nullptr;
   const std::atomic_bool& m_ShouldCancel;
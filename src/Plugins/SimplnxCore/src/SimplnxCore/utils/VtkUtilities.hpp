@@ -1,11 +1,220 @@
 #pragma once
 
+#include "simplnx/Common/Bit.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
 #include "simplnx/Utilities/OStreamUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/StringUtilities.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <charconv>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <string>
 
 namespace nx::core
 {
 
-static constexpr usize k_BufferDumpVal = 1000000;
+// Binary data is read and written in blocks of this many bytes
+static constexpr usize k_VtkBinaryBlockBytes = 64ULL * 1024ULL * 1024ULL;
+// ASCII data is formatted in parallel in blocks of this many values, this many blocks at a time
+static constexpr usize k_VtkAsciiBlockValues = 64ULL * 1024ULL;
+static constexpr usize k_VtkAsciiBlocksPerPass = 64;
+
+static constexpr int32 k_VtkWriteDataError = -2078;
+
+/**
+ * @brief Swaps the bytes of every value in parallel. VTK legacy binary files are always big endian.
+ * @param values
+ */
+template <typename T>
+void VtkByteSwapValues(nonstd::span<T> values)
+{
+  if constexpr(sizeof(T) > 1)
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, values.size());
+    dataAlg.execute([values](const Range& range) {
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        values[i] = nx::core::byteswap(values[i]);
+      }
+    });
+  }
+}
+
+/**
+ * @brief Writes the values of the store as big endian binary data. The values are copied out of the store in large
+ * blocks and swapped in parallel, so the store itself is never modified.
+ * @param dataStore
+ * @param write Called with each block of bytes, returns false if the bytes could not be written
+ * @return Result<>
+ */
+template <typename T, typename WriteFuncT>
+Result<> WriteVtkBinaryValues(const AbstractDataStore<T>& dataStore, const WriteFuncT& write)
+{
+  const usize totalValues = dataStore.getSize();
+  const usize blockValues = std::min(std::max<usize>(k_VtkBinaryBlockBytes / sizeof(T), 1), totalValues);
+  auto block = std::make_unique<T[]>(blockValues);
+  for(usize start = 0; start < totalValues; start += blockValues)
+  {
+    const nonstd::span<T> values(block.get(), std::min(blockValues, totalValues - start));
+    Result<> copyResult = dataStore.copyIntoBuffer(start, values);
+    if(copyResult.invalid())
+    {
+      return copyResult;
+    }
+    if constexpr(endian::little == endian::native)
+    {
+      VtkByteSwapValues(values);
+    }
+    if(!write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T)))
+    {
+      return MakeErrorResult(k_VtkWriteDataError, "Error Writing Binary VTK Data into file");
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief How the values of an array are laid out in an ASCII VTK file.
+ */
+struct VtkAsciiFormat
+{
+  usize ValuesPerLine = 10;
+  bool LeadingSpace = false; // Every value is preceded by a space instead of followed by a space or newline
+  bool FixedFloats = false;  // Floats are written with 6 decimals instead of their shortest representation
+};
+
+/**
+ * @brief Appends one value to the text. Integers are converted with std::to_chars, floats with fmt so that they are
+ * written exactly as before. 8 bit types are written as numbers, not characters.
+ * @param text
+ * @param value
+ * @param fixedFloats
+ */
+template <typename T>
+void AppendVtkAsciiValue(std::string& text, T value, bool fixedFloats)
+{
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    if(fixedFloats)
+    {
+      fmt::format_to(std::back_inserter(text), "{:f}", value);
+    }
+    else
+    {
+      fmt::format_to(std::back_inserter(text), "{}", value);
+    }
+  }
+  else
+  {
+    using ValueType = std::conditional_t<sizeof(T) == 1, int32, T>;
+    char chars[24];
+    const std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), static_cast<ValueType>(value));
+    text.append(chars, result.ptr);
+  }
+}
+
+/**
+ * @brief Formats consecutive values of an array. The separators only depend on the index of each value in the array,
+ * so any block of values can be formatted independently of the others.
+ * @param values
+ * @param firstIndex The index of the first value in the array
+ * @param format
+ * @param text Receives the formatted values
+ */
+template <typename T>
+void FormatVtkAsciiValues(nonstd::span<const T> values, usize firstIndex, const VtkAsciiFormat& format, std::string& text)
+{
+  for(usize i = 0; i < values.size(); i++)
+  {
+    const usize index = firstIndex + i;
+    if(format.LeadingSpace)
+    {
+      if(index % format.ValuesPerLine == 0 && index > 0)
+      {
+        text.push_back('\n');
+      }
+      text.push_back(' ');
+      AppendVtkAsciiValue(text, values[i], format.FixedFloats);
+    }
+    else
+    {
+      AppendVtkAsciiValue(text, values[i], format.FixedFloats);
+      text.push_back(index % format.ValuesPerLine == format.ValuesPerLine - 1 ? '\n' : ' ');
+    }
+  }
+}
+
+/**
+ * @brief Writes the values of the store as ASCII text. Blocks of values are formatted in parallel into their own
+ * buffers, which are then written in order.
+ * @param dataStore
+ * @param format
+ * @param write Called with each block of text, returns false if the text could not be written
+ * @param arrayName Used in the progress messages
+ * @param messageHandler
+ * @param shouldCancel
+ * @return Result<>
+ */
+template <typename T, typename WriteFuncT>
+Result<> WriteVtkAsciiValues(const AbstractDataStore<T>& dataStore, const VtkAsciiFormat& format, const WriteFuncT& write, const std::string& arrayName,
+                             const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+{
+  const usize totalValues = dataStore.getSize();
+  const usize passValues = std::min(k_VtkAsciiBlockValues * k_VtkAsciiBlocksPerPass, totalValues);
+  auto values = std::make_unique<T[]>(passValues);
+  std::vector<std::string> blocks(k_VtkAsciiBlocksPerPass);
+
+  auto start = std::chrono::steady_clock::now();
+  for(usize passStart = 0; passStart < totalValues; passStart += passValues)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    const usize passCount = std::min(passValues, totalValues - passStart);
+    Result<> copyResult = dataStore.copyIntoBuffer(passStart, nonstd::span<T>(values.get(), passCount));
+    if(copyResult.invalid())
+    {
+      return copyResult;
+    }
+
+    const usize numBlocks = (passCount + k_VtkAsciiBlockValues - 1) / k_VtkAsciiBlockValues;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute([&](const Range& range) {
+      for(usize blockIndex = range.min(); blockIndex < range.max(); blockIndex++)
+      {
+        const usize blockStart = blockIndex * k_VtkAsciiBlockValues;
+        blocks[blockIndex].clear();
+        FormatVtkAsciiValues<T>(nonstd::span<const T>(values.get() + blockStart, std::min(k_VtkAsciiBlockValues, passCount - blockStart)), passStart + blockStart, format, blocks[blockIndex]);
+      }
+    });
+
+    for(usize blockIndex = 0; blockIndex < numBlocks; blockIndex++)
+    {
+      if(!write(blocks[blockIndex].data(), blocks[blockIndex].size()))
+      {
+        return MakeErrorResult(k_VtkWriteDataError, "Error Writing ASCII VTK Data into file");
+      }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    {
+      messageHandler(IFilter::Message::Type::Info,
+                     fmt::format("Processing {}: {}% completed", arrayName, static_cast<int32>(100 * static_cast<float>(passStart + passCount) / static_cast<float>(totalValues))));
+      start = now;
+    }
+  }
+  return {};
+}
 
 // -----------------------------------------------------------------------------
 template <typename T>
@@ -138,74 +347,33 @@ std::string TypeForPrimitive(const IFilter::MessageHandler& messageHandler)
 struct WriteVtkDataArrayFunctor
 {
   template <typename T>
-  void operator()(FILE* outputFile, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler)
+  Result<> operator()(FILE* outputFile, bool binary, DataStructure& dataStructure, const DataPath& arrayPath, const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
   {
     auto* dataArray = dataStructure.getDataAs<DataArray<T>>(arrayPath);
-    auto& dataStore = dataArray->template getIDataStoreRefAs<DataStore<T>>();
+    const auto& dataStore = dataArray->getDataStoreRef();
 
     messageHandler(IFilter::Message::Type::Info, fmt::format("Writing Cell Data {}", arrayPath.getTargetName()));
 
-    const usize totalElements = dataStore.getSize();
     const int numComps = static_cast<int>(dataStore.getNumberOfComponents());
     std::string dName = arrayPath.getTargetName();
     dName = StringUtilities::replace(dName, " ", "_");
 
     const std::string vtkTypeString = TypeForPrimitive<T>(messageHandler);
-    bool useIntCast = false;
-    if(vtkTypeString == "unsigned_char" || vtkTypeString == "char")
-    {
-      useIntCast = true;
-    }
 
     fprintf(outputFile, "SCALARS %s %s %d\n", dName.c_str(), vtkTypeString.c_str(), numComps);
     fprintf(outputFile, "LOOKUP_TABLE default\n");
+    auto writeToFile = [outputFile](const char* data, usize size) { return fwrite(data, 1, size, outputFile) == size; };
+    Result<> result;
     if(binary)
     {
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
-      }
-      fwrite(dataStore.data(), sizeof(T), totalElements, outputFile);
-      fprintf(outputFile, "\n");
-      if constexpr(endian::little == endian::native)
-      {
-        dataArray->byteSwapElements();
-      }
+      result = WriteVtkBinaryValues(dataStore, writeToFile);
     }
     else
     {
-      std::string buffer;
-      buffer.reserve(k_BufferDumpVal);
-      for(size_t i = 0; i < totalElements; i++)
-      {
-        if(i % 20 == 0 && i > 0)
-        {
-          buffer.append("\n");
-        }
-        if(useIntCast)
-        {
-          buffer.append(fmt::format(" {:d}", static_cast<int>(dataStore[i])));
-        }
-        else if constexpr(std::is_floating_point_v<T>)
-        {
-          buffer.append(fmt::format(" {:f}", dataStore[i]));
-        }
-        else
-        {
-          buffer.append(fmt::format(" {}", dataStore[i]));
-        }
-        // If the buffer is within 32 bytes of the reserved size, then dump
-        // the contents to the file.
-        if(buffer.size() > (k_BufferDumpVal - 32))
-        {
-          fprintf(outputFile, "%s", buffer.c_str());
-          buffer.clear();
-          buffer.reserve(k_BufferDumpVal);
-        }
-      }
-      buffer.append("\n");
-      fprintf(outputFile, "%s", buffer.c_str());
+      result = WriteVtkAsciiValues(dataStore, VtkAsciiFormat{20, true, true}, writeToFile, arrayPath.getTargetName(), messageHandler, shouldCancel);
     }
+    fprintf(outputFile, "\n");
+    return result;
   }
 };
 
@@ -264,7 +432,6 @@ struct WriteVtkDataFunctor
   Result<> operator()(std::ofstream& outStrm, IDataArray& iDataArray, bool binary, const nx::core::IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
   {
     using DataArrayType = DataArray<T>;
-    using DataStoreType = typename DataArrayType::store_type;
 
     auto& dataArrayRef = dynamic_cast<DataArrayType&>(iDataArray);
     const auto& dataStoreRef = dataArrayRef.getDataStoreRef();
@@ -274,72 +441,21 @@ struct WriteVtkDataFunctor
     outStrm << "SCALARS " << name << " " << ConvertDataTypeToVtkDataType<T>() << " " << dataArrayRef.getNumberOfComponents() << "\n";
     outStrm << "LOOKUP_TABLE default\n";
 
+    auto writeToStream = [&outStrm](const char* data, usize size) {
+      outStrm.write(data, static_cast<std::streamsize>(size));
+      return !outStrm.fail();
+    };
+    Result<> result;
     if(binary)
     {
-      // Swap to big Endian... because
-      if constexpr(endian::little == endian::native)
-      {
-        dataArrayRef.byteSwapElements();
-      }
-
-      auto result = dataStoreRef.writeBinaryFile(outStrm);
-      if(result.first != 0)
-      {
-      }
-
-      // Swap back to little endian
-      if constexpr(endian::little == endian::native)
-      {
-        dataArrayRef.byteSwapElements();
-      }
+      result = WriteVtkBinaryValues(dataStoreRef, writeToStream);
     }
     else
     {
-      const size_t k_DefaultElementsPerLine = 10;
-      auto start = std::chrono::steady_clock::now();
-      auto numTuples = dataStoreRef.getSize();
-      size_t currentItemCount = 0;
-
-      for(size_t idx = 0; idx < numTuples; idx++)
-      {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-        {
-          auto string = fmt::format("Processing {}: {}% completed", dataArrayRef.getName(), static_cast<int32>(100 * static_cast<float>(idx) / static_cast<float>(numTuples)));
-          messageHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
-        }
-
-        if constexpr(std::is_same_v<T, int8> || std::is_same_v<T, uint8>)
-        {
-          outStrm << static_cast<int32>(dataArrayRef[idx]);
-        }
-        else if constexpr(std::is_same_v<T, float32> || std::is_same_v<T, float64>)
-        {
-          outStrm << fmt::format("{}", dataArrayRef[idx]);
-        }
-        else
-        {
-          outStrm << dataArrayRef[idx];
-        }
-        if(currentItemCount < k_DefaultElementsPerLine - 1)
-        {
-          outStrm << ' ';
-          currentItemCount++;
-        }
-        else
-        {
-          outStrm << "\n";
-          currentItemCount = 0;
-        }
-      }
+      result = WriteVtkAsciiValues(dataStoreRef, VtkAsciiFormat{10, false, false}, writeToStream, dataArrayRef.getName(), messageHandler, shouldCancel);
     }
     outStrm << "\n"; // Always end with a new line for binary data
-    return {};
+    return result;
   }
 };
 } // namespace nx::core
@@ -2,6 +2,8 @@
 #include <catch2/catch.hpp>
 
 #include "simplnx/Core/Application.hpp"
+#include "simplnx/DataStructure/AttributeMatrix.hpp"
+#include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/Parameters/ArraySelectionParameter.hpp"
 #include "simplnx/Parameters/BoolParameter.hpp"
 #include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
@@ -59,3 +61,43 @@ TEST_CASE("SimplnxCore::FillBadData", "[Core][FillBadData]")
   WriteTestDataStructure(dataStructure, fs::path(fmt::format("{}/7_0_fill_bad_data.dream3d", unit_test::k_BinaryTestOutputDir)));
 #endif
 }
+
+TEST_CASE("SimplnxCore::FillBadData: Minimum Defect Size Boundary", "[Core][FillBadData]")
+{
+  // A defect of 2 voxels next to feature 5. Defects of more than one voxel are counted one voxel larger, so this
+  // defect has a size of 3: it is kept with a minimum size of 3 and filled with a minimum size of 4.
+  const int32 minAllowedDefectSize = GENERATE(3, 4);
+
+  DataStructure dataStructure;
+  auto* imageGeom = ImageGeom::Create(dataStructure, "Image");
+  imageGeom->setDimensions({3, 1, 1});
+  auto* cellData = AttributeMatrix::Create(dataStructure, "Cell Data", {1, 1, 3}, imageGeom->getId());
+  imageGeom->setCellData(*cellData);
+  auto* featureIds = CreateTestDataArray<int32>(dataStructure, "FeatureIds", {1, 1, 3}, {1}, cellData->getId());
+  auto* phases = CreateTestDataArray<int32>(dataStructure, "Phases", {1, 1, 3}, {1}, cellData->getId());
+  featureIds->getDataStoreRef().setValue(2, 5);
+  phases->fill(1);
+
+  const DataPath imagePath({"Image"});
+  const DataPath cellDataPath = imagePath.createChildPath("Cell Data");
+
+  FillBadDataFilter filter;
+  Arguments args;
+  args.insertOrAssign(FillBadDataFilter::k_MinAllowedDefectSize_Key, std::make_any<int32>(minAllowedDefectSize));
+  args.insertOrAssign(FillBadDataFilter::k_StoreAsNewPhase_Key, std::make_any<bool>(false));
+  args.insertOrAssign(FillBadDataFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("FeatureIds")));
+  args.insertOrAssign(FillBadDataFilter::k_CellPhasesArrayPath_Key, std::make_any<DataPath>(cellDataPath.createChildPath("Phases")));
+  args.insertOrAssign(FillBadDataFilter::k_IgnoredDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+  args.insertOrAssign(FillBadDataFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(imagePath));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions)
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result)
+
+  const int32 expectedDefectId = minAllowedDefectSize == 3 ? 0 : 5;
+  const auto& featureIdsStore = featureIds->getDataStoreRef();
+  REQUIRE(featureIdsStore[0] == expectedDefectId);
+  REQUIRE(featureIdsStore[1] == expectedDefectId);
+  REQUIRE(featureIdsStore[2] == 5);
+}
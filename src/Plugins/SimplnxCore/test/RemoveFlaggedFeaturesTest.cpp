@@ -224,3 +224,116 @@ TEST_CASE("SimplnxCore::RemoveFlaggedFeatures: Test Extract then Remove Algorith
   auto& newTestArrayResult = dataStructure.getDataRefAs<Int32Array>(DataPath({k_NewImgGeom, k_CellFeatureData, k_Int32DataSet}));
   ValidateNewGeom(newFeatureIdsResult, newCellFeatureAMResult, newTestArrayResult);
 }
+
+TEST_CASE("SimplnxCore::RemoveFlaggedFeatures: Test Remove And Fill Algorithm", "[SimplnxCore][RemoveFlaggedFeatures]")
+{ // Instantiate the filter, a DataStructure object and an Arguments Object
+  RemoveFlaggedFeaturesFilter filter;
+  DataStructure dataStructure;
+  FillDataStructure(dataStructure);
+  Arguments args;
+
+  // A cell array that holds the index of each voxel shows which voxel every removed voxel was filled from
+  const DataPath cellIndexPath({k_DataContainer, k_CellData, k_Int32DataSet});
+  const auto& cellData = dataStructure.getDataRefAs<AttributeMatrix>(DataPath({k_DataContainer, k_CellData}));
+  Int32Array* cellIndexArray = UnitTest::CreateTestDataArray<int32>(dataStructure, k_Int32DataSet, cellData.getShape(), {1}, cellData.getId());
+  for(usize i = 0; i < cellIndexArray->getNumberOfTuples(); i++)
+  {
+    (*cellIndexArray)[i] = static_cast<int32>(i);
+  }
+
+  // Create default Parameters for the filter.
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_Functionality_Key, std::make_any<ChoicesParameter::ValueType>(0));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_FillRemovedFeatures_Key, std::make_any<bool>(true));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_FlaggedFeaturesArrayPath_Key, std::make_any<DataPath>(k_FlaggedFeaturesPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_IgnoredDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+
+  // Preflight the filter and check result
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  // Execute the filter and check the result
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  REQUIRE(executeResult.result.warnings().empty());
+
+  // Voxel 13 has two votes for feature 2 and voxel 14 has two votes for feature 0, the last voter is the source
+  const auto& featureIdsResult = dataStructure.getDataRefAs<Int32Array>(k_FeatureIdsPath);
+  const auto& cellIndexResult = dataStructure.getDataRefAs<Int32Array>(cellIndexPath);
+  REQUIRE(featureIdsResult[13] == 2);
+  REQUIRE(featureIdsResult[14] == 0);
+  REQUIRE(cellIndexResult[13] == 12);
+  REQUIRE(cellIndexResult[14] == 15);
+  for(usize i = 0; i < featureIdsResult.getNumberOfTuples(); i++)
+  {
+    if(i != 13 && i != 14)
+    {
+      REQUIRE(cellIndexResult[i] == static_cast<int32>(i));
+    }
+  }
+
+  const auto& cellFeatureAMResult = dataStructure.getDataRefAs<AttributeMatrix>(DataPath({k_DataContainer, k_CellFeatureData}));
+  REQUIRE(cellFeatureAMResult.getNumTuples() == 3);
+  const auto& testArrayResult = dataStructure.getDataRefAs<Int32Array>(DataPath({k_DataContainer, k_CellFeatureData, k_Int32DataSet}));
+  REQUIRE(testArrayResult[0] == 0);
+  REQUIRE(testArrayResult[1] == 4041);
+  REQUIRE(testArrayResult[2] == 10128);
+}
+
+TEST_CASE("SimplnxCore::RemoveFlaggedFeatures: Fill From Repeated Neighbors", "[SimplnxCore][RemoveFlaggedFeatures]")
+{
+  RemoveFlaggedFeaturesFilter filter;
+  DataStructure dataStructure;
+  ImageGeom* imageGeom = ImageGeom::Create(dataStructure, k_DataContainer);
+  imageGeom->setDimensions({3, 3, 1});
+  imageGeom->setOrigin(std::vector<float>{0, 0, 0});
+  imageGeom->setSpacing(std::vector<float>{1, 1, 1});
+  const std::vector<usize> tupleDims = {1, 3, 3};
+  auto* attributeMatrix = AttributeMatrix::Create(dataStructure, k_CellData, tupleDims, imageGeom->getId());
+  imageGeom->setCellData(*attributeMatrix);
+
+  // Feature 4 is removed. Voxel 4 touches feature 1 twice, voxel 7 only touches different features until voxel 4 is filled.
+  const std::vector<int32> featureIdValues = {1, 1, 2, 1, 4, 2, 3, 4, 1};
+  Int32Array* featureIds = UnitTest::CreateTestDataArray<int32>(dataStructure, k_FeatureIds, tupleDims, {1}, attributeMatrix->getId());
+  Int32Array* cellIndexArray = UnitTest::CreateTestDataArray<int32>(dataStructure, k_Int32DataSet, tupleDims, {1}, attributeMatrix->getId());
+  for(usize i = 0; i < featureIdValues.size(); i++)
+  {
+    (*featureIds)[i] = featureIdValues[i];
+    (*cellIndexArray)[i] = static_cast<int32>(i);
+  }
+
+  auto* featureAttributeMatrix = AttributeMatrix::Create(dataStructure, k_CellFeatureData, {5ULL}, imageGeom->getId());
+  BoolArray* maskArray = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, k_ActiveName, {5}, {1}, featureAttributeMatrix->getId());
+  auto& maskDataStore = maskArray->getDataStoreRef();
+  maskDataStore.fill(false);
+  maskDataStore[4] = true;
+
+  Arguments args;
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_Functionality_Key, std::make_any<ChoicesParameter::ValueType>(0));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_FillRemovedFeatures_Key, std::make_any<bool>(true));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_SelectedImageGeometryPath_Key, std::make_any<DataPath>(k_ImageGeomPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_CellFeatureIdsArrayPath_Key, std::make_any<DataPath>(k_FeatureIdsPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_FlaggedFeaturesArrayPath_Key, std::make_any<DataPath>(k_FlaggedFeaturesPath));
+  args.insertOrAssign(RemoveFlaggedFeaturesFilter::k_IgnoredDataArrayPaths_Key, std::make_any<MultiArraySelectionParameter::ValueType>(MultiArraySelectionParameter::ValueType{}));
+
+  auto preflightResult = filter.preflight(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(preflightResult.outputActions);
+
+  auto executeResult = filter.execute(dataStructure, args);
+  SIMPLNX_RESULT_REQUIRE_VALID(executeResult.result);
+  REQUIRE(executeResult.result.warnings().empty());
+
+  // Voxel 4 is filled from the second neighbor of feature 1. Voxel 7 is filled in the next pass from voxel 8, which
+  // is the second neighbor of feature 1 once voxel 4 belongs to it, instead of from feature 3 in voxel 6.
+  const auto& featureIdsResult = dataStructure.getDataRefAs<Int32Array>(k_FeatureIdsPath);
+  const auto& cellIndexResult = dataStructure.getDataRefAs<Int32Array>(DataPath({k_DataContainer, k_CellData, k_Int32DataSet}));
+  const std::vector<int32> expectedFeatureIds = {1, 1, 2, 1, 1, 2, 3, 1, 1};
+  const std::vector<int32> expectedCellIndices = {0, 1, 2, 3, 3, 5, 6, 8, 8};
+  for(usize i = 0; i < expectedFeatureIds.size(); i++)
+  {
+    REQUIRE(featureIdsResult[i] == expectedFeatureIds[i]);
+    REQUIRE(cellIndexResult[i] == expectedCellIndices[i]);
+  }
+  REQUIRE(dataStructure.getDataRefAs<AttributeMatrix>(DataPath({k_DataContainer, k_CellFeatureData})).getNumTuples() == 4);
+}
@@ -16,6 +16,7 @@
 #include <simplnx/DataStructure/DataGroup.hpp>
 #include <simplnx/DataStructure/DataStore.hpp>
 #include <simplnx/DataStructure/DataStructure.hpp>
+#include <simplnx/DataStructure/DynamicListArray.hpp>
 #include <simplnx/DataStructure/Geometry/EdgeGeom.hpp>
 #include <simplnx/DataStructure/Geometry/HexahedralGeom.hpp>
 #include <simplnx/DataStructure/Geometry/IGeometry.hpp>
@@ -25,6 +26,7 @@
 #include <simplnx/DataStructure/Geometry/TetrahedralGeom.hpp>
 #include <simplnx/DataStructure/Geometry/TriangleGeom.hpp>
 #include <simplnx/DataStructure/Geometry/VertexGeom.hpp>
+#include <simplnx/DataStructure/NeighborList.hpp>
 #include <simplnx/DataStructure/StringArray.hpp>
 #include <simplnx/Filter/Actions/CopyArrayInstanceAction.hpp>
 #include <simplnx/Filter/Actions/CopyDataObjectAction.hpp>
@@ -82,6 +84,7 @@
 #include <simplnx/Pipeline/Pipeline.hpp>
 #include <simplnx/Pipeline/PipelineFilter.hpp>
 #include <simplnx/Utilities/DataGroupUtilities.hpp>
+#include <simplnx/Utilities/ParallelDataAlgorithm.hpp>
 #include <simplnx/Utilities/Parsing/HDF5/Readers/AttributeReader.hpp>
 #include <simplnx/Utilities/Parsing/HDF5/Readers/FileReader.hpp>
 
@@ -149,18 +152,148 @@ auto BindVectorParameter(py::handle scope, const char* name)
 #define SIMPLNX_PY_BIND_NUMBER_PARAMETER(scope, className) BindNumberParameter<className>(scope, #className)
 #define SIMPLNX_PY_BIND_VECTOR_PARAMETER(scope, className) BindVectorParameter<className>(scope, #className)
 
+// Number of values copied per chunk by DataArray.iter_chunks() when no chunk size is given
+constexpr usize k_DefaultChunkValues = 1048576;
+
+template <class T>
+IDataStore::ShapeType GetNumpyShape(const AbstractDataStore<T>& dataStore)
+{
+  IDataStore::ShapeType shape = dataStore.getTupleShape();
+  IDataStore::ShapeType componentShape = dataStore.getComponentShape();
+  shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
+  return shape;
+}
+
+/**
+ * @brief Copies the whole store into a new numpy array. The GIL is released during the copy so stores that are not
+ * held in memory can be read while other python threads keep running.
+ */
+template <class T>
+py::array_t<T, py::array::c_style> CopyDataStoreToNumpy(const AbstractDataStore<T>& dataStore)
+{
+  py::array_t<T, py::array::c_style> npArray(GetNumpyShape(dataStore));
+  nonstd::span<T> buffer(npArray.mutable_data(), dataStore.getSize());
+  Result<> result;
+  {
+    py::gil_scoped_release releaseGIL{};
+    result = dataStore.copyIntoBuffer(0, buffer);
+  }
+  if(result.invalid())
+  {
+    throw std::runtime_error(fmt::format("Unable to copy the data store into a numpy array: {}", result.errors()[0].message));
+  }
+  return npArray;
+}
+
+/**
+ * @brief Builds the compressed sparse row form of a list of lists: offsets[i] to offsets[i + 1] is the range of list i
+ * within values. The lists are copied in parallel without holding the GIL.
+ * @param numLists
+ * @param listSize Returns the number of values of list i
+ * @param listData Returns a pointer to the values of list i
+ * @return py::tuple (offsets, values)
+ */
+template <class T, class SizeFunctionT, class DataFunctionT>
+py::tuple MakeCsrArrays(usize numLists, const SizeFunctionT& listSize, const DataFunctionT& listData)
+{
+  py::array_t<uint64> offsets(numLists + 1);
+  uint64* offsetsPtr = offsets.mutable_data();
+  offsetsPtr[0] = 0;
+  {
+    py::gil_scoped_release releaseGIL{};
+    for(usize i = 0; i < numLists; i++)
+    {
+      offsetsPtr[i + 1] = offsetsPtr[i] + listSize(i);
+    }
+  }
+
+  py::array_t<T> values(offsetsPtr[numLists]);
+  T* valuesPtr = values.mutable_data();
+  {
+    py::gil_scoped_release releaseGIL{};
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numLists);
+    dataAlg.execute([&](const Range& range) {
+      for(usize i = range.min(); i < range.max(); i++)
+      {
+        std::copy_n(listData(i), offsetsPtr[i + 1] - offsetsPtr[i], valuesPtr + offsetsPtr[i]);
+      }
+    });
+  }
+  return py::make_tuple(offsets, values);
+}
+
+/**
+ * @brief Iterates over a DataArray in blocks of whole tuples. Every block is copied into its own numpy array so arrays
+ * that are not held in memory can be processed without reading all of them at once.
+ */
+template <class T>
+class DataArrayChunkIterator
+{
+public:
+  DataArrayChunkIterator(std::shared_ptr<DataArray<T>> dataArray, usize chunkTuples)
+  : m_DataArray(std::move(dataArray))
+  , m_ChunkTuples(std::max<usize>(chunkTuples, 1))
+  {
+  }
+
+  py::tuple next()
+  {
+    const auto& dataStore = m_DataArray->getDataStoreRef();
+    const usize numTuples = dataStore.getNumberOfTuples();
+    if(m_NextTuple >= numTuples)
+    {
+      throw py::stop_iteration();
+    }
+
+    const usize numComponents = dataStore.getNumberOfComponents();
+    const usize chunkTuples = std::min(m_ChunkTuples, numTuples - m_NextTuple);
+    IDataStore::ShapeType shape = {chunkTuples};
+    IDataStore::ShapeType componentShape = dataStore.getComponentShape();
+    shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
+
+    py::array_t<T, py::array::c_style> chunk(shape);
+    nonstd::span<T> buffer(chunk.mutable_data(), chunkTuples * numComponents);
+    Result<> result;
+    {
+      py::gil_scoped_release releaseGIL{};
+      result = dataStore.copyIntoBuffer(m_NextTuple * numComponents, buffer);
+    }
+    if(result.invalid())
+    {
+      throw std::runtime_error(fmt::format("Unable to read tuples starting at {}: {}", m_NextTuple, result.errors()[0].message));
+    }
+
+    py::tuple item = py::make_tuple(m_NextTuple, chunk);
+    m_NextTuple += chunkTuples;
+    return item;
+  }
+
+private:
+  std::shared_ptr<DataArray<T>> m_DataArray;
+  usize m_ChunkTuples = 1;
+  usize m_NextTuple = 0;
+};
+
 template <class T>
 auto BindDataStore(py::handle scope, const char* name)
 {
-  py::class_<DataStore<T>, AbstractDataStore<T>, std::shared_ptr<DataStore<T>>> dataStore(scope, name);
+  py::class_<DataStore<T>, AbstractDataStore<T>, std::shared_ptr<DataStore<T>>> dataStore(scope, name, py::buffer_protocol());
   dataStore.def(py::init<const IDataStore::ShapeType&, const IDataStore::ShapeType&, std::optional<T>>(), "tuple_shape"_a, "component_shape"_a, "init_value"_a = std::optional<T>{});
   dataStore.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
+  dataStore.def_buffer([](DataStore<T>& dataStore) {
+    IDataStore::ShapeType shape = GetNumpyShape(dataStore);
+    std::vector<py::ssize_t> strides(shape.size(), static_cast<py::ssize_t>(sizeof(T)));
+    for(usize i = shape.size(); i > 1; i--)
+    {
+      strides[i - 2] = strides[i - 1] * static_cast<py::ssize_t>(shape[i - 1]);
+    }
+    return py::buffer_info(dataStore.data(), sizeof(T), py::format_descriptor<T>::format(), static_cast<py::ssize_t>(shape.size()), shape, strides);
+  });
   dataStore.def(
       "npview",
       [](DataStore<T>& dataStore) {
-        IDataStore::ShapeType shape = dataStore.getTupleShape();
-        IDataStore::ShapeType componentShape = dataStore.getComponentShape();
-        shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
+        IDataStore::ShapeType shape = GetNumpyShape(dataStore);
         return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
       },
       py::return_value_policy::reference_internal);
@@ -175,24 +308,143 @@ auto BindDataArray(py::handle scope, const char* name)
 {
   py::class_<DataArray<T>, IDataArray, std::shared_ptr<DataArray<T>>> dataArray(scope, name);
   dataArray.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
+  dataArray.def_property_readonly(
+      "in_memory", [](const DataArray<T>& dataArray) { return dynamic_cast<const DataStore<T>*>(&dataArray.getDataStoreRef()) != nullptr; },
+      "True if the values are held in one contiguous block of memory that npview() can expose without copying");
   dataArray.def(
       "npview",
       [](DataArray<T>& dataArray) {
-        using DataArrayType = DataArray<T>;
         using DataStoreType = DataStore<T>;
-        const typename DataArrayType::store_type& abstractDataStore = dataArray.getDataStoreRef();
-        const DataStoreType& dataStore = dynamic_cast<const DataStoreType&>(abstractDataStore);
-        IDataStore::ShapeType shape = dataStore.getTupleShape();
-        IDataStore::ShapeType componentShape = dataStore.getComponentShape();
-        shape.insert(shape.end(), componentShape.cbegin(), componentShape.cend());
-        return py::array_t<T, py::array::c_style>(shape, dataStore.data(), py::cast(dataStore));
+        const auto* dataStore = dynamic_cast<const DataStoreType*>(&dataArray.getDataStoreRef());
+        if(dataStore == nullptr)
+        {
+          throw std::runtime_error(fmt::format("DataArray '{}' is not held in memory and can not be viewed without a copy. Use to_numpy() or iter_chunks() instead.", dataArray.getName()));
+        }
+        IDataStore::ShapeType shape = GetNumpyShape(*dataStore);
+        return py::array_t<T, py::array::c_style>(shape, dataStore->data(), py::cast(*dataStore));
       },
       py::return_value_policy::reference_internal);
+  dataArray.def(
+      "to_numpy", [](const DataArray<T>& dataArray) { return CopyDataStoreToNumpy(dataArray.getDataStoreRef()); }, "Copies the values into a new numpy array. Works for every kind of data store.");
+  dataArray.def(
+      "__array__",
+      [](py::object self, const py::object& dtype, const py::object& copy) {
+        const auto& dataArray = self.cast<const DataArray<T>&>();
+        const bool inMemory = dynamic_cast<const DataStore<T>*>(&dataArray.getDataStoreRef()) != nullptr;
+        const bool forceCopy = !copy.is_none() && copy.cast<bool>();
+        const bool forbidCopy = !copy.is_none() && !copy.cast<bool>();
+        const bool convertType = !dtype.is_none() && py::dtype::from_args(dtype).not_equal(py::dtype::of<T>());
+        // NumPy 2 semantics: copy=False must never copy, so raise instead of silently handing back a copy
+        if(forbidCopy && (!inMemory || convertType))
+        {
+          throw py::value_error(fmt::format("Unable to avoid copy while creating a numpy array from DataArray '{}'. {}", dataArray.getName(),
+                                            inMemory ? "The requested dtype differs from the DataArray's dtype." : "The DataArray is not held in memory."));
+        }
+        py::object npArray = (inMemory && !forceCopy) ? self.attr("npview")() : self.attr("to_numpy")();
+        if(convertType)
+        {
+          npArray = npArray.attr("astype")(dtype);
+        }
+        return npArray;
+      },
+      "dtype"_a = py::none(), "copy"_a = py::none());
+  dataArray.def(
+      "iter_chunks",
+      [](const std::shared_ptr<DataArray<T>>& dataArray, usize chunkTuples) {
+        if(chunkTuples == 0)
+        {
+          chunkTuples = std::max<usize>(k_DefaultChunkValues / std::max<usize>(dataArray->getNumberOfComponents(), 1), 1);
+        }
+        return DataArrayChunkIterator<T>(dataArray, chunkTuples);
+      },
+      "chunk_tuples"_a = 0,
+      "Returns an iterator of (start_tuple, numpy array) pairs that copies chunk_tuples tuples at a time. A chunk_tuples of 0 picks a chunk size of about one million values.");
+  dataArray.def(
+      "copy_from",
+      [](DataArray<T>& dataArray, const py::array_t<T, py::array::c_style | py::array::forcecast>& values, usize startTuple) {
+        auto& dataStore = dataArray.getDataStoreRef();
+        const usize numComponents = dataStore.getNumberOfComponents();
+        const usize numValues = static_cast<usize>(values.size());
+        if(numValues % numComponents != 0 || startTuple * numComponents + numValues > dataStore.getSize())
+        {
+          throw std::invalid_argument(fmt::format("Unable to copy {} values starting at tuple {} into DataArray '{}' with {} tuples of {} components.", numValues, startTuple, dataArray.getName(),
+                                                  dataStore.getNumberOfTuples(), numComponents));
+        }
+        Result<> result;
+        {
+          py::gil_scoped_release releaseGIL{};
+          result = dataStore.copyFromBuffer(startTuple * numComponents, nonstd::span<const T>(values.data(), numValues));
+        }
+        if(result.invalid())
+        {
+          throw std::runtime_error(fmt::format("Unable to copy the numpy array into DataArray '{}': {}", dataArray.getName(), result.errors()[0].message));
+        }
+      },
+      "values"_a, "start_tuple"_a = 0, "Copies the values of a numpy array into the DataArray, starting at start_tuple. Works for every kind of data store.");
+
+  py::class_<DataArrayChunkIterator<T>> chunkIterator(dataArray, "ChunkIterator");
+  chunkIterator.def("__iter__", [](DataArrayChunkIterator<T>& self) -> DataArrayChunkIterator<T>& { return self; });
+  chunkIterator.def("__next__", &DataArrayChunkIterator<T>::next);
   return dataArray;
 }
 
+template <class T>
+auto BindNeighborList(py::handle scope, const char* name)
+{
+  py::class_<NeighborList<T>, INeighborList, std::shared_ptr<NeighborList<T>>> neighborList(scope, name);
+  neighborList.def_property_readonly_static("dtype", []([[maybe_unused]] py::object self) { return py::dtype::of<T>(); });
+  neighborList.def("__len__", [](const NeighborList<T>& neighborList) { return neighborList.getNumberOfTuples(); });
+  neighborList.def("__getitem__", [](const NeighborList<T>& neighborList, usize index) {
+    if(index >= neighborList.getNumberOfTuples())
+    {
+      throw py::index_error("Index out of range");
+    }
+    const auto& lists = neighborList.getValues();
+    if(index >= lists.size() || lists[index] == nullptr)
+    {
+      return py::array_t<T>(0);
+    }
+    return py::array_t<T>(static_cast<py::ssize_t>(lists[index]->size()), lists[index]->data());
+  });
+  neighborList.def(
+      "csr",
+      [](const NeighborList<T>& neighborList) {
+        const auto& lists = neighborList.getValues();
+        auto listSize = [&lists](usize i) -> usize { return (i < lists.size() && lists[i] != nullptr) ? lists[i]->size() : 0; };
+        auto listData = [&lists](usize i) -> const T* { return (i < lists.size() && lists[i] != nullptr) ? lists[i]->data() : nullptr; };
+        return MakeCsrArrays<T>(neighborList.getNumberOfTuples(), listSize, listData);
+      },
+      "Returns the lists as a tuple of numpy arrays (offsets, values) where list i is values[offsets[i]:offsets[i + 1]]");
+  neighborList.def(
+      "set_from_csr",
+      [](NeighborList<T>& neighborList, const py::array_t<uint64, py::array::c_style | py::array::forcecast>& offsets,
+         const py::array_t<T, py::array::c_style | py::array::forcecast>& values) {
+        const usize numLists = neighborList.getNumberOfTuples();
+        const uint64* offsetsPtr = offsets.data();
+        if(static_cast<usize>(offsets.size()) != numLists + 1 || offsetsPtr[0] != 0 || offsetsPtr[numLists] != static_cast<uint64>(values.size()) ||
+           !std::is_sorted(offsetsPtr, offsetsPtr + numLists + 1))
+        {
+          throw std::invalid_argument(fmt::format("The offsets must hold {} ascending values that start at 0 and end at the number of values ({}).", numLists + 1, values.size()));
+        }
+        const T* valuesPtr = values.data();
+        py::gil_scoped_release releaseGIL{};
+        neighborList.resizeTuples(numLists);
+        ParallelDataAlgorithm dataAlg;
+        dataAlg.setRange(0, numLists);
+        dataAlg.execute([&](const Range& range) {
+          for(usize i = range.min(); i < range.max(); i++)
+          {
+            neighborList.setList(static_cast<int32>(i), std::make_shared<std::vector<T>>(valuesPtr + offsetsPtr[i], valuesPtr + offsetsPtr[i + 1]));
+          }
+        });
+      },
+      "offsets"_a, "values"_a, "Replaces every list with values[offsets[i]:offsets[i + 1]]");
+  return neighborList;
+}
+
 #define SIMPLNX_PY_BIND_DATA_ARRAY(scope, className) BindDataArray<className::value_type>(scope, #className)
 #define SIMPLNX_PY_BIND_DATA_STORE(scope, className) BindDataStore<className::value_type>(scope, #className)
+#define SIMPLNX_PY_BIND_NEIGHBOR_LIST(scope, className) BindNeighborList<className::value_type>(scope, #className)
 #define SIMPLNX_PY_BIND_ABSTRACT_DATA_STORE(scope, className) SIMPLNX_PY_BIND_CLASS_VARIADIC(scope, className, IDataStore, std::shared_ptr<className>)
 
 template <class GeomT>
@@ -959,6 +1211,14 @@ PYBIND11_MODULE(simplnx, mod)
   stringArray.def_property_readonly("cdims", &StringArray::getComponentShape);
   stringArray.def_property_readonly("values", &StringArray::values);
   stringArray.def("resize_tuples", &StringArray::resizeTuples, "Resize the tuples with the given shape");
+  stringArray.def(
+      "csr",
+      [](const StringArray& strArr) {
+        const auto& strings = strArr.values();
+        return MakeCsrArrays<uint8>(
+            strings.size(), [&strings](usize i) { return strings[i].size(); }, [&strings](usize i) { return reinterpret_cast<const uint8*>(strings[i].data()); });
+      },
+      "Returns the strings as a tuple of numpy arrays (offsets, bytes) where string i is bytes[offsets[i]:offsets[i + 1]]");
 
   auto dataArrayInt8 = SIMPLNX_PY_BIND_DATA_ARRAY(mod, Int8Array);
   auto dataArrayUInt8 = SIMPLNX_PY_BIND_DATA_ARRAY(mod, UInt8Array);
@@ -972,6 +1232,38 @@ PYBIND11_MODULE(simplnx, mod)
   auto dataArrayFloat64 = SIMPLNX_PY_BIND_DATA_ARRAY(mod, Float64Array);
   auto dataArrayBool = SIMPLNX_PY_BIND_DATA_ARRAY(mod, BoolArray);
 
+  py::class_<INeighborList, IArray, std::shared_ptr<INeighborList>> iNeighborList(mod, "INeighborList");
+  iNeighborList.def_property_readonly("data_type", &INeighborList::getDataType);
+
+  auto neighborListInt8 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int8NeighborList);
+  auto neighborListUInt8 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt8NeighborList);
+  auto neighborListInt16 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int16NeighborList);
+  auto neighborListUInt16 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt16NeighborList);
+  auto neighborListInt32 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int32NeighborList);
+  auto neighborListUInt32 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt32NeighborList);
+  auto neighborListInt64 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Int64NeighborList);
+  auto neighborListUInt64 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, UInt64NeighborList);
+  auto neighborListFloat32 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Float32NeighborList);
+  auto neighborListFloat64 = SIMPLNX_PY_BIND_NEIGHBOR_LIST(mod, Float64NeighborList);
+
+  using ElementDynamicList = IGeometry::ElementDynamicList;
+  py::class_<ElementDynamicList, DataObject, std::shared_ptr<ElementDynamicList>> elementDynamicList(mod, "ElementDynamicList");
+  elementDynamicList.def("__len__", &ElementDynamicList::size);
+  elementDynamicList.def("__getitem__", [](const ElementDynamicList& self, usize index) {
+    if(index >= self.size())
+    {
+      throw py::index_error("Index out of range");
+    }
+    return py::array_t<IGeometry::MeshIndexType>(self.getNumberOfElements(index), self.getElementListPointer(index));
+  });
+  elementDynamicList.def(
+      "csr",
+      [](const ElementDynamicList& self) {
+        return MakeCsrArrays<IGeometry::MeshIndexType>(
+            self.size(), [&self](usize i) { return static_cast<usize>(self.getNumberOfElements(i)); }, [&self](usize i) -> const IGeometry::MeshIndexType* { return self.getElementListPointer(i); });
+      },
+      "Returns the lists as a tuple of numpy arrays (offsets, values) where list i is values[offsets[i]:offsets[i + 1]]");
+
   rectGridGeom.def_property_readonly("x_bounds", py::overload_cast<>(&RectGridGeom::getXBoundsRef), py::return_value_policy::reference_internal);
   rectGridGeom.def_property_readonly("y_bounds", py::overload_cast<>(&RectGridGeom::getYBoundsRef), py::return_value_policy::reference_internal);
   rectGridGeom.def_property_readonly("z_bounds", py::overload_cast<>(&RectGridGeom::getZBoundsRef), py::return_value_policy::reference_internal);
@@ -981,6 +1273,8 @@ PYBIND11_MODULE(simplnx, mod)
 
   iNodeGeometry1D.def_property_readonly("edges", py::overload_cast<>(&INodeGeometry1D::getEdgesRef), py::return_value_policy::reference_internal);
   iNodeGeometry1D.def_property_readonly("edge_data", py::overload_cast<>(&INodeGeometry1D::getEdgeAttributeMatrixRef), py::return_value_policy::reference_internal);
+  iNodeGeometry1D.def_property_readonly("elements_containing_vert", &INodeGeometry1D::getElementsContainingVert, py::return_value_policy::reference_internal);
+  iNodeGeometry1D.def_property_readonly("element_neighbors", &INodeGeometry1D::getElementNeighbors, py::return_value_policy::reference_internal);
 
   iNodeGeometry2D.def_property_readonly("faces", py::overload_cast<>(&INodeGeometry2D::getFacesRef), py::return_value_policy::reference_internal);
   iNodeGeometry2D.def_property_readonly("face_data", py::overload_cast<>(&INodeGeometry2D::getFaceAttributeMatrixRef), py::return_value_policy::reference_internal);
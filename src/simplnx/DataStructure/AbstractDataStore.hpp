@@ -829,6 +829,48 @@ public:
     return {};
   }
 
+  /**
+   * @brief Copies buffer.size() values starting at the flat index startIndex into the
+   * provided buffer. Subclasses that own contiguous memory override this with a bulk copy.
+   * @param startIndex
+   * @param buffer
+   * @return
+   */
+  virtual Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} from a data store of size {}.", buffer.size(), startIndex, getSize()));
+    }
+
+    for(usize i = 0; i < buffer.size(); i++)
+    {
+      buffer[i] = getValue(startIndex + i);
+    }
+    return {};
+  }
+
+  /**
+   * @brief Copies the values of the provided buffer into the data store starting at the
+   * flat index startIndex. Subclasses that own contiguous memory override this with a bulk copy.
+   * @param startIndex
+   * @param buffer
+   * @return
+   */
+  virtual Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer)
+  {
+    if(startIndex + buffer.size() > getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values into a data store of size {} starting at index {}.", buffer.size(), getSize(), startIndex));
+    }
+
+    for(usize i = 0; i < buffer.size(); i++)
+    {
+      setValue(startIndex + i, buffer[i]);
+    }
+    return {};
+  }
+
   /**
    * @brief Sets all the components of tuple i to value.
    * @param i
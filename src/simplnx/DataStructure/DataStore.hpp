@@ -337,6 +337,40 @@ public:
     return std::make_unique<DataStore<T>>(this->getTupleShape(), this->getComponentShape(), static_cast<T>(0));
   }
 
+  /**
+   * @brief Copies buffer.size() values starting at the flat index startIndex into the provided buffer.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} from a data store of size {}.", buffer.size(), startIndex, this->getSize()));
+    }
+
+    std::copy_n(m_Data.get() + startIndex, buffer.size(), buffer.data());
+    return {};
+  }
+
+  /**
+   * @brief Copies the values of the provided buffer into the DataStore starting at the flat index startIndex.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const T> buffer) override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14604, fmt::format("Unable to copy {} values into a data store of size {} starting at index {}.", buffer.size(), this->getSize(), startIndex));
+    }
+
+    std::copy(buffer.begin(), buffer.end(), m_Data.get() + startIndex);
+    return {};
+  }
+
   nonstd::span<T> createSpan()
   {
     return {data(), this->getSize()};
@@ -4,6 +4,12 @@
 
 namespace nx::core::IOConstants
 {
+// Data format of arrays whose store is not allocated when they are created but set by the filter that creates them
+inline constexpr StringLiteral k_DeferredDataFormat = "Deferred";
+// Data format of read-only views into another store. Views are never created from a format, arrays created to match a
+// view get the default format
+inline constexpr StringLiteral k_StridedViewDataFormat = "StridedView";
+
 // DataArray
 inline constexpr StringLiteral k_TupleShapeTag = "TupleDimensions";
 inline constexpr StringLiteral k_ComponentShapeTag = "ComponentDimensions";
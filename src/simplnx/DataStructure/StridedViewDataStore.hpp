@@ -0,0 +1,269 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/IO/Generic/IOConstants.hpp"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+namespace nx::core
+{
+/**
+ * @class StridedViewDataStore
+ * @brief Read-only data store that holds no values of its own: it presents a box of voxels from a source store with a
+ * {Z, Y, X} tuple layout, such as the cropped region of an image geometry. Each x row of the box is contiguous in the
+ * source, so rows are read in one block. The view keeps the source store alive and shows any later change to it, so
+ * it is meant for data that is only read from here on. Writing through the view throws.
+ * @tparam T
+ */
+template <typename T>
+class StridedViewDataStore : public AbstractDataStore<T>
+{
+public:
+  using value_type = typename AbstractDataStore<T>::value_type;
+  using reference = typename AbstractDataStore<T>::reference;
+  using const_reference = typename AbstractDataStore<T>::const_reference;
+  using ShapeType = typename IDataStore::ShapeType;
+
+  /**
+   * @param source Store with one tuple per voxel of the source volume
+   * @param sourceDimensions X, Y, Z dimensions of the source volume
+   * @param bounds The viewed voxels as {xBegin, xEnd, yBegin, yEnd, zBegin, zEnd}, the ends are exclusive
+   */
+  StridedViewDataStore(std::shared_ptr<const AbstractDataStore<T>> source, const SizeVec3& sourceDimensions, const std::array<usize, 6>& bounds)
+  : m_Source(std::move(source))
+  , m_SourceDimensions(sourceDimensions)
+  , m_Bounds(bounds)
+  , m_TupleShape({bounds[5] - bounds[4], bounds[3] - bounds[2], bounds[1] - bounds[0]})
+  , m_ComponentShape(m_Source->getComponentShape())
+  {
+    if(bounds[1] > sourceDimensions[0] || bounds[3] > sourceDimensions[1] || bounds[5] > sourceDimensions[2] || bounds[0] > bounds[1] || bounds[2] > bounds[3] || bounds[4] > bounds[5])
+    {
+      throw std::runtime_error(fmt::format("StridedViewDataStore: The bounds [{}, {}) x [{}, {}) x [{}, {}) are outside of the source volume of {} x {} x {}.", bounds[0], bounds[1], bounds[2],
+                                           bounds[3], bounds[4], bounds[5], sourceDimensions[0], sourceDimensions[1], sourceDimensions[2]));
+    }
+  }
+
+  StridedViewDataStore(const StridedViewDataStore& other) = default;
+  StridedViewDataStore(StridedViewDataStore&& other) noexcept = default;
+  ~StridedViewDataStore() override = default;
+
+  usize getNumberOfTuples() const override
+  {
+    return m_TupleShape[0] * m_TupleShape[1] * m_TupleShape[2];
+  }
+
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+
+  usize getNumberOfComponents() const override
+  {
+    return m_Source->getNumberOfComponents();
+  }
+
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+
+  std::optional<ShapeType> getChunkShape() const override
+  {
+    return {};
+  }
+
+  /**
+   * @brief Resizing would lose the mapping to the source, so it always throws.
+   * @param tupleShape
+   */
+  void resizeTuples(const ShapeType& /*tupleShape*/) override
+  {
+    throw std::runtime_error("A strided view can not be resized.");
+  }
+
+  DataType getDataType() const override
+  {
+    return GetDataType<T>();
+  }
+
+  /**
+   * @brief The values are not held in a DataStore of their own, so the view never reports itself as in memory. Code
+   * that needs the raw values of an in memory store checks for this before casting.
+   * @return IDataStore::StoreType
+   */
+  IDataStore::StoreType getStoreType() const override
+  {
+    return IDataStore::StoreType::OutOfCore;
+  }
+
+  /**
+   * @brief Reports its own format even for a source held in memory, so code that casts stores with an empty format to
+   * DataStore<T> takes its generic path instead. Arrays created to match a view get the default format.
+   * @return std::string
+   */
+  std::string getDataFormat() const override
+  {
+    return IOConstants::k_StridedViewDataFormat;
+  }
+
+  usize getTypeSize() const override
+  {
+    return sizeof(T);
+  }
+
+  value_type getValue(usize index) const override
+  {
+    return m_Source->getValue(getSourceIndex(index));
+  }
+
+  void setValue(usize /*index*/, value_type /*value*/) override
+  {
+    throw std::runtime_error("A strided view is read-only.");
+  }
+
+  const_reference operator[](usize index) const override
+  {
+    return (*m_Source)[getSourceIndex(index)];
+  }
+
+  const_reference at(usize index) const override
+  {
+    if(index >= this->getSize())
+    {
+      throw std::runtime_error(fmt::format("StridedViewDataStore: Index {} is out of range for a store of size {}.", index, this->getSize()));
+    }
+    return (*this)[index];
+  }
+
+  /**
+   * @brief A reference could be used to write into the source, so this always throws. Values are read through the
+   * const overload or getValue().
+   * @return reference
+   */
+  reference operator[](usize /*index*/) override
+  {
+    throw std::runtime_error("A strided view is read-only.");
+  }
+
+  /**
+   * @brief Copies the requested values row by row from the source.
+   * @param startIndex
+   * @param buffer
+   * @return Result<>
+   */
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<T> buffer) const override
+  {
+    if(startIndex + buffer.size() > this->getSize())
+    {
+      return MakeErrorResult(-14603, fmt::format("Unable to copy {} values starting at index {} from a data store of size {}.", buffer.size(), startIndex, this->getSize()));
+    }
+
+    const usize rowSize = m_TupleShape[2] * getNumberOfComponents();
+    usize bufferIndex = 0;
+    while(bufferIndex < buffer.size())
+    {
+      const usize index = startIndex + bufferIndex;
+      const usize count = std::min(rowSize - index % rowSize, buffer.size() - bufferIndex);
+      Result<> copyResult = m_Source->copyIntoBuffer(getSourceIndex(index), buffer.subspan(bufferIndex, count));
+      if(copyResult.invalid())
+      {
+        return copyResult;
+      }
+      bufferIndex += count;
+    }
+    return {};
+  }
+
+  Result<> copyFromBuffer(usize /*startIndex*/, nonstd::span<const T> /*buffer*/) override
+  {
+    return MakeErrorResult(-14606, "A strided view is read-only.");
+  }
+
+  /**
+   * @brief The view holds no values of its own.
+   * @return uint64
+   */
+  uint64 memoryUsage() const override
+  {
+    return 0;
+  }
+
+  /**
+   * @brief A deep copy holds its own values, so it no longer follows the source.
+   * @return std::unique_ptr<IDataStore>
+   */
+  std::unique_ptr<IDataStore> deepCopy() const override
+  {
+    auto copy = std::make_unique<DataStore<T>>(m_TupleShape, m_ComponentShape, static_cast<T>(0));
+    Result<> copyResult = copyIntoBuffer(0, nonstd::span<T>(copy->data(), copy->getSize()));
+    if(copyResult.invalid())
+    {
+      throw std::runtime_error(copyResult.errors().front().message);
+    }
+    return copy;
+  }
+
+  std::unique_ptr<IDataStore> createNewInstance() const override
+  {
+    return std::make_unique<DataStore<T>>(m_TupleShape, m_ComponentShape, static_cast<T>(0));
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(const std::string& absoluteFilePath) const override
+  {
+    std::ofstream outStrm(absoluteFilePath, std::ios_base::out | std::ios_base::binary);
+    if(!outStrm.is_open())
+    {
+      return {-10170, fmt::format("File could not be opened for writing:\n  '{}'", absoluteFilePath)};
+    }
+
+    return writeBinaryFile(outStrm);
+  }
+
+  std::pair<int32, std::string> writeBinaryFile(std::ostream& outputStream) const override
+  {
+    const usize rowSize = m_TupleShape[2] * getNumberOfComponents();
+    auto row = std::make_unique<T[]>(rowSize);
+    for(usize index = 0; index < this->getSize(); index += rowSize)
+    {
+      Result<> copyResult = m_Source->copyIntoBuffer(getSourceIndex(index), nonstd::span<T>(row.get(), rowSize));
+      if(copyResult.invalid())
+      {
+        return {copyResult.errors().front().code, copyResult.errors().front().message};
+      }
+      outputStream.write(reinterpret_cast<const char*>(row.get()), sizeof(T) * rowSize);
+      if(outputStream.bad())
+      {
+        return {-10175, fmt::format("Error writing binary file:\n  Total Elements:'{}'\n", this->getSize())};
+      }
+    }
+
+    return {0, ""};
+  }
+
+private:
+  // Maps a value index of the view to the value index in the source
+  usize getSourceIndex(usize index) const
+  {
+    const usize numComps = getNumberOfComponents();
+    const usize tupleIndex = index / numComps;
+    const usize x = tupleIndex % m_TupleShape[2];
+    const usize y = (tupleIndex / m_TupleShape[2]) % m_TupleShape[1];
+    const usize z = tupleIndex / (m_TupleShape[2] * m_TupleShape[1]);
+    const usize sourceTuple = ((z + m_Bounds[4]) * m_SourceDimensions[1] + (y + m_Bounds[2])) * m_SourceDimensions[0] + (x + m_Bounds[0]);
+    return sourceTuple * numComps + index % numComps;
+  }
+
+  std::shared_ptr<const AbstractDataStore<T>> m_Source;
+  SizeVec3 m_SourceDimensions;
+  std::array<usize, 6> m_Bounds;
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+};
+} // namespace nx::core
@@ -67,7 +67,7 @@ Result<> CreateArrayAction::apply(DataStructure& dataStructure, Mode mode) const
 
 IDataAction::UniquePointer CreateArrayAction::clone() const
 {
-  return std::make_unique<CreateArrayAction>(m_Type, m_Dims, m_CDims, getCreatedPath());
+  return std::make_unique<CreateArrayAction>(m_Type, m_Dims, m_CDims, getCreatedPath(), m_DataFormat);
 }
 
 DataType CreateArrayAction::type() const
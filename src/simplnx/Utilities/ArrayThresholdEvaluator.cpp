@@ -0,0 +1,333 @@
+#include "ArrayThresholdEvaluator.hpp"
+
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <tuple>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr int32 k_MissingArrayError = -4010;
+constexpr int32 k_NonScalarArrayError = -4011;
+constexpr int32 k_UnequalTuplesError = -4012;
+constexpr int32 k_UnknownComparisonError = -4013;
+constexpr int32 k_NoThresholdsError = -4014;
+
+/**
+ * @brief Returns true if the set holds at least one ArrayThreshold, directly or in one of its nested sets.
+ */
+bool ContainsThreshold(const ArrayThresholdSet& thresholdSet)
+{
+  for(const std::shared_ptr<IArrayThreshold>& threshold : thresholdSet.getArrayThresholds())
+  {
+    if(std::dynamic_pointer_cast<ArrayThreshold>(threshold) != nullptr)
+    {
+      return true;
+    }
+    auto nestedSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold);
+    if(nestedSet != nullptr && ContainsThreshold(*nestedSet))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+struct CompareBlockFunctor
+{
+  template <typename T>
+  void operator()(const ArrayThresholdEvaluator::Node& node, usize start, usize count, uint8* result)
+  {
+    const auto& dataStore = node.Array->template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto values = std::make_unique<T[]>(count);
+    dataStore.copyIntoBuffer(start, nonstd::span<T>(values.get(), count));
+
+    const T value = static_cast<T>(node.Value);
+    switch(node.Comparison)
+    {
+    case ArrayThreshold::ComparisonType::LessThan: {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] = values[i] < value;
+      }
+      break;
+    }
+    case ArrayThreshold::ComparisonType::GreaterThan: {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] = values[i] > value;
+      }
+      break;
+    }
+    case ArrayThreshold::ComparisonType::Operator_Equal: {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] = values[i] == value;
+      }
+      break;
+    }
+    case ArrayThreshold::ComparisonType::Operator_NotEqual: {
+      for(usize i = 0; i < count; i++)
+      {
+        result[i] = values[i] != value;
+      }
+      break;
+    }
+    }
+  }
+};
+
+template <typename T>
+class FillThresholdMaskImpl
+{
+public:
+  FillThresholdMaskImpl(const ArrayThresholdEvaluator& evaluator, AbstractDataStore<T>& maskStore, T trueValue, T falseValue)
+  : m_Evaluator(evaluator)
+  , m_MaskStore(maskStore)
+  , m_TrueValue(trueValue)
+  , m_FalseValue(falseValue)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    std::vector<uint8> passed(ArrayThresholdEvaluator::k_BlockSize);
+    auto maskValues = std::make_unique<T[]>(ArrayThresholdEvaluator::k_BlockSize);
+    ArrayThresholdEvaluator::Scratch scratch = m_Evaluator.createScratch(ArrayThresholdEvaluator::k_BlockSize);
+    for(usize blockStart = range.min(); blockStart < range.max(); blockStart += ArrayThresholdEvaluator::k_BlockSize)
+    {
+      const usize count = std::min(ArrayThresholdEvaluator::k_BlockSize, range.max() - blockStart);
+      m_Evaluator.evaluate(blockStart, count, passed.data(), scratch);
+      for(usize i = 0; i < count; i++)
+      {
+        maskValues[i] = passed[i] != 0 ? m_TrueValue : m_FalseValue;
+      }
+      m_MaskStore.copyFromBuffer(blockStart, nonstd::span<const T>(maskValues.get(), count));
+    }
+  }
+
+private:
+  const ArrayThresholdEvaluator& m_Evaluator;
+  AbstractDataStore<T>& m_MaskStore;
+  T m_TrueValue;
+  T m_FalseValue;
+};
+
+struct FillThresholdMaskFunctor
+{
+  template <typename T>
+  void operator()(const ArrayThresholdEvaluator& evaluator, IDataArray& maskArray, float64 trueValue, float64 falseValue)
+  {
+    auto& maskStore = maskArray.template getIDataStoreRefAs<AbstractDataStore<T>>();
+
+    IParallelAlgorithm::AlgorithmArrays algorithmArrays = evaluator.getInputArrays();
+    algorithmArrays.push_back(&maskArray);
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, evaluator.getNumberOfTuples());
+    dataAlg.requireArraysInMemory(algorithmArrays);
+    dataAlg.execute(FillThresholdMaskImpl<T>(evaluator, maskStore, static_cast<T>(trueValue), static_cast<T>(falseValue)));
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Result<ArrayThresholdEvaluator> ArrayThresholdEvaluator::Create(const DataStructure& dataStructure, const ArrayThresholdSet& thresholdSet)
+{
+  if(!ContainsThreshold(thresholdSet))
+  {
+    return MakeErrorResult<ArrayThresholdEvaluator>(k_NoThresholdsError, "The threshold set does not contain any array thresholds.");
+  }
+
+  ArrayThresholdEvaluator evaluator;
+  const IDataArray* firstArray = nullptr;
+
+  Node rootNode;
+  rootNode.IsSet = true;
+  rootNode.Inverted = thresholdSet.isInverted();
+  rootNode.UnionOperator = thresholdSet.getUnionOperator();
+  evaluator.m_Nodes.push_back(rootNode);
+
+  // Breadth first so that the children of every set end up next to each other
+  std::deque<std::tuple<usize, ArrayThresholdSet::CollectionType, usize>> pendingSets;
+  pendingSets.emplace_back(0, thresholdSet.getArrayThresholds(), 0);
+  while(!pendingSets.empty())
+  {
+    auto [setIndex, thresholds, depth] = std::move(pendingSets.front());
+    pendingSets.pop_front();
+    evaluator.m_MaxDepth = std::max(evaluator.m_MaxDepth, depth);
+
+    evaluator.m_Nodes[setIndex].FirstChild = evaluator.m_Nodes.size();
+    for(const std::shared_ptr<IArrayThreshold>& threshold : thresholds)
+    {
+      if(auto nestedSet = std::dynamic_pointer_cast<ArrayThresholdSet>(threshold); nestedSet != nullptr)
+      {
+        // Sets without any thresholds do not change the result
+        if(!ContainsThreshold(*nestedSet))
+        {
+          continue;
+        }
+        Node setNode;
+        setNode.IsSet = true;
+        setNode.Inverted = nestedSet->isInverted();
+        setNode.UnionOperator = nestedSet->getUnionOperator();
+        pendingSets.emplace_back(evaluator.m_Nodes.size(), nestedSet->getArrayThresholds(), depth + 1);
+        evaluator.m_Nodes.push_back(setNode);
+        evaluator.m_Nodes[setIndex].NumChildren++;
+        continue;
+      }
+
+      auto arrayThreshold = std::dynamic_pointer_cast<ArrayThreshold>(threshold);
+      if(arrayThreshold == nullptr)
+      {
+        continue;
+      }
+
+      const DataPath arrayPath = arrayThreshold->getArrayPath();
+      const auto* dataArray = dataStructure.getDataAs<IDataArray>(arrayPath);
+      if(dataArray == nullptr)
+      {
+        return MakeErrorResult<ArrayThresholdEvaluator>(k_MissingArrayError, fmt::format("Could not find DataArray at path {}.", arrayPath.toString()));
+      }
+      if(dataArray->getNumberOfComponents() != 1)
+      {
+        return MakeErrorResult<ArrayThresholdEvaluator>(
+            k_NonScalarArrayError, fmt::format("Data Array is not a Scalar Data Array. Data Arrays must only have a single component. '{}:{}'", arrayPath.toString(), dataArray->getNumberOfComponents()));
+      }
+      if(firstArray == nullptr)
+      {
+        firstArray = dataArray;
+        evaluator.m_NumTuples = dataArray->getNumberOfTuples();
+      }
+      else if(dataArray->getNumberOfTuples() != evaluator.m_NumTuples)
+      {
+        return MakeErrorResult<ArrayThresholdEvaluator>(k_UnequalTuplesError, fmt::format("Data Arrays do not have same equal number of tuples. '{}:{}' and '{}:{}'", firstArray->getName(),
+                                                                                          evaluator.m_NumTuples, arrayPath.toString(), dataArray->getNumberOfTuples()));
+      }
+
+      const ArrayThreshold::ComparisonType comparison = arrayThreshold->getComparisonType();
+      if(comparison != ArrayThreshold::ComparisonType::LessThan && comparison != ArrayThreshold::ComparisonType::GreaterThan && comparison != ArrayThreshold::ComparisonType::Operator_Equal &&
+         comparison != ArrayThreshold::ComparisonType::Operator_NotEqual)
+      {
+        return MakeErrorResult<ArrayThresholdEvaluator>(k_UnknownComparisonError, fmt::format("Comparison Operator not understood: '{}'", static_cast<int>(comparison)));
+      }
+
+      Node comparisonNode;
+      comparisonNode.Array = dataArray;
+      comparisonNode.Comparison = comparison;
+      comparisonNode.Value = arrayThreshold->getComparisonValue();
+      comparisonNode.Inverted = arrayThreshold->isInverted();
+      comparisonNode.UnionOperator = arrayThreshold->getUnionOperator();
+      evaluator.m_Nodes.push_back(comparisonNode);
+      evaluator.m_Nodes[setIndex].NumChildren++;
+    }
+  }
+
+  return {std::move(evaluator)};
+}
+
+// -----------------------------------------------------------------------------
+usize ArrayThresholdEvaluator::getNumberOfTuples() const
+{
+  return m_NumTuples;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<const IDataArray*> ArrayThresholdEvaluator::getInputArrays() const
+{
+  std::vector<const IDataArray*> inputArrays;
+  for(const Node& node : m_Nodes)
+  {
+    if(!node.IsSet && std::find(inputArrays.begin(), inputArrays.end(), node.Array) == inputArrays.end())
+    {
+      inputArrays.push_back(node.Array);
+    }
+  }
+  return inputArrays;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<ArrayThresholdEvaluator::Node>& ArrayThresholdEvaluator::getNodes() const
+{
+  return m_Nodes;
+}
+
+// -----------------------------------------------------------------------------
+void ArrayThresholdEvaluator::evaluate(usize start, usize count, uint8* result) const
+{
+  Scratch scratch = createScratch(count);
+  evaluateNode(0, start, count, result, scratch, 0);
+}
+
+// -----------------------------------------------------------------------------
+void ArrayThresholdEvaluator::evaluate(usize start, usize count, uint8* result, Scratch& scratch) const
+{
+  evaluateNode(0, start, count, result, scratch, 0);
+}
+
+// -----------------------------------------------------------------------------
+ArrayThresholdEvaluator::Scratch ArrayThresholdEvaluator::createScratch(usize blockSize) const
+{
+  // One buffer per nesting level holds the result of the child that is being combined into its parent
+  return Scratch(m_MaxDepth + 1, std::vector<uint8>(blockSize));
+}
+
+// -----------------------------------------------------------------------------
+void ArrayThresholdEvaluator::evaluateNode(usize nodeIndex, usize start, usize count, uint8* result, Scratch& scratch, usize depth) const
+{
+  const Node& node = m_Nodes[nodeIndex];
+  if(!node.IsSet)
+  {
+    ExecuteDataFunction(CompareBlockFunctor{}, node.Array->getDataType(), node, start, count, result);
+  }
+  else
+  {
+    uint8* childResult = scratch[depth].data();
+    for(usize child = 0; child < node.NumChildren; child++)
+    {
+      const usize childIndex = node.FirstChild + child;
+      if(child == 0)
+      {
+        evaluateNode(childIndex, start, count, result, scratch, depth + 1);
+        continue;
+      }
+      evaluateNode(childIndex, start, count, childResult, scratch, depth + 1);
+      if(m_Nodes[childIndex].UnionOperator == IArrayThreshold::UnionOperator::Or)
+      {
+        for(usize i = 0; i < count; i++)
+        {
+          result[i] |= childResult[i];
+        }
+      }
+      else
+      {
+        for(usize i = 0; i < count; i++)
+        {
+          result[i] &= childResult[i];
+        }
+      }
+    }
+  }
+
+  if(node.Inverted)
+  {
+    for(usize i = 0; i < count; i++)
+    {
+      result[i] ^= 1;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+void ArrayThresholdEvaluator::fillMask(IDataArray& maskArray, float64 trueValue, float64 falseValue) const
+{
+  ExecuteDataFunction(FillThresholdMaskFunctor{}, maskArray.getDataType(), *this, maskArray, trueValue, falseValue);
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Utilities/ArrayThreshold.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief The ArrayThresholdEvaluator class compiles an ArrayThresholdSet into a flat tree of comparisons that is
+ * evaluated for blocks of tuples at a time.
+ *
+ * Every block is read once from each input array and the whole threshold tree is evaluated for it before the next
+ * block is read, so no full length temporary arrays are needed no matter how many thresholds or nested sets there
+ * are. The children of a set are combined in order: the first child starts the result and every following child
+ * is combined into it with its own union operator. The result of a threshold or set is negated when it is inverted.
+ *
+ * The evaluator only holds pointers to the input arrays and is never modified after it is created, so evaluate()
+ * can be called from any number of threads at the same time.
+ */
+class SIMPLNX_EXPORT ArrayThresholdEvaluator
+{
+public:
+  /**
+   * @brief Number of tuples evaluated at a time by fillMask().
+   */
+  static constexpr usize k_BlockSize = 4096;
+
+  struct Node
+  {
+    const IDataArray* Array = nullptr; // Comparison nodes only
+    ArrayThreshold::ComparisonType Comparison = ArrayThreshold::ComparisonType::GreaterThan;
+    ArrayThreshold::ComparisonValue Value = 0.0;
+    IArrayThreshold::UnionOperator UnionOperator = IArrayThreshold::UnionOperator::And;
+    bool Inverted = false;
+    bool IsSet = false;
+    usize FirstChild = 0; // Set nodes only. The children of a set are stored next to each other
+    usize NumChildren = 0;
+  };
+
+  /**
+   * @brief One buffer per nesting level of the threshold tree that evaluate() combines child results in.
+   */
+  using Scratch = std::vector<std::vector<uint8>>;
+
+  /**
+   * @brief Compiles the threshold set. Fails if an array is missing, is not a scalar array or does not have the
+   * same number of tuples as the other arrays, or if the set does not contain any threshold.
+   * @param dataStructure
+   * @param thresholdSet
+   * @return Result<ArrayThresholdEvaluator>
+   */
+  static Result<ArrayThresholdEvaluator> Create(const DataStructure& dataStructure, const ArrayThresholdSet& thresholdSet);
+
+  /**
+   * @brief Returns the number of tuples of the input arrays.
+   * @return usize
+   */
+  usize getNumberOfTuples() const;
+
+  /**
+   * @brief Returns the input arrays that are read by the evaluator.
+   * @return std::vector<const IDataArray*>
+   */
+  std::vector<const IDataArray*> getInputArrays() const;
+
+  /**
+   * @brief Returns the compiled nodes. The root set is the first node.
+   * @return const std::vector<Node>&
+   */
+  const std::vector<Node>& getNodes() const;
+
+  /**
+   * @brief Evaluates the tuples [start, start + count) and writes 1 (pass) or 0 (fail) for each of them into result.
+   * @param start
+   * @param count
+   * @param result Must hold at least count values
+   */
+  void evaluate(usize start, usize count, uint8* result) const;
+
+  /**
+   * @brief Evaluates the tuples [start, start + count) with caller owned scratch buffers, so a thread that evaluates
+   * many blocks only allocates them once.
+   * @param start
+   * @param count
+   * @param result Must hold at least count values
+   * @param scratch Created by createScratch() with a block size of at least count
+   */
+  void evaluate(usize start, usize count, uint8* result, Scratch& scratch) const;
+
+  /**
+   * @brief Creates the scratch buffers for evaluating blocks of up to blockSize tuples.
+   * @param blockSize
+   * @return Scratch
+   */
+  Scratch createScratch(usize blockSize) const;
+
+  /**
+   * @brief Evaluates every tuple in one parallel pass and writes trueValue or falseValue into the scalar mask array.
+   * @param maskArray Must have the same number of tuples as the input arrays
+   * @param trueValue
+   * @param falseValue
+   */
+  void fillMask(IDataArray& maskArray, float64 trueValue, float64 falseValue) const;
+
+private:
+  ArrayThresholdEvaluator() = default;
+
+  void evaluateNode(usize nodeIndex, usize start, usize count, uint8* result, Scratch& scratch, usize depth) const;
+
+  std::vector<Node> m_Nodes;
+  usize m_MaxDepth = 0;
+  usize m_NumTuples = 0;
+};
+} // namespace nx::core
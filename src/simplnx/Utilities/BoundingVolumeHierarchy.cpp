@@ -0,0 +1,362 @@
+#include "BoundingVolumeHierarchy.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <cmath>
+#include <numeric>
+
+using namespace nx::core;
+
+namespace
+{
+using Bounds = BoundingVolumeHierarchy::Bounds;
+using Node = BoundingVolumeHierarchy::Node;
+using Center = std::array<float32, 3>;
+
+constexpr usize k_NodeCapacity = BoundingVolumeHierarchy::k_NodeCapacity;
+constexpr usize k_SortBlockSize = 16384;
+
+/**
+ * @brief Orders items by the coordinate of their center along one axis. Ties are ordered by item index
+ * so the order is unique.
+ */
+class CenterLess
+{
+public:
+  CenterLess(const std::vector<Center>& centers, usize axis)
+  : m_Centers(centers)
+  , m_Axis(axis)
+  {
+  }
+
+  bool operator()(usize lhs, usize rhs) const
+  {
+    const float32 lhsValue = m_Centers[lhs][m_Axis];
+    const float32 rhsValue = m_Centers[rhs][m_Axis];
+    return lhsValue < rhsValue || (lhsValue == rhsValue && lhs < rhs);
+  }
+
+private:
+  const std::vector<Center>& m_Centers;
+  usize m_Axis = 0;
+};
+
+class SortBlocksImpl
+{
+public:
+  SortBlocksImpl(std::vector<usize>& items, const std::vector<Center>& centers, usize axis)
+  : m_Items(items)
+  , m_Centers(centers)
+  , m_Axis(axis)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      const usize begin = block * k_SortBlockSize;
+      const usize end = std::min(begin + k_SortBlockSize, m_Items.size());
+      std::sort(m_Items.begin() + begin, m_Items.begin() + end, CenterLess(m_Centers, m_Axis));
+    }
+  }
+
+private:
+  std::vector<usize>& m_Items;
+  const std::vector<Center>& m_Centers;
+  usize m_Axis = 0;
+};
+
+class MergeBlocksImpl
+{
+public:
+  MergeBlocksImpl(std::vector<usize>& items, const std::vector<Center>& centers, usize axis, usize width)
+  : m_Items(items)
+  , m_Centers(centers)
+  , m_Axis(axis)
+  , m_Width(width)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize pair = range.min(); pair < range.max(); pair++)
+    {
+      const usize begin = pair * 2 * m_Width;
+      const usize middle = std::min(begin + m_Width, m_Items.size());
+      const usize end = std::min(begin + 2 * m_Width, m_Items.size());
+      std::inplace_merge(m_Items.begin() + begin, m_Items.begin() + middle, m_Items.begin() + end, CenterLess(m_Centers, m_Axis));
+    }
+  }
+
+private:
+  std::vector<usize>& m_Items;
+  const std::vector<Center>& m_Centers;
+  usize m_Axis = 0;
+  usize m_Width = 0;
+};
+
+/**
+ * @brief Sorts all items along one axis by sorting fixed size blocks in parallel and merging
+ * neighboring blocks pairwise in parallel.
+ */
+void SortByCenter(std::vector<usize>& items, const std::vector<Center>& centers, usize axis, bool parallelizationEnabled)
+{
+  const usize numItems = items.size();
+  const usize numBlocks = (numItems + k_SortBlockSize - 1) / k_SortBlockSize;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(parallelizationEnabled);
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.execute(SortBlocksImpl(items, centers, axis));
+
+  for(usize width = k_SortBlockSize; width < numItems; width *= 2)
+  {
+    const usize numPairs = (numItems + 2 * width - 1) / (2 * width);
+    dataAlg.setRange(0, numPairs);
+    dataAlg.execute(MergeBlocksImpl(items, centers, axis, width));
+  }
+}
+
+/**
+ * @brief Sorts each X slab along Y and each Y strip of the slab along Z.
+ */
+class SortSlabsImpl
+{
+public:
+  SortSlabsImpl(std::vector<usize>& items, const std::vector<Center>& centers, usize slabSize, usize stripSize)
+  : m_Items(items)
+  , m_Centers(centers)
+  , m_SlabSize(slabSize)
+  , m_StripSize(stripSize)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize slab = range.min(); slab < range.max(); slab++)
+    {
+      const usize slabBegin = slab * m_SlabSize;
+      const usize slabEnd = std::min(slabBegin + m_SlabSize, m_Items.size());
+      std::sort(m_Items.begin() + slabBegin, m_Items.begin() + slabEnd, CenterLess(m_Centers, 1));
+      for(usize stripBegin = slabBegin; stripBegin < slabEnd; stripBegin += m_StripSize)
+      {
+        const usize stripEnd = std::min(stripBegin + m_StripSize, slabEnd);
+        std::sort(m_Items.begin() + stripBegin, m_Items.begin() + stripEnd, CenterLess(m_Centers, 2));
+      }
+    }
+  }
+
+private:
+  std::vector<usize>& m_Items;
+  const std::vector<Center>& m_Centers;
+  usize m_SlabSize = 0;
+  usize m_StripSize = 0;
+};
+
+/**
+ * @brief Creates one node for every run of k_NodeCapacity consecutive children.
+ */
+class ComputeNodeBoundsImpl
+{
+public:
+  ComputeNodeBoundsImpl(const std::vector<Bounds>& childBounds, std::vector<Node>& nodes, bool isLeaf)
+  : m_ChildBounds(childBounds)
+  , m_Nodes(nodes)
+  , m_IsLeaf(isLeaf)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize nodeIndex = range.min(); nodeIndex < range.max(); nodeIndex++)
+    {
+      const usize first = nodeIndex * k_NodeCapacity;
+      const usize last = std::min(first + k_NodeCapacity, m_ChildBounds.size());
+      Node& node = m_Nodes[nodeIndex];
+      node.Box = m_ChildBounds[first];
+      for(usize child = first + 1; child < last; child++)
+      {
+        for(usize axis = 0; axis < 3; axis++)
+        {
+          node.Box.Min[axis] = std::min(node.Box.Min[axis], m_ChildBounds[child].Min[axis]);
+          node.Box.Max[axis] = std::max(node.Box.Max[axis], m_ChildBounds[child].Max[axis]);
+        }
+      }
+      node.FirstIndex = first;
+      node.Count = static_cast<uint32>(last - first);
+      node.IsLeaf = m_IsLeaf;
+    }
+  }
+
+private:
+  const std::vector<Bounds>& m_ChildBounds;
+  std::vector<Node>& m_Nodes;
+  bool m_IsLeaf = false;
+};
+
+class ComputeTriangleBoundsImpl
+{
+public:
+  ComputeTriangleBoundsImpl(const AbstractDataStore<IGeometry::MeshIndexType>& faces, const AbstractDataStore<float32>& vertices, std::vector<float32>& bounds)
+  : m_Faces(faces)
+  , m_Vertices(vertices)
+  , m_Bounds(bounds)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize triIndex = range.min(); triIndex < range.max(); triIndex++)
+    {
+      const usize v0Index = m_Faces.getValue(triIndex * 3 + 0) * 3;
+      const usize v1Index = m_Faces.getValue(triIndex * 3 + 1) * 3;
+      const usize v2Index = m_Faces.getValue(triIndex * 3 + 2) * 3;
+      for(usize axis = 0; axis < 3; axis++)
+      {
+        const auto [minValue, maxValue] = std::minmax({m_Vertices.getValue(v0Index + axis), m_Vertices.getValue(v1Index + axis), m_Vertices.getValue(v2Index + axis)});
+        m_Bounds[triIndex * 6 + axis] = minValue;
+        m_Bounds[triIndex * 6 + 3 + axis] = maxValue;
+      }
+    }
+  }
+
+private:
+  const AbstractDataStore<IGeometry::MeshIndexType>& m_Faces;
+  const AbstractDataStore<float32>& m_Vertices;
+  std::vector<float32>& m_Bounds;
+};
+
+/**
+ * @brief Returns the Sort-Tile-Recursive order of the items. Consecutive runs of k_NodeCapacity items
+ * in the returned order are spatially close and become the children of one node.
+ */
+std::vector<usize> PackLevel(const std::vector<Bounds>& itemBounds, bool parallelizationEnabled)
+{
+  const usize numItems = itemBounds.size();
+  std::vector<Center> centers(numItems);
+  for(usize item = 0; item < numItems; item++)
+  {
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      centers[item][axis] = 0.5f * (itemBounds[item].Min[axis] + itemBounds[item].Max[axis]);
+    }
+  }
+
+  std::vector<usize> order(numItems);
+  std::iota(order.begin(), order.end(), 0);
+  SortByCenter(order, centers, 0, parallelizationEnabled);
+
+  // Slab and strip sizes are whole multiples of the node capacity so no node spans two strips
+  const usize numNodes = (numItems + k_NodeCapacity - 1) / k_NodeCapacity;
+  const auto numSlabs = static_cast<usize>(std::ceil(std::cbrt(static_cast<float64>(numNodes))));
+  const usize nodesPerSlab = (numNodes + numSlabs - 1) / numSlabs;
+  const usize nodesPerStrip = (nodesPerSlab + numSlabs - 1) / numSlabs;
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(parallelizationEnabled);
+  dataAlg.setRange(0, numSlabs);
+  dataAlg.execute(SortSlabsImpl(order, centers, nodesPerSlab * k_NodeCapacity, nodesPerStrip * k_NodeCapacity));
+
+  return order;
+}
+
+std::vector<Node> CreateParentNodes(const std::vector<Bounds>& childBounds, bool isLeaf, bool parallelizationEnabled)
+{
+  std::vector<Node> nodes((childBounds.size() + k_NodeCapacity - 1) / k_NodeCapacity);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(parallelizationEnabled);
+  dataAlg.setRange(0, nodes.size());
+  dataAlg.execute(ComputeNodeBoundsImpl(childBounds, nodes, isLeaf));
+
+  return nodes;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(const std::vector<float32>& primitiveBounds, bool parallelizationEnabled)
+{
+  const usize numPrimitives = primitiveBounds.size() / 6;
+  if(numPrimitives == 0)
+  {
+    return;
+  }
+
+  std::vector<Bounds> inputBounds(numPrimitives);
+  for(usize primitive = 0; primitive < numPrimitives; primitive++)
+  {
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      inputBounds[primitive].Min[axis] = primitiveBounds[primitive * 6 + axis];
+      inputBounds[primitive].Max[axis] = primitiveBounds[primitive * 6 + 3 + axis];
+    }
+  }
+
+  m_PrimitiveIndices = PackLevel(inputBounds, parallelizationEnabled);
+  m_PrimitiveBounds.resize(numPrimitives);
+  for(usize entry = 0; entry < numPrimitives; entry++)
+  {
+    m_PrimitiveBounds[entry] = inputBounds[m_PrimitiveIndices[entry]];
+  }
+
+  // Build the levels bottom up. The children of every node are stored contiguously in the level below.
+  std::vector<std::vector<Node>> levels;
+  levels.push_back(CreateParentNodes(m_PrimitiveBounds, true, parallelizationEnabled));
+  while(levels.back().size() > 1)
+  {
+    const std::vector<Node>& packedNodes = levels.back();
+    std::vector<Bounds> nodeBounds(packedNodes.size());
+    for(usize nodeIndex = 0; nodeIndex < packedNodes.size(); nodeIndex++)
+    {
+      nodeBounds[nodeIndex] = packedNodes[nodeIndex].Box;
+    }
+
+    const std::vector<usize> order = PackLevel(nodeBounds, parallelizationEnabled);
+    std::vector<Node> sortedNodes(packedNodes.size());
+    std::vector<Bounds> sortedBounds(packedNodes.size());
+    for(usize entry = 0; entry < order.size(); entry++)
+    {
+      sortedNodes[entry] = packedNodes[order[entry]];
+      sortedBounds[entry] = nodeBounds[order[entry]];
+    }
+    levels.back() = std::move(sortedNodes);
+    levels.push_back(CreateParentNodes(sortedBounds, false, parallelizationEnabled));
+  }
+
+  // Flatten the levels root first and turn the child indices of the internal nodes into node indices
+  std::vector<usize> levelOffsets(levels.size(), 0);
+  usize numNodes = 0;
+  for(usize level = levels.size(); level-- > 0;)
+  {
+    levelOffsets[level] = numNodes;
+    numNodes += levels[level].size();
+  }
+  m_Nodes.reserve(numNodes);
+  for(usize level = levels.size(); level-- > 0;)
+  {
+    for(Node node : levels[level])
+    {
+      if(!node.IsLeaf)
+      {
+        node.FirstIndex += levelOffsets[level - 1];
+      }
+      m_Nodes.push_back(node);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+BoundingVolumeHierarchy BoundingVolumeHierarchy::CreateFromTriangles(const AbstractDataStore<IGeometry::MeshIndexType>& faces, const AbstractDataStore<float32>& vertices, bool parallelizationEnabled)
+{
+  const usize numTriangles = faces.getNumberOfTuples();
+  std::vector<float32> triangleBounds(numTriangles * 6, 0.0f);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(parallelizationEnabled);
+  dataAlg.setRange(0, numTriangles);
+  dataAlg.requireStoresInMemory({&faces, &vertices});
+  dataAlg.execute(ComputeTriangleBoundsImpl(faces, vertices, triangleBounds));
+
+  return BoundingVolumeHierarchy(triangleBounds, parallelizationEnabled);
+}
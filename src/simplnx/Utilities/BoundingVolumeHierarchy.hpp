@@ -0,0 +1,322 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/BoundingBox.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/Geometry/IGeometry.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief The BoundingVolumeHierarchy class is an immutable bounding volume hierarchy over a set of
+ * axis aligned primitive bounding boxes.
+ *
+ * The hierarchy is bulk loaded with the Sort-Tile-Recursive (STR) packing: the primitives are sorted into
+ * slabs along X, strips along Y and runs along Z and every run of k_NodeCapacity primitives becomes a leaf.
+ * The same packing is then applied to the nodes of each level until a single root remains. The sorting and
+ * the node bounds are computed in parallel and the packing only depends on the input boxes, so the same
+ * input always produces the same hierarchy.
+ *
+ * All nodes are stored in one flat array (root first) and the hierarchy is never modified after it is
+ * built, so one instance can be queried from any number of threads at the same time.
+ *
+ * Visitors passed to the queries are called as `bool visitor(usize primitiveIndex)` and stop the query
+ * early by returning false. Primitives are visited in no particular order.
+ */
+class SIMPLNX_EXPORT BoundingVolumeHierarchy
+{
+public:
+  /**
+   * @brief Maximum number of children of a node and of primitives in a leaf.
+   */
+  static constexpr usize k_NodeCapacity = 8;
+
+  static constexpr usize k_InvalidIndex = std::numeric_limits<usize>::max();
+
+  struct Bounds
+  {
+    std::array<float32, 3> Min = {0.0f, 0.0f, 0.0f};
+    std::array<float32, 3> Max = {0.0f, 0.0f, 0.0f};
+  };
+
+  struct Node
+  {
+    Bounds Box;
+    usize FirstIndex = 0; // First child node or, for leaves, first entry of the primitive index list
+    uint32 Count = 0;
+    bool IsLeaf = false;
+  };
+
+  struct NearestResult
+  {
+    usize PrimitiveIndex = k_InvalidIndex;
+    float32 SquaredDistance = std::numeric_limits<float32>::max();
+  };
+
+  BoundingVolumeHierarchy() = default;
+
+  /**
+   * @brief Builds the hierarchy.
+   * @param primitiveBounds Bounds of every primitive stored as (minX, minY, minZ, maxX, maxY, maxZ)
+   * @param parallelizationEnabled
+   */
+  explicit BoundingVolumeHierarchy(const std::vector<float32>& primitiveBounds, bool parallelizationEnabled = true);
+
+  ~BoundingVolumeHierarchy() = default;
+
+  BoundingVolumeHierarchy(const BoundingVolumeHierarchy&) = default;
+  BoundingVolumeHierarchy(BoundingVolumeHierarchy&&) noexcept = default;
+  BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy&) = default;
+  BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) noexcept = default;
+
+  /**
+   * @brief Builds a hierarchy over the triangles of a triangle geometry. The primitive index of each
+   * triangle is its face index.
+   * @param faces
+   * @param vertices
+   * @param parallelizationEnabled
+   * @return BoundingVolumeHierarchy
+   */
+  static BoundingVolumeHierarchy CreateFromTriangles(const AbstractDataStore<IGeometry::MeshIndexType>& faces, const AbstractDataStore<float32>& vertices, bool parallelizationEnabled = true);
+
+  /**
+   * @brief Returns the number of primitives in the hierarchy.
+   * @return usize
+   */
+  usize getNumberOfPrimitives() const
+  {
+    return m_PrimitiveIndices.size();
+  }
+
+  /**
+   * @brief Returns the flat node array. The root is the first node.
+   * @return const std::vector<Node>&
+   */
+  const std::vector<Node>& getNodes() const
+  {
+    return m_Nodes;
+  }
+
+  /**
+   * @brief Returns true if the hierarchy holds no primitives.
+   * @return bool
+   */
+  bool empty() const
+  {
+    return m_Nodes.empty();
+  }
+
+  /**
+   * @brief Visits every primitive whose bounding box contains the point. Points on the boundary of a box
+   * are contained by it.
+   * @param point
+   * @param visitor
+   */
+  template <typename VisitorT>
+  void visitContaining(const Point3Df& point, VisitorT&& visitor) const
+  {
+    visitOverlapping(BoundingBox3Df(point, point), visitor);
+  }
+
+  /**
+   * @brief Visits every primitive whose bounding box overlaps the box. Boxes that only touch overlap.
+   * @param box
+   * @param visitor
+   */
+  template <typename VisitorT>
+  void visitOverlapping(const BoundingBox3Df& box, VisitorT&& visitor) const
+  {
+    const Point3Df& boxMin = box.getMinPoint();
+    const Point3Df& boxMax = box.getMaxPoint();
+    auto overlaps = [&boxMin, &boxMax](const Bounds& bounds) {
+      return !(bounds.Min[0] > boxMax[0] || bounds.Max[0] < boxMin[0] || bounds.Min[1] > boxMax[1] || bounds.Max[1] < boxMin[1] || bounds.Min[2] > boxMax[2] || bounds.Max[2] < boxMin[2]);
+    };
+    traverse(overlaps, visitor);
+  }
+
+  /**
+   * @brief Visits every primitive whose bounding box is hit by the segment origin + t * direction with t in [0, tMax].
+   * @param origin
+   * @param direction Does not need to be normalized
+   * @param tMax
+   * @param visitor
+   */
+  template <typename VisitorT>
+  void visitAlongRay(const Point3Df& origin, const Point3Df& direction, float32 tMax, VisitorT&& visitor) const
+  {
+    auto hits = [&origin, &direction, tMax](const Bounds& bounds) {
+      float32 tNear = 0.0f;
+      float32 tFar = tMax;
+      for(usize axis = 0; axis < 3; axis++)
+      {
+        if(direction[axis] == 0.0f)
+        {
+          if(origin[axis] < bounds.Min[axis] || origin[axis] > bounds.Max[axis])
+          {
+            return false;
+          }
+          continue;
+        }
+        const float32 inverse = 1.0f / direction[axis];
+        float32 t0 = (bounds.Min[axis] - origin[axis]) * inverse;
+        float32 t1 = (bounds.Max[axis] - origin[axis]) * inverse;
+        if(t0 > t1)
+        {
+          std::swap(t0, t1);
+        }
+        tNear = std::max(tNear, t0);
+        tFar = std::min(tFar, t1);
+        if(tNear > tFar)
+        {
+          return false;
+        }
+      }
+      return true;
+    };
+    traverse(hits, visitor);
+  }
+
+  /**
+   * @brief Finds the primitive closest to the point.
+   *
+   * The nodes are visited closest box first and any node whose box is farther away than the closest
+   * primitive found so far is skipped. When several primitives are equally close the one with the
+   * lowest primitive index is returned, which is the same result as a linear scan over all primitives.
+   * @param point
+   * @param squaredDistance Called as `float32 squaredDistance(usize primitiveIndex)` and must return the
+   * squared distance between the point and the primitive.
+   * @return NearestResult PrimitiveIndex is k_InvalidIndex if the hierarchy is empty
+   */
+  template <typename DistanceFunctionT>
+  NearestResult findNearest(const Point3Df& point, DistanceFunctionT&& squaredDistance) const
+  {
+    NearestResult nearest;
+    if(m_Nodes.empty())
+    {
+      return nearest;
+    }
+
+    std::array<std::pair<float32, usize>, k_StackSize> stack;
+    usize stackSize = 0;
+    stack[stackSize++] = {SquaredDistanceToBounds(m_Nodes[0].Box, point), 0};
+    while(stackSize > 0)
+    {
+      const auto [nodeDistance, nodeIndex] = stack[--stackSize];
+      if(nodeDistance > nearest.SquaredDistance)
+      {
+        continue;
+      }
+      const Node& node = m_Nodes[nodeIndex];
+      if(node.IsLeaf)
+      {
+        for(usize entry = node.FirstIndex; entry < node.FirstIndex + node.Count; entry++)
+        {
+          const usize primitiveIndex = m_PrimitiveIndices[entry];
+          if(SquaredDistanceToBounds(m_PrimitiveBounds[entry], point) > nearest.SquaredDistance)
+          {
+            continue;
+          }
+          const float32 distance = squaredDistance(primitiveIndex);
+          if(distance < nearest.SquaredDistance || (distance == nearest.SquaredDistance && primitiveIndex < nearest.PrimitiveIndex))
+          {
+            nearest.SquaredDistance = distance;
+            nearest.PrimitiveIndex = primitiveIndex;
+          }
+        }
+        continue;
+      }
+
+      // Push the children farthest first so the closest child is searched next
+      std::array<std::pair<float32, usize>, k_NodeCapacity> children;
+      for(uint32 child = 0; child < node.Count; child++)
+      {
+        const usize childIndex = node.FirstIndex + child;
+        children[child] = {SquaredDistanceToBounds(m_Nodes[childIndex].Box, point), childIndex};
+      }
+      std::sort(children.begin(), children.begin() + node.Count, [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+      for(uint32 child = 0; child < node.Count; child++)
+      {
+        if(children[child].first <= nearest.SquaredDistance)
+        {
+          stack[stackSize++] = children[child];
+        }
+      }
+    }
+    return nearest;
+  }
+
+private:
+  /**
+   * @brief A depth first traversal never holds more than (k_NodeCapacity - 1) entries per level plus one, which
+   * is far below this for any number of primitives that fits in memory.
+   */
+  static constexpr usize k_StackSize = 512;
+
+  static float32 SquaredDistanceToBounds(const Bounds& bounds, const Point3Df& point)
+  {
+    float32 distance = 0.0f;
+    for(usize axis = 0; axis < 3; axis++)
+    {
+      float32 delta = 0.0f;
+      if(point[axis] < bounds.Min[axis])
+      {
+        delta = bounds.Min[axis] - point[axis];
+      }
+      else if(point[axis] > bounds.Max[axis])
+      {
+        delta = point[axis] - bounds.Max[axis];
+      }
+      distance += delta * delta;
+    }
+    return distance;
+  }
+
+  template <typename BoundsTestT, typename VisitorT>
+  void traverse(const BoundsTestT& boundsTest, VisitorT& visitor) const
+  {
+    if(m_Nodes.empty())
+    {
+      return;
+    }
+
+    std::array<usize, k_StackSize> stack;
+    usize stackSize = 0;
+    stack[stackSize++] = 0;
+    while(stackSize > 0)
+    {
+      const Node& node = m_Nodes[stack[--stackSize]];
+      if(!boundsTest(node.Box))
+      {
+        continue;
+      }
+      if(node.IsLeaf)
+      {
+        for(usize entry = node.FirstIndex; entry < node.FirstIndex + node.Count; entry++)
+        {
+          if(boundsTest(m_PrimitiveBounds[entry]) && !visitor(m_PrimitiveIndices[entry]))
+          {
+            return;
+          }
+        }
+        continue;
+      }
+      for(uint32 child = 0; child < node.Count; child++)
+      {
+        stack[stackSize++] = node.FirstIndex + child;
+      }
+    }
+  }
+
+  std::vector<Node> m_Nodes;
+  std::vector<usize> m_PrimitiveIndices;
+  std::vector<Bounds> m_PrimitiveBounds; // Same order as m_PrimitiveIndices
+};
+} // namespace nx::core
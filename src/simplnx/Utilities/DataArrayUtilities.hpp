@@ -2,12 +2,14 @@
 
 #include "simplnx/Common/Array.hpp"
 #include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/ScopeGuard.hpp"
 #include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/DataArray.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/EmptyDataStore.hpp"
 #include "simplnx/DataStructure/IDataStore.hpp"
 #include "simplnx/DataStructure/IO/Generic/DataIOCollection.hpp"
+#include "simplnx/DataStructure/IO/Generic/IOConstants.hpp"
 #include "simplnx/DataStructure/NeighborList.hpp"
 #include "simplnx/DataStructure/StringArray.hpp"
 #include "simplnx/Filter/Actions/CreateArrayAction.hpp"
@@ -16,16 +18,21 @@
 #include "simplnx/Parameters/MultiArraySelectionParameter.hpp"
 #include "simplnx/Utilities/MemoryUtilities.hpp"
 #include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
+#include "simplnx/Utilities/RawVolumeUtilities.hpp"
 #include "simplnx/Utilities/TemplateHelpers.hpp"
 #include "simplnx/simplnx_export.hpp"
 
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 
+#include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <type_traits>
 
 namespace fs = std::filesystem;
 
@@ -376,6 +383,16 @@ std::shared_ptr<AbstractDataStore<T>> CreateDataStore(const typename IDataStore:
     return std::make_unique<EmptyDataStore<T>>(tupleShape, componentShape, dataFormat);
   }
   case IDataAction::Mode::Execute: {
+    if(dataFormat == IOConstants::k_DeferredDataFormat)
+    {
+      // The filter that requested the array sets its store itself
+      return std::make_unique<EmptyDataStore<T>>(tupleShape, componentShape, dataFormat);
+    }
+    if(dataFormat == IOConstants::k_StridedViewDataFormat)
+    {
+      // Arrays created to match a view hold their own values
+      dataFormat.clear();
+    }
     uint64 dataSize = CalculateDataSize<T>(tupleShape, componentShape);
     TryForceLargeDataFormatFromPrefs(dataFormat);
     auto ioCollection = GetIOCollection();
@@ -450,6 +467,10 @@ Result<> CreateArray(DataStructure& dataStructure, const std::vector<usize>& tup
   }
 
   auto store = CreateDataStore<T>(tupleShape, compShape, mode, dataFormat);
+  if(store == nullptr)
+  {
+    return MakeErrorResult(-268, fmt::format("CreateArray: Unable to create DataArray '{}' because no data store of format '{}' can be created.", name, dataFormat));
+  }
   auto dataArray = DataArray<T>::Create(dataStructure, name, store, dataObjectId);
   if(dataArray == nullptr)
   {
@@ -606,52 +627,31 @@ DataArray<T>& ArrayRefFromPath(DataStructure& dataStructure, const DataPath& pat
  * @param binaryFilePath The path to the input file
  * @param outputDataArray The DataArray<T> to store the data read from the file
  * @param startByte The byte offset into the file to start reading the data.
- * @param defaultBufferSize The buffer size that is used when reading.
+ * @param defaultBufferSize The number of values read at a time when the store is not in memory.
+ * @param swapBytes Swap the bytes of the values, which is done in parallel.
  * @return A Result<> type that contains any warnings or errors that occurred.
  */
 template <typename T>
-Result<> ImportFromBinaryFile(const fs::path& binaryFilePath, AbstractDataStore<T>& outputDataArray, usize startByte = 0, usize defaultBufferSize = 1000000)
+Result<> ImportFromBinaryFile(const fs::path& binaryFilePath, AbstractDataStore<T>& outputDataArray, usize startByte = 0, usize defaultBufferSize = 1000000, bool swapBytes = false)
 {
   FILE* inputFilePtr = std::fopen(binaryFilePath.string().c_str(), "rb");
   if(inputFilePtr == nullptr)
   {
-    return MakeErrorResult(-1000, fmt::format("Unable to open the specified file. '{}'", binaryFilePath.string()));
+    return MakeErrorResult(RawVolumeUtilities::k_OpenFileError, fmt::format("Unable to open the specified file. '{}'", binaryFilePath.string()));
   }
+  auto fileGuard = MakeScopeGuard([inputFilePtr]() noexcept { std::fclose(inputFilePtr); });
 
   // Skip some bytes if needed
   if(startByte > 0)
   {
-    FSEEK64(inputFilePtr, static_cast<int32>(startByte), SEEK_SET);
-  }
-
-  const usize numElements = outputDataArray.getSize();
-  // Now start reading the data in chunks if needed.
-  usize chunkSize = std::min(numElements, defaultBufferSize);
-  std::vector<T> buffer(chunkSize);
-
-  usize elementCounter = 0;
-  while(elementCounter < numElements)
-  {
-    usize elementsRead = std::fread(buffer.data(), sizeof(T), chunkSize, inputFilePtr);
-
-    for(usize i = 0; i < elementsRead; i++)
+    Result<> seekResult = RawVolumeUtilities::SeekTo(inputFilePtr, startByte);
+    if(seekResult.invalid())
     {
-      outputDataArray[i + elementCounter] = buffer[i];
-    }
-
-    elementCounter += elementsRead;
-
-    usize elementsLeft = numElements - elementCounter;
-
-    if(elementsLeft < chunkSize)
-    {
-      chunkSize = elementsLeft;
+      return seekResult;
     }
   }
 
-  std::fclose(inputFilePtr);
-
-  return {};
+  return RawVolumeUtilities::ReadValues<T, T>(inputFilePtr, outputDataArray.getSize(), outputDataArray, 0, swapBytes, defaultBufferSize * sizeof(T));
 }
 
 /**
@@ -797,7 +797,7 @@ Result<> ResizeDataArray(DataStructure& dataStructure, const DataPath& arrayPath
   }
 
   // the array's parent is not in an Attribute Matrix, so we can safely reshape to the new tuple shape
-  dataArrayPtr->template getIDataStoreRefAs<DataStore<T>>().resizeTuples(newShape);
+  dataArrayPtr->template getIDataStoreRefAs<AbstractDataStore<T>>().resizeTuples(newShape);
   return {};
 }
 
@@ -1040,8 +1040,91 @@ private:
  */
 namespace CopyFromArray
 {
+namespace detail
+{
+/**
+ * @brief Returns the values of a DataArray that is held in memory or nullptr for any other array or store.
+ */
+template <class K>
+auto* GetInMemoryValues(K& array)
+{
+  using ValueType = typename std::remove_const_t<K>::value_type;
+  if constexpr(std::is_base_of_v<IDataArray, std::remove_const_t<K>>)
+  {
+    using StoreType = std::conditional_t<std::is_const_v<K>, const DataStore<ValueType>, DataStore<ValueType>>;
+    auto* store = dynamic_cast<StoreType*>(array.getDataStore());
+    return store != nullptr ? store->data() : nullptr;
+  }
+  else
+  {
+    return static_cast<std::conditional_t<std::is_const_v<K>, const ValueType*, ValueType*>>(nullptr);
+  }
+}
+
+/**
+ * @brief Returns the arrays that must be in memory for the rows of an append to be copied in parallel.
+ */
+template <class K>
+IParallelAlgorithm::AlgorithmArrays GetAlgorithmArrays(const std::vector<const K*>& inputArrays, const K& destArray)
+{
+  IParallelAlgorithm::AlgorithmArrays arrays;
+  if constexpr(std::is_base_of_v<IDataArray, K>)
+  {
+    arrays.assign(inputArrays.cbegin(), inputArrays.cend());
+    arrays.push_back(&destArray);
+  }
+  return arrays;
+}
+
+/**
+ * @brief Calls rowFunc for every row in [0, numRows) in parallel and returns the first error that is found.
+ */
+template <class FuncT>
+Result<> ForEachRow(const IParallelAlgorithm::AlgorithmArrays& arrays, usize numRows, FuncT&& rowFunc)
+{
+  std::mutex errorMutex;
+  Result<> result;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numRows);
+  dataAlg.requireArraysInMemory(arrays);
+  dataAlg.execute([&](const Range& range) {
+    for(usize row = range.min(); row < range.max(); row++)
+    {
+      Result<> rowResult = rowFunc(row);
+      if(rowResult.invalid())
+      {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if(result.valid())
+        {
+          result = std::move(rowResult);
+        }
+        return;
+      }
+    }
+  });
+  return result;
+}
+
+/**
+ * @brief Swaps count tuples starting at tupleIndex with the count tuples starting at otherTupleIndex. The ranges must not overlap.
+ */
+template <class K>
+void SwapTuples(K& dataArray, usize tupleIndex, usize otherTupleIndex, usize count)
+{
+  const usize numComps = dataArray.getNumberOfComponents();
+  if(auto* values = GetInMemoryValues(dataArray); values != nullptr)
+  {
+    std::swap_ranges(values + tupleIndex * numComps, values + (tupleIndex + count) * numComps, values + otherTupleIndex * numComps);
+    return;
+  }
+  std::swap_ranges(dataArray.begin() + (tupleIndex * numComps), dataArray.begin() + ((tupleIndex + count) * numComps), dataArray.begin() + (otherTupleIndex * numComps));
+}
+} // namespace detail
+
 /**
- * @brief Copies all of the data from the inputArray into the destination array using the given tuple offsets.
+ * @brief Copies all of the data from the inputArray into the destination array using the given tuple offsets. The
+ * ranges may overlap when both are in the same array. DataArrays of trivially copyable values that are held in memory are
+ * copied with a single memmove.
  */
 template <class K>
 Result<> CopyData(const K& inputArray, K& destArray, usize destTupleOffset, usize srcTupleOffset, usize totalSrcTuples)
@@ -1068,14 +1151,68 @@ Result<> CopyData(const K& inputArray, K& destArray, usize destTupleOffset, usiz
     return MakeErrorResult(-2034, fmt::format("The total number of elements to copy ({}) is larger than the total available elements ({}).", elementsToCopy, availableElements));
   }
 
+  if constexpr(std::is_trivially_copyable_v<typename K::value_type>)
+  {
+    const auto* srcValues = detail::GetInMemoryValues(inputArray);
+    auto* destValues = detail::GetInMemoryValues(destArray);
+    if(srcValues != nullptr && destValues != nullptr)
+    {
+      std::memmove(destValues + destTupleOffset * numComponents, srcValues + srcTupleOffset * sourceNumComponents, totalSrcTuples * sourceNumComponents * sizeof(*srcValues));
+      return {};
+    }
+  }
+
   auto srcBegin = inputArray.begin() + (srcTupleOffset * sourceNumComponents);
   auto srcEnd = srcBegin + (totalSrcTuples * sourceNumComponents);
   auto dstBegin = destArray.begin() + (destTupleOffset * numComponents);
-  std::copy(srcBegin, srcEnd, dstBegin);
+  if(&inputArray == &destArray && destTupleOffset > srcTupleOffset)
+  {
+    std::copy_backward(srcBegin, srcEnd, dstBegin + (totalSrcTuples * numComponents));
+  }
+  else
+  {
+    std::copy(srcBegin, srcEnd, dstBegin);
+  }
 
   return {};
 }
 
+namespace detail
+{
+/**
+ * @brief Moves numBlocks consecutive blocks of srcBlockTuples tuples so that they start every destBlockTuples tuples,
+ * where destBlockTuples >= srcBlockTuples. The blocks are moved from the back in waves. Every block of a wave lands
+ * behind the sources of all the blocks of that wave, so a wave is moved in parallel without a second buffer.
+ */
+template <class K>
+Result<> ShiftBlocks(K& dataArray, usize numBlocks, usize srcBlockTuples, usize destBlockTuples)
+{
+  if(srcBlockTuples == destBlockTuples)
+  {
+    return {};
+  }
+
+  const IParallelAlgorithm::AlgorithmArrays arrays = GetAlgorithmArrays<K>({}, dataArray);
+  usize endBlock = numBlocks;
+  // The first block never moves
+  while(endBlock > 1)
+  {
+    const usize firstSafeBlock = (endBlock * srcBlockTuples + destBlockTuples - 1) / destBlockTuples;
+    const usize firstBlock = std::max(std::min(firstSafeBlock, endBlock - 1), static_cast<usize>(1));
+    Result<> result = ForEachRow(arrays, endBlock - firstBlock, [&](usize row) {
+      const usize block = firstBlock + row;
+      return CopyData(dataArray, dataArray, block * destBlockTuples, block * srcBlockTuples, srcBlockTuples);
+    });
+    if(result.invalid())
+    {
+      return result;
+    }
+    endBlock = firstBlock;
+  }
+  return {};
+}
+} // namespace detail
+
 enum class Direction
 {
   X,
@@ -1086,185 +1223,125 @@ enum class Direction
 /**
  * @brief Shifts all of the existing data in the dataArray from its original, smaller location to its new, larger location in the X direction.
  * This function prepares the dataArray so that additional data can be appended in the X direction, and DOES NOT do any bounds checking!
+ * The data is shifted in place, one x row per copy.
  */
 template <class K>
 Result<> ShiftDataX(K& dataArray, const std::vector<usize>& originalDestDims, const std::vector<usize>& newDestDims)
 {
-  auto shiftZDim = static_cast<int64>(newDestDims[0]);
-  auto shiftYDim = static_cast<int64>(newDestDims[1]);
-  auto shiftDestXDim = newDestDims[2];
-  auto shiftSrcXDim = originalDestDims[2];
-
-  for(int64 z = shiftZDim - 1; z >= 0; --z)
-  {
-    for(int64 y = shiftYDim - 1; y >= 0; --y)
-    {
-      usize srcOffset = (z * shiftYDim * shiftSrcXDim) + (y * shiftSrcXDim);
-      usize destOffset = ((z * shiftYDim * shiftDestXDim) + (y * shiftDestXDim));
-      if(srcOffset == destOffset)
-      {
-        continue;
-      }
-
-      auto result = CopyData(dataArray, dataArray, destOffset, srcOffset, shiftSrcXDim);
-      if(result.invalid())
-      {
-        return result;
-      }
-    }
-  }
-
-  return {};
+  return detail::ShiftBlocks(dataArray, newDestDims[0] * newDestDims[1], originalDestDims[2], newDestDims[2]);
 }
 
 /**
  * @brief Shifts all of the existing data in the dataArray from its original, smaller location to its new, larger location in the Y direction.
  * This function prepares the dataArray so that additional data can be appended in the Y direction, and DOES NOT do any bounds checking!
+ * The data is shifted in place, one z slice per copy.
  */
 template <class K>
 Result<> ShiftDataY(K& dataArray, const std::vector<usize>& originalDestDims, const std::vector<usize>& newDestDims)
 {
-  auto shiftZDim = static_cast<int64>(newDestDims[0]);
-  auto shiftDestYDim = newDestDims[1];
-  auto shiftSrcYDim = static_cast<int64>(originalDestDims[1]);
-  auto shiftXDim = newDestDims[2];
-
-  for(int64 z = shiftZDim - 1; z >= 0; --z)
-  {
-    for(int64 y = shiftSrcYDim - 1; y >= 0; --y)
-    {
-      usize srcOffset = (z * shiftSrcYDim * shiftXDim) + (y * shiftXDim);
-      usize destOffset = ((z * shiftDestYDim * shiftXDim) + (y * shiftXDim));
-      if(srcOffset == destOffset)
-      {
-        continue;
-      }
-
-      auto result = CopyData(dataArray, dataArray, destOffset, srcOffset, shiftXDim);
-      if(result.invalid())
-      {
-        return result;
-      }
-    }
-  }
-
-  return {};
+  return detail::ShiftBlocks(dataArray, newDestDims[0], originalDestDims[1] * newDestDims[2], newDestDims[1] * newDestDims[2]);
 }
 
 /**
  * @brief Appends all of the data from the inputArrays into the destArray using the given inputTupleShapes and offset. This function DOES NOT do any bounds checking!
+ * The (z, y) rows are copied in parallel.
  */
 template <class K>
 Result<> AppendDataX(const std::vector<const K*>& inputArrays, const std::vector<std::vector<usize>>& inputTupleShapes, K& destArray, const std::vector<usize>& newDestDims, usize offset,
                      bool mirror = false)
 {
-  auto appendZDim = static_cast<int64>(newDestDims[0]);
-  auto appendYDim = static_cast<int64>(newDestDims[1]);
-  auto appendDestXDim = newDestDims[2];
+  const usize appendYDim = newDestDims[1];
+  const usize appendDestXDim = newDestDims[2];
 
   // Copy the input arrays into the destination array
-  for(int z = 0; z < appendZDim; ++z)
-  {
-    for(int y = 0; y < appendYDim; ++y)
+  return detail::ForEachRow(detail::GetAlgorithmArrays(inputArrays, destArray), newDestDims[0] * appendYDim, [&](usize row) -> Result<> {
+    const usize destRowOffset = row * appendDestXDim;
+    usize xOffset = offset;
+    for(usize i = 0; i < inputArrays.size(); ++i)
     {
-      usize xOffset = offset;
-      for(usize i = 0; i < inputArrays.size(); ++i)
+      auto appendSrcXDim = inputTupleShapes[i][2];
+      auto result = CopyData(*inputArrays[i], destArray, destRowOffset + xOffset, row * appendSrcXDim, appendSrcXDim);
+      if(result.invalid())
       {
-        const K& inputArray = *inputArrays[i];
-        auto appendSrcXDim = inputTupleShapes[i][2];
-        usize srcOffset = (z * appendYDim * appendSrcXDim) + (y * appendSrcXDim);
-        usize destOffset = ((z * appendYDim * appendDestXDim) + (y * appendDestXDim) + xOffset);
-        auto result = CopyData(inputArray, destArray, destOffset, srcOffset, appendSrcXDim);
-        if(result.invalid())
-        {
-          return result;
-        }
-        xOffset += inputTupleShapes[i][2];
+        return result;
       }
+      xOffset += appendSrcXDim;
+    }
 
-      // Mirror the array along the X axis if the mirror flag is true
-      if(mirror)
+    // Mirror the array along the X axis if the mirror flag is true
+    if(mirror)
+    {
+      for(usize x = 0; x < appendDestXDim / 2; ++x)
       {
-        auto numComps = destArray.getNumberOfComponents();
-        for(usize x = 0; x < appendDestXDim / 2; ++x)
-        {
-          usize tupleIdx = (z * appendYDim * appendDestXDim) + (y * appendDestXDim) + x;
-          usize endTupleIdx = tupleIdx + 1;
-          usize mirrorTupleIdx = (z * appendYDim * appendDestXDim) + (y * appendDestXDim) + (appendDestXDim - 1 - x);
-          std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
-        }
+        detail::SwapTuples(destArray, destRowOffset + x, destRowOffset + (appendDestXDim - 1 - x), 1);
       }
     }
-  }
-
-  return {};
+    return {};
+  });
 }
 
 /**
  * @brief Appends all of the data from the inputArrays into the destArray using the given inputTupleShapes and offset. This function DOES NOT do any bounds checking!
+ * The x rows of each input array are copied in parallel.
  */
 template <class K>
 Result<> AppendDataY(const std::vector<const K*>& inputArrays, const std::vector<std::vector<usize>>& inputTupleShapes, K& destArray, const std::vector<usize>& newDestDims, usize offset,
                      bool mirror = false)
 {
-  auto appendZDim = static_cast<int64>(newDestDims[0]);
-  auto appendDestYDim = newDestDims[1];
-  auto appendXDim = static_cast<int64>(newDestDims[2]);
+  const usize appendZDim = newDestDims[0];
+  const usize appendDestYDim = newDestDims[1];
+  const usize appendXDim = newDestDims[2];
+  const IParallelAlgorithm::AlgorithmArrays arrays = detail::GetAlgorithmArrays(inputArrays, destArray);
 
   // Copy the input arrays into the destination array
   usize yOffset = offset;
   for(usize i = 0; i < inputArrays.size(); ++i)
   {
-    auto appendSrcYDim = inputTupleShapes[i][1];
-    for(int z = 0; z < appendZDim; ++z)
+    const usize appendSrcYDim = inputTupleShapes[i][1];
+    Result<> result = detail::ForEachRow(arrays, appendZDim * appendSrcYDim, [&](usize row) {
+      const usize z = row / appendSrcYDim;
+      const usize y = row % appendSrcYDim;
+      const usize destOffset = ((z * appendDestYDim) + y + yOffset) * appendXDim;
+      return CopyData(*inputArrays[i], destArray, destOffset, row * appendXDim, appendXDim);
+    });
+    if(result.invalid())
     {
-      for(int y = 0; y < appendSrcYDim; ++y)
-      {
-        const K* inputArray = inputArrays[i];
-        usize srcOffset = ((z * appendSrcYDim * appendXDim) + (y * appendXDim));
-        usize destOffset = ((z * appendDestYDim * appendXDim) + ((y + yOffset) * appendXDim));
-        auto result = CopyData(*inputArray, destArray, destOffset, srcOffset, appendXDim);
-        if(result.invalid())
-        {
-          return result;
-        }
-      }
+      return result;
     }
-    yOffset += inputTupleShapes[i][1];
+    yOffset += appendSrcYDim;
   }
 
-  // Mirror the array along the Y axis if the mirror flag is true
+  // Mirror the array along the Y axis if the mirror flag is true by swapping whole x rows
   if(mirror)
   {
-    auto numComps = destArray.getNumberOfComponents();
-    for(int z = 0; z < appendZDim; ++z)
-    {
-      for(int x = 0; x < appendXDim; ++x)
-      {
-        for(int y = 0; y < appendDestYDim / 2; ++y)
-        {
-          usize tupleIdx = (z * appendDestYDim * appendXDim) + (y * appendXDim) + x;
-          usize endTupleIdx = tupleIdx + 1;
-          usize mirrorTupleIdx = (z * appendDestYDim * appendXDim) + ((appendDestYDim - 1 - y) * appendXDim) + x;
-          std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
-        }
-      }
-    }
+    const usize halfYDim = appendDestYDim / 2;
+    return detail::ForEachRow(arrays, appendZDim * halfYDim, [&](usize row) -> Result<> {
+      const usize z = row / halfYDim;
+      const usize y = row % halfYDim;
+      detail::SwapTuples(destArray, ((z * appendDestYDim) + y) * appendXDim, ((z * appendDestYDim) + (appendDestYDim - 1 - y)) * appendXDim, appendXDim);
+      return {};
+    });
   }
 
   return {};
 }
 
+/**
+ * @brief Appends all of the data from the inputArrays into the destArray using the given inputTupleShapes and offset. This function DOES NOT do any bounds checking!
+ * The z slices of each input array are copied in parallel.
+ */
 template <class K>
 Result<> AppendDataZ(const std::vector<const K*>& inputArrays, const std::vector<std::vector<usize>>& inputTupleShapes, K& destArray, const std::vector<usize>& newDestDims, usize offset,
                      bool mirror = false)
 {
+  const IParallelAlgorithm::AlgorithmArrays arrays = detail::GetAlgorithmArrays(inputArrays, destArray);
+
   usize destOffset = offset;
   for(usize i = 0; i < inputArrays.size(); ++i)
   {
-    const K* inputArray = inputArrays[i];
-    auto totalInputTuples = std::accumulate(inputTupleShapes[i].begin(), inputTupleShapes[i].end(), static_cast<usize>(1), std::multiplies<>());
-    auto result = CopyData(*inputArray, destArray, destOffset, 0, totalInputTuples);
+    const usize sliceTuples = inputTupleShapes[i][1] * inputTupleShapes[i][2];
+    const usize totalInputTuples = inputTupleShapes[i][0] * sliceTuples;
+    Result<> result = detail::ForEachRow(arrays, inputTupleShapes[i][0], [&](usize slice) { return CopyData(*inputArrays[i], destArray, destOffset + slice * sliceTuples, slice * sliceTuples, sliceTuples); });
     if(result.invalid())
     {
       return result;
@@ -1275,16 +1352,12 @@ Result<> AppendDataZ(const std::vector<const K*>& inputArrays, const std::vector
   // Mirror the array along the Z axis if the mirror flag is true
   if(mirror)
   {
-    auto appendDestZDim = newDestDims[0];
-    auto sliceTupleCount = newDestDims[1] * newDestDims[2];
-    auto numComps = destArray.getNumberOfComponents();
-    for(int i = 0; i < appendDestZDim / 2; ++i)
-    {
-      usize tupleIdx = i * sliceTupleCount;
-      usize endTupleIdx = tupleIdx + sliceTupleCount;
-      usize mirrorTupleIdx = (appendDestZDim - 1 - i) * sliceTupleCount;
-      std::swap_ranges(destArray.begin() + (tupleIdx * numComps), destArray.begin() + (endTupleIdx * numComps), destArray.begin() + (mirrorTupleIdx * numComps));
-    }
+    const usize appendDestZDim = newDestDims[0];
+    const usize sliceTupleCount = newDestDims[1] * newDestDims[2];
+    return detail::ForEachRow(arrays, appendDestZDim / 2, [&](usize z) -> Result<> {
+      detail::SwapTuples(destArray, z * sliceTupleCount, (appendDestZDim - 1 - z) * sliceTupleCount, sliceTupleCount);
+      return {};
+    });
   }
 
   return {};
@@ -1789,7 +1862,20 @@ inline void RunCombineBoolAppend(IArray& destCellArray, const std::vector<const
 inline void RunBoolCopyUsingIndexList(IArray& destCellArray, const IArray& inputCellArray, const nonstd::span<const int64>& newToOldIndices)
 {
   using DataArrayType = DataArray<bool>;
-  CopyUsingIndexList<DataArrayType>(*dynamic_cast<DataArrayType*>(&destCellArray), *dynamic_cast<const DataArrayType*>(&inputCellArray), newToOldIndices);
+  auto& destArray = dynamic_cast<DataArrayType&>(destCellArray);
+  const auto& inputArray = dynamic_cast<const DataArrayType&>(inputCellArray);
+  for(usize i = 0; i < newToOldIndices.size(); i++)
+  {
+    const int64 oldIndexI = newToOldIndices[i];
+    if(oldIndexI >= 0)
+    {
+      CopyData<DataArrayType>(inputArray, destArray, i, oldIndexI, 1);
+    }
+    else
+    {
+      destArray.initializeTuple(i, false);
+    }
+  }
 }
 
 /**
@@ -1840,6 +1926,7 @@ void RunParallelCombine(IArray& destArray, ParallelRunnerT&& runner, ArgsT&&...
     if(dataType == DataType::boolean)
     {
       RunCombineBoolAppend(destArray, std::forward<ArgsT>(args)...);
+      return;
     }
   }
 
@@ -1863,7 +1950,7 @@ void RunParallelCopyUsingIndexList(IArray& destArray, ParallelRunnerT&& runner,
     dataType = dynamic_cast<IDataArray*>(&destArray)->getDataType();
     if(dataType == DataType::boolean)
     {
-      RunBoolCopyUsingIndexList(destArray, std::forward<ArgsT>(args)...);
+      return RunBoolCopyUsingIndexList(destArray, std::forward<ArgsT>(args)...);
     }
   }
 
@@ -2,6 +2,9 @@
 
 #include "simplnx/DataStructure/AttributeMatrix.hpp"
 #include "simplnx/DataStructure/BaseGroup.hpp"
+#include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 namespace nx::core
 {
@@ -36,63 +39,70 @@ bool RemoveInactiveObjects(DataStructure& dataStructure, const DataPath& feature
   size_t totalTuples = currentFeatureCount;
   if(activeObjects.size() == totalTuples)
   {
-    size_t goodCount = 1;
-    std::vector<size_t> newNames(totalTuples, 0);
-    std::vector<size_t> removeList;
-    std::vector<size_t> keepList;
-    keepList.reserve(activeObjects.size());
-
-    for(int32_t i = 1; i < activeObjects.size(); i++)
+    // Old to new feature ids and, for the compaction, the old id of every kept feature in order
+    std::vector<int32> newNames(totalTuples, 0);
+    std::vector<int64> newToOldIndices = {0};
+    newToOldIndices.reserve(activeObjects.size());
+    for(usize i = 1; i < activeObjects.size(); i++)
     {
       if(activeObjects[i])
       {
-        newNames[i] = goodCount;
-        goodCount++;
-        keepList.push_back(i);
-      }
-      else
-      {
-        removeList.push_back(i);
-        newNames[i] = 0;
+        newNames[i] = static_cast<int32>(newToOldIndices.size());
+        newToOldIndices.push_back(static_cast<int64>(i));
       }
     }
 
-    std::vector<usize> newShape = {keepList.size() + 1};
-    if(!removeList.empty())
+    std::vector<usize> newShape = {newToOldIndices.size()};
+    if(newToOldIndices.size() < activeObjects.size())
     {
+      // Every array is compacted "in place" by its own task. This works because the kept indices are sorted lowest to
+      // highest, so values are only ever copied from further in the array to the front of the array.
+      ParallelTaskAlgorithm taskRunner;
+      IParallelAlgorithm::AlgorithmArrays algorithmArrays;
+      algorithmArrays.reserve(matchingDataArrayPtrs.size());
+      for(const auto& dataArray : matchingDataArrayPtrs)
+      {
+        algorithmArrays.push_back(dataArray.get());
+      }
+      taskRunner.requireArraysInMemory(algorithmArrays);
       for(const auto& dataArray : matchingDataArrayPtrs)
       {
         if(shouldCancel)
         {
-          return false;
-        }
-        // Do the update "in place". This works because the keepList _should_ be sorted lowest to
-        // highest. So we are constantly grabbing values from further in the array and copying
-        // them to location to the front of the array.
-        size_t destIdx = 1;
-        for(const auto& keepIdx : keepList)
-        {
-          dataArray->copyTuple(keepIdx, destIdx);
-          destIdx++;
+          break;
         }
-        // Now chop off the end of the copy and modified array
-        // dataArray->getIDataStore()->resizeTuples(newShape);
+        CopyFromArray::RunParallelCopyUsingIndexList(*dataArray, taskRunner, *dataArray, nonstd::span<const int64>(newToOldIndices));
       }
-
-      // Loop over all the points and correct all the feature names
-      size_t totalPoints = cellFeatureIds.getNumberOfTuples();
-      bool featureIdsChanged = false;
-      for(size_t i = 0; i < totalPoints; i++)
+      taskRunner.wait();
+      if(shouldCancel)
       {
-        if(cellFeatureIds[i] >= 0 && cellFeatureIds[i] < newNames.size())
+        return false;
+      }
+
+      // Correct all the feature names
+      std::atomic_bool featureIdsChanged = false;
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setRange(0, cellFeatureIds.getNumberOfTuples());
+      dataAlg.requireStoresInMemory({&cellFeatureIds});
+      dataAlg.execute([&](const Range& range) {
+        bool changed = false;
+        for(usize i = range.min(); i < range.max(); i++)
         {
-          cellFeatureIds[i] = static_cast<int32_t>(newNames[cellFeatureIds[i]]);
-          featureIdsChanged = true;
+          const int32 featureId = cellFeatureIds.getValue(i);
+          if(featureId >= 0 && static_cast<usize>(featureId) < newNames.size())
+          {
+            cellFeatureIds.setValue(i, newNames[featureId]);
+            changed = true;
+          }
         }
-        if(shouldCancel)
+        if(changed)
         {
-          return false;
+          featureIdsChanged = true;
         }
+      });
+      if(shouldCancel)
+      {
+        return false;
       }
 
       if(featureIdsChanged)
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Range3D.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/Utilities/ParallelData3DAlgorithm.hpp"
+
+#include <array>
+
+namespace nx::core
+{
+/**
+ * @brief The FaceNeighborStencil class visits the six face neighbors of a voxel in an image geometry.
+ *
+ * The neighbors are always visited in the order -Z, -Y, -X, +X, +Y, +Z, which is ascending voxel index order and the
+ * order the serial filters have always used. Neighbors outside of the geometry and neighbors along a disabled
+ * direction are skipped. Whether two voxels are neighbors is symmetric, so a pass that scatters into its neighbors
+ * can always be rewritten as a pass that gathers from them.
+ */
+class FaceNeighborStencil
+{
+public:
+  FaceNeighborStencil(const SizeVec3& dims, bool xDirOn = true, bool yDirOn = true, bool zDirOn = true)
+  : m_Dims(dims)
+  , m_PlaneSize(dims[0] * dims[1])
+  , m_XDirOn(xDirOn)
+  , m_YDirOn(yDirOn)
+  , m_ZDirOn(zDirOn)
+  {
+  }
+
+  /**
+   * @brief Returns the dimensions of the image geometry.
+   * @return SizeVec3
+   */
+  const SizeVec3& getDimensions() const
+  {
+    return m_Dims;
+  }
+
+  /**
+   * @brief Returns the number of voxels in the image geometry.
+   * @return usize
+   */
+  usize getNumberOfVoxels() const
+  {
+    return m_PlaneSize * m_Dims[2];
+  }
+
+  /**
+   * @brief Returns the voxel index of the given position.
+   * @return usize
+   */
+  usize getIndex(usize xIndex, usize yIndex, usize zIndex) const
+  {
+    return zIndex * m_PlaneSize + yIndex * m_Dims[0] + xIndex;
+  }
+
+  /**
+   * @brief Calls visitor(neighborIndex) for every enabled neighbor of the voxel in -Z, -Y, -X, +X, +Y, +Z order.
+   */
+  template <typename VisitorT>
+  void forEachNeighbor(usize xIndex, usize yIndex, usize zIndex, VisitorT&& visitor) const
+  {
+    const usize index = getIndex(xIndex, yIndex, zIndex);
+    if(m_ZDirOn && zIndex > 0)
+    {
+      visitor(index - m_PlaneSize);
+    }
+    if(m_YDirOn && yIndex > 0)
+    {
+      visitor(index - m_Dims[0]);
+    }
+    if(m_XDirOn && xIndex > 0)
+    {
+      visitor(index - 1);
+    }
+    if(m_XDirOn && xIndex + 1 < m_Dims[0])
+    {
+      visitor(index + 1);
+    }
+    if(m_YDirOn && yIndex + 1 < m_Dims[1])
+    {
+      visitor(index + m_Dims[0]);
+    }
+    if(m_ZDirOn && zIndex + 1 < m_Dims[2])
+    {
+      visitor(index + m_PlaneSize);
+    }
+  }
+
+  /**
+   * @brief Calls body(xIndex, yIndex, zIndex, index) for every voxel of the range in index order.
+   */
+  template <typename BodyT>
+  void forEachVoxel(const Range3D& range, BodyT&& body) const
+  {
+    for(usize zIndex = range[4]; zIndex < range[5]; zIndex++)
+    {
+      for(usize yIndex = range[2]; yIndex < range[3]; yIndex++)
+      {
+        const usize rowStart = getIndex(0, yIndex, zIndex);
+        for(usize xIndex = range[0]; xIndex < range[1]; xIndex++)
+        {
+          body(xIndex, yIndex, zIndex, rowStart + xIndex);
+        }
+      }
+    }
+  }
+
+private:
+  SizeVec3 m_Dims;
+  usize m_PlaneSize = 0;
+  bool m_XDirOn = true;
+  bool m_YDirOn = true;
+  bool m_ZDirOn = true;
+};
+
+/**
+ * @brief The FeatureVote class counts the features of the neighbors of a single voxel.
+ *
+ * It replaces the global per feature counter that the serial filters reset after every voxel, so each thread can
+ * vote on its own. add() returns the number of times the feature has been added, so the caller keeps the first
+ * neighbor that reaches a new maximum exactly like the serial filters do.
+ */
+class FeatureVote
+{
+public:
+  /**
+   * @brief Adds one vote for the feature and returns the number of votes it has.
+   * @param feature
+   * @return int32
+   */
+  int32 add(int32 feature)
+  {
+    for(usize i = 0; i < m_Size; i++)
+    {
+      if(m_Features[i] == feature)
+      {
+        return ++m_Counts[i];
+      }
+    }
+    m_Features[m_Size] = feature;
+    m_Counts[m_Size] = 1;
+    m_Size++;
+    return 1;
+  }
+
+  /**
+   * @brief Removes all votes.
+   */
+  void clear()
+  {
+    m_Size = 0;
+  }
+
+private:
+  std::array<int32, 6> m_Features = {};
+  std::array<int32, 6> m_Counts = {};
+  usize m_Size = 0;
+};
+
+/**
+ * @brief Runs pass(xIndex, yIndex, zIndex, index) for every voxel of the image geometry in parallel. The pass must
+ * only write to the voxel it is called for and must not read anything that another voxel writes in the same pass.
+ * @param stencil
+ * @param pass
+ * @param algorithmArrays Arrays that are read or written by the pass
+ */
+template <typename PassT>
+void ExecuteStencilPass(const FaceNeighborStencil& stencil, const PassT& pass, const IParallelAlgorithm::AlgorithmArrays& algorithmArrays)
+{
+  class StencilPassImpl
+  {
+  public:
+    StencilPassImpl(const FaceNeighborStencil& stencil, const PassT& pass)
+    : m_Stencil(stencil)
+    , m_Pass(pass)
+    {
+    }
+
+    void operator()(const Range3D& range) const
+    {
+      m_Stencil.forEachVoxel(range, m_Pass);
+    }
+
+  private:
+    const FaceNeighborStencil& m_Stencil;
+    const PassT& m_Pass;
+  };
+
+  const SizeVec3& dims = stencil.getDimensions();
+  ParallelData3DAlgorithm dataAlg;
+  dataAlg.setRange(Range3D(0, dims[0], 0, dims[1], 0, dims[2]));
+  dataAlg.requireArraysInMemory(algorithmArrays);
+  dataAlg.execute(StencilPassImpl(stencil, pass));
+}
+} // namespace nx::core
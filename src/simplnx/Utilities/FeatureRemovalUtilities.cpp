@@ -0,0 +1,177 @@
+#include "FeatureRemovalUtilities.hpp"
+
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+using namespace nx::core;
+
+namespace
+{
+// Roughly the number of voxels that are voted on by one block of the plan
+constexpr usize k_VoxelsPerBlock = 1024 * 1024;
+
+usize FindFillSourcesInSlices(const Int32AbstractDataStore& featureIds, const SizeVec3& dimensions, FeatureRemovalUtilities::FillVote vote, usize firstSlice, usize endSlice,
+                              std::vector<FeatureRemovalUtilities::FillPair>& pairs)
+{
+  const auto dimX = static_cast<int64>(dimensions[0]);
+  const auto dimY = static_cast<int64>(dimensions[1]);
+  const auto dimZ = static_cast<int64>(dimensions[2]);
+  const std::array<int64, 6> neighborOffsets = {-dimX * dimY, -dimX, -1, 1, dimX, dimX * dimY};
+
+  usize numBadVoxels = 0;
+  for(int64 k = static_cast<int64>(firstSlice); k < static_cast<int64>(endSlice); k++)
+  {
+    for(int64 j = 0; j < dimY; j++)
+    {
+      for(int64 i = 0; i < dimX; i++)
+      {
+        const int64 voxelIndex = (k * dimY + j) * dimX + i;
+        if(featureIds.getValue(voxelIndex) >= 0)
+        {
+          continue;
+        }
+        numBadVoxels++;
+
+        const std::array<bool, 6> hasNeighbor = {k > 0, j > 0, i > 0, i < dimX - 1, j < dimY - 1, k < dimZ - 1};
+        std::array<int32, 6> features = {};
+        std::array<int32, 6> hits = {};
+        usize numFeatures = 0;
+        int32 most = 0;
+        int64 source = -1;
+        for(usize l = 0; l < neighborOffsets.size(); l++)
+        {
+          if(!hasNeighbor[l])
+          {
+            continue;
+          }
+          const int64 neighborIndex = voxelIndex + neighborOffsets[l];
+          const int32 feature = featureIds.getValue(neighborIndex);
+          if(feature < 0)
+          {
+            continue;
+          }
+          const usize featureIndex = std::find(features.begin(), features.begin() + numFeatures, feature) - features.begin();
+          if(featureIndex == numFeatures)
+          {
+            features[numFeatures++] = feature;
+            if(vote == FeatureRemovalUtilities::FillVote::RepeatedNeighbor)
+            {
+              continue;
+            }
+          }
+          hits[featureIndex]++;
+          if(hits[featureIndex] > most)
+          {
+            most = hits[featureIndex];
+            source = neighborIndex;
+          }
+        }
+        if(source >= 0)
+        {
+          pairs.push_back({static_cast<usize>(voxelIndex), static_cast<usize>(source)});
+        }
+      }
+    }
+  }
+  return numBadVoxels;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+usize FeatureRemovalUtilities::FindFillSources(const Int32AbstractDataStore& featureIds, const SizeVec3& dimensions, FillVote vote, FillPlan& plan, const std::atomic_bool& shouldCancel)
+{
+  const usize sliceSize = std::max(dimensions[0] * dimensions[1], static_cast<usize>(1));
+  const usize slicesPerBlock = std::max(k_VoxelsPerBlock / sliceSize, static_cast<usize>(1));
+  const usize numBlocks = (dimensions[2] + slicesPerBlock - 1) / slicesPerBlock;
+
+  plan.resize(numBlocks);
+  std::vector<usize> numBadVoxels(numBlocks, 0);
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numBlocks);
+  dataAlg.requireStoresInMemory({&featureIds});
+  dataAlg.execute([&](const Range& range) {
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      plan[block].clear();
+      if(shouldCancel)
+      {
+        continue;
+      }
+      const usize firstSlice = block * slicesPerBlock;
+      numBadVoxels[block] = FindFillSourcesInSlices(featureIds, dimensions, vote, firstSlice, std::min(firstSlice + slicesPerBlock, dimensions[2]), plan[block]);
+    }
+  });
+
+  return std::accumulate(numBadVoxels.cbegin(), numBadVoxels.cend(), static_cast<usize>(0));
+}
+
+// -----------------------------------------------------------------------------
+void FeatureRemovalUtilities::ApplyFillPlan(const FillPlan& plan, Int32AbstractDataStore& featureIds, const std::vector<std::shared_ptr<IDataArray>>& voxelArrays, const std::atomic_bool& shouldCancel)
+{
+  // The feature ids are filled on their own, so they are skipped if they are also one of the voxel arrays
+  std::vector<IDataArray*> otherArrays;
+  IParallelAlgorithm::AlgorithmStores stores = {&featureIds};
+  for(const auto& voxelArray : voxelArrays)
+  {
+    if(voxelArray == nullptr || voxelArray->getIDataStore() == &featureIds)
+    {
+      continue;
+    }
+    otherArrays.push_back(voxelArray.get());
+    stores.push_back(voxelArray->getIDataStore());
+  }
+
+  const usize numComponents = featureIds.getNumberOfComponents();
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, plan.size());
+  dataAlg.requireStoresInMemory(stores);
+  dataAlg.execute([&](const Range& range) {
+    for(usize block = range.min(); block < range.max(); block++)
+    {
+      if(shouldCancel)
+      {
+        return;
+      }
+      for(const auto& pair : plan[block])
+      {
+        for(usize comp = 0; comp < numComponents; comp++)
+        {
+          featureIds.setValue(pair.Destination * numComponents + comp, featureIds.getValue(pair.Source * numComponents + comp));
+        }
+        for(auto* voxelArray : otherArrays)
+        {
+          voxelArray->copyTuple(pair.Source, pair.Destination);
+        }
+      }
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+usize FeatureRemovalUtilities::FillRemovedVoxels(Int32AbstractDataStore& featureIds, const SizeVec3& dimensions, FillVote vote, const std::vector<std::shared_ptr<IDataArray>>& voxelArrays,
+                                                 const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel)
+{
+  FillPlan plan;
+  usize pass = 0;
+  while(!shouldCancel)
+  {
+    pass++;
+    const usize numBadVoxels = FindFillSources(featureIds, dimensions, vote, plan, shouldCancel);
+    const usize numFilled = std::accumulate(plan.cbegin(), plan.cend(), static_cast<usize>(0), [](usize total, const auto& pairs) { return total + pairs.size(); });
+    if(numBadVoxels == 0 || numFilled == 0 || shouldCancel)
+    {
+      return numBadVoxels;
+    }
+
+    messageHandler(IFilter::Message{IFilter::Message::Type::Info, fmt::format("Fill pass {}: Filling {} of {} voxels...", pass, numFilled, numBadVoxels)});
+    ApplyFillPlan(plan, featureIds, voxelArrays, shouldCancel);
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/IDataArray.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nx::core::FeatureRemovalUtilities
+{
+/**
+ * @brief How the face neighbors of a removed voxel vote for the voxel it is filled from.
+ */
+enum class FillVote : uint8
+{
+  MostCommonNeighbor = 0, ///< Every face neighbor that belongs to a feature is a vote (Require Minimum Size)
+  RepeatedNeighbor = 1    ///< A feature only gets votes from its second face neighbor on (Remove Flagged Features)
+};
+
+/**
+ * @brief A voxel to fill and the voxel whose tuples it receives.
+ */
+struct FillPair
+{
+  usize Destination = 0;
+  usize Source = 0;
+};
+
+/**
+ * @brief The fill pairs of one pass, grouped by blocks of Z slices in voxel order.
+ */
+using FillPlan = std::vector<std::vector<FillPair>>;
+
+/**
+ * @brief Finds a source for every voxel with a negative feature id. The source is the face neighbor whose feature
+ * is most common among the 6 face neighbors that belong to a feature (id >= 0). Ties go to the neighbor that reached
+ * the count first in the order -Z, -Y, -X, +X, +Y, +Z. With FillVote::RepeatedNeighbor a voxel whose neighboring
+ * features are all different gets no source in this pass. The feature ids are only read, so the slices are voted on
+ * in parallel and the plan does not depend on the number of threads.
+ * @param featureIds
+ * @param dimensions X, Y, Z dimensions of the image geometry
+ * @param vote
+ * @param plan Receives the fill pairs
+ * @param shouldCancel
+ * @return usize The number of voxels with a negative feature id
+ */
+SIMPLNX_EXPORT usize FindFillSources(const Int32AbstractDataStore& featureIds, const SizeVec3& dimensions, FillVote vote, FillPlan& plan, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Copies the source tuple into the destination tuple of every fill pair in the feature ids and in each voxel
+ * array. The sources always belong to a feature and the destinations never do, so no pair reads a tuple that another
+ * pair writes and the pairs are copied in parallel.
+ * @param plan
+ * @param featureIds
+ * @param voxelArrays Arrays that hold one tuple per voxel. The feature ids may be part of the list.
+ * @param shouldCancel
+ */
+SIMPLNX_EXPORT void ApplyFillPlan(const FillPlan& plan, Int32AbstractDataStore& featureIds, const std::vector<std::shared_ptr<IDataArray>>& voxelArrays, const std::atomic_bool& shouldCancel);
+
+/**
+ * @brief Grows the surrounding features into every voxel with a negative feature id. Each pass votes on all the
+ * remaining voxels from the feature ids of the previous pass and then fills them, which repeats until no negative
+ * ids are left or a pass can not fill any of them.
+ * @param featureIds
+ * @param dimensions X, Y, Z dimensions of the image geometry
+ * @param vote
+ * @param voxelArrays Arrays that are filled together with the feature ids
+ * @param messageHandler
+ * @param shouldCancel
+ * @return usize The number of voxels that could not be filled
+ */
+SIMPLNX_EXPORT usize FillRemovedVoxels(Int32AbstractDataStore& featureIds, const SizeVec3& dimensions, FillVote vote, const std::vector<std::shared_ptr<IDataArray>>& voxelArrays,
+                                       const IFilter::MessageHandler& messageHandler, const std::atomic_bool& shouldCancel);
+} // namespace nx::core::FeatureRemovalUtilities
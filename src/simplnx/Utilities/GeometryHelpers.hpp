@@ -6,9 +6,14 @@
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/Geometry/IGeometry.hpp"
 #include "simplnx/Utilities/Math/GeometryMath.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
 #include <Eigen/Dense>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace nx::core
 {
 namespace GeometryHelpers
@@ -820,6 +825,104 @@ void Find2DUnsharedEdges(const DataArray<T>* elemList, DataArray<T>* edgeList)
     ++index;
   }
 }
+
+/**
+ * @brief Compressed (CSR) vertex adjacency of a mesh. The neighbors of vertex i are stored in ascending order in
+ * Neighbors[Offsets[i]] up to (but not including) Neighbors[Offsets[i + 1]].
+ */
+template <typename T>
+struct VertexAdjacency
+{
+  std::vector<usize> Offsets;
+  std::vector<T> Neighbors;
+};
+
+/**
+ * @brief Builds the vertex adjacency of a 2D element list straight from the elements without creating an edge
+ * list. Two vertices are adjacent when they share an edge of an element.
+ * @tparam T
+ * @param elemList
+ * @param numVerts
+ * @return VertexAdjacency<T>
+ */
+template <typename T>
+VertexAdjacency<T> Find2DVertexAdjacency(const DataArray<T>* elemList, usize numVerts)
+{
+  class SortNeighborsImpl
+  {
+  public:
+    SortNeighborsImpl(VertexAdjacency<T>& adjacency, std::vector<usize>& uniqueCounts)
+    : m_Adjacency(adjacency)
+    , m_UniqueCounts(uniqueCounts)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize vert = range.min(); vert < range.max(); vert++)
+      {
+        auto begin = m_Adjacency.Neighbors.begin() + m_Adjacency.Offsets[vert];
+        auto end = m_Adjacency.Neighbors.begin() + m_Adjacency.Offsets[vert + 1];
+        std::sort(begin, end);
+        m_UniqueCounts[vert] = static_cast<usize>(std::distance(begin, std::unique(begin, end)));
+      }
+    }
+
+  private:
+    VertexAdjacency<T>& m_Adjacency;
+    std::vector<usize>& m_UniqueCounts;
+  };
+
+  const auto& elems = elemList->getDataStoreRef();
+  const usize numElems = elemList->getNumberOfTuples();
+  const usize numVertsPerElem = elemList->getNumberOfComponents();
+
+  // Every edge is listed from both of its vertices, so edges shared by several elements are listed more than once
+  VertexAdjacency<T> adjacency;
+  adjacency.Offsets.assign(numVerts + 1, 0);
+  for(usize i = 0; i < numElems; i++)
+  {
+    const usize offset = i * numVertsPerElem;
+    for(usize j = 0; j < numVertsPerElem; j++)
+    {
+      adjacency.Offsets[elems[offset + j] + 1] += 2;
+    }
+  }
+  std::partial_sum(adjacency.Offsets.begin(), adjacency.Offsets.end(), adjacency.Offsets.begin());
+
+  adjacency.Neighbors.resize(adjacency.Offsets[numVerts]);
+  std::vector<usize> cursors(adjacency.Offsets.begin(), adjacency.Offsets.end() - 1);
+  for(usize i = 0; i < numElems; i++)
+  {
+    const usize offset = i * numVertsPerElem;
+    for(usize j = 0; j < numVertsPerElem; j++)
+    {
+      const T v0 = elems[offset + j];
+      const T v1 = elems[offset + (j + 1) % numVertsPerElem];
+      adjacency.Neighbors[cursors[v0]++] = v1;
+      adjacency.Neighbors[cursors[v1]++] = v0;
+    }
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, numVerts);
+  dataAlg.execute(SortNeighborsImpl(adjacency, cursors));
+
+  // Squeeze out the duplicates. Every list only moves towards the front so this can be done in place
+  usize next = 0;
+  for(usize vert = 0; vert < numVerts; vert++)
+  {
+    const usize start = adjacency.Offsets[vert];
+    adjacency.Offsets[vert] = next;
+    std::copy(adjacency.Neighbors.begin() + start, adjacency.Neighbors.begin() + start + cursors[vert], adjacency.Neighbors.begin() + next);
+    next += cursors[vert];
+  }
+  adjacency.Offsets[numVerts] = next;
+  adjacency.Neighbors.resize(next);
+  adjacency.Neighbors.shrink_to_fit();
+
+  return adjacency;
+}
 } // namespace Connectivity
 
 namespace Topology
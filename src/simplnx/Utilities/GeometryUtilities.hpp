@@ -6,29 +6,12 @@
 #include "simplnx/DataStructure/Geometry/ImageGeom.hpp"
 #include "simplnx/DataStructure/Geometry/RectGridGeom.hpp"
 #include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Utilities/ParallelChunkAlgorithm.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/Utilities/VertexWelder.hpp"
 
 namespace nx::core::GeometryUtilities
 {
-/**
- * @brief The FindUniqueIdsImpl class implements a threaded algorithm that determines the set of
- * unique vertices in a given geometry
- */
-class SIMPLNX_EXPORT FindUniqueIdsImpl
-{
-public:
-  using VertexStore = nx::core::AbstractDataStore<nx::core::IGeometry::SharedVertexList::value_type>;
-  FindUniqueIdsImpl(VertexStore& vertexStore, const std::vector<std::vector<size_t>>& nodesInBin, nx::core::Int64DataStore& uniqueIds);
-
-  void convert(size_t start, size_t end) const;
-  void operator()(const Range& range) const;
-
-private:
-  const VertexStore& m_VertexStore;
-  const std::vector<std::vector<size_t>>& m_NodesInBin;
-  nx::core::Int64DataStore& m_UniqueIds;
-};
-
 /**
  * @brief Calculates the X,Y,Z partition length for a given geometry if the geometry were partitioned into equal numberOfPartitionsPerAxis partitions.
  * @param geometry The geometry to be partitioned
@@ -82,10 +65,6 @@ SIMPLNX_EXPORT Result<FloatVec3> CalculatePartitionLengthsOfBoundingBox(const Bo
 template <class GeometryType = INodeGeometry1D, class = std::enable_if_t<std::is_base_of<INodeGeometry1D, GeometryType>::value>>
 Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scaleFactor = std::nullopt)
 {
-  usize numXBins = 100;
-  usize numYBins = 100;
-  usize numZBins = 100;
-
   using SharedVertList = AbstractDataStore<IGeometry::SharedVertexList::value_type>;
 
   SharedVertList& vertices = geom.getVertices()->getDataStoreRef();
@@ -110,113 +89,61 @@ Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scal
   }
   AbstractDataStore<INodeGeometry1D::MeshIndexArrayType::value_type>& cellsRef = cells->getDataStoreRef();
 
-  IGeometry::MeshIndexType nNodesAll = geom.getNumberOfVertices();
-  size_t nNodes = 0;
-  if(nNodesAll > 0)
-  {
-    nNodes = static_cast<size_t>(nNodesAll);
-  }
-
-  auto boundingBox = geom.getBoundingBox();
-  auto minPoint = boundingBox.getMinPoint();
-  auto maxPoint = boundingBox.getMaxPoint();
-  float32 stepX = (maxPoint.getX() - minPoint.getX()) / numXBins;
-  float32 stepY = (maxPoint.getY() - minPoint.getY()) / numYBins;
-  float32 stepZ = (maxPoint.getZ() - minPoint.getZ()) / numZBins;
-
-  std::vector<std::vector<usize>> nodesInBin(numXBins * numYBins * numZBins);
+  const usize nNodes = static_cast<usize>(geom.getNumberOfVertices());
 
-  // determine (xyz) bin each node falls in - used to speed up node comparison
-  usize xBin = 0, yBin = 0, zBin = 0;
-  for(size_t i = 0; i < nNodes; i++)
+  // Merge every node into the first node with the same coordinates, one block of nodes at a time
+  constexpr usize k_BlockSize = 65536;
+  VertexWelder welder;
+  std::vector<uint64> uniqueIds(nNodes);
+  std::vector<float32> blockCoords(std::min(nNodes, k_BlockSize) * 3);
+  for(usize start = 0; start < nNodes; start += k_BlockSize)
   {
-    if(stepX != 0.0)
+    const usize count = std::min(k_BlockSize, nNodes - start);
+    nonstd::span<float32> coords(blockCoords.data(), count * 3);
+    Result<> result = vertices.copyIntoBuffer(start * 3, coords);
+    if(result.invalid())
     {
-      xBin = static_cast<usize>((vertices[i * 3] - minPoint.getX()) / stepX);
+      return result;
     }
-    if(stepY != 0.0)
-    {
-      yBin = static_cast<usize>((vertices[i * 3 + 1] - minPoint.getY()) / stepY);
-    }
-    if(stepZ != 0)
-    {
-      zBin = static_cast<usize>((vertices[i * 3 + 2] - minPoint.getZ()) / stepZ);
-    }
-    if(xBin == numXBins)
-    {
-      xBin = numXBins - 1;
-    }
-    if(yBin == numYBins)
-    {
-      yBin = numYBins - 1;
-    }
-    if(zBin == numZBins)
-    {
-      zBin = numZBins - 1;
-    }
-    usize bin = (zBin * numYBins * numXBins) + (yBin * numXBins) + xBin;
-    nodesInBin[bin].push_back(i);
+    welder.addVertices(coords, nonstd::span<uint64>(uniqueIds.data() + start, count));
   }
 
-  // Create array to hold unique node numbers
-  Int64DataStore uniqueIds(IDataStore::ShapeType{nNodes}, IDataStore::ShapeType{1}, {});
-  for(IGeometry::MeshIndexType i = 0; i < nNodesAll; i++)
+  // Replace the nodes with the unique nodes and apply the optional scaling
+  geom.resizeVertexList(welder.getNumberOfVertices());
+  SharedVertList& uniqueVertices = geom.getVertices()->getDataStoreRef();
+  Result<> copyResult = uniqueVertices.copyFromBuffer(0, nonstd::span<const float32>(welder.getVertices().data(), welder.getVertices().size()));
+  if(copyResult.invalid())
   {
-    uniqueIds[i] = static_cast<int64>(i);
+    return copyResult;
   }
-
-  // Parallel algorithm to find duplicate nodes
-  ParallelDataAlgorithm dataAlg;
-  dataAlg.setParallelizationEnabled(true);
-  dataAlg.setRange(0ULL, static_cast<usize>(numXBins * numYBins * numZBins));
-  dataAlg.execute(GeometryUtilities::FindUniqueIdsImpl(vertices, nodesInBin, uniqueIds));
-
-  // renumber the unique nodes
-  int64 uniqueCount = 0;
-  for(usize i = 0; i < nNodes; i++)
+  ParallelChunkAlgorithm chunkAlg;
+  if(scaleFactor.has_value())
   {
-    if(uniqueIds[i] == static_cast<int64>(i))
-    {
-      uniqueIds[i] = uniqueCount;
-      uniqueCount++;
-    }
-    else
+    const float32 scaleFactorValue = scaleFactor.value();
+    Result<> scaleResult = chunkAlg.executeInPlace(uniqueVertices, [scaleFactorValue](nonstd::span<float32> coords, const Range& /*tupleRange*/) {
+      for(float32& coord : coords)
+      {
+        coord *= scaleFactorValue;
+      }
+    });
+    if(scaleResult.invalid())
     {
-      uniqueIds[i] = uniqueIds[uniqueIds[i]];
+      return scaleResult;
     }
   }
 
-  float32 scaleFactorValue = 1.0F;
-  if(scaleFactor.has_value())
-  {
-    scaleFactorValue = scaleFactor.value();
-  }
-
-  // Move nodes to uniqueIds and then resize nodes array and apply optional scaling
-  for(size_t i = 0; i < nNodes; i++)
-  {
-    vertices[uniqueIds[i] * 3] = vertices[i * 3] * scaleFactorValue;
-    vertices[uniqueIds[i] * 3 + 1] = vertices[i * 3 + 1] * scaleFactorValue;
-    vertices[uniqueIds[i] * 3 + 2] = vertices[i * 3 + 2] * scaleFactorValue;
-  }
-  geom.resizeVertexList(uniqueCount);
-
-  // Update the triangle nodes to reflect the unique ids
-  IGeometry::MeshIndexType nCells;
+  // Update the cell nodes to reflect the unique ids
   usize nVerticesPerCell = 0;
   if constexpr(std::is_base_of<INodeGeometry3D, GeometryType>::value)
   {
-    nCells = geom.getNumberOfPolyhedra();
     nVerticesPerCell = geom.getNumberOfVerticesPerCell();
   }
   else if constexpr(std::is_base_of<INodeGeometry2D, GeometryType>::value)
   {
-    nCells = geom.getNumberOfFaces();
     nVerticesPerCell = geom.getNumberOfVerticesPerFace();
   }
   else if constexpr(std::is_base_of<INodeGeometry1D, GeometryType>::value)
   {
-    nCells = geom.getNumberOfEdges();
     nVerticesPerCell = geom.getNumberOfVerticesPerEdge();
   }
 
@@ -225,13 +152,15 @@ Result<> EliminateDuplicateNodes(GeometryType& geom, std::optional<float32> scal
     return MakeErrorResult(-56801, "EliminateDuplicateNodes Error: nVerticesPerCell = 0? Did you pass in a vertex geometry?");
   }
 
-  for(size_t i = 0; i < static_cast<size_t>(nCells); i++)
-  {
-    for(usize j = 0; j < nVerticesPerCell; j++)
+  Result<> renumberResult = chunkAlg.executeInPlace(cellsRef, [&uniqueIds](nonstd::span<IGeometry::MeshIndexType> cellNodes, const Range& /*tupleRange*/) {
+    for(IGeometry::MeshIndexType& node : cellNodes)
     {
-      auto node = static_cast<int64>(cellsRef[i * nVerticesPerCell + j]);
-      cellsRef[i * nVerticesPerCell + j] = uniqueIds[node];
+      node = uniqueIds[node];
     }
+  });
+  if(renumberResult.invalid())
+  {
+    return renumberResult;
   }
 
   if constexpr(std::is_base_of<INodeGeometry3D, GeometryType>::value)
@@ -1,7 +1,11 @@
 
 #include "ImageRotationUtilities.hpp"
 
+#include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
 #include <algorithm>
+#include <atomic>
 
 namespace nx::core::ImageRotationUtilities
 {
@@ -276,4 +280,304 @@ size_t FindOctant(const RotateArgs& params, const Point3Df& centerPoint, const E
   return minIndex;
 }
 
+namespace
+{
+// Upper bound of voxels per remap tile. A whole X row is always one tile entry so very wide geometries can exceed it.
+constexpr usize k_TileVoxelCount = 65536;
+
+/**
+ * @brief This comes from https://www.cs.purdue.edu/homes/cs530/slides/04.DataStructure.pdf, page 36.
+ *
+ * Note in the codes below the equations have been changed to do all of the additions first, then
+ * the subtractions. This should hopefully alleviate issue with trying to subtract unsigned integers
+ * and ending up with what should have been a negative number but since it is unsigned the value
+ * that the compiler will compute would be vastly different.
+ */
+template <typename T>
+T CalculateInterpolatedValue(const std::vector<T>& pValues, const Eigen::Vector3f& uvw, usize numComps, usize compIndex)
+{
+  constexpr usize P1 = 0;
+  constexpr usize P2 = 1;
+  constexpr usize P3 = 2;
+  constexpr usize P4 = 3;
+  constexpr usize P5 = 4;
+  constexpr usize P6 = 5;
+  constexpr usize P7 = 6;
+  constexpr usize P8 = 7;
+
+  const float u = uvw[0];
+  const float v = uvw[1];
+  const float w = uvw[2];
+
+  T value = pValues[0];
+  // clang-format off
+  value += u * (pValues[P2 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
+  value += v * (pValues[P4 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
+  value += w * (pValues[P5 * numComps + compIndex] - pValues[P1 * numComps + compIndex]);
+  value += u * v * (pValues[P1 * numComps + compIndex] + pValues[P3 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P4 * numComps + compIndex]);
+  value += u * w * (pValues[P1 * numComps + compIndex] + pValues[P6 * numComps + compIndex] - pValues[P2 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
+  value += v * w * (pValues[P1 * numComps + compIndex] + pValues[P8 * numComps + compIndex] - pValues[P4 * numComps + compIndex] - pValues[P5 * numComps + compIndex]);
+  value += u * v * w *
+           ( pValues[P4 * numComps + compIndex]
+            + pValues[P2 * numComps + compIndex]
+            + pValues[P8 * numComps + compIndex]
+            + pValues[P6 * numComps + compIndex]
+            - pValues[P1 * numComps + compIndex]
+            - pValues[P3 * numComps + compIndex]
+            - pValues[P5 * numComps + compIndex]
+            - pValues[P7 * numComps + compIndex] );
+  // clang-format on
+  return value;
+}
+
+struct GatherRemapTileFunctor
+{
+  template <typename T>
+  void operator()(const VoxelRemapPlan& remapPlan, const VoxelRemapPlan::Tile& tile, const IDataArray* sourceArray, IDataArray* targetArray)
+  {
+    const auto& sourceStore = sourceArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
+    auto& targetStore = targetArray->template getIDataStoreRefAs<AbstractDataStore<T>>();
+    const usize numComps = sourceStore.getNumberOfComponents();
+
+    if(remapPlan.getInterpolationType() == InterpolationType::NearestNeighbor)
+    {
+      for(usize voxel = 0; voxel < tile.NumVoxels; voxel++)
+      {
+        const usize newIndex = tile.StartIndex + voxel;
+        const usize oldIndex = tile.SourceIndices[voxel];
+        if(oldIndex == VoxelRemapPlan::k_InvalidIndex)
+        {
+          targetStore.fillTuple(newIndex, static_cast<T>(0));
+          continue;
+        }
+        for(usize compIndex = 0; compIndex < numComps; compIndex++)
+        {
+          targetStore.setValue(newIndex * numComps + compIndex, sourceStore.getValue(oldIndex * numComps + compIndex));
+        }
+      }
+      return;
+    }
+
+    if constexpr(!std::is_same_v<T, bool>)
+    {
+      std::vector<T> pValues(8 * numComps);
+      for(usize voxel = 0; voxel < tile.NumVoxels; voxel++)
+      {
+        const usize newIndex = tile.StartIndex + voxel;
+        const usize* oldIndices = tile.SourceIndices.data() + voxel * 8;
+        if(oldIndices[0] == VoxelRemapPlan::k_InvalidIndex)
+        {
+          targetStore.fillTuple(newIndex, static_cast<T>(0));
+          continue;
+        }
+        for(usize i = 0; i < 8; i++)
+        {
+          for(usize compIndex = 0; compIndex < numComps; compIndex++)
+          {
+            pValues[i * numComps + compIndex] = sourceStore.getValue(oldIndices[i] * numComps + compIndex);
+          }
+        }
+        for(usize compIndex = 0; compIndex < numComps; compIndex++)
+        {
+          targetStore.setComponent(newIndex, compIndex, CalculateInterpolatedValue(pValues, tile.Weights[voxel], numComps, compIndex));
+        }
+      }
+    }
+  }
+};
+
+class RemapImageGeometryArraysImpl
+{
+public:
+  RemapImageGeometryArraysImpl(const VoxelRemapPlan& remapPlan, const std::vector<std::pair<const IDataArray*, IDataArray*>>& arrays, FilterProgressCallback* filterCallback,
+                               std::atomic<usize>& completedRows)
+  : m_RemapPlan(remapPlan)
+  , m_Arrays(arrays)
+  , m_FilterCallback(filterCallback)
+  , m_CompletedRows(completedRows)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    const usize rowLength = static_cast<usize>(m_RemapPlan.getRotateArgs().xpNew);
+    const usize rowsPerTile = std::max(usize{1}, k_TileVoxelCount / std::max(usize{1}, rowLength));
+    const usize totalRows = m_RemapPlan.getNumberOfRows();
+
+    VoxelRemapPlan::Tile tile;
+    for(usize startRow = range.min(); startRow < range.max(); startRow += rowsPerTile)
+    {
+      if(m_FilterCallback->getCancel())
+      {
+        return;
+      }
+      const usize endRow = std::min(startRow + rowsPerTile, range.max());
+      m_RemapPlan.computeTile(startRow, endRow, tile);
+      for(const auto& [sourceArray, targetArray] : m_Arrays)
+      {
+        ExecuteDataFunction(GatherRemapTileFunctor{}, sourceArray->getDataType(), m_RemapPlan, tile, sourceArray, targetArray);
+      }
+      const usize completedRows = m_CompletedRows.fetch_add(endRow - startRow) + (endRow - startRow);
+      m_FilterCallback->sendThreadSafeProgressMessage(fmt::format("Transforming {} Arrays: {}/{} rows completed", m_Arrays.size(), completedRows, totalRows));
+    }
+  }
+
+private:
+  const VoxelRemapPlan& m_RemapPlan;
+  const std::vector<std::pair<const IDataArray*, IDataArray*>>& m_Arrays;
+  FilterProgressCallback* m_FilterCallback = nullptr;
+  std::atomic<usize>& m_CompletedRows;
+};
+} // namespace
+
+//------------------------------------------------------------------------------
+VoxelRemapPlan::VoxelRemapPlan(const RotateArgs& rotateArgs, const Matrix4fR& transformationMatrix, InterpolationType interpolationType, bool sliceBySlice)
+: m_Params(rotateArgs)
+, m_InverseTransform(transformationMatrix.inverse())
+, m_InterpolationType(interpolationType)
+, m_SliceBySlice(sliceBySlice)
+{
+  ImageGeom* sourceGeomPtr = ImageGeom::Create(m_DataStructure, "source image geom");
+  sourceGeomPtr->setDimensions(m_Params.OriginalDims);
+  sourceGeomPtr->setSpacing(m_Params.OriginalSpacing);
+  sourceGeomPtr->setOrigin(m_Params.OriginalOrigin);
+  m_SourceGeom = sourceGeomPtr;
+
+  ImageGeom* transformedGeomPtr = ImageGeom::Create(m_DataStructure, "dest image geom");
+  transformedGeomPtr->setDimensions(m_Params.TransformedDims);
+  transformedGeomPtr->setSpacing(m_Params.TransformedSpacing);
+  transformedGeomPtr->setOrigin(m_Params.TransformedOrigin);
+  m_TransformedGeom = transformedGeomPtr;
+}
+
+//------------------------------------------------------------------------------
+usize VoxelRemapPlan::getNumberOfRows() const
+{
+  return static_cast<usize>(m_Params.ypNew * m_Params.zpNew);
+}
+
+//------------------------------------------------------------------------------
+usize VoxelRemapPlan::getNumberOfSourceIndices() const
+{
+  return m_InterpolationType == InterpolationType::Trilinear ? 8 : 1;
+}
+
+//------------------------------------------------------------------------------
+InterpolationType VoxelRemapPlan::getInterpolationType() const
+{
+  return m_InterpolationType;
+}
+
+//------------------------------------------------------------------------------
+const RotateArgs& VoxelRemapPlan::getRotateArgs() const
+{
+  return m_Params;
+}
+
+//------------------------------------------------------------------------------
+void VoxelRemapPlan::computeTile(usize startRow, usize endRow, Tile& tile) const
+{
+  const usize rowLength = static_cast<usize>(m_Params.xpNew);
+  const usize numRowsPerSlice = static_cast<usize>(m_Params.ypNew);
+  const usize numSourceIndices = getNumberOfSourceIndices();
+  const usize sliceSize = m_Params.OriginalDims[0] * m_Params.OriginalDims[1];
+
+  tile.StartIndex = startRow * rowLength;
+  tile.NumVoxels = (endRow - startRow) * rowLength;
+  tile.SourceIndices.resize(tile.NumVoxels * numSourceIndices);
+  tile.Weights.resize(m_InterpolationType == InterpolationType::Trilinear ? tile.NumVoxels : 0);
+
+  for(usize row = startRow; row < endRow; row++)
+  {
+    const usize k = row / numRowsPerSlice;
+    for(usize i = 0; i < rowLength; i++)
+    {
+      const usize newIndex = row * rowLength + i;
+      const usize voxel = newIndex - tile.StartIndex;
+      usize* sourceIndices = tile.SourceIndices.data() + voxel * numSourceIndices;
+
+      Point3Df point = m_TransformedGeom->getCoordsf(newIndex);
+      // Last value is 1. See https://www.euclideanspace.com/maths/geometry/affine/matrix4x4/index.htm
+      Eigen::Vector4f coordsNew(point.getX(), point.getY(), point.getZ(), 1.0f);
+      // Transform back to the old coordinate
+      Eigen::Array4f coordsOld = m_InverseTransform * coordsNew;
+
+      // Now compute the old Cell Index from the old coordinate
+      SizeVec3 oldGeomIndices;
+      auto errorResult = m_SourceGeom->computeCellIndex(coordsOld.data(), oldGeomIndices);
+      if(errorResult != ImageGeom::ErrorType::NoError)
+      {
+        sourceIndices[0] = k_InvalidIndex;
+        continue;
+      }
+
+      if(m_InterpolationType == InterpolationType::NearestNeighbor)
+      {
+        if(m_SliceBySlice)
+        {
+          oldGeomIndices[2] = k;
+        }
+        sourceIndices[0] = (sliceSize * oldGeomIndices[2]) + (m_Params.OriginalDims[0] * oldGeomIndices[1]) + oldGeomIndices[0];
+        continue;
+      }
+
+      // The octant is found from this center point, which is kept as it has always been computed so that the
+      // interpolated values do not change.
+      size_t oldIndex = (sliceSize * oldGeomIndices[2]) + sliceSize + oldGeomIndices[0];
+      auto centerPoint = m_SourceGeom->getCoordsf(oldIndex);
+      const usize octant = FindOctant(m_Params, centerPoint, coordsOld);
+      const OctantOffsetArrayType& indexOffset = k_AllOctantOffsets[octant];
+
+      const Vector3i64 oldIndices(static_cast<int64>(oldGeomIndices[0]), static_cast<int64>(oldGeomIndices[1]), static_cast<int64>(oldGeomIndices[2]));
+      for(usize n = 0; n < 8; n++)
+      {
+        Vector3i64 pIndices = oldIndices + indexOffset[n];
+        if(n == 0)
+        {
+          const Eigen::Vector3f p1Coord = {static_cast<float32>(pIndices[0]) * m_Params.xRes + (0.5F * m_Params.xRes) + m_Params.OriginalOrigin[0],
+                                           static_cast<float32>(pIndices[1]) * m_Params.yRes + (0.5F * m_Params.yRes) + m_Params.OriginalOrigin[1],
+                                           static_cast<float32>(pIndices[2]) * m_Params.zRes + (0.5F * m_Params.zRes) + m_Params.OriginalOrigin[2]};
+          tile.Weights[voxel] = {coordsOld[0] - p1Coord[0], coordsOld[1] - p1Coord[1], coordsOld[2] - p1Coord[2]};
+        }
+        pIndices[0] = std::clamp(pIndices[0], int64{0}, m_Params.xp - 1);
+        pIndices[1] = std::clamp(pIndices[1], int64{0}, m_Params.yp - 1);
+        pIndices[2] = std::clamp(pIndices[2], int64{0}, m_Params.zp - 1);
+        sourceIndices[n] = static_cast<usize>((pIndices[2] * m_Params.xp * m_Params.yp) + (pIndices[1] * m_Params.xp) + pIndices[0]);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void RemapImageGeometryArrays(const VoxelRemapPlan& remapPlan, const std::vector<std::pair<const IDataArray*, IDataArray*>>& arrays, FilterProgressCallback* filterCallback)
+{
+  std::vector<std::pair<const IDataArray*, IDataArray*>> remapArrays;
+  IParallelAlgorithm::AlgorithmArrays algorithmArrays;
+  for(const auto& [sourceArray, targetArray] : arrays)
+  {
+    if(sourceArray->getNumberOfComponents() == 0)
+    {
+      filterCallback->sendThreadSafeProgressMessage(fmt::format("{}: Number of Components was Zero for array. Exiting Transform.", sourceArray->getName()));
+      continue;
+    }
+    if(remapPlan.getInterpolationType() == InterpolationType::Trilinear && sourceArray->getDataType() == DataType::boolean)
+    {
+      continue;
+    }
+    remapArrays.emplace_back(sourceArray, targetArray);
+    algorithmArrays.push_back(sourceArray);
+    algorithmArrays.push_back(targetArray);
+  }
+  if(remapArrays.empty())
+  {
+    return;
+  }
+
+  std::atomic<usize> completedRows = 0;
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, remapPlan.getNumberOfRows());
+  dataAlg.requireArraysInMemory(algorithmArrays);
+  dataAlg.execute(RemapImageGeometryArraysImpl(remapPlan, remapArrays, filterCallback, completedRows));
+}
+
 } // namespace nx::core::ImageRotationUtilities
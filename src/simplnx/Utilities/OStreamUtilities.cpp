@@ -2,11 +2,21 @@
 
 #include "simplnx/Common/AtomicFile.hpp"
 #include "simplnx/Utilities/FilterUtilities.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 
+#include <charconv>
 #include <chrono>
-#include <iomanip>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <thread>
 
 namespace fs = std::filesystem;
 using namespace nx::core;
@@ -15,9 +25,275 @@ namespace // for nonmember functions
 {
 const std::array<std::string, 5> k_DelimiterStrings = {" ", ";", ",", ":", "\t"}; // Don't reorder
 
+// Rows are formatted in parallel in blocks of this many rows, this many blocks at a time
+constexpr usize k_RowsPerBlock = 4096;
+constexpr usize k_BlocksPerPass = 64;
+// The formatting threads wait once this many bytes are waiting to be written
+constexpr usize k_MaxQueuedBytes = 256ULL * 1024ULL * 1024ULL;
+
+constexpr int32 k_WriteStreamError = -10180;
+
+enum class FloatFormat
+{
+  Shortest, // The shortest text that reads back as the same value
+  Precise   // 8 significant digits for float32 and 16 for float64
+};
+
+/**
+ * @brief Appends the text of one value. 8 bit integers are written as numbers, not characters.
+ * @tparam T
+ * @param text The text to append to
+ * @param value
+ * @param floatFormat
+ */
+template <typename T>
+void AppendValue(std::string& text, T value, FloatFormat floatFormat = FloatFormat::Shortest)
+{
+  if constexpr(std::is_floating_point_v<T>)
+  {
+    if(floatFormat == FloatFormat::Shortest)
+    {
+      fmt::format_to(std::back_inserter(text), "{}", value);
+      return;
+    }
+    // Same as an ostream with std::setprecision() and the default float notation
+    constexpr int32 k_Precision = std::is_same_v<T, float32> ? 8 : 16;
+    char chars[32];
+#if defined(__cpp_lib_to_chars)
+    const std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), value, std::chars_format::general, k_Precision);
+    text.append(chars, result.ptr);
+#else
+    // Floating point std::to_chars is not available in every standard library
+    const int32 length = std::snprintf(chars, sizeof(chars), "%.*g", k_Precision, static_cast<float64>(value));
+    text.append(chars, static_cast<usize>(length));
+#endif
+  }
+  else
+  {
+    using ValueType = std::conditional_t<sizeof(T) == 1, int32, T>;
+    char chars[24];
+    const std::to_chars_result result = std::to_chars(chars, chars + sizeof(chars), static_cast<ValueType>(value));
+    text.append(chars, result.ptr);
+  }
+}
+
+/**
+ * @brief Writes blocks of text on a background thread in the order they were queued, so that formatting the next
+ * blocks overlaps with writing the previous ones. Several streams can share one queue, which keeps the output of
+ * multiple files in order as well. Any other work that has to happen in order with the writes, such as closing a
+ * file, can be queued as a task. Once a task fails the remaining tasks are skipped.
+ */
+class OrderedWriteQueue
+{
+public:
+  using Task = std::function<Result<>()>;
+
+  OrderedWriteQueue()
+  : m_WriterThread([this]() { run(); })
+  {
+  }
+
+  ~OrderedWriteQueue() noexcept
+  {
+    finish();
+  }
+
+  OrderedWriteQueue(const OrderedWriteQueue&) = delete;
+  OrderedWriteQueue(OrderedWriteQueue&&) noexcept = delete;
+
+  OrderedWriteQueue& operator=(const OrderedWriteQueue&) = delete;
+  OrderedWriteQueue& operator=(OrderedWriteQueue&&) noexcept = delete;
+
+  /**
+   * @brief Queues the text to be written to the stream. Blocks while too much text is waiting to be written.
+   * @param outputStrm The stream has to stay open until the queue is finished or a later task closes it
+   * @param text
+   */
+  void write(std::ostream& outputStrm, std::string&& text)
+  {
+    if(text.empty())
+    {
+      return;
+    }
+    const usize numBytes = text.size();
+    push(
+        [&outputStrm, text = std::move(text)]() -> Result<> {
+          outputStrm.write(text.data(), static_cast<std::streamsize>(text.size()));
+          if(outputStrm.fail())
+          {
+            return MakeErrorResult(k_WriteStreamError, "Error writing to the output stream.");
+          }
+          return {};
+        },
+        numBytes);
+  }
+
+  /**
+   * @brief Queues a task that runs on the writer thread after everything queued before it.
+   * @param task
+   * @param numBytes The number of bytes the task holds on to until it has run
+   */
+  void push(Task&& task, usize numBytes = 0)
+  {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_SpaceAvailable.wait(lock, [this]() { return m_QueuedBytes < k_MaxQueuedBytes || m_Tasks.empty(); });
+    m_QueuedBytes += numBytes;
+    m_Tasks.push_back({std::move(task), numBytes});
+    m_TaskAvailable.notify_one();
+  }
+
+  /**
+   * @brief Returns true once a task has failed. Nothing that is queued afterwards runs.
+   * @return bool
+   */
+  bool hasFailed() const
+  {
+    return m_HasFailed;
+  }
+
+  /**
+   * @brief Waits for the queued tasks to finish and stops the writer thread.
+   * @return The first error from the tasks
+   */
+  Result<> finish()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_Mutex);
+      m_Finished = true;
+    }
+    m_TaskAvailable.notify_one();
+    if(m_WriterThread.joinable())
+    {
+      m_WriterThread.join();
+    }
+    return m_Result;
+  }
+
+private:
+  struct QueuedTask
+  {
+    Task Function;
+    usize NumBytes = 0;
+  };
+
+  void run()
+  {
+    while(true)
+    {
+      QueuedTask task;
+      {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_TaskAvailable.wait(lock, [this]() { return !m_Tasks.empty() || m_Finished; });
+        if(m_Tasks.empty())
+        {
+          return;
+        }
+        task = std::move(m_Tasks.front());
+        m_Tasks.pop_front();
+      }
+
+      if(!m_HasFailed)
+      {
+        Result<> result = task.Function();
+        if(result.invalid())
+        {
+          m_Result = std::move(result);
+          m_HasFailed = true;
+        }
+      }
+      // Release whatever the task holds before making room for more
+      task.Function = nullptr;
+
+      {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_QueuedBytes -= task.NumBytes;
+      }
+      m_SpaceAvailable.notify_one();
+    }
+  }
+
+  std::mutex m_Mutex;
+  std::condition_variable m_TaskAvailable;
+  std::condition_variable m_SpaceAvailable;
+  std::deque<QueuedTask> m_Tasks;
+  usize m_QueuedBytes = 0;
+  bool m_Finished = false;
+  std::atomic_bool m_HasFailed = false;
+  Result<> m_Result;
+  std::thread m_WriterThread;
+};
+
+/**
+ * @brief Formats rows [firstRow, endRow) in blocks in parallel and queues the blocks to be written in order.
+ * @param writeQueue
+ * @param outputStrm
+ * @param firstRow
+ * @param endRow
+ * @param loadRows Called as loadRows(passFirstRow, numRows) on this thread before each pass of blocks is formatted, so
+ * data stores are only read from one thread and in bulk. Returns a Result<>.
+ * @param formatRows Called as formatRows(blockFirstRow, blockEndRow, text) from several threads at once
+ * @param progressName Prefix of the progress messages
+ * @param mesgHandler The message handler to dump progress updates to
+ * @param shouldCancel
+ * @return Result<>
+ */
+template <typename LoadFuncT, typename FormatFuncT>
+Result<> FormatRowsInParallel(OrderedWriteQueue& writeQueue, std::ostream& outputStrm, usize firstRow, usize endRow, const LoadFuncT& loadRows, const FormatFuncT& formatRows,
+                              const std::string& progressName, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel)
+{
+  constexpr usize k_RowsPerPass = k_RowsPerBlock * k_BlocksPerPass;
+  const usize numRows = endRow > firstRow ? endRow - firstRow : 0;
+  std::vector<std::string> blocks(k_BlocksPerPass);
+  auto start = std::chrono::steady_clock::now();
+
+  for(usize passFirstRow = firstRow; passFirstRow < endRow; passFirstRow += k_RowsPerPass)
+  {
+    if(shouldCancel || writeQueue.hasFailed())
+    {
+      return {};
+    }
+
+    const usize passEndRow = std::min(passFirstRow + k_RowsPerPass, endRow);
+    Result<> loadResult = loadRows(passFirstRow, passEndRow - passFirstRow);
+    if(loadResult.invalid())
+    {
+      return loadResult;
+    }
+
+    // The blocks only read memory that was loaded above, so they are formatted in parallel even for out-of-core data
+    const usize numBlocks = (passEndRow - passFirstRow + k_RowsPerBlock - 1) / k_RowsPerBlock;
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(true);
+    dataAlg.setRange(0, numBlocks);
+    dataAlg.execute([&](const Range& range) {
+      for(usize blockIndex = range.min(); blockIndex < range.max(); blockIndex++)
+      {
+        const usize blockFirstRow = passFirstRow + blockIndex * k_RowsPerBlock;
+        formatRows(blockFirstRow, std::min(blockFirstRow + k_RowsPerBlock, passEndRow), blocks[blockIndex]);
+      }
+    });
+
+    for(usize blockIndex = 0; blockIndex < numBlocks; blockIndex++)
+    {
+      writeQueue.write(outputStrm, std::move(blocks[blockIndex]));
+      blocks[blockIndex] = std::string();
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    {
+      auto string = fmt::format("{}: {}% completed", progressName, static_cast<int32>(100 * static_cast<float>(passEndRow - firstRow) / static_cast<float>(numRows)));
+      mesgHandler(IFilter::Message::Type::Info, string);
+      start = now;
+    }
+  }
+  return {};
+}
+
 /**
  * @brief implicit writing of **NeighborList**'s elements to outputStrm
  * @tparam ScalarType The primitive type attacthed to **NeighborList**
+ * @param writeQueue The queue that writes the formatted text
  * @param outputStrm the ostream to write to
  * @param inputNeighborList The **NeighborList** that will have its values translated into strings
  * @param mesgHandler The message handler to dump progress updates to
@@ -29,106 +305,55 @@ const std::array<std::string, 5> k_DelimiterStrings = {" ", ";", ",", ":", "\t"}
 struct PrintNeighborList
 {
   template <typename ScalarType>
-  Result<> operator()(std::ostream& outputStrm, INeighborList* inputNeighborList, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, const std::string& delimiter = ",",
-                      bool hasIndex = false, bool hasHeader = false)
+  Result<> operator()(OrderedWriteQueue& writeQueue, std::ostream& outputStrm, INeighborList* inputNeighborList, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
+                      const std::string& delimiter = ",", bool hasIndex = false, bool hasHeader = false)
   {
     auto& neighborList = *dynamic_cast<NeighborList<ScalarType>*>(inputNeighborList);
-    auto start = std::chrono::steady_clock::now();
-    auto numLists = neighborList.getNumberOfLists();
+    const auto numLists = static_cast<usize>(neighborList.getNumberOfLists());
 
     if(hasHeader)
     {
+      std::string header;
       if(hasIndex)
       {
-        outputStrm << "Feature_IDs" << delimiter;
+        header.append("Feature_IDs").append(delimiter);
       }
-      outputStrm << "Element Count" << delimiter << inputNeighborList->getName() << "\n";
+      header.append("Element Count").append(delimiter).append(inputNeighborList->getName()).append("\n");
+      writeQueue.write(outputStrm, std::move(header));
     }
-    if(hasIndex)
-    {
-      for(size_t list = 0; list < numLists; list++)
-      {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-        {
-          auto string = fmt::format("Processing {}: {}% completed", neighborList.getName(), static_cast<int32>(100 * static_cast<float>(list) / static_cast<float>(numLists)));
-          mesgHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
-        }
-        const auto& grain = neighborList.getListReference(list);
-        outputStrm << list << delimiter << grain.size() << delimiter;
-        for(size_t index = 0; index < grain.size(); index++)
-        {
-          if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-          {
-            outputStrm << static_cast<int32>(grain[index]);
-          }
-          else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-          {
-            outputStrm << fmt::format("{}", grain[index]);
-          }
-          else
-          {
-            outputStrm << grain[index];
-          }
-          if(index != grain.size() - 1)
-          {
-            outputStrm << delimiter;
-          }
-        }
-        outputStrm << "\n";
-      }
-    }
-    else // no index
-    {
-      for(size_t list = 0; list < neighborList.getNumberOfLists(); list++)
+
+    // The lists are already in memory
+    auto loadRows = [](usize, usize) -> Result<> { return {}; };
+    auto formatRows = [&](usize firstList, usize endList, std::string& text) {
+      for(usize list = firstList; list < endList; list++)
       {
-        auto now = std::chrono::steady_clock::now();
-        if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+        const auto& grain = neighborList.getListReference(static_cast<int32>(list));
+        if(hasIndex)
         {
-          auto string = fmt::format("Processing {}: {}% completed", neighborList.getName(), static_cast<int32>(static_cast<float>(list) / static_cast<float>(numLists)));
-          mesgHandler(IFilter::Message::Type::Info, string);
-          start = now;
-          if(shouldCancel)
-          {
-            return {};
-          }
+          AppendValue(text, list);
+          text.append(delimiter);
         }
-        const auto& grain = neighborList.getListReference(list);
-        outputStrm << grain.size() << delimiter;
-        for(size_t index = 0; index < grain.size(); index++)
+        AppendValue(text, grain.size());
+        text.append(delimiter);
+        for(usize index = 0; index < grain.size(); index++)
         {
-          if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-          {
-            outputStrm << static_cast<int32>(grain[index]);
-          }
-          else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-          {
-            outputStrm << fmt::format("{}", grain[index]);
-          }
-          else
-          {
-            outputStrm << grain[index];
-          }
+          AppendValue(text, grain[index]);
           if(index != grain.size() - 1)
           {
-            outputStrm << delimiter;
+            text.append(delimiter);
           }
         }
-        outputStrm << "\n";
+        text.push_back('\n');
       }
-    }
-    return {};
+    };
+    return FormatRowsInParallel(writeQueue, outputStrm, 0, numLists, loadRows, formatRows, fmt::format("Processing {}", neighborList.getName()), mesgHandler, shouldCancel);
   }
 };
 
 /**
  * @brief implicit writing of **DataArray**'s elements to outputStrm
  * @tparam ScalarType The primitive type attached to **DataArray**
+ * @param writeQueue The queue that writes the formatted text
  * @param outputStrm the ostream to write to
  * @param inputDataArray The **DataArray** that will have its values translated into strings
  * @param mesgHandler The message handler to dump progress updates to
@@ -139,11 +364,10 @@ struct PrintNeighborList
 struct PrintDataArray
 {
   template <typename ScalarType>
-  Result<> operator()(std::ostream& outputStrm, IDataArray* inputDataArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel, const std::string& delimiter = ",",
-                      int32 componentsPerLine = 0)
+  Result<> operator()(OrderedWriteQueue& writeQueue, std::ostream& outputStrm, IDataArray* inputDataArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
+                      const std::string& delimiter = ",", int32 componentsPerLine = 0)
   {
     auto& dataStore = inputDataArray->template getIDataStoreRefAs<AbstractDataStore<ScalarType>>();
-    auto start = std::chrono::steady_clock::now();
     auto numTuples = dataStore.getNumberOfTuples();
     auto maxLine = static_cast<size_t>(componentsPerLine);
     if(componentsPerLine == 0)
@@ -152,79 +376,57 @@ struct PrintDataArray
     }
 
     usize numComps = dataStore.getNumberOfComponents();
-    for(size_t tuple = 0; tuple < numTuples; tuple++)
-    {
-      auto now = std::chrono::steady_clock::now();
-      if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
-      {
-        auto string = fmt::format("Processing {}: {}% completed", inputDataArray->getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-        mesgHandler(IFilter::Message::Type::Info, string);
-        start = now;
-        if(shouldCancel)
-        {
-          return {};
-        }
-      }
-      for(size_t index = 0; index < numComps; index++)
+    const usize passTuples = std::min(k_RowsPerBlock * k_BlocksPerPass, numTuples);
+    auto values = std::make_unique<ScalarType[]>(passTuples * numComps);
+    usize loadedFirstTuple = 0;
+
+    auto loadRows = [&](usize firstTuple, usize count) -> Result<> {
+      loadedFirstTuple = firstTuple;
+      return dataStore.copyIntoBuffer(firstTuple * numComps, nonstd::span<ScalarType>(values.get(), count * numComps));
+    };
+    auto formatRows = [&](usize firstTuple, usize endTuple, std::string& text) {
+      for(usize tuple = firstTuple; tuple < endTuple; tuple++)
       {
-        if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
+        const ScalarType* tupleValues = values.get() + (tuple - loadedFirstTuple) * numComps;
+        for(usize index = 0; index < numComps; index++)
         {
-          outputStrm << static_cast<int32>(dataStore[tuple * numComps + index]);
-        }
-        else if constexpr(std::is_same_v<ScalarType, float32> || std::is_same_v<ScalarType, float64>)
-        {
-          outputStrm << fmt::format("{}", dataStore[tuple * numComps + index]);
-        }
-        else
-        {
-          outputStrm << dataStore[tuple * numComps + index];
-        }
-        if(index != maxLine - 1)
-        {
-          outputStrm << delimiter;
-        }
-        else
-        {
-          outputStrm << "\n";
+          AppendValue(text, tupleValues[index]);
+          if(index != maxLine - 1)
+          {
+            text.append(delimiter);
+          }
+          else
+          {
+            text.push_back('\n');
+          }
         }
       }
-    }
-    return {};
+    };
+    return FormatRowsInParallel(writeQueue, outputStrm, 0, numTuples, loadRows, formatRows, fmt::format("Processing {}", inputDataArray->getName()), mesgHandler, shouldCancel);
   }
 };
 
 /**
  * @brief writing of **StringArray**'s elements to outputStrm
- * @param absoluteFilePath The output path to write to
+ * @param writeQueue The queue that writes the formatted text
+ * @param outputStrm the ostream to write to
  * @param inputStringArray The **StringArray** that will have its values translated into strings
  * @param mesgHandler The message handler to dump progress updates to
- * // default parameters
- * @param delimiter The delimiter to insert between values
+ * @param shouldCancel
  * @return A result object with any errors or warnings
  */
-Result<> PrintStringArray(std::ostream& outputStrm, const StringArray& inputStringArray, const IFilter::MessageHandler& mesgHandler, const std::atomic_bool& shouldCancel,
-                          const std::string& delimiter = ",")
+Result<> PrintStringArray(OrderedWriteQueue& writeQueue, std::ostream& outputStrm, const StringArray& inputStringArray, const IFilter::MessageHandler& mesgHandler,
+                          const std::atomic_bool& shouldCancel)
 {
-  auto start = std::chrono::steady_clock::now();
-  auto numTuples = inputStringArray.getNumberOfTuples();
-
-  for(size_t tuple = 0; tuple < numTuples; tuple++)
-  {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+  auto loadRows = [](usize, usize) -> Result<> { return {}; };
+  auto formatRows = [&](usize firstTuple, usize endTuple, std::string& text) {
+    for(usize tuple = firstTuple; tuple < endTuple; tuple++)
     {
-      auto string = fmt::format("Processing {}: {}% completed", inputStringArray.getName(), static_cast<int32>(100 * static_cast<float>(tuple) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
-      {
-        return {};
-      }
+      text.append(inputStringArray[tuple]).push_back('\n');
     }
-    outputStrm << inputStringArray[tuple] << "\n";
-  }
-
-  return {};
+  };
+  return FormatRowsInParallel(writeQueue, outputStrm, 0, inputStringArray.getNumberOfTuples(), loadRows, formatRows, fmt::format("Processing {}", inputStringArray.getName()), mesgHandler,
+                              shouldCancel);
 }
 
 class ITupleWriter
@@ -232,8 +434,15 @@ class ITupleWriter
 public:
   ITupleWriter() = default;
   virtual ~ITupleWriter() = default;
-  virtual void write(std::ostream& outputStrm, usize tupleIndex) const = 0;
-  virtual void writeHeader(std::ostream& outputStrm) const = 0;
+  /**
+   * @brief Reads the values of the tuples that are formatted next. Only called from one thread.
+   */
+  virtual Result<> load(usize firstTuple, usize numTuples) = 0;
+  /**
+   * @brief Appends one of the loaded tuples. Called from several threads at once.
+   */
+  virtual void write(std::string& text, usize tupleIndex) const = 0;
+  virtual void writeHeader(std::string& text) const = 0;
 };
 
 class StringTupleWriter : public ITupleWriter
@@ -254,14 +463,20 @@ public:
   StringTupleWriter& operator=(const StringTupleWriter&) = delete;
   StringTupleWriter& operator=(StringTupleWriter&&) noexcept = delete;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  Result<> load(usize /*firstTuple*/, usize /*numTuples*/) override
+  {
+    // Strings are always in memory
+    return {};
+  }
+
+  void write(std::string& text, usize tupleIndex) const override
   {
-    outputStrm << m_Delimiter << m_DataArray[tupleIndex] << m_Delimiter;
+    text.append(m_Delimiter).append(m_DataArray[tupleIndex]).append(m_Delimiter);
   }
 
-  void writeHeader(std::ostream& outputStrm) const override
+  void writeHeader(std::string& text) const override
   {
-    outputStrm << m_DataArray.getName();
+    text.append(m_DataArray.getName());
   }
 
 private:
@@ -284,58 +499,58 @@ public:
   }
   ~TupleWriter() override = default;
 
-  void write(std::ostream& outputStrm, usize tupleIndex) const override
+  Result<> load(usize firstTuple, usize numTuples) override
+  {
+    if(m_NumValues < numTuples * m_NumComps)
+    {
+      m_NumValues = numTuples * m_NumComps;
+      m_Values = std::make_unique<ScalarType[]>(m_NumValues);
+    }
+    m_FirstTuple = firstTuple;
+    return m_DataStore.copyIntoBuffer(firstTuple * m_NumComps, nonstd::span<ScalarType>(m_Values.get(), numTuples * m_NumComps));
+  }
+
+  void write(std::string& text, usize tupleIndex) const override
   {
+    const ScalarType* tupleValues = m_Values.get() + (tupleIndex - m_FirstTuple) * m_NumComps;
     for(usize comp = 0; comp < m_NumComps; comp++)
     {
-      if constexpr(std::is_same_v<ScalarType, int8> || std::is_same_v<ScalarType, uint8>)
-      {
-        outputStrm << static_cast<int32>(m_DataStore[tupleIndex * m_NumComps + comp]);
-      }
-      else if constexpr(std::is_same_v<ScalarType, float32>)
-      {
-        outputStrm << std::setprecision(8) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
-      else if constexpr(std::is_same_v<ScalarType, float64>)
-      {
-        outputStrm << std::setprecision(16) << std::noshowpoint << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
-      else
-      {
-        outputStrm << m_DataStore[tupleIndex * m_NumComps + comp];
-      }
+      AppendValue(text, tupleValues[comp], FloatFormat::Precise);
       if(comp < m_NumComps - 1)
       {
-        outputStrm << m_Delimiter;
+        text.append(m_Delimiter);
       }
     }
   }
 
-  void writeHeader(std::ostream& outputStrm) const override
+  void writeHeader(std::string& text) const override
   {
     // If there is only 1 component then write the name of the array and return
     if(m_NumComps == 1)
     {
-      outputStrm << m_Name;
+      text.append(m_Name);
       return;
     }
 
     for(size_t index = 0; index < m_NumComps; index++)
     {
-      outputStrm << m_Name << "_" << index;
+      text.append(fmt::format("{}_{}", m_Name, index));
 
       if(index < m_NumComps - 1)
       {
-        outputStrm << m_Delimiter;
+        text.append(m_Delimiter);
       }
     }
   }
 
 private:
-  const std::string m_Name;
   const AbstractDataStore<ScalarType>& m_DataStore;
+  const std::string m_Name;
   const std::string& m_Delimiter = ",";
   usize m_NumComps = 1;
+  std::unique_ptr<ScalarType[]> m_Values;
+  usize m_NumValues = 0;
+  usize m_FirstTuple = 0;
 };
 
 struct AddTupleWriter
@@ -385,68 +600,92 @@ Result<> PrintDataSetsToMultipleFiles(const std::vector<DataPath>& objectPaths,
     throw std::runtime_error(fmt::format("{}({}): Function {}: Error. OutputPath must be a directory. '{}'", "PrintDataSetsToMultipleFiles", __FILE__, __LINE__, directoryPath));
   }
 
+  // Formatting the next file overlaps with writing the previous ones
+  OrderedWriteQueue writeQueue;
+  Result<> result;
   for(const auto& dataPath : objectPaths)
   {
+    if(shouldCancel || writeQueue.hasFailed())
+    {
+      break;
+    }
+
     auto atomicFileResult = AtomicFile::Create(fmt::format("{}/{}{}", directoryPath, dataPath.getTargetName(), fileExtension));
     if(atomicFileResult.invalid())
     {
-      return ConvertResult(std::move(atomicFileResult));
+      result = ConvertResult(std::move(atomicFileResult));
+      break;
     }
 
-    AtomicFile atomicFile = std::move(atomicFileResult.value());
+    // Shared with the tasks of the write queue, which close the file and commit it once it is written
+    auto atomicFile = std::make_shared<AtomicFile>(std::move(atomicFileResult.value()));
 
-    auto outputFilePath = atomicFile.tempFilePath().string();
+    auto outputFilePath = atomicFile->tempFilePath().string();
     mesgHandler(IFilter::Message::Type::Info, fmt::format("Writing IArray ({}) to output file {}", dataPath.getTargetName(), outputFilePath));
 
-    // Scope file writer in code block to get around file lock on windows (enforce destructor order)
-    {
-      std::ofstream outStrm(outputFilePath, std::ios_base::out | std::ios_base::binary);
+    auto outStrm = std::make_shared<std::ofstream>(outputFilePath, std::ios_base::out | std::ios_base::binary);
 
-      std::pair<int32, std::string> result = {0, "PrintDataSetsToMultipleFiles default failure. If you are seeing this error something bad has happened."};
-      auto* dataArray = dataStructure.getDataAs<IDataArray>(dataPath);
-      if(dataArray != nullptr)
+    auto* dataArray = dataStructure.getDataAs<IDataArray>(dataPath);
+    if(dataArray != nullptr)
+    {
+      if(exportToBinary)
       {
-        if(exportToBinary)
+        auto writeBinary = [dataArray, outStrm]() -> Result<> {
+          std::pair<int32, std::string> binaryResult = dataArray->getIDataStore()->writeBinaryFile(*outStrm);
+          if(binaryResult.first < 0)
+          {
+            return MakeErrorResult(binaryResult.first, binaryResult.second);
+          }
+          return {};
+        };
+        // Stores that are not held in memory are only read from this thread, on the writer thread their reads would
+        // race with the reads of the next array
+        if(dataArray->getIDataStoreRef().getStoreType() != IDataStore::StoreType::InMemory)
         {
-          result = dataArray->getIDataStore()->writeBinaryFile(outputFilePath);
+          result = writeBinary();
         }
         else
         {
-          ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), outStrm, dataArray, mesgHandler, shouldCancel, delimiter, componentsPerLine);
-        }
-      }
-      auto* stringArray = dataStructure.getDataAs<StringArray>(dataPath);
-      if(stringArray != nullptr)
-      {
-        PrintStringArray(outStrm, *stringArray, mesgHandler, shouldCancel, delimiter);
-      }
-      auto* neighborList = dataStructure.getDataAs<INeighborList>(dataPath);
-      if(neighborList != nullptr)
-      {
-        if(exportToBinary)
-        {
-          throw std::runtime_error(
-              fmt::format("{}({}): Function {}: Error. Cannot print a NeighborList to binary: '{}'", "PrintDataSetsToMultipleFiles", __FILE__, __LINE__, dataPath.getTargetName()));
+          writeQueue.push(std::move(writeBinary));
         }
-        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
       }
-      if(result.first < 0)
+      else
       {
-        mesgHandler(IFilter::Message::Type::Error, result.second);
+        result = ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), writeQueue, *outStrm, dataArray, mesgHandler, shouldCancel, delimiter, componentsPerLine);
       }
     }
-    if(shouldCancel)
+    auto* stringArray = dataStructure.getDataAs<StringArray>(dataPath);
+    if(stringArray != nullptr)
     {
-      return {};
+      result = PrintStringArray(writeQueue, *outStrm, *stringArray, mesgHandler, shouldCancel);
     }
-    Result<> commitResult = atomicFile.commit();
-    if(commitResult.invalid())
+    auto* neighborList = dataStructure.getDataAs<INeighborList>(dataPath);
+    if(neighborList != nullptr)
     {
-      return commitResult;
+      if(exportToBinary)
+      {
+        throw std::runtime_error(
+            fmt::format("{}({}): Function {}: Error. Cannot print a NeighborList to binary: '{}'", "PrintDataSetsToMultipleFiles", __FILE__, __LINE__, dataPath.getTargetName()));
+      }
+      result = ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), writeQueue, *outStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+    }
+    if(result.invalid())
+    {
+      break;
     }
+
+    writeQueue.push([atomicFile, outStrm, &shouldCancel]() -> Result<> {
+      // Close the file before committing it to get around the file lock on windows
+      outStrm->close();
+      if(shouldCancel)
+      {
+        return {};
+      }
+      return atomicFile->commit();
+    });
   }
 
-  return {};
+  return MergeResults(std::move(result), writeQueue.finish());
 }
 
 /**
@@ -465,20 +704,27 @@ void PrintSingleDataObject(std::ostream& outputStrm, const DataPath& objectPath,
 {
   mesgHandler(IFilter::Message::Type::Info, fmt::format("Writing IArray ({}) to output stream", objectPath.getTargetName()));
 
+  OrderedWriteQueue writeQueue;
+  Result<> result;
   auto* dataArray = dataStructure.getDataAs<IDataArray>(objectPath);
   if(dataArray != nullptr)
   {
-    ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), outputStrm, dataArray, mesgHandler, shouldCancel, delimiter, componentsPerLine);
+    result = ExecuteDataFunction(PrintDataArray{}, dataArray->getDataType(), writeQueue, outputStrm, dataArray, mesgHandler, shouldCancel, delimiter, componentsPerLine);
   }
   auto* stringArray = dataStructure.getDataAs<StringArray>(objectPath);
   if(stringArray != nullptr)
   {
-    PrintStringArray(outputStrm, *stringArray, mesgHandler, shouldCancel, delimiter);
+    result = PrintStringArray(writeQueue, outputStrm, *stringArray, mesgHandler, shouldCancel);
   }
   auto* neighborList = dataStructure.getDataAs<INeighborList>(objectPath);
   if(neighborList != nullptr)
   {
-    ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+    result = ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), writeQueue, outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+  }
+  result = MergeResults(std::move(result), writeQueue.finish());
+  if(result.invalid())
+  {
+    mesgHandler(IFilter::Message::Type::Error, result.errors().front().message);
   }
 };
 
@@ -502,7 +748,6 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
 {
   const auto& firstDataArray = dataStructure.getDataRefAs<IArray>(objectPaths[0]);
   usize numTuples = firstDataArray.getNumberOfTuples();
-  auto start = std::chrono::steady_clock::now();
 
   // Create our wrapper classes for each DataArray
   std::vector<std::shared_ptr<ITupleWriter>> writers;
@@ -528,6 +773,8 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
     return;
   }
 
+  OrderedWriteQueue writeQueue;
+  std::string header;
   if(writeNumOfFeatures)
   {
     size_t featureCount = 0;
@@ -537,7 +784,7 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
     {
       featureCount--;
     }
-    outputStrm << featureCount << "\n";
+    header.append(fmt::format("{}\n", featureCount));
   }
 
   // Write out the header line
@@ -545,23 +792,19 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
   {
     if(includeIndex)
     {
-      outputStrm << indexName << delimiter;
+      header.append(indexName).append(delimiter);
     }
     for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
     {
-      writers[writerIndex]->writeHeader(outputStrm);
+      writers[writerIndex]->writeHeader(header);
       if(writerIndex != writersCount - 1)
       {
-        outputStrm << delimiter;
+        header.append(delimiter);
       }
     }
-    outputStrm << '\n';
-  }
-
-  if(shouldCancel)
-  {
-    return;
+    header.push_back('\n');
   }
+  writeQueue.write(outputStrm, std::move(header));
 
   // Loop on ever tuple using our predefined writer for each data array
   size_t writerIndexStart = 0;
@@ -569,48 +812,58 @@ void PrintDataSetsToSingleFile(std::ostream& outputStrm, const std::vector<DataP
   {
     writerIndexStart = 1;
   }
-  for(usize tupleIndex = writerIndexStart; tupleIndex < numTuples; tupleIndex++)
-  {
-    auto now = std::chrono::steady_clock::now();
-    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+  auto loadRows = [&](usize firstTuple, usize count) -> Result<> {
+    for(const auto& writer : writers)
     {
-      auto string = fmt::format("Printing tuples: {}% completed", static_cast<int32>(100 * static_cast<float>(tupleIndex) / static_cast<float>(numTuples)));
-      mesgHandler(IFilter::Message::Type::Info, string);
-      start = now;
-      if(shouldCancel)
+      Result<> loadResult = writer->load(firstTuple, count);
+      if(loadResult.invalid())
       {
-        return;
+        return loadResult;
       }
     }
-    if(includeIndex)
-    {
-      outputStrm << tupleIndex << delimiter;
-    }
-    for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
+    return {};
+  };
+  auto formatRows = [&](usize firstTuple, usize endTuple, std::string& text) {
+    for(usize tupleIndex = firstTuple; tupleIndex < endTuple; tupleIndex++)
     {
-      writers[writerIndex]->write(outputStrm, tupleIndex);
-      if(writerIndex != writersCount - 1)
+      if(includeIndex)
       {
-        outputStrm << delimiter;
+        AppendValue(text, tupleIndex);
+        text.append(delimiter);
       }
+      for(size_t writerIndex = 0; writerIndex < writersCount; writerIndex++)
+      {
+        writers[writerIndex]->write(text, tupleIndex);
+        if(writerIndex != writersCount - 1)
+        {
+          text.append(delimiter);
+        }
+      }
+      text.push_back('\n');
     }
-    outputStrm << '\n';
-  }
+  };
+  Result<> result = FormatRowsInParallel(writeQueue, outputStrm, writerIndexStart, numTuples, loadRows, formatRows, "Printing tuples", mesgHandler, shouldCancel);
 
-  if(!neighborLists.empty())
+  if(result.valid() && !shouldCancel)
   {
     for(const auto& dataPath : neighborLists)
     {
       auto* neighborList = dataStructure.getDataAs<INeighborList>(dataPath);
       if(neighborList != nullptr)
       {
-        ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
+        result = ExecuteNeighborFunction(PrintNeighborList{}, neighborList->getDataType(), writeQueue, outputStrm, neighborList, mesgHandler, shouldCancel, delimiter, includeIndex, includeHeaders);
       }
-      if(shouldCancel)
+      if(result.invalid() || shouldCancel)
       {
-        return;
+        break;
       }
     }
   }
+
+  result = MergeResults(std::move(result), writeQueue.finish());
+  if(result.invalid())
+  {
+    mesgHandler(IFilter::Message::Type::Error, result.errors().front().message);
+  }
 };
 } // namespace nx::core::OStreamUtilities
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief The ParallelChunkAlgorithm class visits a data store one chunk of whole tuples at a time.
+ *
+ * Every chunk is handed to the visitor as one contiguous span of its values together with the tuple range it covers.
+ * For stores that are held in memory the span points straight into the store. Other stores (e.g. out-of-core stores)
+ * are read into a buffer per chunk with one bulk copy and, for executeInPlace(), written back with one bulk copy. The
+ * chunks of such stores follow the store's own chunk layout along the slowest tuple dimension, so every chunk of the
+ * underlying file is loaded by exactly one visitor call.
+ *
+ * Whole chunks are scheduled on the threads. The store itself is only ever accessed by one thread at a time, so the
+ * visitors of out-of-core stores run in parallel even though those stores are not thread safe. The visitor must only
+ * touch the values it is given.
+ *
+ * The visitor passed to execute() must provide:
+ * @code
+ * void operator()(nonstd::span<const T> values, const Range& tupleRange) const;
+ * @endcode
+ * and the visitor passed to executeInPlace():
+ * @code
+ * void operator()(nonstd::span<T> values, const Range& tupleRange) const;
+ * @endcode
+ */
+class ParallelChunkAlgorithm : public IParallelAlgorithm
+{
+public:
+  /**
+   * @brief Default number of values in each chunk of a store that has no chunk layout of its own.
+   */
+  static constexpr usize k_DefaultChunkValues = 65536;
+
+  ParallelChunkAlgorithm()
+  {
+    // Access to the store is serialized by the algorithm, so out-of-core stores can be visited in parallel as well
+    setParallelizationEnabled(true);
+  }
+  ~ParallelChunkAlgorithm() = default;
+
+  ParallelChunkAlgorithm(const ParallelChunkAlgorithm&) = default;
+  ParallelChunkAlgorithm(ParallelChunkAlgorithm&&) noexcept = default;
+  ParallelChunkAlgorithm& operator=(const ParallelChunkAlgorithm&) = default;
+  ParallelChunkAlgorithm& operator=(ParallelChunkAlgorithm&&) noexcept = default;
+
+  /**
+   * @brief Sets the number of values in each chunk of a store that has no chunk layout of its own.
+   * @param chunkValues
+   */
+  void setChunkValues(usize chunkValues)
+  {
+    m_ChunkValues = std::max<usize>(chunkValues, 1);
+  }
+
+  /**
+   * @brief Returns the tuple ranges of the chunks the store is visited in, in increasing tuple order.
+   * @param store
+   * @param chunkValues Number of values in each chunk of a store that has no chunk layout of its own
+   * @return std::vector<Range>
+   */
+  static std::vector<Range> GetChunkRanges(const IDataStore& store, usize chunkValues = k_DefaultChunkValues)
+  {
+    const usize numTuples = store.getNumberOfTuples();
+    if(numTuples == 0)
+    {
+      return {};
+    }
+
+    usize tuplesPerChunk = std::max<usize>(chunkValues / std::max<usize>(store.getNumberOfComponents(), 1), 1);
+    const std::optional<IDataStore::ShapeType> chunkShape = store.getChunkShape();
+    if(chunkShape.has_value() && !chunkShape->empty())
+    {
+      // One row of store chunks along the slowest tuple dimension is one contiguous block of tuples
+      const IDataStore::ShapeType tupleShape = store.getTupleShape();
+      usize tuplesPerSlice = 1;
+      for(usize i = 1; i < tupleShape.size(); i++)
+      {
+        tuplesPerSlice *= tupleShape[i];
+      }
+      tuplesPerChunk = std::max<usize>(chunkShape->front(), 1) * tuplesPerSlice;
+    }
+
+    std::vector<Range> ranges;
+    ranges.reserve((numTuples + tuplesPerChunk - 1) / tuplesPerChunk);
+    for(usize tupleStart = 0; tupleStart < numTuples; tupleStart += tuplesPerChunk)
+    {
+      ranges.emplace_back(tupleStart, std::min(tupleStart + tuplesPerChunk, numTuples));
+    }
+    return ranges;
+  }
+
+  /**
+   * @brief Calls the visitor once for every chunk of the store.
+   * @param store
+   * @param visitor
+   * @return Result<> The first error reported by the store, if any
+   */
+  template <typename T, typename VisitorT>
+  Result<> execute(const AbstractDataStore<T>& store, const VisitorT& visitor)
+  {
+    return run<T, const AbstractDataStore<T>, VisitorT, false>(store, visitor);
+  }
+
+  /**
+   * @brief Calls the visitor once for every chunk of the store. The values the visitor changes are written back to
+   * the store.
+   * @param store
+   * @param visitor
+   * @return Result<> The first error reported by the store, if any
+   */
+  template <typename T, typename VisitorT>
+  Result<> executeInPlace(AbstractDataStore<T>& store, const VisitorT& visitor)
+  {
+    return run<T, AbstractDataStore<T>, VisitorT, true>(store, visitor);
+  }
+
+private:
+  /**
+   * @brief Holds the store lock and the first error reported by the store.
+   */
+  struct StoreAccess
+  {
+    std::mutex mutex;
+    Result<> result;
+
+    bool record(Result<>&& storeResult)
+    {
+      if(storeResult.invalid() && result.valid())
+      {
+        result = std::move(storeResult);
+      }
+      return result.valid();
+    }
+  };
+
+  template <typename T, typename StoreT, typename VisitorT, bool WriteBack>
+  class VisitChunksImpl
+  {
+  public:
+    using SpanType = std::conditional_t<WriteBack, nonstd::span<T>, nonstd::span<const T>>;
+
+    VisitChunksImpl(StoreT& store, const std::vector<Range>& chunkRanges, const VisitorT& visitor, StoreAccess& storeAccess)
+    : m_Store(store)
+    , m_ChunkRanges(chunkRanges)
+    , m_Visitor(visitor)
+    , m_StoreAccess(storeAccess)
+    {
+      if constexpr(WriteBack)
+      {
+        auto* dataStore = dynamic_cast<DataStore<T>*>(&m_Store);
+        m_Data = dataStore != nullptr ? dataStore->data() : nullptr;
+      }
+      else
+      {
+        const auto* dataStore = dynamic_cast<const DataStore<T>*>(&m_Store);
+        m_Data = dataStore != nullptr ? dataStore->data() : nullptr;
+      }
+    }
+
+    void operator()(const Range& range) const
+    {
+      const usize numComponents = m_Store.getNumberOfComponents();
+      std::unique_ptr<T[]> buffer;
+      usize bufferSize = 0;
+      for(usize chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        const Range& tupleRange = m_ChunkRanges[chunk];
+        const usize valueStart = tupleRange.min() * numComponents;
+        const usize numValues = tupleRange.size() * numComponents;
+
+        // Stores held in memory are visited without a copy
+        if(m_Data != nullptr)
+        {
+          m_Visitor(SpanType(m_Data + valueStart, numValues), tupleRange);
+          continue;
+        }
+
+        if(bufferSize < numValues)
+        {
+          buffer = std::make_unique<T[]>(numValues);
+          bufferSize = numValues;
+        }
+        nonstd::span<T> values(buffer.get(), numValues);
+        {
+          std::lock_guard<std::mutex> lock(m_StoreAccess.mutex);
+          if(!m_StoreAccess.record(m_Store.copyIntoBuffer(valueStart, values)))
+          {
+            return;
+          }
+        }
+
+        m_Visitor(SpanType(values.data(), numValues), tupleRange);
+
+        if constexpr(WriteBack)
+        {
+          std::lock_guard<std::mutex> lock(m_StoreAccess.mutex);
+          if(!m_StoreAccess.record(m_Store.copyFromBuffer(valueStart, nonstd::span<const T>(values.data(), numValues))))
+          {
+            return;
+          }
+        }
+      }
+    }
+
+  private:
+    StoreT& m_Store;
+    const std::vector<Range>& m_ChunkRanges;
+    const VisitorT& m_Visitor;
+    StoreAccess& m_StoreAccess;
+    std::conditional_t<WriteBack, T*, const T*> m_Data = nullptr;
+  };
+
+  template <typename T, typename StoreT, typename VisitorT, bool WriteBack>
+  Result<> run(StoreT& store, const VisitorT& visitor)
+  {
+    const std::vector<Range> chunkRanges = GetChunkRanges(store, m_ChunkValues);
+    StoreAccess storeAccess;
+
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(getParallelizationEnabled());
+    dataAlg.setRange(0, chunkRanges.size());
+    dataAlg.execute(VisitChunksImpl<T, StoreT, VisitorT, WriteBack>(store, chunkRanges, visitor, storeAccess));
+    return std::move(storeAccess.result);
+  }
+
+  usize m_ChunkValues = k_DefaultChunkValues;
+};
+
+/**
+ * @brief Calls visitor(nonstd::span<const T> values, const Range& tupleRange) for every chunk of the store, in tuple
+ * order on the calling thread. See ParallelChunkAlgorithm for how the store is split into chunks.
+ * @param store
+ * @param visitor
+ * @return Result<>
+ */
+template <typename T, typename VisitorT>
+Result<> ForEachChunk(const AbstractDataStore<T>& store, const VisitorT& visitor)
+{
+  ParallelChunkAlgorithm chunkAlg;
+  chunkAlg.setParallelizationEnabled(false);
+  return chunkAlg.execute(store, visitor);
+}
+
+/**
+ * @brief Calls visitor(nonstd::span<T> values, const Range& tupleRange) for every chunk of the store, in tuple order
+ * on the calling thread, and writes the changed values back to the store.
+ * @param store
+ * @param visitor
+ * @return Result<>
+ */
+template <typename T, typename VisitorT>
+Result<> ForEachChunk(AbstractDataStore<T>& store, const VisitorT& visitor)
+{
+  ParallelChunkAlgorithm chunkAlg;
+  chunkAlg.setParallelizationEnabled(false);
+  return chunkAlg.executeInPlace(store, visitor);
+}
+} // namespace nx::core
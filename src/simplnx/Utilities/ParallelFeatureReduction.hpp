@@ -0,0 +1,204 @@
+#pragma once
+
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/Utilities/IParallelAlgorithm.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief The ParallelFeatureReduction class reduces per cell values into per feature accumulators.
+ *
+ * The cell range is split into fixed size chunks. Each chunk is reduced on its own into partial
+ * accumulators for the features it touches and the partial accumulators are then merged into the
+ * feature totals in chunk order. The chunk boundaries and the merge order only depend on the chunk
+ * size, so the result is identical for any number of threads and when parallelization is disabled,
+ * e.g., for out-of-core data.
+ *
+ * The reducer passed to execute() must provide:
+ * @code
+ * using AccumulatorType = ...; // Default constructible, the default value is the empty accumulator
+ * void accumulate(AccumulatorType& accumulator, usize cellIndex, usize featureId) const;
+ * void merge(AccumulatorType& total, const AccumulatorType& partial, usize featureId) const;
+ * @endcode
+ * accumulate() is called exactly once for every cell in the range whose feature id is in [0, numFeatures),
+ * in increasing cell order within a chunk. accumulate() is called concurrently for different chunks, merge()
+ * is only ever called from one thread at a time.
+ */
+class ParallelFeatureReduction : public IParallelAlgorithm
+{
+public:
+  /**
+   * @brief Default number of cells in each chunk.
+   */
+  static constexpr usize k_DefaultChunkSize = 32768;
+
+  /**
+   * @brief Number of chunks that are reduced in parallel before their partial accumulators are merged.
+   * This bounds the memory held by the partial accumulators.
+   */
+  static constexpr usize k_ChunksPerBatch = 256;
+
+  ParallelFeatureReduction() = default;
+  ~ParallelFeatureReduction() = default;
+
+  ParallelFeatureReduction(const ParallelFeatureReduction&) = default;
+  ParallelFeatureReduction(ParallelFeatureReduction&&) noexcept = default;
+  ParallelFeatureReduction& operator=(const ParallelFeatureReduction&) = default;
+  ParallelFeatureReduction& operator=(ParallelFeatureReduction&&) noexcept = default;
+
+  /**
+   * @brief Sets the range of cells to reduce.
+   * @param min
+   * @param max
+   */
+  void setRange(usize min, usize max)
+  {
+    m_Range = {min, max};
+  }
+
+  /**
+   * @brief Sets the number of cells in each chunk. Changing the chunk size can change the rounding of
+   * the merged results, the result for a given chunk size is always the same.
+   * @param chunkSize
+   */
+  void setChunkSize(usize chunkSize)
+  {
+    m_ChunkSize = std::max<usize>(chunkSize, 1);
+  }
+
+  /**
+   * @brief Reduces the cells of the range into one accumulator per feature.
+   * @param featureIds Feature id of every cell
+   * @param numFeatures Number of features (accumulators) to produce
+   * @param reducer
+   * @return The merged accumulator of every feature. Features without cells hold the default accumulator.
+   */
+  template <typename ReducerT>
+  std::vector<typename ReducerT::AccumulatorType> execute(const AbstractDataStore<int32>& featureIds, usize numFeatures, const ReducerT& reducer)
+  {
+    using AccumulatorType = typename ReducerT::AccumulatorType;
+
+    std::vector<AccumulatorType> totals(numFeatures);
+    const usize numCells = m_Range.max() - m_Range.min();
+    if(numCells == 0 || numFeatures == 0)
+    {
+      return totals;
+    }
+
+    const usize numChunks = (numCells + m_ChunkSize - 1) / m_ChunkSize;
+    std::vector<PartialResult<AccumulatorType>> partials(std::min(numChunks, k_ChunksPerBatch));
+    for(usize batchStart = 0; batchStart < numChunks; batchStart += k_ChunksPerBatch)
+    {
+      const usize batchSize = std::min(k_ChunksPerBatch, numChunks - batchStart);
+
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setParallelizationEnabled(getParallelizationEnabled());
+      dataAlg.setRange(0, batchSize);
+      dataAlg.execute(ReduceChunksImpl<ReducerT>(featureIds, numFeatures, reducer, partials, batchStart, m_Range.min(), m_Range.max(), m_ChunkSize));
+
+      // Merge in chunk order so the floating point results do not depend on the thread scheduling
+      for(usize chunk = 0; chunk < batchSize; chunk++)
+      {
+        const PartialResult<AccumulatorType>& partial = partials[chunk];
+        for(usize slot = 0; slot < partial.featureIds.size(); slot++)
+        {
+          const usize featureId = partial.featureIds[slot];
+          reducer.merge(totals[featureId], partial.accumulators[slot], featureId);
+        }
+      }
+    }
+    return totals;
+  }
+
+private:
+  /**
+   * @brief The partial accumulators of one chunk, stored in the order the features were first seen.
+   */
+  template <typename AccumulatorType>
+  struct PartialResult
+  {
+    std::vector<usize> featureIds;
+    std::vector<AccumulatorType> accumulators;
+  };
+
+  template <typename ReducerT>
+  class ReduceChunksImpl
+  {
+  public:
+    using AccumulatorType = typename ReducerT::AccumulatorType;
+
+    ReduceChunksImpl(const AbstractDataStore<int32>& featureIds, usize numFeatures, const ReducerT& reducer, std::vector<PartialResult<AccumulatorType>>& partials, usize firstChunk, usize rangeMin,
+                     usize rangeMax, usize chunkSize)
+    : m_FeatureIds(featureIds)
+    , m_NumFeatures(numFeatures)
+    , m_Reducer(reducer)
+    , m_Partials(partials)
+    , m_FirstChunk(firstChunk)
+    , m_RangeMin(rangeMin)
+    , m_RangeMax(rangeMax)
+    , m_ChunkSize(chunkSize)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      std::unordered_map<usize, usize> slots;
+      for(usize chunk = range.min(); chunk < range.max(); chunk++)
+      {
+        PartialResult<AccumulatorType>& partial = m_Partials[chunk];
+        partial.featureIds.clear();
+        partial.accumulators.clear();
+        slots.clear();
+
+        const usize cellStart = m_RangeMin + (m_FirstChunk + chunk) * m_ChunkSize;
+        const usize cellEnd = std::min(cellStart + m_ChunkSize, m_RangeMax);
+
+        // Neighboring cells usually belong to the same feature so the last slot is checked before the map
+        usize lastFeatureId = m_NumFeatures;
+        usize lastSlot = 0;
+        for(usize cellIndex = cellStart; cellIndex < cellEnd; cellIndex++)
+        {
+          const int32 featureIdValue = m_FeatureIds.getValue(cellIndex);
+          if(featureIdValue < 0 || static_cast<usize>(featureIdValue) >= m_NumFeatures)
+          {
+            continue;
+          }
+          const auto featureId = static_cast<usize>(featureIdValue);
+          if(featureId != lastFeatureId)
+          {
+            auto [iter, inserted] = slots.try_emplace(featureId, partial.featureIds.size());
+            if(inserted)
+            {
+              partial.featureIds.push_back(featureId);
+              partial.accumulators.emplace_back();
+            }
+            lastFeatureId = featureId;
+            lastSlot = iter->second;
+          }
+          m_Reducer.accumulate(partial.accumulators[lastSlot], cellIndex, featureId);
+        }
+      }
+    }
+
+  private:
+    const AbstractDataStore<int32>& m_FeatureIds;
+    usize m_NumFeatures = 0;
+    const ReducerT& m_Reducer;
+    std::vector<PartialResult<AccumulatorType>>& m_Partials;
+    usize m_FirstChunk = 0;
+    usize m_RangeMin = 0;
+    usize m_RangeMax = 0;
+    usize m_ChunkSize = k_DefaultChunkSize;
+  };
+
+  Range m_Range;
+  usize m_ChunkSize = k_DefaultChunkSize;
+};
+} // namespace nx::core
@@ -0,0 +1,65 @@
+#include "RawVolumeUtilities.hpp"
+
+using namespace nx::core;
+
+// -----------------------------------------------------------------------------
+RawVolumeUtilities::Subvolume RawVolumeUtilities::Subvolume::Whole(const SizeVec3& dimensions)
+{
+  Subvolume subvolume;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    subvolume.End[axis] = dimensions[axis] > 0 ? dimensions[axis] - 1 : 0;
+  }
+  return subvolume;
+}
+
+// -----------------------------------------------------------------------------
+SizeVec3 RawVolumeUtilities::Subvolume::getDimensions() const
+{
+  SizeVec3 dimensions = {0, 0, 0};
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    if(End[axis] >= Start[axis] && Step[axis] > 0)
+    {
+      dimensions[axis] = (End[axis] - Start[axis]) / Step[axis] + 1;
+    }
+  }
+  return dimensions;
+}
+
+// -----------------------------------------------------------------------------
+Result<> RawVolumeUtilities::SeekTo(FILE* file, uint64 offset)
+{
+#if defined(_MSC_VER)
+  const int32 err = _fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+#else
+  const int32 err = fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+  if(err != 0)
+  {
+    return MakeErrorResult(k_SeekError, fmt::format("Could not seek to position {} in the file.", offset));
+  }
+  return {};
+}
+
+// -----------------------------------------------------------------------------
+Result<> RawVolumeUtilities::ValidateSubvolume(const FileLayout& layout, const Subvolume& subvolume)
+{
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    if(subvolume.Step[axis] == 0)
+    {
+      return MakeErrorResult(k_SubvolumeError, fmt::format("The step along axis {} of the subvolume must be at least 1.", axis));
+    }
+    if(subvolume.Start[axis] > subvolume.End[axis] || subvolume.End[axis] >= layout.Dimensions[axis])
+    {
+      return MakeErrorResult(k_SubvolumeError, fmt::format("The subvolume from {} to {} along axis {} is outside of the volume with {} voxels along that axis.", subvolume.Start[axis],
+                                                           subvolume.End[axis], axis, layout.Dimensions[axis]));
+    }
+  }
+  if(layout.NumComponents == 0)
+  {
+    return MakeErrorResult(k_SubvolumeError, "The volume must have at least 1 component.");
+  }
+  return {};
+}
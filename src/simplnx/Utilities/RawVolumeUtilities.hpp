@@ -0,0 +1,356 @@
+#pragma once
+
+#include "simplnx/Common/Array.hpp"
+#include "simplnx/Common/Bit.hpp"
+#include "simplnx/Common/Result.hpp"
+#include "simplnx/Common/ScopeGuard.hpp"
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/DataStructure/AbstractDataStore.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Filter/IFilter.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <fmt/format.h>
+#include <nonstd/span.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace nx::core::RawVolumeUtilities
+{
+inline constexpr usize k_DefaultBlockBytes = 64ULL * 1024ULL * 1024ULL;
+
+inline constexpr int32 k_OpenFileError = -1000;
+inline constexpr int32 k_SeekError = -1001;
+inline constexpr int32 k_ReadError = -1002;
+inline constexpr int32 k_SubvolumeError = -1003;
+
+/**
+ * @brief Layout of a volume in a raw binary file. X varies fastest, then Y, then Z, and every voxel holds
+ * NumComponents consecutive values.
+ */
+struct FileLayout
+{
+  SizeVec3 Dimensions = {0, 0, 0};
+  usize NumComponents = 1;
+  uint64 HeaderBytes = 0; // Bytes in front of the first value
+  bool SwapBytes = false; // The file was written with the other byte order
+};
+
+/**
+ * @brief The voxels to extract from a volume. Start and End are inclusive voxel coordinates and every Step'th voxel
+ * along an axis is taken, starting at Start.
+ */
+struct SIMPLNX_EXPORT Subvolume
+{
+  SizeVec3 Start = {0, 0, 0};
+  SizeVec3 End = {0, 0, 0};
+  SizeVec3 Step = {1, 1, 1};
+
+  /**
+   * @brief Returns the subvolume that covers the whole volume.
+   * @param dimensions
+   * @return Subvolume
+   */
+  static Subvolume Whole(const SizeVec3& dimensions);
+
+  /**
+   * @brief Returns the number of voxels that are extracted along each axis.
+   * @return SizeVec3
+   */
+  SizeVec3 getDimensions() const;
+};
+
+/**
+ * @brief Moves the file to a byte offset. Unlike std::fseek this works past 2 GB on every platform.
+ * @param file
+ * @param offset
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> SeekTo(FILE* file, uint64 offset);
+
+/**
+ * @brief Checks that the subvolume lies inside the volume and has valid steps.
+ * @param layout
+ * @param subvolume
+ * @return Result<>
+ */
+SIMPLNX_EXPORT Result<> ValidateSubvolume(const FileLayout& layout, const Subvolume& subvolume);
+
+/**
+ * @brief Swaps the bytes of the file values if needed and converts them to the type of the store, in parallel.
+ * @tparam FileT The type of the values in the file
+ * @tparam T The type of the values in the store
+ * @param fileValues
+ * @param output Receives fileValues.size() values. May be the same memory as fileValues if the types are the same.
+ * @param swapBytes
+ */
+template <typename FileT, typename T>
+void ConvertValues(nonstd::span<FileT> fileValues, T* output, bool swapBytes)
+{
+  if constexpr(std::is_same_v<FileT, T>)
+  {
+    if(!swapBytes && static_cast<const void*>(fileValues.data()) == static_cast<const void*>(output))
+    {
+      return;
+    }
+  }
+
+  ParallelDataAlgorithm dataAlg;
+  // Only plain memory is touched here, so this can run in parallel even for out-of-core data
+  dataAlg.setParallelizationEnabled(true);
+  dataAlg.setRange(0, fileValues.size());
+  dataAlg.execute([fileValues, output, swapBytes](const Range& range) {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      FileT value = fileValues[i];
+      if constexpr(sizeof(FileT) > 1)
+      {
+        if(swapBytes)
+        {
+          value = nx::core::byteswap(value);
+        }
+      }
+      output[i] = static_cast<T>(value);
+    }
+  });
+}
+
+/**
+ * @brief Reads consecutive values from the current position of the file into the store. When the store is in memory
+ * and the types match, the values are read with a single read straight into the memory of the store. Otherwise they
+ * are read in blocks of blockBytes.
+ * @tparam FileT The type of the values in the file
+ * @tparam T The type of the values in the store
+ * @param file
+ * @param count The number of values to read
+ * @param dataStore
+ * @param storeIndex The index in the store of the first value
+ * @param swapBytes
+ * @param blockBytes
+ * @return Result<>
+ */
+template <typename FileT, typename T>
+Result<> ReadValues(FILE* file, usize count, AbstractDataStore<T>& dataStore, usize storeIndex, bool swapBytes, usize blockBytes = k_DefaultBlockBytes)
+{
+  if(storeIndex + count > dataStore.getSize())
+  {
+    return MakeErrorResult(k_ReadError, fmt::format("Unable to read {} values into a data store of size {} starting at index {}.", count, dataStore.getSize(), storeIndex));
+  }
+
+  auto* inMemoryStore = dynamic_cast<DataStore<T>*>(&dataStore);
+  if constexpr(std::is_same_v<FileT, T>)
+  {
+    if(inMemoryStore != nullptr)
+    {
+      T* values = inMemoryStore->data() + storeIndex;
+      if(std::fread(values, sizeof(T), count, file) != count)
+      {
+        return MakeErrorResult(k_ReadError, fmt::format("Unable to read {} values from the file.", count));
+      }
+      ConvertValues(nonstd::span<T>(values, count), values, swapBytes);
+      return {};
+    }
+  }
+
+  const usize blockValues = std::min(std::max<usize>(blockBytes / sizeof(FileT), 1), count);
+  auto fileValues = std::make_unique<FileT[]>(blockValues);
+  std::unique_ptr<T[]> values = inMemoryStore == nullptr ? std::make_unique<T[]>(blockValues) : nullptr;
+  for(usize start = 0; start < count; start += blockValues)
+  {
+    const usize numValues = std::min(blockValues, count - start);
+    if(std::fread(fileValues.get(), sizeof(FileT), numValues, file) != numValues)
+    {
+      return MakeErrorResult(k_ReadError, fmt::format("Unable to read {} values from the file.", count));
+    }
+    if(inMemoryStore != nullptr)
+    {
+      ConvertValues(nonstd::span<FileT>(fileValues.get(), numValues), inMemoryStore->data() + storeIndex + start, swapBytes);
+      continue;
+    }
+    ConvertValues(nonstd::span<FileT>(fileValues.get(), numValues), values.get(), swapBytes);
+    Result<> copyResult = dataStore.copyFromBuffer(storeIndex + start, nonstd::span<const T>(values.get(), numValues));
+    if(copyResult.invalid())
+    {
+      return copyResult;
+    }
+  }
+  return {};
+}
+
+/**
+ * @brief Reads a subvolume of a raw binary volume into the store. Only the rows of the subvolume are read from the
+ * file. When the subvolume spans whole slices the file is read in large contiguous blocks, otherwise the rows are read
+ * in batches and the voxels of the subvolume are picked out of them in parallel. The values are stored X fastest,
+ * then Y, then Z.
+ * @tparam FileT The type of the values in the file
+ * @tparam T The type of the values in the store
+ * @param filePath
+ * @param layout
+ * @param subvolume
+ * @param dataStore
+ * @param messageHandler Receives the progress
+ * @param shouldCancel
+ * @param storeIndex The index in the store of the first value of the subvolume
+ * @return Result<>
+ */
+template <typename FileT, typename T>
+Result<> ReadVolume(const std::filesystem::path& filePath, const FileLayout& layout, const Subvolume& subvolume, AbstractDataStore<T>& dataStore, const IFilter::MessageHandler& messageHandler,
+                    const std::atomic_bool& shouldCancel, usize storeIndex = 0)
+{
+  Result<> validResult = ValidateSubvolume(layout, subvolume);
+  if(validResult.invalid())
+  {
+    return validResult;
+  }
+
+  FILE* file = std::fopen(filePath.string().c_str(), "rb");
+  if(file == nullptr)
+  {
+    return MakeErrorResult(k_OpenFileError, fmt::format("Unable to open the specified file. '{}'", filePath.string()));
+  }
+  auto fileGuard = MakeScopeGuard([file]() noexcept { std::fclose(file); });
+
+  const SizeVec3& dims = layout.Dimensions;
+  const usize numComps = layout.NumComponents;
+  const SizeVec3 outDims = subvolume.getDimensions();
+  const usize sliceValues = dims[0] * dims[1] * numComps;
+  const usize numRows = outDims[1] * outDims[2];
+  const std::string fileName = filePath.filename().string();
+
+  auto start = std::chrono::steady_clock::now();
+  auto sendProgress = [&](usize rowsDone) {
+    auto now = std::chrono::steady_clock::now();
+    if(std::chrono::duration_cast<std::chrono::milliseconds>(now - start).count() > 1000)
+    {
+      messageHandler(IFilter::Message::Type::Info,
+                     fmt::format("Importing {}: {}% completed", fileName, static_cast<int32>(100 * static_cast<float>(rowsDone) / static_cast<float>(numRows))));
+      start = now;
+    }
+  };
+
+  // Whole slices are one contiguous run of values in the file
+  const bool wholeSlices = subvolume.Step[0] == 1 && subvolume.Step[1] == 1 && subvolume.Step[2] == 1 && outDims[0] == dims[0] && outDims[1] == dims[1];
+  if(wholeSlices)
+  {
+    Result<> seekResult = SeekTo(file, layout.HeaderBytes + subvolume.Start[2] * sliceValues * sizeof(FileT));
+    if(seekResult.invalid())
+    {
+      return seekResult;
+    }
+    const usize slicesPerBlock = std::max<usize>(k_DefaultBlockBytes / std::max<usize>(sliceValues * sizeof(FileT), 1), 1);
+    for(usize z = 0; z < outDims[2]; z += slicesPerBlock)
+    {
+      if(shouldCancel)
+      {
+        return {};
+      }
+      const usize numSlices = std::min(slicesPerBlock, outDims[2] - z);
+      Result<> readResult = ReadValues<FileT, T>(file, numSlices * sliceValues, dataStore, storeIndex + z * sliceValues, layout.SwapBytes);
+      if(readResult.invalid())
+      {
+        return readResult;
+      }
+      sendProgress((z + numSlices) * outDims[1]);
+    }
+    return {};
+  }
+
+  // Every row of the subvolume is one contiguous run of values in the file that is picked apart in memory
+  const usize rowFileValues = ((outDims[0] - 1) * subvolume.Step[0] + 1) * numComps;
+  const usize rowValues = outDims[0] * numComps;
+  const usize batchRows = std::min(std::max<usize>(k_DefaultBlockBytes / (rowFileValues * sizeof(FileT)), 1), numRows);
+  if(storeIndex + numRows * rowValues > dataStore.getSize())
+  {
+    return MakeErrorResult(k_ReadError, fmt::format("Unable to read {} values into a data store of size {} starting at index {}.", numRows * rowValues, dataStore.getSize(), storeIndex));
+  }
+
+  auto* inMemoryStore = dynamic_cast<DataStore<T>*>(&dataStore);
+  auto fileValues = std::make_unique<FileT[]>(batchRows * rowFileValues);
+  std::unique_ptr<T[]> values = inMemoryStore == nullptr ? std::make_unique<T[]>(batchRows * rowValues) : nullptr;
+  uint64 filePosition = std::numeric_limits<uint64>::max();
+
+  for(usize firstRow = 0; firstRow < numRows; firstRow += batchRows)
+  {
+    if(shouldCancel)
+    {
+      return {};
+    }
+
+    const usize numBatchRows = std::min(batchRows, numRows - firstRow);
+    for(usize row = 0; row < numBatchRows; row++)
+    {
+      const usize y = subvolume.Start[1] + ((firstRow + row) % outDims[1]) * subvolume.Step[1];
+      const usize z = subvolume.Start[2] + ((firstRow + row) / outDims[1]) * subvolume.Step[2];
+      const uint64 offset = layout.HeaderBytes + (z * sliceValues + (y * dims[0] + subvolume.Start[0]) * numComps) * sizeof(FileT);
+      if(offset != filePosition)
+      {
+        Result<> seekResult = SeekTo(file, offset);
+        if(seekResult.invalid())
+        {
+          return seekResult;
+        }
+      }
+      if(std::fread(fileValues.get() + row * rowFileValues, sizeof(FileT), rowFileValues, file) != rowFileValues)
+      {
+        return MakeErrorResult(k_ReadError, fmt::format("Unable to read row {} of slice {} from file '{}'.", y, z, filePath.string()));
+      }
+      filePosition = offset + rowFileValues * sizeof(FileT);
+    }
+
+    T* output = inMemoryStore != nullptr ? inMemoryStore->data() + storeIndex + firstRow * rowValues : values.get();
+    if(subvolume.Step[0] == 1)
+    {
+      ConvertValues(nonstd::span<FileT>(fileValues.get(), numBatchRows * rowValues), output, layout.SwapBytes);
+    }
+    else
+    {
+      const usize xStep = subvolume.Step[0];
+      const bool swapBytes = layout.SwapBytes;
+      FileT* rowsData = fileValues.get();
+      ParallelDataAlgorithm dataAlg;
+      dataAlg.setParallelizationEnabled(true);
+      dataAlg.setRange(0, numBatchRows);
+      dataAlg.execute([&](const Range& range) {
+        for(usize row = range.min(); row < range.max(); row++)
+        {
+          for(usize x = 0; x < outDims[0]; x++)
+          {
+            const FileT* voxel = rowsData + row * rowFileValues + x * xStep * numComps;
+            T* outVoxel = output + row * rowValues + x * numComps;
+            for(usize comp = 0; comp < numComps; comp++)
+            {
+              FileT value = voxel[comp];
+              if constexpr(sizeof(FileT) > 1)
+              {
+                if(swapBytes)
+                {
+                  value = nx::core::byteswap(value);
+                }
+              }
+              outVoxel[comp] = static_cast<T>(value);
+            }
+          }
+        }
+      });
+    }
+
+    if(inMemoryStore == nullptr)
+    {
+      Result<> copyResult = dataStore.copyFromBuffer(storeIndex + firstRow * rowValues, nonstd::span<const T>(values.get(), numBatchRows * rowValues));
+      if(copyResult.invalid())
+      {
+        return copyResult;
+      }
+    }
+    sendProgress(firstRow + numBatchRows);
+  }
+  return {};
+}
+} // namespace nx::core::RawVolumeUtilities
@@ -3,25 +3,81 @@
 #include "simplnx/Common/BoundingBox.hpp"
 #include "simplnx/DataStructure/Geometry/RectGridGeom.hpp"
 #include "simplnx/DataStructure/Geometry/TriangleGeom.hpp"
+#include "simplnx/Utilities/BoundingVolumeHierarchy.hpp"
 #include "simplnx/Utilities/Math/GeometryMath.hpp"
-#include "simplnx/Utilities/ParallelAlgorithmUtilities.hpp"
 #include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
 #include "simplnx/Utilities/StringUtilities.hpp"
 
 #include <chrono>
+#include <random>
 
 using namespace nx::core;
 
 namespace
 {
-class SampleSurfaceMeshImpl
+std::array<Point3Df, 3> GetTriangleCoordinates(const AbstractDataStore<IGeometry::MeshIndexType>& faces, const AbstractDataStore<float32>& vertices, usize faceId)
+{
+  std::array<Point3Df, 3> coords;
+  for(usize corner = 0; corner < 3; corner++)
+  {
+    const usize vertexOffset = faces.getValue(faceId * 3 + corner) * 3;
+    coords[corner] = Point3Df(vertices.getValue(vertexOffset), vertices.getValue(vertexOffset + 1), vertices.getValue(vertexOffset + 2));
+  }
+  return coords;
+}
+
+/**
+ * @brief The feature surface of one feature: its bounding box, the length of the test rays and the
+ * number of faces it references (a face that has the feature on both sides counts twice).
+ */
+struct FeatureSurface
+{
+  BoundingBox3Df Bounds = {Point3Df(0.0f, 0.0f, 0.0f), Point3Df(0.0f, 0.0f, 0.0f)};
+  float32 Radius = 0.0f;
+  usize NumFaces = 0;
+};
+
+class FindFeatureSurfacesImpl
 {
 public:
-  SampleSurfaceMeshImpl(const TriangleGeom& faces, const std::vector<std::vector<int32>>& faceIds, const std::vector<BoundingBox3Df>& faceBBs, const std::vector<Point3Df>& points,
-                        Int32AbstractDataStore& polyIds, const std::atomic_bool& shouldCancel)
+  FindFeatureSurfacesImpl(const TriangleGeom& faces, const std::vector<std::vector<int32>>& faceLists, std::vector<FeatureSurface>& featureSurfaces)
   : m_Faces(faces)
-  , m_FaceIds(faceIds)
-  , m_FaceBBs(faceBBs)
+  , m_FaceLists(faceLists)
+  , m_FeatureSurfaces(featureSurfaces)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize featureId = range.min(); featureId < range.max(); featureId++)
+    {
+      FeatureSurface& featureSurface = m_FeatureSurfaces[featureId];
+      featureSurface.Bounds = GeometryMath::FindBoundingBoxOfFaces(m_Faces, m_FaceLists[featureId]);
+      featureSurface.Radius = GeometryMath::FindDistanceBetweenPoints(featureSurface.Bounds.getMinPoint(), featureSurface.Bounds.getMaxPoint()) / 2;
+      featureSurface.NumFaces = m_FaceLists[featureId].size();
+    }
+  }
+
+private:
+  const TriangleGeom& m_Faces;
+  const std::vector<std::vector<int32>>& m_FaceLists;
+  std::vector<FeatureSurface>& m_FeatureSurfaces;
+};
+
+// -----------------------------------------------------------------------------
+class SampleSurfaceMeshImpl
+{
+public:
+  SampleSurfaceMeshImpl(SampleSurfaceMesh* filter, const AbstractDataStore<IGeometry::MeshIndexType>& faces, const AbstractDataStore<float32>& vertices, const Int32AbstractDataStore& faceLabels,
+                        const BoundingVolumeHierarchy& faceHierarchy, const BoundingVolumeHierarchy& featureHierarchy, const std::vector<FeatureSurface>& featureSurfaces,
+                        const std::vector<Point3Df>& points, Int32AbstractDataStore& polyIds, const std::atomic_bool& shouldCancel)
+  : m_Filter(filter)
+  , m_Faces(faces)
+  , m_Vertices(vertices)
+  , m_FaceLabels(faceLabels)
+  , m_FaceHierarchy(faceHierarchy)
+  , m_FeatureHierarchy(featureHierarchy)
+  , m_FeatureSurfaces(featureSurfaces)
   , m_Points(points)
   , m_PolyIds(polyIds)
   , m_ShouldCancel(shouldCancel)
@@ -35,102 +91,133 @@ public:
   SampleSurfaceMeshImpl& operator=(const SampleSurfaceMeshImpl&) = delete; // Copy Assignment Not Implemented
   SampleSurfaceMeshImpl& operator=(SampleSurfaceMeshImpl&&) = delete;      // Move Assignment Not Implemented
 
-  void checkPoints(usize start, usize end) const
+  /**
+   * @brief Same test as GeometryMath::IsPointInPolyhedron for the faces of one feature. The faces crossed by
+   * each test ray are found with the face hierarchy instead of testing every face of the feature.
+   * @param featureId
+   * @param point
+   * @return char
+   */
+  char isPointInFeature(int32 featureId, const Point3Df& point) const
   {
-    for(usize iter = start; iter < end; iter++)
+    const FeatureSurface& featureSurface = m_FeatureSurfaces[featureId];
+
+    // Standard mersenne_twister_engine random seed
+    std::mt19937_64 generator(std::mt19937_64::default_seed);
+    std::uniform_real_distribution<float32> distribution(0.0, 1.0);
+
+    usize iter = 0;
+    usize crossings = 0;
+    while(iter++ < featureSurface.NumFaces)
     {
-      usize numPoints = m_Points.size();
+      crossings = 0;
 
-      // find bounding box for current feature
-      BoundingBox3Df boundingBox(GeometryMath::FindBoundingBoxOfFaces(m_Faces, m_FaceIds[iter]));
-      float32 radius = GeometryMath::FindDistanceBetweenPoints(boundingBox.getMinPoint(), boundingBox.getMaxPoint()) / 2;
+      std::array<float32, 3> eulerAngles;
 
-      // check points in vertex array to see if they are in the bounding box of the feature
-      for(usize i = 0; i < numPoints; i++)
-      {
-        // Check for the filter being cancelled.
-        if(m_ShouldCancel)
+      float rand1 = distribution(generator);
+      float rand2 = distribution(generator);
+
+      eulerAngles[2] = (2.0f * rand1) - 1.0f;
+      float t = Constants::k_2PiF * rand2;
+      float w = std::sqrt(1.0f - (eulerAngles[2] * eulerAngles[2]));
+      eulerAngles[0] = w * std::cos(t);
+      eulerAngles[1] = w * std::sin(t);
+
+      CachedRay<float32> ray(point, ZXZEuler(eulerAngles.data()), featureSurface.Radius);
+      const Point3Df direction = ray.getEndPointRef() - point;
+
+      bool degenerate = false;
+      char boundaryCode = '0';
+      m_FaceHierarchy.visitAlongRay(point, direction, 1.0f, [&](usize faceId) {
+        const usize multiplicity = static_cast<usize>(m_FaceLabels.getValue(2 * faceId) == featureId) + static_cast<usize>(m_FaceLabels.getValue(2 * faceId + 1) == featureId);
+        if(multiplicity == 0)
         {
-          return;
+          return true;
         }
-
-        Point3Df point = m_Points[i];
-        if(m_PolyIds[i] == 0)
+        std::array<Point3Df, 3> coords = GetTriangleCoordinates(m_Faces, m_Vertices, faceId);
+        char code = GeometryMath::RayIntersectsTriangle(ray, coords[0], coords[1], coords[2]);
+        // If the query point sits on a V/E/F it is on the surface regardless of the ray
+        if(code == 'V' || code == 'E' || code == 'F')
+        {
+          boundaryCode = code;
+          return false;
+        }
+        if(code == 'p' || code == 'v' || code == 'e' || code == '?')
+        {
+          degenerate = true;
+        }
+        else if(code == 'f')
         {
-          char code = GeometryMath::IsPointInPolyhedron(m_Faces, m_FaceIds[iter], m_FaceBBs, point, boundingBox, radius);
-          if(code == 'i' || code == 'V' || code == 'E' || code == 'F')
-          {
-            m_PolyIds[i] = iter;
-          }
+          crossings += multiplicity;
         }
+        return true;
+      });
+
+      if(boundaryCode != '0')
+      {
+        return boundaryCode;
+      }
+      // If ray is degenerate, then generate another one
+      if(degenerate)
+      {
+        continue;
       }
+      break;
     }
-  }
 
-  void operator()(const Range& range) const
-  {
-    checkPoints(range.min(), range.max());
-  }
-
-private:
-  const TriangleGeom& m_Faces;
-  const std::vector<std::vector<int32>>& m_FaceIds;
-  const std::vector<BoundingBox3Df>& m_FaceBBs;
-  const std::vector<Point3Df>& m_Points;
-  Int32AbstractDataStore& m_PolyIds;
-  const std::atomic_bool& m_ShouldCancel;
-};
-
-// -----------------------------------------------------------------------------
-class SampleSurfaceMeshImplByPoints
-{
-public:
-  SampleSurfaceMeshImplByPoints(SampleSurfaceMesh* filter, const TriangleGeom& faces, const std::vector<int32>& faceIds, const std::vector<BoundingBox3Df>& faceBBs,
-                                const std::vector<Point3Df>& points, const usize featureId, Int32AbstractDataStore& polyIds, const std::atomic_bool& shouldCancel)
-  : m_Filter(filter)
-  , m_Faces(faces)
-  , m_FaceIds(faceIds)
-  , m_FaceBBs(faceBBs)
-  , m_Points(points)
-  , m_FeatureId(featureId)
-  , m_PolyIds(polyIds)
-  , m_ShouldCancel(shouldCancel)
-  {
+    // Point is strictly interior to the polyhedron if an odd number of crossings
+    if(crossings % 2 != 0)
+    {
+      return 'i';
+    }
+    return 'o';
   }
-  virtual ~SampleSurfaceMeshImplByPoints() = default;
 
   void checkPoints(usize start, usize end) const
   {
-    usize iter = m_FeatureId;
-
-    // find bounding box for current feature
-    BoundingBox3Df boundingBox(GeometryMath::FindBoundingBoxOfFaces(m_Faces, m_FaceIds));
-    float32 radius = GeometryMath::FindDistanceBetweenPoints(boundingBox.getMinPoint(), boundingBox.getMaxPoint()) / 2;
-
+    std::vector<int32> candidateFeatures;
     usize pointsVisited = 0;
-    // check points in vertex array to see if they are in the bounding box of the feature
     for(usize i = start; i < end; i++)
     {
-      Point3Df point = m_Points[i];
-      if(m_PolyIds[i] == 0)
+      // Check for the filter being cancelled.
+      if(m_ShouldCancel)
       {
-        char code = GeometryMath::IsPointInPolyhedron(m_Faces, m_FaceIds, m_FaceBBs, point, boundingBox, radius);
-        if(code == 'i' || code == 'V' || code == 'E' || code == 'F')
-        {
-          m_PolyIds[i] = iter;
-        }
+        return;
       }
-      pointsVisited++;
 
-      // Send some feedback
+      pointsVisited++;
       if(pointsVisited % 1000 == 0)
       {
-        m_Filter->sendThreadSafeProgressMessage(m_FeatureId, 1000, m_Points.size());
+        m_Filter->sendThreadSafeProgressMessage(1000, m_Points.size());
       }
-      // Check for the filter being cancelled.
-      if(m_ShouldCancel)
+
+      if(m_PolyIds[i] != 0)
       {
-        return;
+        continue;
+      }
+
+      // Only the features whose bounding box contains the point can contain it. They are tested in
+      // increasing feature id order so the lowest containing feature id wins.
+      const Point3Df& point = m_Points[i];
+      candidateFeatures.clear();
+      m_FeatureHierarchy.visitContaining(point, [&candidateFeatures](usize featureId) {
+        candidateFeatures.push_back(static_cast<int32>(featureId));
+        return true;
+      });
+      std::sort(candidateFeatures.begin(), candidateFeatures.end());
+
+      for(const int32 featureId : candidateFeatures)
+      {
+        if(m_FeatureSurfaces[featureId].NumFaces == 0)
+        {
+          continue;
+        }
+        char code = isPointInFeature(featureId, point);
+        if(code == 'i' || code == 'V' || code == 'E' || code == 'F')
+        {
+          m_PolyIds[i] = featureId;
+          break;
+        }
       }
     }
   }
@@ -142,12 +229,14 @@ public:
 
 private:
   SampleSurfaceMesh* m_Filter = nullptr;
-  const TriangleGeom& m_Faces;
-  const std::vector<int32>& m_FaceIds;
-  const std::vector<BoundingBox3Df>& m_FaceBBs;
+  const AbstractDataStore<IGeometry::MeshIndexType>& m_Faces;
+  const AbstractDataStore<float32>& m_Vertices;
+  const Int32AbstractDataStore& m_FaceLabels;
+  const BoundingVolumeHierarchy& m_FaceHierarchy;
+  const BoundingVolumeHierarchy& m_FeatureHierarchy;
+  const std::vector<FeatureSurface>& m_FeatureSurfaces;
   const std::vector<Point3Df>& m_Points;
   Int32AbstractDataStore& m_PolyIds;
-  const usize m_FeatureId = 0;
   const std::atomic_bool& m_ShouldCancel;
 };
 } // namespace
@@ -233,34 +322,55 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
   updateProgress("Allocating triangle faces per feature ...");
 
   // fill out lists with number of references to cells
-  std::vector<int32> linkLoc(numFaces, 0);
+  std::vector<int32> linkLoc(numFeatures, 0);
+
+  // traverse data again to get the faces belonging to each feature
+  for(int32 i = 0; i < static_cast<int32>(numFaces); i++)
+  {
+    g1 = faceLabelsSM[2 * i];
+    g2 = faceLabelsSM[2 * i + 1];
+    if(g1 > 0)
+    {
+      faceLists[g1][(linkLoc[g1])++] = i;
+    }
+    if(g2 > 0)
+    {
+      faceLists[g2][(linkLoc[g2])++] = i;
+    }
+  }
 
-  std::vector<BoundingBox3Df> faceBBs;
+  // Check for user canceled flag.
+  if(m_ShouldCancel)
   {
-    // !!! DO NOT USE GeometryStoreCache ELSEWHERE, SPECIAL CASE !!!
-    GeometryMath::detail::GeometryStoreCache cache(triangleGeom.getVertices()->getDataStoreRef(), triangleGeom.getFaces()->getDataStoreRef(), triangleGeom.getNumberOfVerticesPerFace());
+    return {};
+  }
 
-    // initialize temp storage 'verts' vector to avoid expensive
-    // calls during tight loops below
-    std::vector<usize> verts(cache.NumVertsPerFace);
+  updateProgress("Building the triangle and feature bounding volume hierarchies ...");
 
-    // traverse data again to get the faces belonging to each feature
-    for(int32 i = 0; i < numFaces; i++)
+  const auto& faces = triangleGeom.getFaces()->getDataStoreRef();
+  const auto& vertices = triangleGeom.getVertices()->getDataStoreRef();
+  const BoundingVolumeHierarchy faceHierarchy = BoundingVolumeHierarchy::CreateFromTriangles(faces, vertices);
+
+  std::vector<FeatureSurface> featureSurfaces(numFeatures);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setRange(0, numFeatures);
+    dataAlg.requireStoresInMemory({&faces, &vertices});
+    dataAlg.execute(FindFeatureSurfacesImpl(triangleGeom, faceLists, featureSurfaces));
+  }
+  faceLists.clear();
+
+  std::vector<float32> featureBounds(numFeatures * 6, 0.0f);
+  for(usize featureId = 0; featureId < numFeatures; featureId++)
+  {
+    const BoundingBox3Df& bounds = featureSurfaces[featureId].Bounds;
+    for(usize axis = 0; axis < 3; axis++)
     {
-      g1 = faceLabelsSM[2 * i];
-      g2 = faceLabelsSM[2 * i + 1];
-      if(g1 > 0)
-      {
-        faceLists[g1][(linkLoc[g1])++] = i;
-      }
-      if(g2 > 0)
-      {
-        faceLists[g2][(linkLoc[g2])++] = i;
-      }
-      // find bounding box for each face
-      faceBBs.emplace_back(GeometryMath::FindBoundingBoxOfFace(cache, triangleGeom, i, verts));
+      featureBounds[featureId * 6 + axis] = bounds.getMinPoint()[axis];
+      featureBounds[featureId * 6 + 3 + axis] = bounds.getMaxPoint()[axis];
     }
   }
+  const BoundingVolumeHierarchy featureHierarchy(featureBounds);
 
   // Check for user canceled flag.
   if(m_ShouldCancel)
@@ -279,25 +389,12 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
 
   updateProgress("Sampling triangle geometry ...");
 
-  // C++11 RIGHT HERE....
-  auto nthreads = static_cast<int32>(std::thread::hardware_concurrency()); // Returns ZERO if not defined on this platform
-  // If the number of features is larger than the number of cores to do the work then parallelize over the number of features
-  // otherwise parallelize over the number of triangle points.
-  if(numFeatures > nthreads)
-  {
-    ParallelDataAlgorithm dataAlg;
-    dataAlg.setRange(0, numFeatures);
-    dataAlg.execute(SampleSurfaceMeshImpl(triangleGeom, faceLists, faceBBs, points, polyIds, m_ShouldCancel));
-  }
-  else
-  {
-    for(int32 featureId = 0; featureId < numFeatures; featureId++)
-    {
-      ParallelDataAlgorithm dataAlg;
-      dataAlg.setRange(0, points.size());
-      dataAlg.execute(SampleSurfaceMeshImplByPoints(this, triangleGeom, faceLists[featureId], faceBBs, points, featureId, polyIds, m_ShouldCancel));
-    }
-  }
+  // Every point is tested on its own against the features whose bounds contain it, so the points are
+  // processed in parallel and the result does not depend on the number of threads.
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setRange(0, points.size());
+  dataAlg.requireStoresInMemory({&faces, &vertices, &faceLabelsSM, &polyIds});
+  dataAlg.execute(SampleSurfaceMeshImpl(this, faces, vertices, faceLabelsSM, faceHierarchy, featureHierarchy, featureSurfaces, points, polyIds, m_ShouldCancel));
 
   updateProgress("Complete");
 
@@ -305,18 +402,18 @@ Result<> SampleSurfaceMesh::execute(SampleSurfaceMeshInputValues& inputValues)
 }
 
 // -----------------------------------------------------------------------------
-void SampleSurfaceMesh::sendThreadSafeProgressMessage(usize featureId, usize numCompleted, usize totalFeatures)
+void SampleSurfaceMesh::sendThreadSafeProgressMessage(usize numCompleted, usize totalPoints)
 {
   std::lock_guard<std::mutex> lock(m_ProgressMessage_Mutex);
 
   m_ProgressCounter += numCompleted;
   auto now = std::chrono::steady_clock::now();
-  auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(m_InitialTime - now).count();
+  auto diff = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_InitialTime).count();
   if(diff > 1000)
   {
-    std::string progMessage = fmt::format("Feature {} | Points Completed: {} of {}", featureId, m_ProgressCounter, totalFeatures);
+    std::string progMessage = fmt::format("Points Completed: {} of {}", m_ProgressCounter, totalPoints);
     float inverseRate = static_cast<float>(diff) / static_cast<float>(m_ProgressCounter - m_LastProgressInt);
-    auto remainMillis = std::chrono::milliseconds(static_cast<int64>(inverseRate * (totalFeatures - m_ProgressCounter)));
+    auto remainMillis = std::chrono::milliseconds(static_cast<int64>(inverseRate * (totalPoints - m_ProgressCounter)));
     auto secs = std::chrono::duration_cast<std::chrono::seconds>(remainMillis);
     remainMillis -= std::chrono::duration_cast<std::chrono::milliseconds>(secs);
     auto mins = std::chrono::duration_cast<std::chrono::minutes>(secs);
@@ -38,7 +38,7 @@ public:
   Result<> execute(SampleSurfaceMeshInputValues& inputValues);
 
   void updateProgress(const std::string& progMessage);
-  void sendThreadSafeProgressMessage(usize featureId, size_t numCompleted, size_t totalFeatures);
+  void sendThreadSafeProgressMessage(usize numCompleted, usize totalPoints);
 
 protected:
   virtual void generatePoints(std::vector<Point3Df>& points) = 0;
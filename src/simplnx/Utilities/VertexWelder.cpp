@@ -0,0 +1,274 @@
+#include "VertexWelder.hpp"
+
+#include "simplnx/Common/Bit.hpp"
+#include "simplnx/Common/Range.hpp"
+#include "simplnx/Utilities/ParallelDataAlgorithm.hpp"
+
+#include <algorithm>
+#include <limits>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr uint64 k_EmptySlot = std::numeric_limits<uint64>::max();
+
+// Marks a match that points at a vertex of the current block that has not been given its id yet
+constexpr uint64 k_PendingFlag = uint64{1} << 63;
+
+constexpr usize k_ShardShift = 56;
+constexpr usize k_MinShardCapacity = 16;
+
+uint64 HashCoordinate(float32 value)
+{
+  // -0.0 == 0.0, so both have to land in the same slot
+  return value == 0.0f ? 0 : bit_cast<uint32>(value);
+}
+
+uint64 HashVertex(const float32* coords)
+{
+  uint64 hash = HashCoordinate(coords[0]) * 0x9E3779B97F4A7C15ull;
+  hash ^= HashCoordinate(coords[1]) * 0xC2B2AE3D27D4EB4Full;
+  hash ^= HashCoordinate(coords[2]) * 0x165667B19E3779F9ull;
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+bool SameVertex(const float32* lhs, const float32* rhs)
+{
+  return lhs[0] == rhs[0] && lhs[1] == rhs[1] && lhs[2] == rhs[2];
+}
+
+usize ShardOf(uint64 hash)
+{
+  return static_cast<usize>(hash >> k_ShardShift);
+}
+
+class HashVerticesImpl
+{
+public:
+  HashVerticesImpl(const float32* coords, uint64* hashes)
+  : m_Coords(coords)
+  , m_Hashes(hashes)
+  {
+  }
+
+  void operator()(const Range& range) const
+  {
+    for(usize i = range.min(); i < range.max(); i++)
+    {
+      m_Hashes[i] = HashVertex(m_Coords + i * 3);
+    }
+  }
+
+private:
+  const float32* m_Coords;
+  uint64* m_Hashes;
+};
+
+template <typename BodyT>
+void ForEachShard(bool parallelizationEnabled, const BodyT& body)
+{
+  class ShardsImpl
+  {
+  public:
+    explicit ShardsImpl(const BodyT& body)
+    : m_Body(body)
+    {
+    }
+
+    void operator()(const Range& range) const
+    {
+      for(usize shard = range.min(); shard < range.max(); shard++)
+      {
+        m_Body(shard);
+      }
+    }
+
+  private:
+    const BodyT& m_Body;
+  };
+
+  ParallelDataAlgorithm dataAlg;
+  dataAlg.setParallelizationEnabled(parallelizationEnabled);
+  dataAlg.setRange(0, VertexWelder::k_NumShards);
+  dataAlg.execute(ShardsImpl(body));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+void VertexWelder::setParallelizationEnabled(bool enabled)
+{
+  m_ParallelizationEnabled = enabled;
+}
+
+// -----------------------------------------------------------------------------
+void VertexWelder::reserve(usize numVertices)
+{
+  m_Vertices.reserve(numVertices * 3);
+  const usize perShard = numVertices / k_NumShards + 1;
+  for(Shard& shard : m_Shards)
+  {
+    growShard(shard, perShard);
+  }
+}
+
+// -----------------------------------------------------------------------------
+usize VertexWelder::getNumberOfVertices() const
+{
+  return m_Vertices.size() / 3;
+}
+
+// -----------------------------------------------------------------------------
+const std::vector<float32>& VertexWelder::getVertices() const
+{
+  return m_Vertices;
+}
+
+// -----------------------------------------------------------------------------
+void VertexWelder::growShard(Shard& shard, usize minCount) const
+{
+  // Keep the table at most half full so that the probe sequences stay short
+  usize capacity = std::max(shard.Slots.size(), k_MinShardCapacity);
+  while(capacity < minCount * 2)
+  {
+    capacity *= 2;
+  }
+  if(capacity == shard.Slots.size())
+  {
+    return;
+  }
+
+  std::vector<uint64> oldSlots(capacity, k_EmptySlot);
+  oldSlots.swap(shard.Slots);
+  const usize mask = capacity - 1;
+  for(uint64 id : oldSlots)
+  {
+    if(id == k_EmptySlot)
+    {
+      continue;
+    }
+    usize slot = static_cast<usize>(HashVertex(m_Vertices.data() + id * 3)) & mask;
+    while(shard.Slots[slot] != k_EmptySlot)
+    {
+      slot = (slot + 1) & mask;
+    }
+    shard.Slots[slot] = id;
+  }
+}
+
+// -----------------------------------------------------------------------------
+void VertexWelder::addVertices(nonstd::span<const float32> coords, nonstd::span<uint64> ids)
+{
+  const usize numVertices = std::min(coords.size() / 3, ids.size());
+  if(numVertices == 0)
+  {
+    return;
+  }
+  const float32* blockCoords = coords.data();
+
+  std::vector<uint64> hashes(numVertices);
+  {
+    ParallelDataAlgorithm dataAlg;
+    dataAlg.setParallelizationEnabled(m_ParallelizationEnabled);
+    dataAlg.setRange(0, numVertices);
+    dataAlg.execute(HashVerticesImpl(blockCoords, hashes.data()));
+  }
+
+  // Group the vertices by shard. The sort is stable, so every shard sees its vertices in block order.
+  std::array<usize, k_NumShards + 1> shardOffsets = {};
+  for(uint64 hash : hashes)
+  {
+    shardOffsets[ShardOf(hash) + 1]++;
+  }
+  for(usize shard = 0; shard < k_NumShards; shard++)
+  {
+    shardOffsets[shard + 1] += shardOffsets[shard];
+  }
+  std::vector<usize> order(numVertices);
+  {
+    std::array<usize, k_NumShards> cursors = {};
+    std::copy_n(shardOffsets.cbegin(), k_NumShards, cursors.begin());
+    for(usize i = 0; i < numVertices; i++)
+    {
+      order[cursors[ShardOf(hashes[i])]++] = i;
+    }
+  }
+
+  // Look up every vertex in its shard. Vertices that are new to the welder are entered with a pending reference to
+  // their first occurrence in this block since their ids are not known yet.
+  std::vector<uint64> matches(numVertices);
+  std::vector<usize> insertedSlots(numVertices);
+  ForEachShard(m_ParallelizationEnabled, [&](usize shardIndex) {
+    const usize begin = shardOffsets[shardIndex];
+    const usize end = shardOffsets[shardIndex + 1];
+    if(begin == end)
+    {
+      return;
+    }
+    Shard& shard = m_Shards[shardIndex];
+    growShard(shard, shard.Count + (end - begin));
+    const usize mask = shard.Slots.size() - 1;
+    for(usize k = begin; k < end; k++)
+    {
+      const usize vertex = order[k];
+      const float32* vertexCoords = blockCoords + vertex * 3;
+      usize slot = static_cast<usize>(hashes[vertex]) & mask;
+      while(true)
+      {
+        const uint64 entry = shard.Slots[slot];
+        if(entry == k_EmptySlot)
+        {
+          shard.Slots[slot] = k_PendingFlag | vertex;
+          shard.Count++;
+          matches[vertex] = k_PendingFlag | vertex;
+          insertedSlots[vertex] = slot;
+          break;
+        }
+        const float32* entryCoords = (entry & k_PendingFlag) != 0 ? blockCoords + (entry & ~k_PendingFlag) * 3 : m_Vertices.data() + entry * 3;
+        if(SameVertex(vertexCoords, entryCoords))
+        {
+          matches[vertex] = entry;
+          break;
+        }
+        slot = (slot + 1) & mask;
+      }
+    }
+  });
+
+  // Number the new vertices in the order they first appear
+  for(usize i = 0; i < numVertices; i++)
+  {
+    const uint64 match = matches[i];
+    if((match & k_PendingFlag) == 0)
+    {
+      ids[i] = match;
+      continue;
+    }
+    const usize firstOccurrence = static_cast<usize>(match & ~k_PendingFlag);
+    if(firstOccurrence == i)
+    {
+      ids[i] = getNumberOfVertices();
+      m_Vertices.insert(m_Vertices.end(), blockCoords + i * 3, blockCoords + i * 3 + 3);
+    }
+    else
+    {
+      ids[i] = ids[firstOccurrence];
+    }
+  }
+
+  // Replace the pending references with the final ids
+  ForEachShard(m_ParallelizationEnabled, [&](usize shardIndex) {
+    Shard& shard = m_Shards[shardIndex];
+    for(usize k = shardOffsets[shardIndex]; k < shardOffsets[shardIndex + 1]; k++)
+    {
+      const usize vertex = order[k];
+      if(matches[vertex] == (k_PendingFlag | vertex))
+      {
+        shard.Slots[insertedSlots[vertex]] = ids[vertex];
+      }
+    }
+  });
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "simplnx/Common/Types.hpp"
+#include "simplnx/simplnx_export.hpp"
+
+#include <nonstd/span.hpp>
+
+#include <array>
+#include <vector>
+
+namespace nx::core
+{
+/**
+ * @brief The VertexWelder class merges vertices with identical coordinates while they are added in blocks.
+ *
+ * Every vertex that is added is given the id of the first vertex that was added with exactly the same coordinates, so
+ * the unique vertices are numbered in the order they first appear, which is the numbering a serial pass over the
+ * vertices produces. Coordinates are compared with ==, so -0.0 and 0.0 are the same coordinate and a coordinate that is
+ * NaN never matches anything.
+ *
+ * The unique vertices are held in a hash table that is split into shards by the hash of the coordinates. The lookups
+ * of one block are done for all shards in parallel and only the final numbering of the new vertices of a block is a
+ * serial pass, so a mesh can be welded while it is being read without ever holding the duplicated vertices.
+ */
+class SIMPLNX_EXPORT VertexWelder
+{
+public:
+  /**
+   * @brief Number of independent hash tables the unique vertices are spread over.
+   */
+  static constexpr usize k_NumShards = 256;
+
+  VertexWelder() = default;
+  ~VertexWelder() noexcept = default;
+
+  VertexWelder(const VertexWelder&) = default;
+  VertexWelder(VertexWelder&&) noexcept = default;
+  VertexWelder& operator=(const VertexWelder&) = default;
+  VertexWelder& operator=(VertexWelder&&) noexcept = default;
+
+  /**
+   * @brief Sets whether the blocks are welded on multiple threads. Enabled by default.
+   * @param enabled
+   */
+  void setParallelizationEnabled(bool enabled);
+
+  /**
+   * @brief Reserves space for the given number of unique vertices.
+   * @param numVertices
+   */
+  void reserve(usize numVertices);
+
+  /**
+   * @brief Adds a block of vertices and writes the id of the unique vertex each of them was merged into.
+   * @param coords The X, Y, Z coordinates of the vertices
+   * @param ids Receives one id per vertex. Must hold coords.size() / 3 values.
+   */
+  void addVertices(nonstd::span<const float32> coords, nonstd::span<uint64> ids);
+
+  /**
+   * @brief Returns the number of unique vertices.
+   * @return usize
+   */
+  usize getNumberOfVertices() const;
+
+  /**
+   * @brief Returns the X, Y, Z coordinates of the unique vertices in id order.
+   * @return const std::vector<float32>&
+   */
+  const std::vector<float32>& getVertices() const;
+
+private:
+  /**
+   * @brief Open addressing hash table of one shard. Every slot holds the id of a unique vertex or k_EmptySlot.
+   */
+  struct Shard
+  {
+    std::vector<uint64> Slots;
+    usize Count = 0;
+  };
+
+  void growShard(Shard& shard, usize minCount) const;
+
+  std::vector<float32> m_Vertices;
+  std::array<Shard, k_NumShards> m_Shards;
+  bool m_ParallelizationEnabled = true;
+};
+} // namespace nx::core
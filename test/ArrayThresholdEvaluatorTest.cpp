@@ -0,0 +1,95 @@
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Utilities/ArrayThresholdEvaluator.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <memory>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_NumTuples = 10000;
+
+std::shared_ptr<ArrayThreshold> CreateThreshold(const DataPath& arrayPath, ArrayThreshold::ComparisonType comparison, float64 value, IArrayThreshold::UnionOperator unionOperator,
+                                                bool inverted = false)
+{
+  auto threshold = std::make_shared<ArrayThreshold>();
+  threshold->setArrayPath(arrayPath);
+  threshold->setComparisonType(comparison);
+  threshold->setComparisonValue(value);
+  threshold->setUnionOperator(unionOperator);
+  threshold->setInverted(inverted);
+  return threshold;
+}
+} // namespace
+
+TEST_CASE("Simplnx::ArrayThresholdEvaluator", "[Simplnx][ArrayThresholdEvaluator]")
+{
+  DataStructure dataStructure;
+  auto* floatArray = Float32Array::CreateWithStore<Float32DataStore>(dataStructure, "Floats", {k_NumTuples}, {1});
+  auto* intArray = Int32Array::CreateWithStore<Int32DataStore>(dataStructure, "Ints", {k_NumTuples}, {1});
+  auto* maskArray = UInt8Array::CreateWithStore<UInt8DataStore>(dataStructure, "Mask", {k_NumTuples}, {1});
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    (*floatArray)[i] = static_cast<float32>(i % 100) * 0.01f;
+    (*intArray)[i] = static_cast<int32>(i % 37);
+  }
+  const DataPath floatPath({"Floats"});
+  const DataPath intPath({"Ints"});
+
+  using ComparisonType = ArrayThreshold::ComparisonType;
+  using UnionOperator = IArrayThreshold::UnionOperator;
+
+  // (float > 0.5 AND NOT(int == 3)) OR NOT(int < 10 OR float < 0.2)
+  auto nestedSet = std::make_shared<ArrayThresholdSet>();
+  nestedSet->setUnionOperator(UnionOperator::Or);
+  nestedSet->setInverted(true);
+  nestedSet->setArrayThresholds({CreateThreshold(intPath, ComparisonType::LessThan, 10, UnionOperator::And), CreateThreshold(floatPath, ComparisonType::LessThan, 0.2, UnionOperator::Or)});
+
+  ArrayThresholdSet thresholdSet;
+  thresholdSet.setArrayThresholds({CreateThreshold(floatPath, ComparisonType::GreaterThan, 0.5, UnionOperator::And),
+                                   CreateThreshold(intPath, ComparisonType::Operator_Equal, 3, UnionOperator::And, true), std::make_shared<ArrayThresholdSet>(), nestedSet});
+
+  Result<ArrayThresholdEvaluator> evaluatorResult = ArrayThresholdEvaluator::Create(dataStructure, thresholdSet);
+  REQUIRE(evaluatorResult.valid());
+  const ArrayThresholdEvaluator& evaluator = evaluatorResult.value();
+  REQUIRE(evaluator.getNumberOfTuples() == k_NumTuples);
+  REQUIRE(evaluator.getInputArrays().size() == 2);
+
+  evaluator.fillMask(*maskArray, 255.0, 7.0);
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    const float32 floatValue = (*floatArray)[i];
+    const int32 intValue = (*intArray)[i];
+    const bool expected = (floatValue > 0.5f && intValue != 3) || !(intValue < 10 || floatValue < 0.2f);
+    REQUIRE((*maskArray)[i] == (expected ? 255 : 7));
+  }
+
+  // An inverted root set negates the combined result
+  thresholdSet.setInverted(true);
+  evaluatorResult = ArrayThresholdEvaluator::Create(dataStructure, thresholdSet);
+  REQUIRE(evaluatorResult.valid());
+  std::vector<uint8> passed(k_NumTuples);
+  evaluatorResult.value().evaluate(0, k_NumTuples, passed.data());
+  for(usize i = 0; i < k_NumTuples; i++)
+  {
+    REQUIRE(passed[i] == ((*maskArray)[i] == 255 ? 0 : 1));
+  }
+
+  // Blocks that share one set of scratch buffers give the same result
+  constexpr usize k_ScratchBlockSize = 7;
+  ArrayThresholdEvaluator::Scratch scratch = evaluatorResult.value().createScratch(k_ScratchBlockSize);
+  std::vector<uint8> blockPassed(k_NumTuples);
+  for(usize blockStart = 0; blockStart < k_NumTuples; blockStart += k_ScratchBlockSize)
+  {
+    const usize count = std::min(k_ScratchBlockSize, k_NumTuples - blockStart);
+    evaluatorResult.value().evaluate(blockStart, count, blockPassed.data() + blockStart, scratch);
+  }
+  REQUIRE(blockPassed == passed);
+
+  // Sets without any array threshold can not be evaluated
+  REQUIRE(ArrayThresholdEvaluator::Create(dataStructure, ArrayThresholdSet{}).invalid());
+}
@@ -0,0 +1,153 @@
+#include "simplnx/Utilities/BoundingVolumeHierarchy.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+bool BoxContains(const std::vector<float32>& bounds, usize primitive, const Point3Df& point)
+{
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    if(point[axis] < bounds[primitive * 6 + axis] || point[axis] > bounds[primitive * 6 + 3 + axis])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SegmentHitsBox(const std::vector<float32>& bounds, usize primitive, const Point3Df& origin, const Point3Df& direction)
+{
+  float32 tNear = 0.0f;
+  float32 tFar = 1.0f;
+  for(usize axis = 0; axis < 3; axis++)
+  {
+    const float32 minValue = bounds[primitive * 6 + axis];
+    const float32 maxValue = bounds[primitive * 6 + 3 + axis];
+    if(direction[axis] == 0.0f)
+    {
+      if(origin[axis] < minValue || origin[axis] > maxValue)
+      {
+        return false;
+      }
+      continue;
+    }
+    const float32 inverse = 1.0f / direction[axis];
+    float32 t0 = (minValue - origin[axis]) * inverse;
+    float32 t1 = (maxValue - origin[axis]) * inverse;
+    if(t0 > t1)
+    {
+      std::swap(t0, t1);
+    }
+    tNear = std::max(tNear, t0);
+    tFar = std::min(tFar, t1);
+    if(tNear > tFar)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+TEST_CASE("Simplnx::BoundingVolumeHierarchy", "[Simplnx][BoundingVolumeHierarchy]")
+{
+  std::mt19937 generator(5489u);
+  std::uniform_real_distribution<float32> position(0.0f, 100.0f);
+  std::uniform_real_distribution<float32> halfSize(0.0f, 3.0f);
+
+  for(const usize numPrimitives : {0, 1, 8, 9, 1000, 50000})
+  {
+    std::vector<float32> bounds(numPrimitives * 6);
+    std::vector<Point3Df> centers(numPrimitives);
+    for(usize primitive = 0; primitive < numPrimitives; primitive++)
+    {
+      for(usize axis = 0; axis < 3; axis++)
+      {
+        const float32 center = position(generator);
+        const float32 size = halfSize(generator);
+        bounds[primitive * 6 + axis] = center - size;
+        bounds[primitive * 6 + 3 + axis] = center + size;
+        centers[primitive][axis] = center;
+      }
+    }
+
+    const BoundingVolumeHierarchy hierarchy(bounds);
+    const BoundingVolumeHierarchy serialHierarchy(bounds, false);
+    REQUIRE(hierarchy.getNumberOfPrimitives() == numPrimitives);
+    REQUIRE(hierarchy.empty() == (numPrimitives == 0));
+
+    // The packing does not depend on the threading
+    REQUIRE(hierarchy.getNodes().size() == serialHierarchy.getNodes().size());
+    for(usize nodeIndex = 0; nodeIndex < hierarchy.getNodes().size(); nodeIndex++)
+    {
+      REQUIRE(hierarchy.getNodes()[nodeIndex].FirstIndex == serialHierarchy.getNodes()[nodeIndex].FirstIndex);
+      REQUIRE(hierarchy.getNodes()[nodeIndex].Count == serialHierarchy.getNodes()[nodeIndex].Count);
+    }
+
+    for(usize query = 0; query < 200; query++)
+    {
+      const Point3Df point(position(generator), position(generator), position(generator));
+
+      // Nearest primitive compared to a linear scan that keeps the first of equally close primitives
+      auto squaredDistance = [&centers, &point](usize primitive) {
+        const Point3Df delta = centers[primitive] - point;
+        return delta[0] * delta[0] + delta[1] * delta[1] + delta[2] * delta[2];
+      };
+      usize expectedNearest = BoundingVolumeHierarchy::k_InvalidIndex;
+      float32 expectedDistance = std::numeric_limits<float32>::max();
+      for(usize primitive = 0; primitive < numPrimitives; primitive++)
+      {
+        const float32 distance = squaredDistance(primitive);
+        if(distance < expectedDistance)
+        {
+          expectedDistance = distance;
+          expectedNearest = primitive;
+        }
+      }
+      const BoundingVolumeHierarchy::NearestResult nearest = hierarchy.findNearest(point, squaredDistance);
+      REQUIRE(nearest.PrimitiveIndex == expectedNearest);
+
+      // Point containment
+      std::vector<usize> expectedContaining;
+      for(usize primitive = 0; primitive < numPrimitives; primitive++)
+      {
+        if(BoxContains(bounds, primitive, point))
+        {
+          expectedContaining.push_back(primitive);
+        }
+      }
+      std::vector<usize> containing;
+      hierarchy.visitContaining(point, [&containing](usize primitive) {
+        containing.push_back(primitive);
+        return true;
+      });
+      std::sort(containing.begin(), containing.end());
+      REQUIRE(containing == expectedContaining);
+
+      // Segment queries, including an axis aligned direction
+      const Point3Df direction(position(generator) - 50.0f, position(generator) - 50.0f, query % 2 == 0 ? 0.0f : position(generator) - 50.0f);
+      std::vector<usize> expectedHits;
+      for(usize primitive = 0; primitive < numPrimitives; primitive++)
+      {
+        if(SegmentHitsBox(bounds, primitive, point, direction))
+        {
+          expectedHits.push_back(primitive);
+        }
+      }
+      std::vector<usize> hits;
+      hierarchy.visitAlongRay(point, direction, 1.0f, [&hits](usize primitive) {
+        hits.push_back(primitive);
+        return true;
+      });
+      std::sort(hits.begin(), hits.end());
+      REQUIRE(hits == expectedHits);
+    }
+  }
+}
@@ -3,7 +3,10 @@
 #include "simplnx/Core/Application.hpp"
 #include "simplnx/DataStructure/DataStore.hpp"
 #include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/DataStructure/IO/Generic/IOConstants.hpp"
+#include "simplnx/DataStructure/StridedViewDataStore.hpp"
 #include "simplnx/Utilities/DataArrayUtilities.hpp"
+#include "simplnx/Utilities/ParallelTaskAlgorithm.hpp"
 
 #include <catch2/catch.hpp>
 
@@ -149,3 +152,73 @@ TEST_CASE("Copy DataStore", "DataArray")
     REQUIRE(dataStore[i] == dataStore2[i]);
   }
 }
+
+TEST_CASE("nx::core::DataArray Bool Copy Using Index List", "[simplnx][DataArray]")
+{
+  DataStructure dataStructure;
+  auto* inputArray = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Input", {6}, {1});
+  auto* destArray = BoolArray::CreateWithStore<DataStore<bool>>(dataStructure, "Destination", {4}, {1});
+  REQUIRE(inputArray != nullptr);
+  REQUIRE(destArray != nullptr);
+  const std::vector<bool> inputValues = {false, true, false, true, true, false};
+  for(usize i = 0; i < inputValues.size(); i++)
+  {
+    (*inputArray)[i] = inputValues[i];
+  }
+  destArray->fill(true);
+
+  // Negative indices reset the tuple
+  const std::vector<int64> newToOldIndices = {3, -1, 0, 4};
+  ParallelTaskAlgorithm taskRunner;
+  CopyFromArray::RunParallelCopyUsingIndexList(*destArray, taskRunner, *inputArray, nonstd::span<const int64>(newToOldIndices));
+  taskRunner.wait();
+  REQUIRE((*destArray)[0] == true);
+  REQUIRE((*destArray)[1] == false);
+  REQUIRE((*destArray)[2] == false);
+  REQUIRE((*destArray)[3] == true);
+
+  // Compacting in place the way RemoveInactiveObjects does
+  const std::vector<int64> keptIndices = {1, 3, 4};
+  CopyFromArray::RunParallelCopyUsingIndexList(*inputArray, taskRunner, *inputArray, nonstd::span<const int64>(keptIndices));
+  taskRunner.wait();
+  REQUIRE((*inputArray)[0] == true);
+  REQUIRE((*inputArray)[1] == true);
+  REQUIRE((*inputArray)[2] == true);
+}
+
+TEST_CASE("nx::core::StridedViewDataStore Read-Only", "[simplnx][DataArray]")
+{
+  // 4 x 3 x 2 source volume with 2 components, each value holds its own index
+  auto source = std::make_shared<DataStore<int32>>(IDataStore::ShapeType{2, 3, 4}, IDataStore::ShapeType{2}, 0);
+  for(usize i = 0; i < source->getSize(); i++)
+  {
+    (*source)[i] = static_cast<int32>(i);
+  }
+
+  StridedViewDataStore<int32> view(source, SizeVec3{4, 3, 2}, {1, 3, 1, 3, 1, 2});
+  const auto& constView = view;
+  REQUIRE(view.getNumberOfTuples() == 4);
+  REQUIRE(view.getDataFormat() == IOConstants::k_StridedViewDataFormat.str());
+  REQUIRE(view.getStoreType() != IDataStore::StoreType::InMemory);
+
+  // The first viewed voxel is (1, 1, 1), which is source tuple 17
+  REQUIRE(constView[0] == 34);
+  REQUIRE(constView[1] == 35);
+  REQUIRE(view.getValue(2) == 36);
+  std::vector<int32> values(view.getSize());
+  REQUIRE(view.copyIntoBuffer(0, nonstd::span<int32>(values)).valid());
+  REQUIRE(values == std::vector<int32>{34, 35, 36, 37, 42, 43, 44, 45});
+
+  // Writing through the view fails and leaves the source unchanged
+  REQUIRE_THROWS(view[0] = 1);
+  REQUIRE_THROWS(view.setValue(0, 1));
+  const std::vector<int32> newValues(view.getSize(), 1);
+  REQUIRE(view.copyFromBuffer(0, nonstd::span<const int32>(newValues)).invalid());
+  REQUIRE((*source)[34] == 34);
+
+  // Arrays created to match the view get a store of their own
+  DataStructure dataStructure;
+  const DataPath createdPath({"Created"});
+  REQUIRE(CreateArray<int32>(dataStructure, view.getTupleShape(), view.getComponentShape(), createdPath, IDataAction::Mode::Execute, view.getDataFormat()).valid());
+  REQUIRE(dataStructure.getDataRefAs<Int32Array>(createdPath).getStoreType() == IDataStore::StoreType::InMemory);
+}
@@ -0,0 +1,84 @@
+#include "simplnx/Utilities/FaceNeighborStencil.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace nx::core;
+
+TEST_CASE("Simplnx::FaceNeighborStencil: Neighbor Order", "[Simplnx][FaceNeighborStencil]")
+{
+  const SizeVec3 dims = {4, 3, 5};
+
+  const FaceNeighborStencil stencil(dims);
+  std::vector<usize> visited;
+  stencil.forEachNeighbor(1, 1, 2, [&visited](usize neighbor) { visited.push_back(neighbor); });
+  const usize index = stencil.getIndex(1, 1, 2);
+  REQUIRE(visited == std::vector<usize>{index - 12, index - 4, index - 1, index + 1, index + 4, index + 12});
+
+  // Corners only visit neighbors inside of the geometry
+  visited.clear();
+  stencil.forEachNeighbor(3, 2, 4, [&visited](usize neighbor) { visited.push_back(neighbor); });
+  const usize lastIndex = stencil.getNumberOfVoxels() - 1;
+  REQUIRE(visited == std::vector<usize>{lastIndex - 12, lastIndex - 4, lastIndex - 1});
+
+  // Disabled directions are skipped
+  const FaceNeighborStencil xOnlyStencil(dims, true, false, false);
+  visited.clear();
+  xOnlyStencil.forEachNeighbor(1, 1, 2, [&visited](usize neighbor) { visited.push_back(neighbor); });
+  REQUIRE(visited == std::vector<usize>{index - 1, index + 1});
+}
+
+TEST_CASE("Simplnx::FaceNeighborStencil: Parallel Pass", "[Simplnx][FaceNeighborStencil]")
+{
+  const SizeVec3 dims = {37, 23, 19};
+  const FaceNeighborStencil stencil(dims, true, false, true);
+  const usize numVoxels = stencil.getNumberOfVoxels();
+
+  std::vector<int32> features(numVoxels);
+  for(usize i = 0; i < numVoxels; i++)
+  {
+    features[i] = static_cast<int32>((i * 7919) % 5);
+  }
+
+  // Serial reference: the first neighbor of the feature with the most votes
+  std::vector<int64> expected(numVoxels, -1);
+  for(usize zIndex = 0; zIndex < dims[2]; zIndex++)
+  {
+    for(usize yIndex = 0; yIndex < dims[1]; yIndex++)
+    {
+      for(usize xIndex = 0; xIndex < dims[0]; xIndex++)
+      {
+        std::vector<int32> counts(5, 0);
+        int32 most = 0;
+        const usize index = stencil.getIndex(xIndex, yIndex, zIndex);
+        stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighbor) {
+          const int32 current = ++counts[features[neighbor]];
+          if(current > most)
+          {
+            most = current;
+            expected[index] = static_cast<int64>(neighbor);
+          }
+        });
+      }
+    }
+  }
+
+  std::vector<int64> chosen(numVoxels, -1);
+  ExecuteStencilPass(
+      stencil,
+      [&](usize xIndex, usize yIndex, usize zIndex, usize index) {
+        FeatureVote vote;
+        int32 most = 0;
+        stencil.forEachNeighbor(xIndex, yIndex, zIndex, [&](usize neighbor) {
+          const int32 current = vote.add(features[neighbor]);
+          if(current > most)
+          {
+            most = current;
+            chosen[index] = static_cast<int64>(neighbor);
+          }
+        });
+      },
+      {});
+  REQUIRE(chosen == expected);
+}
@@ -0,0 +1,122 @@
+#include "simplnx/DataStructure/DataArray.hpp"
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/DataStructure/DataStructure.hpp"
+#include "simplnx/Utilities/FeatureRemovalUtilities.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace nx::core;
+using FillVote = FeatureRemovalUtilities::FillVote;
+
+namespace
+{
+Int32Array* CreateFeatureIds(DataStructure& dataStructure, const SizeVec3& dimensions, const std::vector<int32>& values)
+{
+  auto* featureIds = Int32Array::CreateWithStore<DataStore<int32>>(dataStructure, "FeatureIds", {dimensions[2], dimensions[1], dimensions[0]}, {1});
+  REQUIRE(featureIds != nullptr);
+  REQUIRE(featureIds->getSize() == values.size());
+  for(usize i = 0; i < values.size(); i++)
+  {
+    (*featureIds)[i] = values[i];
+  }
+  return featureIds;
+}
+} // namespace
+
+TEST_CASE("Simplnx::FeatureRemovalUtilities: Find Fill Sources", "[Simplnx][FeatureRemovalUtilities]")
+{
+  const SizeVec3 dims = {3, 3, 1};
+  DataStructure dataStructure;
+  // clang-format off
+  Int32Array* featureIds = CreateFeatureIds(dataStructure, dims, {
+     1,  1, 2,
+    -1, -1, 2,
+     3,  3, 2});
+  // clang-format on
+
+  // Every candidate feature has one vote, so the first one in -Z, -Y, -X, +X, +Y, +Z order wins
+  const std::atomic_bool shouldCancel = false;
+  FeatureRemovalUtilities::FillPlan plan;
+  const usize numBadVoxels = FeatureRemovalUtilities::FindFillSources(featureIds->getDataStoreRef(), dims, FillVote::MostCommonNeighbor, plan, shouldCancel);
+  REQUIRE(numBadVoxels == 2);
+  REQUIRE(plan.size() == 1);
+  REQUIRE(plan[0].size() == 2);
+  REQUIRE(plan[0][0].Destination == 3);
+  REQUIRE(plan[0][0].Source == 0);
+  REQUIRE(plan[0][1].Destination == 4);
+  REQUIRE(plan[0][1].Source == 1);
+}
+
+TEST_CASE("Simplnx::FeatureRemovalUtilities: Find Fill Sources With Repeated Neighbors", "[Simplnx][FeatureRemovalUtilities]")
+{
+  const SizeVec3 dims = {3, 3, 1};
+  DataStructure dataStructure;
+  // clang-format off
+  Int32Array* featureIds = CreateFeatureIds(dataStructure, dims, {
+     1,  1, 2,
+     1, -1, 2,
+     3, -1, 1});
+  // clang-format on
+
+  // Feature 1 touches voxel 4 twice and is taken from its second neighbor. Voxel 7 only touches different features,
+  // so it has to wait for the next pass where voxel 4 belongs to feature 1.
+  const std::atomic_bool shouldCancel = false;
+  FeatureRemovalUtilities::FillPlan plan;
+  const usize numBadVoxels = FeatureRemovalUtilities::FindFillSources(featureIds->getDataStoreRef(), dims, FillVote::RepeatedNeighbor, plan, shouldCancel);
+  REQUIRE(numBadVoxels == 2);
+  REQUIRE(plan.size() == 1);
+  REQUIRE(plan[0].size() == 1);
+  REQUIRE(plan[0][0].Destination == 4);
+  REQUIRE(plan[0][0].Source == 3);
+
+  const usize numUnfilled = FeatureRemovalUtilities::FillRemovedVoxels(featureIds->getDataStoreRef(), dims, FillVote::RepeatedNeighbor, {}, IFilter::MessageHandler{}, shouldCancel);
+  REQUIRE(numUnfilled == 0);
+  REQUIRE((*featureIds)[4] == 1);
+  REQUIRE((*featureIds)[7] == 1);
+}
+
+TEST_CASE("Simplnx::FeatureRemovalUtilities: Fill Removed Voxels", "[Simplnx][FeatureRemovalUtilities]")
+{
+  const SizeVec3 dims = {4, 1, 1};
+  DataStructure dataStructure;
+  Int32Array* featureIds = CreateFeatureIds(dataStructure, dims, {5, -1, -1, -1});
+  auto* values = Float32Array::CreateWithStore<DataStore<float32>>(dataStructure, "Values", {1, 1, 4}, {2});
+  REQUIRE(values != nullptr);
+  for(usize i = 0; i < values->getSize(); i++)
+  {
+    (*values)[i] = static_cast<float32>(i);
+  }
+
+  // The removed voxels are only reached one pass at a time
+  std::vector<std::string> messages;
+  const IFilter::MessageHandler messageHandler{[&messages](const IFilter::Message& message) { messages.push_back(message.message); }};
+  const std::atomic_bool shouldCancel = false;
+  const std::vector<std::shared_ptr<IDataArray>> voxelArrays = {dataStructure.getSharedDataAs<IDataArray>(featureIds->getId()), dataStructure.getSharedDataAs<IDataArray>(values->getId())};
+  const usize numUnfilled = FeatureRemovalUtilities::FillRemovedVoxels(featureIds->getDataStoreRef(), dims, FillVote::MostCommonNeighbor, voxelArrays, messageHandler, shouldCancel);
+  REQUIRE(numUnfilled == 0);
+  REQUIRE(messages.size() == 3);
+  for(usize i = 0; i < 4; i++)
+  {
+    REQUIRE((*featureIds)[i] == 5);
+    REQUIRE((*values)[i * 2] == 0.0f);
+    REQUIRE((*values)[i * 2 + 1] == 1.0f);
+  }
+}
+
+TEST_CASE("Simplnx::FeatureRemovalUtilities: Unfillable Voxels", "[Simplnx][FeatureRemovalUtilities]")
+{
+  const SizeVec3 dims = {2, 2, 2};
+  DataStructure dataStructure;
+  Int32Array* featureIds = CreateFeatureIds(dataStructure, dims, std::vector<int32>(8, -1));
+
+  // Without a neighboring feature the fill stops instead of looping and reports the voxels it could not fill
+  const std::atomic_bool shouldCancel = false;
+  const usize numUnfilled = FeatureRemovalUtilities::FillRemovedVoxels(featureIds->getDataStoreRef(), dims, FillVote::MostCommonNeighbor, {}, IFilter::MessageHandler{}, shouldCancel);
+  REQUIRE(numUnfilled == 8);
+  for(usize i = 0; i < 8; i++)
+  {
+    REQUIRE((*featureIds)[i] == -1);
+  }
+}
@@ -0,0 +1,231 @@
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/ParallelChunkAlgorithm.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+/**
+ * @brief Stands in for an out-of-core store: it reports a chunk layout and a data format and remembers whether it was
+ * ever accessed by two threads at the same time.
+ */
+class ChunkedTestStore : public AbstractDataStore<int32>
+{
+public:
+  ChunkedTestStore(const ShapeType& tupleShape, const ShapeType& componentShape, const ShapeType& chunkShape)
+  : m_TupleShape(tupleShape)
+  , m_ComponentShape(componentShape)
+  , m_ChunkShape(chunkShape)
+  , m_NumTuples(std::accumulate(tupleShape.cbegin(), tupleShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_NumComponents(std::accumulate(componentShape.cbegin(), componentShape.cend(), static_cast<usize>(1), std::multiplies<>()))
+  , m_Values(m_NumTuples * m_NumComponents, 0)
+  {
+  }
+
+  value_type getValue(usize index) const override
+  {
+    return m_Values[index];
+  }
+  void setValue(usize index, value_type value) override
+  {
+    m_Values[index] = value;
+  }
+  const_reference operator[](usize index) const override
+  {
+    return m_Values[index];
+  }
+  const_reference at(usize index) const override
+  {
+    return m_Values.at(index);
+  }
+  reference operator[](usize index) override
+  {
+    return m_Values[index];
+  }
+
+  Result<> copyIntoBuffer(usize startIndex, nonstd::span<int32> buffer) const override
+  {
+    enter();
+    std::copy_n(m_Values.cbegin() + startIndex, buffer.size(), buffer.begin());
+    m_NumReads++;
+    leave();
+    return {};
+  }
+  Result<> copyFromBuffer(usize startIndex, nonstd::span<const int32> buffer) override
+  {
+    enter();
+    std::copy(buffer.begin(), buffer.end(), m_Values.begin() + startIndex);
+    leave();
+    return {};
+  }
+
+  usize getNumberOfTuples() const override
+  {
+    return m_NumTuples;
+  }
+  const ShapeType& getTupleShape() const override
+  {
+    return m_TupleShape;
+  }
+  usize getNumberOfComponents() const override
+  {
+    return m_NumComponents;
+  }
+  const ShapeType& getComponentShape() const override
+  {
+    return m_ComponentShape;
+  }
+  std::optional<ShapeType> getChunkShape() const override
+  {
+    return m_ChunkShape;
+  }
+  void resizeTuples(const ShapeType& /*tupleShape*/) override
+  {
+  }
+  DataType getDataType() const override
+  {
+    return DataType::int32;
+  }
+  StoreType getStoreType() const override
+  {
+    return StoreType::OutOfCore;
+  }
+  std::string getDataFormat() const override
+  {
+    return "Test";
+  }
+  usize getTypeSize() const override
+  {
+    return sizeof(int32);
+  }
+  std::unique_ptr<IDataStore> deepCopy() const override
+  {
+    return nullptr;
+  }
+  std::unique_ptr<IDataStore> createNewInstance() const override
+  {
+    return nullptr;
+  }
+  std::pair<int32, std::string> writeBinaryFile(const std::string& /*absoluteFilePath*/) const override
+  {
+    return {-1, "Not supported"};
+  }
+  std::pair<int32, std::string> writeBinaryFile(std::ostream& /*outputStream*/) const override
+  {
+    return {-1, "Not supported"};
+  }
+
+  bool hadConcurrentAccess() const
+  {
+    return m_ConcurrentAccess;
+  }
+
+  usize getNumberOfReads() const
+  {
+    return m_NumReads;
+  }
+
+private:
+  void enter() const
+  {
+    if(m_InUse.exchange(true))
+    {
+      m_ConcurrentAccess = true;
+    }
+  }
+  void leave() const
+  {
+    m_InUse = false;
+  }
+
+  ShapeType m_TupleShape;
+  ShapeType m_ComponentShape;
+  ShapeType m_ChunkShape;
+  usize m_NumTuples = 0;
+  usize m_NumComponents = 0;
+  std::vector<int32> m_Values;
+  mutable std::atomic_bool m_InUse = false;
+  mutable std::atomic_bool m_ConcurrentAccess = false;
+  mutable std::atomic<usize> m_NumReads = 0;
+};
+} // namespace
+
+TEST_CASE("Simplnx::ParallelChunkAlgorithm: Chunk Ranges", "[Simplnx][ParallelChunkAlgorithm]")
+{
+  // Stores without a chunk layout are split by the number of values
+  DataStore<float32> inMemoryStore({1000}, {3}, 0.0f);
+  std::vector<Range> ranges = ParallelChunkAlgorithm::GetChunkRanges(inMemoryStore, 300);
+  REQUIRE(ranges.size() == 10);
+  REQUIRE(ranges.front().min() == 0);
+  REQUIRE(ranges.front().max() == 100);
+  REQUIRE(ranges.back().max() == 1000);
+
+  // Chunked stores are split into rows of store chunks along the slowest tuple dimension
+  ChunkedTestStore chunkedStore({10, 7, 5}, {2}, {4, 7, 5, 2});
+  ranges = ParallelChunkAlgorithm::GetChunkRanges(chunkedStore);
+  REQUIRE(ranges.size() == 3);
+  REQUIRE(ranges[0].min() == 0);
+  REQUIRE(ranges[0].max() == 140);
+  REQUIRE(ranges[1].max() == 280);
+  REQUIRE(ranges[2].max() == 350);
+}
+
+TEST_CASE("Simplnx::ParallelChunkAlgorithm: Visit Chunks", "[Simplnx][ParallelChunkAlgorithm]")
+{
+  ChunkedTestStore chunkedStore({64, 33, 17}, {3}, {2, 33, 17, 3});
+  DataStore<int32> inMemoryStore({64, 33, 17}, {3}, 0);
+  const usize numValues = inMemoryStore.getSize();
+
+  auto fillVisitor = [](nonstd::span<int32> values, const Range& tupleRange) {
+    for(usize i = 0; i < values.size(); i++)
+    {
+      values[i] = static_cast<int32>(tupleRange.min() * 3 + i);
+    }
+  };
+
+  ParallelChunkAlgorithm chunkAlg;
+  chunkAlg.setChunkValues(1000);
+  REQUIRE(chunkAlg.executeInPlace(chunkedStore, fillVisitor).valid());
+  REQUIRE(chunkAlg.executeInPlace(inMemoryStore, fillVisitor).valid());
+  for(usize i = 0; i < numValues; i++)
+  {
+    REQUIRE(chunkedStore[i] == static_cast<int32>(i));
+    REQUIRE(inMemoryStore[i] == static_cast<int32>(i));
+  }
+  REQUIRE_FALSE(chunkedStore.hadConcurrentAccess());
+  REQUIRE(chunkedStore.getNumberOfReads() == 32);
+
+  // Every value is visited exactly once
+  std::vector<std::atomic<int32>> visits(numValues);
+  const auto& constStore = static_cast<const AbstractDataStore<int32>&>(chunkedStore);
+  REQUIRE(chunkAlg
+              .execute(constStore,
+                       [&visits](nonstd::span<const int32> values, const Range& /*tupleRange*/) {
+                         for(int32 value : values)
+                         {
+                           visits[value]++;
+                         }
+                       })
+              .valid());
+  for(usize i = 0; i < numValues; i++)
+  {
+    REQUIRE(visits[i] == 1);
+  }
+  REQUIRE_FALSE(chunkedStore.hadConcurrentAccess());
+
+  // The serial visitor sees the chunks in tuple order
+  usize nextTuple = 0;
+  bool inOrder = true;
+  REQUIRE(ForEachChunk(static_cast<const AbstractDataStore<int32>&>(inMemoryStore), [&](nonstd::span<const int32> values, const Range& tupleRange) {
+            inOrder = inOrder && tupleRange.min() == nextTuple && values.size() == tupleRange.size() * 3;
+            nextTuple = tupleRange.max();
+          }).valid());
+  REQUIRE(inOrder);
+  REQUIRE(nextTuple == inMemoryStore.getNumberOfTuples());
+}
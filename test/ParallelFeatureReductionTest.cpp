@@ -0,0 +1,106 @@
+#include "simplnx/DataStructure/DataStore.hpp"
+#include "simplnx/Utilities/ParallelFeatureReduction.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+struct SumAccumulator
+{
+  float64 sum = 0.0;
+  usize count = 0;
+  usize firstCell = 0;
+};
+
+class SumReducer
+{
+public:
+  using AccumulatorType = SumAccumulator;
+
+  explicit SumReducer(const std::vector<float64>& values)
+  : m_Values(values)
+  {
+  }
+
+  void accumulate(AccumulatorType& accumulator, usize cellIndex, [[maybe_unused]] usize featureId) const
+  {
+    if(accumulator.count == 0)
+    {
+      accumulator.firstCell = cellIndex;
+    }
+    accumulator.sum += m_Values[cellIndex];
+    accumulator.count++;
+  }
+
+  void merge(AccumulatorType& total, const AccumulatorType& partial, [[maybe_unused]] usize featureId) const
+  {
+    if(total.count == 0)
+    {
+      total.firstCell = partial.firstCell;
+    }
+    total.sum += partial.sum;
+    total.count += partial.count;
+  }
+
+private:
+  const std::vector<float64>& m_Values;
+};
+} // namespace
+
+TEST_CASE("Simplnx::ParallelFeatureReduction", "[Simplnx][ParallelFeatureReduction]")
+{
+  constexpr usize k_NumCells = 200000;
+  constexpr usize k_NumFeatures = 1000;
+
+  DataStore<int32> featureIds({k_NumCells}, {1}, 0);
+  std::vector<float64> values(k_NumCells);
+  for(usize i = 0; i < k_NumCells; i++)
+  {
+    // Runs of 37 cells per feature with a few out of range feature ids mixed in
+    featureIds.setValue(i, i % 101 == 0 ? -1 : static_cast<int32>((i / 37) % k_NumFeatures));
+    values[i] = static_cast<float64>(i % 17) * 0.25;
+  }
+
+  std::vector<float64> expectedSums(k_NumFeatures, 0.0);
+  std::vector<usize> expectedCounts(k_NumFeatures, 0);
+  std::vector<usize> expectedFirstCells(k_NumFeatures, 0);
+  for(usize i = 0; i < k_NumCells; i++)
+  {
+    const int32 featureId = featureIds.getValue(i);
+    if(featureId < 0)
+    {
+      continue;
+    }
+    if(expectedCounts[featureId] == 0)
+    {
+      expectedFirstCells[featureId] = i;
+    }
+    expectedSums[featureId] += values[i];
+    expectedCounts[featureId]++;
+  }
+
+  ParallelFeatureReduction featureReduction;
+  featureReduction.setRange(0, k_NumCells);
+  featureReduction.setChunkSize(1000);
+  std::vector<SumAccumulator> parallelResult = featureReduction.execute(featureIds, k_NumFeatures, SumReducer(values));
+
+  featureReduction.setParallelizationEnabled(false);
+  std::vector<SumAccumulator> serialResult = featureReduction.execute(featureIds, k_NumFeatures, SumReducer(values));
+
+  REQUIRE(parallelResult.size() == k_NumFeatures);
+  REQUIRE(serialResult.size() == k_NumFeatures);
+  for(usize featureId = 0; featureId < k_NumFeatures; featureId++)
+  {
+    REQUIRE(parallelResult[featureId].count == expectedCounts[featureId]);
+    REQUIRE(parallelResult[featureId].firstCell == expectedFirstCells[featureId]);
+    REQUIRE(parallelResult[featureId].sum == Approx(expectedSums[featureId]));
+
+    // The merge order is fixed so the results are identical with and without threads
+    REQUIRE(parallelResult[featureId].sum == serialResult[featureId].sum);
+    REQUIRE(parallelResult[featureId].count == serialResult[featureId].count);
+  }
+}
@@ -0,0 +1,126 @@
+#include "simplnx/Utilities/RawVolumeUtilities.hpp"
+
+#include "simplnx/DataStructure/DataStore.hpp"
+
+#include "simplnx/unit_test/simplnx_test_dirs.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace nx::core;
+
+namespace
+{
+constexpr usize k_NumComps = 2;
+const SizeVec3 k_Dims = {7, 5, 4};
+
+uint16 ValueAt(usize x, usize y, usize z, usize comp)
+{
+  return static_cast<uint16>(((z * k_Dims[1] + y) * k_Dims[0] + x) * k_NumComps + comp + 300);
+}
+
+// Writes the volume as big endian uint16 values behind a header of 3 bytes
+std::filesystem::path WriteTestVolume()
+{
+  const std::filesystem::path outputDir = fmt::format("{}/RawVolumeUtilitiesTest", unit_test::k_BinaryTestOutputDir);
+  std::filesystem::create_directories(outputDir);
+  const std::filesystem::path filePath = outputDir / "volume.raw";
+
+  std::ofstream outStrm(filePath, std::ios_base::out | std::ios_base::binary);
+  outStrm.write("abc", 3);
+  for(usize z = 0; z < k_Dims[2]; z++)
+  {
+    for(usize y = 0; y < k_Dims[1]; y++)
+    {
+      for(usize x = 0; x < k_Dims[0]; x++)
+      {
+        for(usize comp = 0; comp < k_NumComps; comp++)
+        {
+          const uint16 value = ValueAt(x, y, z, comp);
+          const char bytes[2] = {static_cast<char>(value >> 8), static_cast<char>(value & 0xFF)};
+          outStrm.write(bytes, 2);
+        }
+      }
+    }
+  }
+  return filePath;
+}
+
+RawVolumeUtilities::FileLayout CreateLayout()
+{
+  RawVolumeUtilities::FileLayout layout;
+  layout.Dimensions = k_Dims;
+  layout.NumComponents = k_NumComps;
+  layout.HeaderBytes = 3;
+  layout.SwapBytes = endian::little == endian::native;
+  return layout;
+}
+} // namespace
+
+TEST_CASE("Simplnx::RawVolumeUtilities: Whole Volume", "[Simplnx][RawVolumeUtilities]")
+{
+  const std::filesystem::path filePath = WriteTestVolume();
+  const std::atomic_bool shouldCancel = false;
+
+  DataStore<uint16> dataStore({k_Dims[2], k_Dims[1], k_Dims[0]}, {k_NumComps}, 0);
+  Result<> result = RawVolumeUtilities::ReadVolume<uint16, uint16>(filePath, CreateLayout(), RawVolumeUtilities::Subvolume::Whole(k_Dims), dataStore, {}, shouldCancel);
+  REQUIRE(result.valid());
+
+  usize index = 0;
+  for(usize z = 0; z < k_Dims[2]; z++)
+  {
+    for(usize y = 0; y < k_Dims[1]; y++)
+    {
+      for(usize x = 0; x < k_Dims[0]; x++)
+      {
+        for(usize comp = 0; comp < k_NumComps; comp++)
+        {
+          REQUIRE(dataStore[index++] == ValueAt(x, y, z, comp));
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("Simplnx::RawVolumeUtilities: Strided Subvolume", "[Simplnx][RawVolumeUtilities]")
+{
+  const std::filesystem::path filePath = WriteTestVolume();
+  const std::atomic_bool shouldCancel = false;
+
+  RawVolumeUtilities::Subvolume subvolume;
+  subvolume.Start = {1, 1, 1};
+  subvolume.End = {6, 4, 3};
+  subvolume.Step = {2, 3, 1};
+  const SizeVec3 outDims = subvolume.getDimensions();
+  REQUIRE(outDims == SizeVec3{3, 2, 3});
+
+  // The values are converted to the type of the store while they are read
+  DataStore<float32> dataStore({outDims[2], outDims[1], outDims[0]}, {k_NumComps}, 0.0f);
+  Result<> result = RawVolumeUtilities::ReadVolume<uint16, float32>(filePath, CreateLayout(), subvolume, dataStore, {}, shouldCancel);
+  REQUIRE(result.valid());
+
+  usize index = 0;
+  for(usize z = 0; z < outDims[2]; z++)
+  {
+    for(usize y = 0; y < outDims[1]; y++)
+    {
+      for(usize x = 0; x < outDims[0]; x++)
+      {
+        for(usize comp = 0; comp < k_NumComps; comp++)
+        {
+          const uint16 expected = ValueAt(subvolume.Start[0] + x * subvolume.Step[0], subvolume.Start[1] + y * subvolume.Step[1], subvolume.Start[2] + z * subvolume.Step[2], comp);
+          REQUIRE(dataStore[index++] == static_cast<float32>(expected));
+        }
+      }
+    }
+  }
+
+  // A subvolume outside of the volume is rejected before the file is read
+  subvolume.End = {7, 4, 3};
+  result = RawVolumeUtilities::ReadVolume<uint16, float32>(filePath, CreateLayout(), subvolume, dataStore, {}, shouldCancel);
+  REQUIRE(result.invalid());
+  REQUIRE(result.errors().front().code == RawVolumeUtilities::k_SubvolumeError);
+}
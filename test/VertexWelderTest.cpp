@@ -0,0 +1,92 @@
+#include "simplnx/Utilities/VertexWelder.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <vector>
+
+using namespace nx::core;
+
+TEST_CASE("Simplnx::VertexWelder: Exact Matches", "[Simplnx][VertexWelder]")
+{
+  const float32 nan = std::numeric_limits<float32>::quiet_NaN();
+  const std::vector<float32> coords = {
+      1.0f, 2.0f, 3.0f,  // 0
+      0.0f, 0.0f, 0.0f,  // 1
+      1.0f, 2.0f, 3.0f,  // 0
+      -0.0f, 0.0f, 0.0f, // 1
+      1.0f, 2.0f, 3.5f,  // 2
+      nan, 0.0f, 0.0f,   // 3
+      nan, 0.0f, 0.0f,   // 4
+  };
+
+  VertexWelder welder;
+  std::vector<uint64> ids(coords.size() / 3);
+  welder.addVertices(coords, ids);
+  REQUIRE(ids == std::vector<uint64>{0, 1, 0, 1, 2, 3, 4});
+  REQUIRE(welder.getNumberOfVertices() == 5);
+
+  // The first occurrence is kept
+  const std::vector<float32>& vertices = welder.getVertices();
+  REQUIRE(vertices[3] == 0.0f);
+  REQUIRE_FALSE(std::signbit(vertices[3]));
+  REQUIRE(vertices[8] == 3.5f);
+
+  // Later blocks match the vertices of earlier blocks
+  const std::vector<float32> moreCoords = {-0.0f, -0.0f, -0.0f, 1.0f, 2.0f, 3.5f, 7.0f, 8.0f, 9.0f};
+  std::vector<uint64> moreIds(3);
+  welder.addVertices(moreCoords, moreIds);
+  REQUIRE(moreIds == std::vector<uint64>{1, 2, 5});
+}
+
+TEST_CASE("Simplnx::VertexWelder: Blocks Match Serial Numbering", "[Simplnx][VertexWelder]")
+{
+  // A grid of triangles where every vertex is shared by several triangles
+  const usize gridSize = 120;
+  std::vector<float32> coords;
+  for(usize y = 0; y < gridSize; y++)
+  {
+    for(usize x = 0; x < gridSize; x++)
+    {
+      const float32 x0 = static_cast<float32>(x) * 0.1f;
+      const float32 y0 = static_cast<float32>(y) * 0.1f;
+      const float32 x1 = static_cast<float32>(x + 1) * 0.1f;
+      const float32 y1 = static_cast<float32>(y + 1) * 0.1f;
+      coords.insert(coords.end(), {x0, y0, 0.0f, x1, y0, 0.0f, x1, y1, 0.0f, x0, y0, 0.0f, x1, y1, 0.0f, x0, y1, 0.0f});
+    }
+  }
+  const usize numVertices = coords.size() / 3;
+
+  // Serial reference numbering in order of first occurrence
+  std::map<std::tuple<float32, float32, float32>, uint64> seen;
+  std::vector<uint64> expected(numVertices);
+  for(usize i = 0; i < numVertices; i++)
+  {
+    auto [iter, inserted] = seen.emplace(std::make_tuple(coords[i * 3], coords[i * 3 + 1], coords[i * 3 + 2]), seen.size());
+    expected[i] = iter->second;
+  }
+
+  for(bool parallel : {true, false})
+  {
+    VertexWelder welder;
+    welder.setParallelizationEnabled(parallel);
+    std::vector<uint64> ids(numVertices);
+    const usize blockSize = 4099;
+    for(usize start = 0; start < numVertices; start += blockSize)
+    {
+      const usize count = std::min(blockSize, numVertices - start);
+      welder.addVertices(nonstd::span<const float32>(coords.data() + start * 3, count * 3), nonstd::span<uint64>(ids.data() + start, count));
+    }
+    REQUIRE(ids == expected);
+    REQUIRE(welder.getNumberOfVertices() == seen.size());
+    REQUIRE(welder.getNumberOfVertices() == (gridSize + 1) * (gridSize + 1));
+    for(usize i = 0; i < numVertices; i++)
+    {
+      REQUIRE(welder.getVertices()[ids[i] * 3] == coords[i * 3]);
+      REQUIRE(welder.getVertices()[ids[i] * 3 + 1] == coords[i * 3 + 1]);
+    }
+  }
+}
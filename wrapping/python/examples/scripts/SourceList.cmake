@@ -6,6 +6,7 @@ set(SIMPLNX_PYTHON_TESTS
   "basic_arrays" 
   "basic_ebsd_ipf"
   "basic_numpy" 
+  "numpy_buffers"
   "create_ensemble_info" 
   "generated_file_list" 
   "geometry_examples" 
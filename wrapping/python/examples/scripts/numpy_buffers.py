@@ -0,0 +1,101 @@
+"""
+Exercises the numpy access paths of DataArray, DataStore, NeighborList and StringArray:
+copy-free views of arrays held in memory, bulk copies and the compressed sparse row form
+of list arrays.
+"""
+import simplnx as nx
+
+import numpy as np
+
+data_structure = nx.DataStructure()
+
+#------------------------------------------------------------------------------
+# DataArray held in memory
+#------------------------------------------------------------------------------
+array_path = nx.DataPath(['data'])
+assert nx.CreateDataArrayFilter.execute(data_structure,
+                                        numeric_type_index=nx.NumericType.int32,
+                                        component_count=2,
+                                        tuple_dimensions=[[4, 3]],
+                                        output_array_path=array_path,
+                                        initialization_value_str='0')
+data_array = data_structure[array_path]
+assert data_array.in_memory
+
+# np.asarray wraps the values without a copy
+view = np.asarray(data_array)
+assert view.shape == (4, 3, 2)
+view[...] = np.arange(view.size, dtype=np.int32).reshape(view.shape)
+assert np.array_equal(data_array.npview(), view)
+
+# The buffer protocol of the store shares the same memory
+store_view = np.asarray(memoryview(data_array.store))
+assert store_view.shape == view.shape
+assert np.shares_memory(store_view, view)
+
+# Explicit copies do not write back into the DataArray
+copied = np.array(data_array, copy=True)
+copied += 100
+assert not np.shares_memory(copied, view)
+assert np.array_equal(data_array.to_numpy(), view)
+assert not np.shares_memory(data_array.to_numpy(), view)
+
+if np.lib.NumpyVersion(np.__version__) >= '2.0.0':
+    # copy=False is honored when no copy is needed ...
+    assert np.shares_memory(np.asarray(data_array, copy=False), view)
+    # ... and raises when a dtype conversion would need one
+    try:
+        np.asarray(data_array, dtype=np.float64, copy=False)
+        assert False, 'copy=False with a different dtype must raise'
+    except ValueError:
+        pass
+
+converted = np.asarray(data_array, dtype=np.float64)
+assert converted.dtype == np.float64
+assert np.array_equal(converted, view)
+
+# iter_chunks copies whole tuples, 5 at a time
+chunks = list(data_array.iter_chunks(chunk_tuples=5))
+assert [start for start, _ in chunks] == [0, 5, 10]
+assert [chunk.shape for _, chunk in chunks] == [(5, 2), (5, 2), (2, 2)]
+assert np.array_equal(np.concatenate([chunk for _, chunk in chunks]), view.reshape(-1, 2))
+
+# copy_from writes a block of tuples
+data_array.copy_from(np.full((2, 2), -1, dtype=np.int32), start_tuple=3)
+assert np.array_equal(view.reshape(-1, 2)[3:5], np.full((2, 2), -1))
+assert view.reshape(-1, 2)[5, 0] == 10
+
+#------------------------------------------------------------------------------
+# NeighborList
+#------------------------------------------------------------------------------
+neighbor_list_path = nx.DataPath(['neighbors'])
+result = nx.CreateNeighborListAction(nx.DataType.int32, 3, neighbor_list_path).apply(data_structure, nx.IDataAction.Mode.Execute)
+assert result.valid()
+neighbor_list = data_structure[neighbor_list_path]
+
+offsets = np.array([0, 2, 2, 5], dtype=np.uint64)
+values = np.array([1, 2, 3, 4, 5], dtype=np.int32)
+neighbor_list.set_from_csr(offsets, values)
+assert len(neighbor_list) == 3
+assert np.array_equal(neighbor_list[0], [1, 2])
+assert len(neighbor_list[1]) == 0
+assert np.array_equal(neighbor_list[2], [3, 4, 5])
+
+csr_offsets, csr_values = neighbor_list.csr()
+assert np.array_equal(csr_offsets, offsets)
+assert np.array_equal(csr_values, values)
+
+#------------------------------------------------------------------------------
+# StringArray
+#------------------------------------------------------------------------------
+string_array_path = nx.DataPath(['strings'])
+result = nx.CreateStringArrayAction([3], string_array_path).apply(data_structure, nx.IDataAction.Mode.Execute)
+assert result.valid()
+string_array = data_structure[string_array_path]
+string_array.initialize_with_list(['ab', '', 'xyz'])
+
+string_offsets, string_bytes = string_array.csr()
+assert np.array_equal(string_offsets, [0, 2, 2, 5])
+assert string_bytes.tobytes() == b'abxyz'
+
+print('numpy buffer access verified')